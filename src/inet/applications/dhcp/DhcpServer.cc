@@ -176,7 +176,10 @@ void DhcpServer::processDhcpMessage(Packet *packet)
                 lease = getAvailableLease(dhcpMsg->getOptions().getRequestedIp(), dhcpMsg->getChaddr());
                 if (lease != nullptr) {
 //                    std::cout << "MAC: " << packet->getChaddr() << " ----> IP: " << lease->ip << endl;
+                    if (!lease->mac.isUnspecified())
+                        leaseIpByMac.erase(lease->mac); // the lease is being reassigned to another client
                     lease->mac = dhcpMsg->getChaddr();
+                    leaseIpByMac[lease->mac] = lease->ip;
                     lease->xid = dhcpMsg->getXid();
 //                    lease->parameterRequestList = packet->getOptions().get(PARAM_LIST); TODO !!
                     lease->leased = true; // TODO
@@ -481,12 +484,10 @@ void DhcpServer::sendOffer(DhcpLease *lease, const Ptr<const DhcpMessage>& packe
 
 DhcpLease *DhcpServer::getLeaseByMac(MacAddress mac)
 {
-    for (auto& elem : leased) {
-        // lease exist
-        if (elem.second.mac == mac) {
-            EV_DETAIL << "Found lease for MAC " << mac << "." << endl;
-            return &(elem.second);
-        }
+    auto it = leaseIpByMac.find(mac);
+    if (it != leaseIpByMac.end()) {
+        EV_DETAIL << "Found lease for MAC " << mac << "." << endl;
+        return &leased[it->second];
     }
     EV_DETAIL << "Lease not found for MAC " << mac << "." << endl;
 
@@ -512,9 +513,11 @@ DhcpLease *DhcpServer::getAvailableLease(Ipv4Address requestedAddress, const Mac
         return &leased[requestedAddress];
     }
 
-    // allocate new address from server's pool of available addresses
-    for (unsigned int i = 0; i < maxNumOfClients; i++) {
-        Ipv4Address ip(beginAddr + i);
+    // allocate new address from server's pool of available addresses; the scan
+    // position persists across calls because all addresses below it have leases,
+    // so booting many clients doesn't rescan the front of the pool every time
+    for (; poolOffset < maxNumOfClients; poolOffset++) {
+        Ipv4Address ip(beginAddr + (int)poolOffset);
         if (containsKey(leased, ip)) {
             // lease exists but not allocated (e.g. expired or released)
             if (!leased[ip].leased)
@@ -529,6 +532,13 @@ DhcpLease *DhcpServer::getAvailableLease(Ipv4Address requestedAddress, const Mac
             return &(leased[ip]);
         }
     }
+    // the pool has been fully handed out at least once, fall back to
+    // searching for a lease that has become available again
+    for (unsigned int i = 0; i < maxNumOfClients; i++) {
+        Ipv4Address ip(beginAddr + i);
+        if (containsKey(leased, ip) && !leased[ip].leased)
+            return &(leased[ip]);
+    }
     // no lease available
     return nullptr;
 }
@@ -565,6 +575,8 @@ void DhcpServer::handleStartOperation(LifecycleOperation *operation)
 void DhcpServer::handleStopOperation(LifecycleOperation *operation)
 {
     leased.clear();
+    leaseIpByMac.clear();
+    poolOffset = 0;
     ie = nullptr;
     cancelEvent(startTimer);
     socket.close();
@@ -574,6 +586,8 @@ void DhcpServer::handleStopOperation(LifecycleOperation *operation)
 void DhcpServer::handleCrashOperation(LifecycleOperation *operation)
 {
     leased.clear();
+    leaseIpByMac.clear();
+    poolOffset = 0;
     ie = nullptr;
     cancelEvent(startTimer);
     if (operation->getRootModule() != getContainingNode(this)) // closes socket when the application crashed only
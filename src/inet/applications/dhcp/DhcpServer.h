@@ -31,6 +31,8 @@ class INET_API DhcpServer : public ApplicationBase, public cListener, public Udp
         START_DHCP
     };
     DhcpLeased leased; // lookup table for lease infos
+    std::map<MacAddress, Ipv4Address> leaseIpByMac; // index of leased by client MAC address
+    unsigned int poolOffset = 0; // all pool addresses below this offset have leases already
 
     int numSent = 0; // num of sent UDP packets
     int numReceived = 0; // num of received UDP packets
@@ -27,6 +27,7 @@ Define_Module(EtherAppClient);
 EtherAppClient::~EtherAppClient()
 {
     cancelAndDelete(timerMsg);
+    delete packetTemplate;
 }
 
 void EtherAppClient::initialize(int stage)
@@ -74,6 +75,7 @@ void EtherAppClient::handleMessageWhenUp(cMessage *msg)
             // if no dest address given, nothing to do
             if (destMacAddress.isUnspecified())
                 return;
+            createPacketTemplate();
         }
         sendPacket();
         scheduleNextPacket(false);
@@ -146,6 +148,18 @@ MacAddress EtherAppClient::resolveDestMacAddress()
     return destMacAddress;
 }
 
+void EtherAppClient::createPacketTemplate()
+{
+    // the tags are the same for every request, build them once and let
+    // sendPacket() duplicate the template instead of re-creating them
+    delete packetTemplate;
+    packetTemplate = new Packet();
+    packetTemplate->addTag<MacAddressReq>()->setDestAddress(destMacAddress);
+    auto ieee802SapReq = packetTemplate->addTag<Ieee802SapReq>();
+    ieee802SapReq->setSsap(localSap);
+    ieee802SapReq->setDsap(remoteSap);
+}
+
 void EtherAppClient::sendPacket()
 {
     seqNum++;
@@ -154,7 +168,8 @@ void EtherAppClient::sendPacket()
     sprintf(msgname, "req-%d-%ld", getId(), seqNum);
     EV_INFO << "Generating packet `" << msgname << "'\n";
 
-    Packet *datapacket = new Packet(msgname);
+    Packet *datapacket = packetTemplate->dup();
+    datapacket->setName(msgname);
     const auto& data = makeShared<EtherAppReq>();
 
     long len = *reqLength;
@@ -168,11 +183,6 @@ void EtherAppClient::sendPacket()
 
     datapacket->insertAtBack(data);
 
-    datapacket->addTag<MacAddressReq>()->setDestAddress(destMacAddress);
-    auto ieee802SapReq = datapacket->addTag<Ieee802SapReq>();
-    ieee802SapReq->setSsap(localSap);
-    ieee802SapReq->setDsap(remoteSap);
-
     emit(packetSentSignal, datapacket);
     llcSocket.send(datapacket);
     packetsSent++;
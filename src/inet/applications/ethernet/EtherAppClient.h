@@ -36,6 +36,10 @@ class INET_API EtherAppClient : public ApplicationBase, public Ieee8022LlcSocket
     MacAddress destMacAddress;
     ModuleRefByPar<IInterfaceTable> interfaceTable;
 
+    // prebuilt packet carrying the tags shared by all requests; sendPacket()
+    // duplicates it instead of re-creating the tags for every packet
+    Packet *packetTemplate = nullptr;
+
     // self messages
     cMessage *timerMsg = nullptr;
     simtime_t startTime;
@@ -59,6 +63,7 @@ class INET_API EtherAppClient : public ApplicationBase, public Ieee8022LlcSocket
 
     virtual MacAddress resolveDestMacAddress();
 
+    virtual void createPacketTemplate();
     virtual void sendPacket();
 
     // Ieee8022LlcSocket::ICallback
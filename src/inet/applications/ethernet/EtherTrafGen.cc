@@ -37,6 +37,7 @@ EtherTrafGen::EtherTrafGen()
 EtherTrafGen::~EtherTrafGen()
 {
     cancelAndDelete(timerMsg);
+    delete packetTemplate;
 }
 
 void EtherTrafGen::initialize(int stage)
@@ -81,6 +82,7 @@ void EtherTrafGen::handleMessageWhenUp(cMessage *msg)
             // if no dest address given, nothing to do
             if (destMacAddress.isUnspecified())
                 return;
+            createPacketTemplate();
         }
         sendBurstPackets();
         scheduleNextPacket(simTime());
@@ -143,6 +145,20 @@ MacAddress EtherTrafGen::resolveDestMacAddress()
     return destMacAddress;
 }
 
+void EtherTrafGen::createPacketTemplate()
+{
+    // the tags are the same for every generated packet, build them once and
+    // let sendBurstPackets() duplicate the template instead of re-creating them
+    delete packetTemplate;
+    packetTemplate = new Packet(nullptr, SOCKET_C_DATA);
+    packetTemplate->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ieee8022llc);
+    packetTemplate->addTag<MacAddressReq>()->setDestAddress(destMacAddress);
+    packetTemplate->addTag<InterfaceReq>()->setInterfaceId(outInterface);
+    auto sapTag = packetTemplate->addTag<Ieee802SapReq>();
+    sapTag->setSsap(ssap);
+    sapTag->setDsap(dsap);
+}
+
 void EtherTrafGen::sendBurstPackets()
 {
     int n = *numPacketsPerBurst;
@@ -152,17 +168,12 @@ void EtherTrafGen::sendBurstPackets()
         char msgname[40];
         sprintf(msgname, "pk-%d-%ld", getId(), seqNum);
 
-        Packet *datapacket = new Packet(msgname, SOCKET_C_DATA);
+        Packet *datapacket = packetTemplate->dup();
+        datapacket->setName(msgname);
         long len = *packetLength;
         const auto& payload = makeShared<ByteCountChunk>(B(len));
         payload->addTag<CreationTimeTag>()->setCreationTime(simTime());
         datapacket->insertAtBack(payload);
-        datapacket->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ieee8022llc);
-        datapacket->addTag<MacAddressReq>()->setDestAddress(destMacAddress);
-        datapacket->addTag<InterfaceReq>()->setInterfaceId(outInterface);
-        auto sapTag = datapacket->addTag<Ieee802SapReq>();
-        sapTag->setSsap(ssap);
-        sapTag->setDsap(dsap);
 
         EV_INFO << "Send packet `" << msgname << "' dest=" << destMacAddress << " length=" << len << "B ssap/dsap=" << ssap << "/" << dsap << "\n";
         emit(packetSentSignal, datapacket);
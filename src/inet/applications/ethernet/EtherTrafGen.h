@@ -38,6 +38,10 @@ class INET_API EtherTrafGen : public ApplicationBase
     MacAddress destMacAddress;
     int outInterface = -1;
 
+    // prebuilt packet carrying the tags shared by all generated packets; sendBurstPackets()
+    // duplicates it instead of re-creating the tags for every packet
+    Packet *packetTemplate = nullptr;
+
     Ieee8022LlcSocket llcSocket;
     // self messages
     cMessage *timerMsg = nullptr;
@@ -60,6 +64,7 @@ class INET_API EtherTrafGen : public ApplicationBase
 
     virtual MacAddress resolveDestMacAddress();
 
+    virtual void createPacketTemplate();
     virtual void sendBurstPackets();
     virtual void receivePacket(Packet *msg);
 
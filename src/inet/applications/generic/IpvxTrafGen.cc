@@ -30,6 +30,8 @@ IpvxTrafGen::IpvxTrafGen()
 IpvxTrafGen::~IpvxTrafGen()
 {
     cancelAndDelete(timer);
+    for (auto packetTemplate : packetTemplates)
+        delete packetTemplate;
     if (ProtocolGroup::getIpProtocolGroup()->findProtocol(par("protocol")) == nullptr)
         delete protocol;
 }
@@ -91,6 +93,7 @@ void IpvxTrafGen::handleMessageWhenUp(cMessage *msg)
                 else
                     destAddresses.push_back(result);
             }
+            createPacketTemplates();
         }
         if (!destAddresses.empty()) {
             sendPacket();
@@ -136,10 +139,26 @@ bool IpvxTrafGen::isEnabled()
     return numPackets == -1 || numSent < numPackets;
 }
 
-L3Address IpvxTrafGen::chooseDestAddr()
+int IpvxTrafGen::chooseDestAddrIndex()
 {
-    int k = intrand(destAddresses.size());
-    return destAddresses[k];
+    return intrand(destAddresses.size());
+}
+
+void IpvxTrafGen::createPacketTemplates()
+{
+    // the tags only depend on the destination address, build one template
+    // packet per destination and let sendPacket() duplicate them
+    for (auto packetTemplate : packetTemplates)
+        delete packetTemplate;
+    packetTemplates.clear();
+    for (auto& destAddr : destAddresses) {
+        auto packetTemplate = new Packet();
+        const IL3AddressType *addressType = destAddr.getAddressType();
+        packetTemplate->addTag<PacketProtocolTag>()->setProtocol(protocol);
+        packetTemplate->addTag<DispatchProtocolReq>()->setProtocol(addressType->getNetworkProtocol());
+        packetTemplate->addTag<L3AddressReq>()->setDestAddress(destAddr);
+        packetTemplates.push_back(packetTemplate);
+    }
 }
 
 void IpvxTrafGen::sendPacket()
@@ -147,18 +166,12 @@ void IpvxTrafGen::sendPacket()
     char msgName[32];
     sprintf(msgName, "appData-%d", numSent);
 
-    Packet *packet = new Packet(msgName);
+    Packet *packet = packetTemplates[chooseDestAddrIndex()]->dup();
+    packet->setName(msgName);
     const auto& payload = makeShared<ByteCountChunk>(B(*packetLengthPar));
     payload->addTag<CreationTimeTag>()->setCreationTime(simTime());
     packet->insertAtBack(payload);
 
-    L3Address destAddr = chooseDestAddr();
-
-    const IL3AddressType *addressType = destAddr.getAddressType();
-    packet->addTag<PacketProtocolTag>()->setProtocol(protocol);
-    packet->addTag<DispatchProtocolReq>()->setProtocol(addressType->getNetworkProtocol());
-    packet->addTag<L3AddressReq>()->setDestAddress(destAddr);
-
     EV_INFO << "Sending packet: ";
     printPacket(packet);
     emit(packetSentSignal, packet);
@@ -33,6 +33,9 @@ class INET_API IpvxTrafGen : public ApplicationBase
     cPar *packetLengthPar = nullptr;
     const Protocol *protocol = nullptr;
     std::vector<L3Address> destAddresses;
+    // prebuilt packets carrying the per-destination tags, aligned with destAddresses;
+    // sendPacket() duplicates one instead of re-creating the tags for every packet
+    std::vector<Packet *> packetTemplates;
     int numPackets = 0;
 
     // state
@@ -47,7 +50,8 @@ class INET_API IpvxTrafGen : public ApplicationBase
     virtual void cancelNextPacket();
     virtual bool isEnabled();
 
-    virtual L3Address chooseDestAddr();
+    virtual int chooseDestAddrIndex();
+    virtual void createPacketTemplates();
     virtual void sendPacket();
 
     virtual int numInitStages() const override { return NUM_INIT_STAGES; }
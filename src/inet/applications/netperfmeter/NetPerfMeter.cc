@@ -885,6 +885,22 @@ void NetPerfMeter::writeStatistics()
     resetStatistics(); // Make sure that it is not mistakenly used later
 }
 
+// ###### Create data message payload of given size #########################
+const Ptr<BytesChunk> NetPerfMeter::createDataChunk(const unsigned int msgSize)
+{
+    // The payload contents is the constant "TDTD..." pattern; keep it in a
+    // reusable buffer instead of filling it in byte by byte for every message.
+    if (PayloadPattern.size() < msgSize) {
+        const size_t oldSize = PayloadPattern.size();
+        PayloadPattern.resize(msgSize);
+        for (size_t i = oldSize; i < msgSize; i++)
+            PayloadPattern[i] = ((i & 1) ? 'D' : 'T');
+    }
+    auto dataMessage = makeShared<BytesChunk>(std::vector<uint8_t>(PayloadPattern.begin(), PayloadPattern.begin() + msgSize));
+    dataMessage->addTag<CreationTimeTag>()->setCreationTime(simTime());
+    return dataMessage;
+}
+
 // ###### Transmit frame of given size via given stream #####################
 unsigned long NetPerfMeter::transmitFrame(const unsigned int frameSize,
                                           const unsigned int streamID)
@@ -898,14 +914,7 @@ unsigned long NetPerfMeter::transmitFrame(const unsigned int frameSize,
     if (TransportProtocol == TCP) {
         // TCP is stream-oriented: just pass the amount of frame data.
         auto cmsg = new Packet("NetPerfMeterDataMessage");
-        auto dataMessage = makeShared<BytesChunk>();
-        std::vector<uint8_t> vec;
-        vec.resize(frameSize);
-        for (uint32_t i = 0; i < frameSize; i++)
-            vec[i] = ((i & 1) ? 'D' : 'T');
-        dataMessage->setBytes(vec);
-        dataMessage->addTag<CreationTimeTag>()->setCreationTime(simTime());
-        cmsg->insertAtBack(dataMessage);
+        cmsg->insertAtBack(createDataChunk(frameSize));
 
         if (IncomingSocketTCP) {
             IncomingSocketTCP->send(cmsg);
@@ -934,14 +943,7 @@ unsigned long NetPerfMeter::transmitFrame(const unsigned int frameSize,
                 const bool sendUnreliable = (UnreliableMode > 0.0) ? (uniform(0.0, 1.0) < UnreliableMode) : false;
 
                 auto cmsg = new Packet("NetPerfMeterDataMessage");
-                auto dataMessage = makeShared<BytesChunk>();
-                std::vector<uint8_t> vec;
-                vec.resize(msgSize);
-                for (uint32_t i = 0; i < msgSize; i++)
-                    vec[i] = ((i & 1) ? 'D' : 'T');
-                dataMessage->setBytes(vec);
-                dataMessage->addTag<CreationTimeTag>()->setCreationTime(simTime());
-                cmsg->insertAtBack(dataMessage);
+                cmsg->insertAtBack(createDataChunk(msgSize));
 
                 cmsg->addTag<SocketReq>()->setSocketId(ConnectionID);
                 auto command = cmsg->addTag<SctpSendReq>();
@@ -966,14 +968,7 @@ unsigned long NetPerfMeter::transmitFrame(const unsigned int frameSize,
             // ====== UDP ===================================================
             else if (TransportProtocol == UDP) {
                 auto cmsg = new Packet("NetPerfMeterDataMessage");
-                auto dataMessage = makeShared<BytesChunk>();
-                std::vector<uint8_t> vec;
-                vec.resize(msgSize);
-                for (uint32_t i = 0; i < msgSize; i++)
-                    vec[i] = ((i & 1) ? 'D' : 'T');
-                dataMessage->setBytes(vec);
-                dataMessage->addTag<CreationTimeTag>()->setCreationTime(simTime());
-                cmsg->insertAtBack(dataMessage);
+                cmsg->insertAtBack(createDataChunk(msgSize));
 
                 SocketUDP->send(cmsg);
 
@@ -22,6 +22,7 @@
 #include <fstream>
 
 #include "inet/applications/netperfmeter/NetPerfMeter_m.h"
+#include "inet/common/packet/chunk/BytesChunk.h"
 #include "inet/networklayer/common/L3Address.h"
 #include "inet/transportlayer/contract/sctp/SctpCommand_m.h"
 #include "inet/transportlayer/contract/sctp/SctpSocket.h"
@@ -127,6 +128,7 @@ class INET_API NetPerfMeter : public cSimpleModule
 
     // ====== Variables ======================================================
     unsigned int LastStreamID = 0; // Stream number of last message being sent
+    std::vector<uint8_t> PayloadPattern; // Reusable "TDTD..." payload contents, grown on demand
 
     // ====== Statistics =====================================================
     simtime_t StatisticsStartTime; // Absolute start time of statistics recording
@@ -185,6 +187,7 @@ class INET_API NetPerfMeter : public cSimpleModule
 
     void sendDataOfNonSaturatedStreams(const unsigned long long bytesAvailableInQueue, const unsigned int streamID);
     unsigned long transmitFrame(const unsigned int frameSize, const unsigned int streamID);
+    const Ptr<BytesChunk> createDataChunk(const unsigned int msgSize);
     static opp_string format(const char *formatString, ...);
     static void parseExpressionVector(std::vector<cDynamicExpression>& expressionVector,
             const char *string, const char *delimiters = nullptr);
@@ -93,6 +93,7 @@ void PingApp::initialize(int stage)
             throw cRuntimeError("Invalid startTime/stopTime parameters");
         printPing = par("printPing");
         continuous = par("continuous");
+        recordRttPerDestination = par("recordRttPerDestination");
 
         const char *crcModeString = par("crcMode");
         crcMode = parseCrcMode(crcModeString, false);
@@ -373,7 +374,9 @@ void PingApp::sendPingRequest()
     ASSERT(pid != -1);
 
     Packet *outPacket = new Packet(name);
-    auto payload = makeShared<ByteCountChunk>(B(packetSize));
+    if (payloadTemplate == nullptr)
+        payloadTemplate = makeShared<ByteCountChunk>(B(packetSize));
+    const auto& payload = payloadTemplate;
 
     switch (destAddr.getType()) {
         case L3Address::IPv4: {
@@ -478,6 +481,8 @@ void PingApp::processPingResponse(int originatorId, int seqNo, Packet *packet)
     }
 
     // update statistics
+    if (recordRttPerDestination && rtt > SIMTIME_ZERO && !isDup)
+        perDestinationRttStats[src].collect(rtt);
     countPingResponse(B(pingPayload->getChunkLength()).get(), seqNo, rtt, isDup);
 }
 
@@ -574,6 +579,8 @@ void PingApp::finish()
     recordScalar("Pings sent", sendSeqNo);
     recordScalar("ping loss rate (%)", 100 * lossCount / (double)sendSeqNo);
     recordScalar("ping out-of-order rate (%)", 100 * outOfOrderArrivalCount / (double)sendSeqNo);
+    for (auto& elem : perDestinationRttStats)
+        recordStatistic((std::string("rtt ") + elem.first.str()).c_str(), &elem.second, "s");
 
     // print it to stdout as well
     if (printPing) {
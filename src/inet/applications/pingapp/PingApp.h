@@ -13,6 +13,7 @@
 #include "inet/common/lifecycle/LifecycleOperation.h"
 #include "inet/common/lifecycle/NodeStatus.h"
 #include "inet/common/packet/Packet.h"
+#include "inet/common/packet/chunk/ByteCountChunk.h"
 #include "inet/common/socket/SocketMap.h"
 #include "inet/networklayer/common/L3Address.h"
 #include "inet/networklayer/contract/INetworkSocket.h"
@@ -47,6 +48,7 @@ class INET_API PingApp : public ApplicationBase, public INetworkSocket::ICallbac
     CrcMode crcMode = CRC_MODE_UNDEFINED;
     bool printPing = false;
     bool continuous = false;
+    bool recordRttPerDestination = false;
 
     // state
     SocketMap socketMap;
@@ -59,11 +61,13 @@ class INET_API PingApp : public ApplicationBase, public INetworkSocket::ICallbac
     long expectedReplySeqNo = 0;
     simtime_t sendTimeHistory[PING_HISTORY_SIZE]; // times of when the requests were sent
     bool pongReceived[PING_HISTORY_SIZE];
+    Ptr<const ByteCountChunk> payloadTemplate; // the payload never changes, all requests share the same immutable chunk
 
     static const std::map<const Protocol *, const Protocol *> l3Echo;
 
     // statistics
     cStdDev rttStat;
+    std::map<L3Address, cStdDev> perDestinationRttStats; // only filled when recordRttPerDestination is enabled
     static simsignal_t rttSignal;
     static simsignal_t numLostSignal;
     static simsignal_t numOutOfOrderArrivalsSignal;
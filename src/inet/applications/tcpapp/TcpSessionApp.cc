@@ -7,6 +7,10 @@
 
 #include "inet/applications/tcpapp/TcpSessionApp.h"
 
+#include <string.h>
+
+#include <algorithm>
+
 #include "inet/applications/base/ApplicationPacket_m.h"
 #include "inet/common/ModuleAccess.h"
 #include "inet/common/TagBase_m.h"
@@ -39,6 +43,15 @@ void TcpSessionApp::initialize(int stage)
         tSend = par("tSend");
         tClose = par("tClose");
         sendBytes = par("sendBytes");
+        const char *dataTransferModeString = par("dataTransferMode");
+        if (!strcmp(dataTransferModeString, "bytecount"))
+            dataTransferMode = BYTECOUNT;
+        else if (!strcmp(dataTransferModeString, "object"))
+            dataTransferMode = OBJECT;
+        else if (!strcmp(dataTransferModeString, "bytestream"))
+            dataTransferMode = BYTESTREAM;
+        else
+            throw cRuntimeError("Invalid data transfer mode: %s", dataTransferModeString);
         commandIndex = 0;
 
         const char *script = par("sendScript");
@@ -118,27 +131,30 @@ void TcpSessionApp::sendData()
 
 Packet *TcpSessionApp::createDataPacket(long sendBytes)
 {
-    const char *dataTransferMode = par("dataTransferMode");
     Ptr<Chunk> payload;
-    if (!strcmp(dataTransferMode, "bytecount")) {
+    if (dataTransferMode == BYTECOUNT) {
         payload = makeShared<ByteCountChunk>(B(sendBytes));
     }
-    else if (!strcmp(dataTransferMode, "object")) {
+    else if (dataTransferMode == OBJECT) {
         const auto& applicationPacket = makeShared<ApplicationPacket>();
         applicationPacket->setChunkLength(B(sendBytes));
         payload = applicationPacket;
     }
-    else if (!strcmp(dataTransferMode, "bytestream")) {
+    else if (dataTransferMode == BYTESTREAM) {
         const auto& bytesChunk = makeShared<BytesChunk>();
-        std::vector<uint8_t> vec;
-        vec.resize(sendBytes);
-        for (int i = 0; i < sendBytes; i++)
-            vec[i] = (bytesSent + i) & 0xFF;
+        std::vector<uint8_t> vec(sendBytes);
+        // fill in the rolling 0..255 byte pattern with bulk copies instead of byte by byte
+        static uint8_t pattern[512];
+        if (pattern[511] == 0)
+            for (int i = 0; i < 512; i++)
+                pattern[i] = i & 0xFF;
+        for (long i = 0; i < sendBytes; i += 256)
+            memcpy(vec.data() + i, pattern + ((bytesSent + i) & 0xFF), std::min(256L, sendBytes - i));
         bytesChunk->setBytes(vec);
         payload = bytesChunk;
     }
     else
-        throw cRuntimeError("Invalid data transfer mode: %s", dataTransferMode);
+        throw cRuntimeError("Invalid data transfer mode: %d", dataTransferMode);
     payload->addTag<CreationTimeTag>()->setCreationTime(simTime());
     Packet *packet = new Packet("data1");
     packet->insertAtBack(payload);
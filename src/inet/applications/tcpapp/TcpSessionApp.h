@@ -30,11 +30,14 @@ class INET_API TcpSessionApp : public TcpAppBase
     typedef std::vector<Command> CommandVector;
     CommandVector commands;
 
+    enum DataTransferMode { BYTECOUNT, OBJECT, BYTESTREAM };
+
     bool activeOpen = false;
     simtime_t tOpen;
     simtime_t tSend;
     simtime_t tClose;
     int sendBytes = 0;
+    DataTransferMode dataTransferMode = BYTECOUNT; // parsed once, createDataPacket() runs per send
 
     // state
     int commandIndex = -1;
@@ -43,6 +43,7 @@ void UdpBasicApp::initialize(int stage)
         stopTime = par("stopTime");
         packetName = par("packetName");
         dontFragment = par("dontFragment");
+        messageLengthPar = &par("messageLength");
         if (stopTime >= CLOCKTIME_ZERO && stopTime < startTime)
             throw cRuntimeError("Invalid startTime/stopTime parameters");
         selfMsg = new ClockEvent("sendTimer");
@@ -102,13 +103,13 @@ L3Address UdpBasicApp::chooseDestAddr()
 
 void UdpBasicApp::sendPacket()
 {
-    std::ostringstream str;
-    str << packetName << "-" << numSent;
-    Packet *packet = new Packet(str.str().c_str());
+    char msgName[64];
+    snprintf(msgName, sizeof(msgName), "%s-%d", packetName, numSent);
+    Packet *packet = new Packet(msgName);
     if (dontFragment)
         packet->addTag<FragmentationReq>()->setDontFragment(true);
     const auto& payload = makeShared<ApplicationPacket>();
-    payload->setChunkLength(B(par("messageLength")));
+    payload->setChunkLength(B(*messageLengthPar));
     payload->setSequenceNumber(numSent);
     payload->addTag<CreationTimeTag>()->setCreationTime(simTime());
     packet->insertAtBack(payload);
@@ -35,6 +35,7 @@ class INET_API UdpBasicApp : public ClockUserModuleMixin<ApplicationBase>, publi
     clocktime_t stopTime;
     bool dontFragment = false;
     const char *packetName = nullptr;
+    cPar *messageLengthPar = nullptr;
 
     // state
     UdpSocket socket;
@@ -192,7 +192,8 @@ void VoipStreamReceiver::createConnection(Packet *pk)
     if (err < 0)
         throw cRuntimeError("could not open decoding codec %d (%s): error (%d) %s", curConn.codec, curConn.pCodecDec->name, err, av_err2str(err));
 
-    curConn.openAudio(resultFile);
+    if (resultFile && *resultFile)
+        curConn.openAudio(resultFile);
     curConn.offline = false;
     emit(connStateSignal, 1);
 }
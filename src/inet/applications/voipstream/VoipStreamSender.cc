@@ -40,6 +40,7 @@ VoipStreamSender::~VoipStreamSender()
         avcodec_close(pEncoderCtx);
         avcodec_free_context(&pEncoderCtx);
     }
+    delete[] resampleBuffer;
     cancelAndDelete(timer);
 }
 
@@ -311,6 +312,9 @@ void VoipStreamSender::openSoundFile(const char *name)
         err = swr_init(pReSampleCtx);
         if (err < 0)
             throw cRuntimeError("Error opening context, swr_init() returns (%d) %s", err, av_err2str(err));
+
+        if (!resampleBuffer)
+            resampleBuffer = new uint8_t[Buffer::BUFSIZE];
     }
 
     if (traceFileName && *traceFileName) {
@@ -418,6 +422,8 @@ bool VoipStreamSender::checkSilence(AVSampleFormat sampleFormat, void *_buf, int
             uint8_t *buf = (uint8_t *)_buf;
             for (i = 0; i < samples; ++i) {
                 int s = abs(int(buf[i]) - 0x80);
+                if (s >= voipSilenceThreshold)
+                    return false;
                 if (s > max)
                     max = s;
             }
@@ -428,6 +434,8 @@ bool VoipStreamSender::checkSilence(AVSampleFormat sampleFormat, void *_buf, int
             int16_t *buf = (int16_t *)_buf;
             for (i = 0; i < samples; ++i) {
                 int s = abs(buf[i]);
+                if (s >= voipSilenceThreshold)
+                    return false;
                 if (s > max)
                     max = s;
             }
@@ -439,7 +447,8 @@ bool VoipStreamSender::checkSilence(AVSampleFormat sampleFormat, void *_buf, int
 
             for (i = 0; i < samples; ++i) {
                 int s = abs(buf[i]);
-
+                if (s >= voipSilenceThreshold)
+                    return false;
                 if (s > max)
                     max = s;
             }
@@ -541,13 +550,12 @@ void VoipStreamSender::readFrame()
 void VoipStreamSender::resampleFrame(const uint8_t **in_data, int in_nb_samples)
 {
     short int outBytesPerSample = av_get_bytes_per_sample(pEncoderCtx->sample_fmt);
-    uint8_t *tmpSamples = new uint8_t[Buffer::BUFSIZE];
     uint8_t *out_data[1] = { nullptr };
     int maxOutSamples = sampleBuffer.availableSpace() / outBytesPerSample;
     int out_linesize;
     int err;
 
-    err = av_samples_fill_arrays(out_data, &out_linesize, tmpSamples, 1, maxOutSamples, pEncoderCtx->sample_fmt, 0);
+    err = av_samples_fill_arrays(out_data, &out_linesize, resampleBuffer, 1, maxOutSamples, pEncoderCtx->sample_fmt, 0);
     if (err < 0)
         throw cRuntimeError("failed out_data fill arrays: (%d) %s", err, av_err2str(err));
 
@@ -560,7 +568,6 @@ void VoipStreamSender::resampleFrame(const uint8_t **in_data, int in_nb_samples)
         memcpy(sampleBuffer.writePtr(), out_data[0], resampled * outBytesPerSample);
         sampleBuffer.notifyWrote(resampled * outBytesPerSample);
     }
-    delete[] tmpSamples;
 }
 
 } // namespace inet
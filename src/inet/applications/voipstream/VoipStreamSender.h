@@ -121,6 +121,7 @@ class INET_API VoipStreamSender : public cSimpleModule, public LifecycleUnsuppor
     uint32_t pktID = 0; // increasing packet sequence number
     int samplesPerPacket = 0;
     Buffer sampleBuffer;
+    uint8_t *resampleBuffer = nullptr; // reused output buffer for resampleFrame()
 
     cMessage *timer = nullptr;
 };
@@ -69,24 +69,30 @@ void OscillatorBasedClock::initialize(int stage)
         originClockTime = par("initialClockTime");
         if (originClockTime.raw() % oscillator->getNominalTickLength().raw() != 0)
             throw cRuntimeError("Initial clock time must be a multiple of the oscillator nominal tick length");
+        updateConversionState();
     }
 }
 
+void OscillatorBasedClock::updateConversionState()
+{
+    originTicks = oscillator->computeTicksForInterval(originSimulationTime - oscillator->getComputationOrigin());
+    oscillatorCompensationFactor = 1 + unit(getOscillatorCompensation()).get();
+}
+
 clocktime_t OscillatorBasedClock::computeClockTimeFromSimTime(simtime_t t) const
 {
     ASSERT(t >= simTime());
     return originClockTime +
-           SIMTIME_AS_CLOCKTIME((oscillator->computeTicksForInterval(t - oscillator->getComputationOrigin()) -
-                                 oscillator->computeTicksForInterval(originSimulationTime - oscillator->getComputationOrigin())) *
-                                oscillator->getNominalTickLength() * (1 + unit(getOscillatorCompensation()).get()));
+           SIMTIME_AS_CLOCKTIME((oscillator->computeTicksForInterval(t - oscillator->getComputationOrigin()) - originTicks) *
+                                oscillator->getNominalTickLength() * oscillatorCompensationFactor);
 }
 
 simtime_t OscillatorBasedClock::computeSimTimeFromClockTime(clocktime_t t) const
 {
     ASSERT(t >= getClockTime());
     return oscillator->getComputationOrigin() +
-           oscillator->computeIntervalForTicks((t - originClockTime).dbl() / oscillator->getNominalTickLength() / (1 + unit(getOscillatorCompensation()).get()) +
-                                               oscillator->computeTicksForInterval(originSimulationTime - oscillator->getComputationOrigin()));
+           oscillator->computeIntervalForTicks((t - originClockTime).dbl() / oscillator->getNominalTickLength() / oscillatorCompensationFactor +
+                                               originTicks);
 }
 
 void OscillatorBasedClock::scheduleClockEventAt(clocktime_t time, ClockEvent *event)
@@ -137,6 +143,7 @@ void OscillatorBasedClock::receiveSignal(cComponent *source, int signal, cObject
         originSimulationTime = simTime();
     }
     else if (signal == IOscillator::postOscillatorStateChangedSignal) {
+        updateConversionState();
         simtime_t currentSimTime = simTime();
         for (auto event : events) {
             if (event->getRelative()) {
@@ -25,11 +25,22 @@ class INET_API OscillatorBasedClock : public ClockBase, public cListener
     simtime_t originSimulationTime;
     clocktime_t originClockTime;
 
+    int64_t originTicks = 0; // cached number of oscillator ticks from the oscillator computation origin to originSimulationTime
+    double oscillatorCompensationFactor = 1; // cached value of (1 + oscillator compensation) as a plain factor
+
     std::vector<ClockEvent *> events;
 
   protected:
     virtual void initialize(int stage) override;
 
+    /**
+     * Recomputes the cached conversion state. Must be called whenever the
+     * conversion origin, the oscillator state, or the oscillator compensation
+     * changes, so that the time conversion methods don't have to recompute it
+     * for every call in between.
+     */
+    virtual void updateConversionState();
+
   public:
     virtual ~OscillatorBasedClock();
 
@@ -71,6 +71,7 @@ void SettableClock::setClockTime(clocktime_t newClockTime, ppm oscillatorCompens
         originSimulationTime = simTime();
         originClockTime = newClockTime;
         this->oscillatorCompensation = oscillatorCompensation;
+        updateConversionState();
         ASSERT(newClockTime == getClockTime());
         clocktime_t clockDelta = newClockTime - oldClockTime;
         for (auto event : events) {
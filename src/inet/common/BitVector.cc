@@ -98,8 +98,23 @@ void BitVector::appendBit(bool value)
 
 void BitVector::appendBit(bool value, int n)
 {
-    while (n--)
-        appendBit(value);
+    if (n <= 0)
+        return;
+    int newSize = size + n;
+    if (containerSize() < newSize)
+        bytes.resize((newSize + UINT8_LENGTH - 1) / UINT8_LENGTH, uint8_t(0));
+    // bits beyond size are always 0, so appending 0 bits only requires growing the size
+    if (value) {
+        for (int pos = size; pos < newSize && pos % UINT8_LENGTH != 0; pos++)
+            bytes[pos / UINT8_LENGTH] |= 1 << (pos % UINT8_LENGTH);
+        int firstFullByte = (size + UINT8_LENGTH - 1) / UINT8_LENGTH;
+        int lastFullByte = newSize / UINT8_LENGTH;
+        for (int i = firstFullByte; i < lastFullByte; i++)
+            bytes[i] = 0xFF;
+        for (int pos = std::max(size, lastFullByte * UINT8_LENGTH); pos < newSize; pos++)
+            bytes[pos / UINT8_LENGTH] |= 1 << (pos % UINT8_LENGTH);
+    }
+    size = newSize;
 }
 
 void BitVector::appendByte(uint8_t value)
@@ -161,10 +176,15 @@ int BitVector::computeHammingDistance(const BitVector& u) const
 {
     if (getSize() != u.getSize())
         throw cRuntimeError("You can't compute Hamming distance between two vectors with different sizes");
+    // compare whole bytes instead of individual bits, bits beyond size are always 0
+    int numBytes = (size + UINT8_LENGTH - 1) / UINT8_LENGTH;
     int hammingDistance = 0;
-    for (unsigned int i = 0; i < getSize(); i++)
-        if (u.getBit(i) != getBit(i))
-            hammingDistance++;
+    for (int i = 0; i < numBytes; i++) {
+        unsigned int diff = bytes[i] ^ u.bytes[i];
+        diff = diff - ((diff >> 1) & 0x55);
+        diff = (diff & 0x33) + ((diff >> 2) & 0x33);
+        hammingDistance += (diff + (diff >> 4)) & 0x0F;
+    }
     return hammingDistance;
 }
 
@@ -180,8 +200,10 @@ bool BitVector::operator==(const BitVector& rhs) const
 {
     if (rhs.getSize() != getSize())
         return false;
-    for (unsigned int i = 0; i < getSize(); i++)
-        if (getBit(i) != rhs.getBit(i))
+    // compare whole bytes instead of individual bits, bits beyond size are always 0
+    int numBytes = (size + UINT8_LENGTH - 1) / UINT8_LENGTH;
+    for (int i = 0; i < numBytes; i++)
+        if (bytes[i] != rhs.bytes[i])
             return false;
     return true;
 }
@@ -193,10 +215,8 @@ bool BitVector::operator!=(const BitVector& rhs) const
 
 void BitVector::copy(const BitVector& other)
 {
-    size = 0;
-    bytes.clear();
-    for (unsigned int i = 0; i < other.getSize(); i++)
-        appendBit(other.getBit(i));
+    size = other.size;
+    bytes.assign(other.bytes.begin(), other.bytes.begin() + (size + UINT8_LENGTH - 1) / UINT8_LENGTH);
 }
 
 } /* namespace inet */
@@ -15,6 +15,16 @@ namespace inet {
 
 Register_Class(FingerprintCalculator);
 
+Register_PerRunConfigOption(CFGID_FINGERPRINT_EVENT_SAMPLING_INTERVAL, "fingerprint-event-sampling-interval", CFG_INT, "1", "When greater than 1, only every Nth event (after the ingredient filters) is added to the fingerprint. The sampling is deterministic, so the resulting fingerprint is still reproducible, but it is not comparable to a fingerprint computed with a different sampling interval.");
+
+void FingerprintCalculator::initialize(const char *expectedFingerprints, cConfiguration *cfg, int index)
+{
+    cSingleFingerprintCalculator::initialize(expectedFingerprints, cfg, index);
+    eventSamplingInterval = cfg->getAsInt(CFGID_FINGERPRINT_EVENT_SAMPLING_INTERVAL);
+    if (eventSamplingInterval < 1)
+        throw cRuntimeError("Invalid fingerprint-event-sampling-interval value %ld", (long)eventSamplingInterval);
+}
+
 void FingerprintCalculator::parseIngredients(const char *s)
 {
     cSingleFingerprintCalculator::parseIngredients(s);
@@ -24,7 +34,7 @@ void FingerprintCalculator::parseIngredients(const char *s)
 
 cSingleFingerprintCalculator::FingerprintIngredient FingerprintCalculator::validateIngredient(char ch)
 {
-    if (strchr(INET_FINGERPRINT_INGREDIENTS, ch) != nullptr)
+    if (isInetIngredient(ch))
         return (cSingleFingerprintCalculator::FingerprintIngredient)ch;
     else
         return cSingleFingerprintCalculator::validateIngredient(ch);
@@ -32,7 +42,7 @@ cSingleFingerprintCalculator::FingerprintIngredient FingerprintCalculator::valid
 
 bool FingerprintCalculator::addEventIngredient(cEvent *event, cSingleFingerprintCalculator::FingerprintIngredient ingredient)
 {
-    if (strchr(INET_FINGERPRINT_INGREDIENTS, ingredient) == nullptr)
+    if (!isInetIngredient(ingredient))
         return cSingleFingerprintCalculator::addEventIngredient(event, ingredient);
     else {
         switch ((FingerprintIngredient)ingredient) {
@@ -110,6 +120,8 @@ void FingerprintCalculator::addEvent(cEvent *event)
                 return;
         }
     }
+    if (eventSamplingInterval > 1 && sampledEventNumber++ % eventSamplingInterval != 0)
+        return;
     cSingleFingerprintCalculator::addEvent(event);
 }
 
@@ -0,0 +1,63 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#include "inet/common/HotPathProfiler.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <vector>
+
+namespace inet {
+
+static bool readEnabledFromEnvironment()
+{
+#if HOT_PATH_PROFILER_ENABLED
+    return true;
+#else
+    const char *value = std::getenv("INET_HOT_PATH_PROFILER");
+    return value != nullptr && *value != '\0' && *value != '0';
+#endif
+}
+
+bool HotPathProfiler::enabled = readEnabledFromEnvironment();
+
+HotPathProfiler::~HotPathProfiler()
+{
+    if (enabled && !entries.empty())
+        dump(std::cout);
+}
+
+void HotPathProfiler::add(cComponentType *componentType, uint64_t cycles)
+{
+    Entry& entry = entries[componentType];
+    entry.totalCycles += cycles;
+    entry.numEvents++;
+}
+
+void HotPathProfiler::dump(std::ostream& stream) const
+{
+    std::vector<std::pair<cComponentType *, Entry>> sortedEntries(entries.begin(), entries.end());
+    std::sort(sortedEntries.begin(), sortedEntries.end(), [] (const auto& a, const auto& b) {
+        return a.second.totalCycles > b.second.totalCycles;
+    });
+    stream << "Hot path profile (CPU cycles per module type):\n";
+    stream << std::setw(20) << "total" << std::setw(12) << "events" << std::setw(12) << "average" << "  module type\n";
+    for (const auto& [componentType, entry] : sortedEntries)
+        stream << std::setw(20) << entry.totalCycles
+               << std::setw(12) << entry.numEvents
+               << std::setw(12) << entry.totalCycles / entry.numEvents
+               << "  " << componentType->getFullName() << "\n";
+    stream.flush();
+}
+
+HotPathProfiler& HotPathProfiler::getInstance()
+{
+    static HotPathProfiler instance;
+    return instance;
+}
+
+} // namespace inet
@@ -0,0 +1,116 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#ifndef __INET_HOTPATHPROFILER_H
+#define __INET_HOTPATHPROFILER_H
+
+#include <cstdlib>
+#include <map>
+
+#include "inet/common/INETDefs.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+// hot path profiling is disabled by default, it can be enabled globally at
+// build time (e.g. -DHOT_PATH_PROFILER_ENABLED=1) or at run time via the
+// INET_HOT_PATH_PROFILER environment variable
+#ifndef HOT_PATH_PROFILER_ENABLED
+#define HOT_PATH_PROFILER_ENABLED    0
+#endif
+
+namespace inet {
+
+/**
+ * This class aggregates the time spent in the message processing hot paths
+ * per module type. Measurement scopes are placed in the handleMessage()
+ * methods of the framework base classes (OperationalMixin and the queueing
+ * base classes), so the table covers both protocol modules and the packet
+ * processing elements without per-module changes. Time is measured with the
+ * raw CPU cycle counter, which is cheap enough to leave compiled in; when
+ * profiling is disabled the measurement scope is a single branch on a
+ * static flag.
+ *
+ * The collected table is printed sorted by total cost when the process
+ * exits, and can also be printed on demand with dump().
+ */
+class INET_API HotPathProfiler
+{
+  public:
+    /**
+     * Measures the cycles spent between construction and destruction and
+     * adds them to the entry of the given module's type. The scope does
+     * nothing when profiling is disabled.
+     */
+    class INET_API Measurement
+    {
+      protected:
+        cComponentType *componentType = nullptr;
+        uint64_t startTime = 0;
+
+      public:
+        Measurement(const cModule *module) {
+            if (HotPathProfiler::isEnabled()) {
+                componentType = module->getComponentType();
+                startTime = readCycleCounter();
+            }
+        }
+
+        ~Measurement() {
+            if (componentType != nullptr)
+                HotPathProfiler::getInstance().add(componentType, readCycleCounter() - startTime);
+        }
+    };
+
+  protected:
+    class INET_API Entry
+    {
+      public:
+        uint64_t totalCycles = 0;
+        uint64_t numEvents = 0;
+    };
+
+    std::map<cComponentType *, Entry> entries;
+
+    static bool enabled;
+
+  public:
+    ~HotPathProfiler();
+
+    void add(cComponentType *componentType, uint64_t cycles);
+
+    /**
+     * Prints the collected per-module-type cost table sorted by total cost.
+     */
+    void dump(std::ostream& stream) const;
+
+    static uint64_t readCycleCounter() {
+#if defined(_MSC_VER) || defined(__i386__) || defined(__x86_64__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t value;
+        asm volatile("mrs %0, cntvct_el0" : "=r" (value));
+        return value;
+#else
+        return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+
+    static HotPathProfiler& getInstance();
+
+    static bool isEnabled() { return enabled; }
+    static void setEnabled(bool enabled) { HotPathProfiler::enabled = enabled; }
+};
+
+} // namespace inet
+
+#endif
@@ -192,6 +192,7 @@ IntervalTree::Node *IntervalTree::insert(const Interval *new_interval)
     Node *new_node;
 
     x = new Node(new_interval);
+    new_interval->node = x;
     recursiveInsert(x);
     fixupMaxHigh(x->parent);
     new_node = x;
@@ -385,9 +386,10 @@ void IntervalTree::deleteFixup(Node *x)
 
 void IntervalTree::deleteNode(const Interval *ivl)
 {
-    Node *node = recursiveSearch(root, ivl);
-    if (node != nil)
-        deleteNode(node);
+    /// the backpointer set by insert() makes this O(log n) instead of a full tree search
+    Node *node = ivl->node;
+    ASSERT(node != nullptr && node->stored_interval == ivl);
+    deleteNode(node);
 }
 
 IntervalTree::Node *IntervalTree::recursiveSearch(Node *node, const Interval *ivl) const
@@ -473,6 +475,12 @@ bool overlap(simtime_t a1, simtime_t a2, simtime_t b1, simtime_t b2)
 std::deque<const IntervalTree::Interval *> IntervalTree::query(simtime_t low, simtime_t high)
 {
     std::deque<const Interval *> result_stack;
+    query(low, high, [&] (const Interval *interval) { result_stack.push_back(interval); });
+    return result_stack;
+}
+
+void IntervalTree::query(simtime_t low, simtime_t high, const std::function<void(const Interval *)>& visitor)
+{
     Node *x = root->left;
     bool run = (x != nil);
 
@@ -480,7 +488,7 @@ std::deque<const IntervalTree::Interval *> IntervalTree::query(simtime_t low, si
 
     while (run) {
         if (overlap(low, high, x->key, x->high)) {
-            result_stack.push_back(x->stored_interval);
+            visitor(x->stored_interval);
             recursion_node_stack[current_parent].try_right_branch = true;
         }
         if (x->left->max_high >= low) {
@@ -510,7 +518,6 @@ std::deque<const IntervalTree::Interval *> IntervalTree::query(simtime_t low, si
             }
         }
     }
-    return result_stack;
 }
 
 } // namespace inet
@@ -38,6 +38,7 @@
 #define __INET_INTERVALTREE_H
 
 #include <deque>
+#include <functional>
 #include <limits>
 
 #include "inet/common/INETDefs.h"
@@ -49,6 +50,9 @@ class INET_API IntervalTree
 {
     friend class IntervalTreeTest;
 
+  protected:
+    class Node;
+
   public:
     /// @brief Interval trees implemented using red-black-trees as described in
     /// the book Introduction_To_Algorithms_ by Cormen, Leisserson, and Rivest.
@@ -70,6 +74,10 @@ class INET_API IntervalTree
         /// @brief interval is defined as [low, high]
         simtime_t low, high;
         void *value;
+
+        /// @brief tree node storing this interval, maintained by insert() to allow
+        /// deleting by interval without searching the whole tree
+        mutable Node *node = nullptr;
     };
 
   protected:
@@ -151,6 +159,9 @@ class INET_API IntervalTree
     /// @brief Return result for a given query
     std::deque<const Interval *> query(simtime_t low, simtime_t high);
 
+    /// @brief Call the visitor for each interval overlapping [low, high] without allocating a result container
+    void query(simtime_t low, simtime_t high, const std::function<void(const Interval *)>& visitor);
+
   protected:
     Node *root = nullptr;
 
@@ -10,6 +10,10 @@
 
 #include <iosfwd>
 
+#ifdef _OPENMP
+#include <atomic>
+#endif
+
 #include "inet/common/INETDefs.h"
 
 #define INET_ALWAYS_INLINE    __attribute__((always_inline)) inline
@@ -239,7 +243,15 @@ template<typename T>
 class IntrusivePtrCounter
 {
   private:
+#ifdef _OPENMP
+    // OpenMP parallel sections may copy pointers to shared immutable objects
+    // concurrently (e.g. RadioMedium.parallelReceptionComputation), so the
+    // reference count must be thread safe in such builds; the OpenMP compiler
+    // flag is global, so all translation units see the same layout
+    mutable std::atomic<unsigned int> c;
+#else
     mutable unsigned int c;
+#endif
 
   public:
     INET_ALWAYS_INLINE IntrusivePtrCounter() noexcept : c(0) {}
@@ -261,14 +273,23 @@ class IntrusivePtrCounter
 template<typename T>
 INET_ALWAYS_INLINE void intrusivePtrCounterIncrement(const IntrusivePtrCounter<T> *p) noexcept
 {
+#ifdef _OPENMP
+    p->c.fetch_add(1, std::memory_order_relaxed);
+#else
     ++(p->c);
+#endif
 }
 
 template<typename T>
 INET_ALWAYS_INLINE void intrusivePtrCounterDecrement(const IntrusivePtrCounter<T> *p) noexcept
 {
+#ifdef _OPENMP
+    if (p->c.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete static_cast<const T *>(p);
+#else
     if (--(p->c) == 0)
         delete static_cast<const T *>(p);
+#endif
 }
 
 } // namespace inet
@@ -156,6 +156,10 @@ class INET_API MemoryInputStream
      */
     bool readBitRepeatedly(bool value, size_t count) {
         bool success = true;
+        // read whole bytes as long as possible, only the tail goes bit by bit
+        uint8_t expected = value ? 0xFF : 0x00;
+        for (; count >= 8 && position + B(1) <= length; count -= 8)
+            success &= (expected == readByte());
         for (size_t i = 0; i < count; i++)
             success &= (value == readBit());
         return success;
@@ -166,8 +170,15 @@ class INET_API MemoryInputStream
      * the original bit order.
      */
     b readBits(std::vector<bool>& bits, b length) {
-        b i;
-        for (i = b(0); i < length; i++) {
+        b i = b(0);
+        // read whole bytes as long as possible, only the tail goes bit by bit
+        while (i + b(8) <= length && position + B(1) <= this->length) {
+            uint8_t byte = readByte();
+            for (int j = 7; j >= 0; j--)
+                bits.push_back((byte >> j) & 1);
+            i += b(8);
+        }
+        for (; i < length; i += b(1)) {
             if (isReadBeyondEnd_)
                 break;
             bits.push_back(readBit());
@@ -471,12 +482,17 @@ class INET_API MemoryInputStream
     uint64_t readNBitsToUint64Be(uint8_t n) {
         if (n == 0 || n > 64)
             throw cRuntimeError("Can not read 0 bit or more than 64 bits.");
-        uint64_t mul = 1 << (n - 1);
         uint64_t num = 0;
+        // read whole bytes as long as possible, only the tail goes bit by bit
+        while (n >= 8 && position + B(1) <= length) {
+            n -= 8;
+            num |= (uint64_t)readByte() << n;
+        }
+        uint64_t mul = (uint64_t)1 << n;
         for (int i = 0; i < n; ++i) {
+            mul >>= 1;
             if (readBit())
                 num |= mul;
-            mul >>= 1;
         }
         return num;
     }
@@ -63,6 +63,12 @@ class INET_API MemoryOutputStream
 
     const std::vector<uint8_t>& getData() const { return data; }
 
+    /**
+     * Returns the written data by moving the internal buffer out of the
+     * stream without copying. The stream becomes empty.
+     */
+    std::vector<uint8_t> extractData() { length = b(0); return std::move(data); }
+
     void copyData(std::vector<bool>& result, b offset = b(0), b length = b(-1)) const {
         size_t end = b(length == b(-1) ? this->length : offset + length).get();
         for (size_t i = b(offset).get(); i < end; i++) {
@@ -104,6 +110,10 @@ class INET_API MemoryOutputStream
      * Writes the same bit repeatedly to the end of the stream.
      */
     void writeBitRepeatedly(bool value, size_t count) {
+        // write whole bytes as long as possible, only the tail goes bit by bit
+        uint8_t byte = value ? 0xFF : 0x00;
+        for (; count >= 8; count -= 8)
+            writeByte(byte);
         for (size_t i = 0; i < count; i++)
             writeBit(value);
     }
@@ -114,8 +124,16 @@ class INET_API MemoryOutputStream
      */
     void writeBits(const std::vector<bool>& bits, b offset = b(0), b length = b(-1)) {
         auto end = length == b(-1) ? bits.size() : b(offset + length).get();
-        for (size_t i = b(offset).get(); i < end; i++)
-            writeBit(bits.at(i));
+        size_t i = b(offset).get();
+        // assemble whole bytes so the stream state isn't updated bit by bit
+        while (i + 8 <= end) {
+            uint8_t byte = 0;
+            for (int j = 0; j < 8; j++)
+                byte = (byte << 1) | (bits.at(i++) ? 1 : 0);
+            writeByte(byte);
+        }
+        while (i < end)
+            writeBit(bits.at(i++));
     }
     //@}
 
@@ -363,10 +381,15 @@ class INET_API MemoryOutputStream
     void writeNBitsOfUint64Be(uint64_t value, uint8_t n) {
         if (n == 0 || n > 64)
             throw cRuntimeError("Can not write 0 bit or more than 64 bits.");
-        uint64_t mul = 1 << (n - 1);
+        // write whole bytes as long as possible, only the tail goes bit by bit
+        while (n >= 8) {
+            n -= 8;
+            writeByte(static_cast<uint8_t>(value >> n));
+        }
+        uint64_t mul = (uint64_t)1 << n;
         for (int i = 0; i < n; ++i) {
-            writeBit((value & mul) != 0);
             mul >>= 1;
+            writeBit((value & mul) != 0);
         }
     }
     //@}
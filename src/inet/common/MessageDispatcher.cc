@@ -28,6 +28,9 @@ void MessageDispatcher::initialize(int stage)
     if (stage == INITSTAGE_LOCAL) {
         forwardServiceRegistration = par("forwardServiceRegistration");
         forwardProtocolRegistration = par("forwardProtocolRegistration");
+        int size = gateSize("out");
+        for (int i = 0; i < size; i++)
+            outGates.push_back(gate("out", i));
         WATCH_MAP(socketIdToGateIndex);
         WATCH_MAP(interfaceIdToGateIndex);
         WATCH_MAP(serviceToGateIndex);
@@ -133,7 +136,7 @@ cGate *MessageDispatcher::handlePacket(Packet *packet, const cGate *inGate)
         int socketId = socketInd->getSocketId();
         auto it = socketIdToGateIndex.find(socketId);
         if (it != socketIdToGateIndex.end()) {
-            auto outGate = gate("out", it->second);
+            auto outGate = outGates[it->second];
             EV_INFO << "Dispatching packet to socket" << EV_FIELD(socketId) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(packet) << EV_ENDL;
             return outGate;
         }
@@ -153,16 +156,16 @@ cGate *MessageDispatcher::handlePacket(Packet *packet, const cGate *inGate)
         }
         auto protocol = dispatchProtocolReq->getProtocol();
         if (servicePrimitive == SP_REQUEST) {
-            auto it = serviceToGateIndex.find(Key(protocol->getId(), servicePrimitive));
-            if (it != serviceToGateIndex.end()) {
-                auto outGate = gate("out", it->second);
+            int gateIndex = findDispatchTableEntry(serviceRequestGateIndexes, protocol->getId());
+            if (gateIndex != -1) {
+                auto outGate = outGates[gateIndex];
                 EV_INFO << "Dispatching packet to service" << EV_FIELD(protocol, *protocol) << EV_FIELD(servicePrimitive) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(packet) << EV_ENDL;
                 return outGate;
             }
             else {
-                auto it = serviceToGateIndex.find(Key(-1, servicePrimitive));
-                if (it != serviceToGateIndex.end()) {
-                    auto outGate = gate("out", it->second);
+                gateIndex = findDispatchTableEntry(serviceRequestGateIndexes, -1);
+                if (gateIndex != -1) {
+                    auto outGate = outGates[gateIndex];
                     EV_INFO << "Dispatching packet to any service" << EV_FIELD(servicePrimitive) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(packet) << EV_ENDL;
                     return outGate;
                 }
@@ -171,16 +174,16 @@ cGate *MessageDispatcher::handlePacket(Packet *packet, const cGate *inGate)
             }
         }
         else if (servicePrimitive == SP_INDICATION) {
-            auto it = protocolToGateIndex.find(Key(protocol->getId(), servicePrimitive));
-            if (it != protocolToGateIndex.end()) {
-                auto outGate = gate("out", it->second);
+            int gateIndex = findDispatchTableEntry(protocolIndicationGateIndexes, protocol->getId());
+            if (gateIndex != -1) {
+                auto outGate = outGates[gateIndex];
                 EV_INFO << "Dispatching packet to protocol" << EV_FIELD(protocol, *protocol) << EV_FIELD(servicePrimitive) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(packet) << EV_ENDL;
                 return outGate;
             }
             else {
-                auto it = protocolToGateIndex.find(Key(-1, servicePrimitive));
-                if (it != protocolToGateIndex.end()) {
-                    auto outGate = gate("out", it->second);
+                gateIndex = findDispatchTableEntry(protocolIndicationGateIndexes, -1);
+                if (gateIndex != -1) {
+                    auto outGate = outGates[gateIndex];
                     EV_INFO << "Dispatching packet to any protocol" << EV_FIELD(servicePrimitive) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(packet) << EV_ENDL;
                     return outGate;
                 }
@@ -196,7 +199,7 @@ cGate *MessageDispatcher::handlePacket(Packet *packet, const cGate *inGate)
         int interfaceId = interfaceReq->getInterfaceId();
         auto it = interfaceIdToGateIndex.find(interfaceId);
         if (it != interfaceIdToGateIndex.end()) {
-            auto outGate = gate("out", it->second);
+            auto outGate = outGates[it->second];
             EV_INFO << "Dispatching packet to interface" << EV_FIELD(interfaceId) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(packet) << EV_ENDL;
             return outGate;
         }
@@ -222,7 +225,7 @@ cGate *MessageDispatcher::handleMessage(Message *message, cGate *inGate)
         int socketId = socketInd->getSocketId();
         auto it = socketIdToGateIndex.find(socketId);
         if (it != socketIdToGateIndex.end()) {
-            auto outGate = gate("out", it->second);
+            auto outGate = outGates[it->second];
             EV_INFO << "Dispatching message to socket" << EV_FIELD(socketId) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(message) << EV_ENDL;
             return outGate;
         }
@@ -237,16 +240,16 @@ cGate *MessageDispatcher::handleMessage(Message *message, cGate *inGate)
             servicePrimitive = SP_REQUEST;
         auto protocol = dispatchProtocolReq->getProtocol();
         if (servicePrimitive == SP_REQUEST) {
-            auto it = serviceToGateIndex.find(Key(protocol->getId(), servicePrimitive));
-            if (it != serviceToGateIndex.end()) {
-                auto outGate = gate("out", it->second);
+            int gateIndex = findDispatchTableEntry(serviceRequestGateIndexes, protocol->getId());
+            if (gateIndex != -1) {
+                auto outGate = outGates[gateIndex];
                 EV_INFO << "Dispatching message to service" << EV_FIELD(protocol, *protocol) << EV_FIELD(servicePrimitive) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(message) << EV_ENDL;
                 return outGate;
             }
             else {
-                auto it = serviceToGateIndex.find(Key(-1, servicePrimitive));
-                if (it != serviceToGateIndex.end()) {
-                    auto outGate = gate("out", it->second);
+                gateIndex = findDispatchTableEntry(serviceRequestGateIndexes, -1);
+                if (gateIndex != -1) {
+                    auto outGate = outGates[gateIndex];
                     EV_INFO << "Dispatching message to any service" << EV_FIELD(servicePrimitive) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(message) << EV_ENDL;
                     return outGate;
                 }
@@ -255,16 +258,16 @@ cGate *MessageDispatcher::handleMessage(Message *message, cGate *inGate)
             }
         }
         else if (servicePrimitive == SP_INDICATION) {
-            auto it = protocolToGateIndex.find(Key(protocol->getId(), servicePrimitive));
-            if (it != protocolToGateIndex.end()) {
-                auto outGate = gate("out", it->second);
+            int gateIndex = findDispatchTableEntry(protocolIndicationGateIndexes, protocol->getId());
+            if (gateIndex != -1) {
+                auto outGate = outGates[gateIndex];
                 EV_INFO << "Dispatching message to protocol" << EV_FIELD(protocol, *protocol) << EV_FIELD(servicePrimitive) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(message) << EV_ENDL;
                 return outGate;
             }
             else {
-                auto it = protocolToGateIndex.find(Key(-1, servicePrimitive));
-                if (it != protocolToGateIndex.end()) {
-                    auto outGate = gate("out", it->second);
+                gateIndex = findDispatchTableEntry(protocolIndicationGateIndexes, -1);
+                if (gateIndex != -1) {
+                    auto outGate = outGates[gateIndex];
                     EV_INFO << "Dispatching message to any protocol" << EV_FIELD(servicePrimitive) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(message) << EV_ENDL;
                     return outGate;
                 }
@@ -280,7 +283,7 @@ cGate *MessageDispatcher::handleMessage(Message *message, cGate *inGate)
         int interfaceId = interfaceReq->getInterfaceId();
         auto it = interfaceIdToGateIndex.find(interfaceId);
         if (it != interfaceIdToGateIndex.end()) {
-            auto outGate = gate("out", it->second);
+            auto outGate = outGates[it->second];
             EV_INFO << "Dispatching message to interface" << EV_FIELD(interfaceId) << EV_FIELD(inGate) << EV_FIELD(outGate) << EV_FIELD(message) << EV_ENDL;
             return outGate;
         }
@@ -290,6 +293,14 @@ cGate *MessageDispatcher::handleMessage(Message *message, cGate *inGate)
     throw cRuntimeError("handleMessage(): Unknown message: %s(%s), pathStartGate = %s, pathEndGate = %s", message->getName(), message->getClassName(), inGate->getPathStartGate()->getFullPath().c_str(), inGate->getPathEndGate()->getFullPath().c_str());
 }
 
+void MessageDispatcher::setDispatchTableEntry(std::vector<int>& table, int protocolId, int gateIndex)
+{
+    size_t index = protocolId + 1;
+    if (table.size() <= index)
+        table.resize(index + 1, -1);
+    table[index] = gateIndex;
+}
+
 void MessageDispatcher::handleRegisterService(const Protocol& protocol, cGate *g, ServicePrimitive servicePrimitive)
 {
     Enter_Method("handleRegisterService");
@@ -308,6 +319,10 @@ void MessageDispatcher::handleRegisterService(const Protocol& protocol, cGate *g
         }
         else {
             serviceToGateIndex[key] = g->getIndex();
+            if (servicePrimitive == SP_REQUEST)
+                setDispatchTableEntry(serviceRequestGateIndexes, protocol.getId(), g->getIndex());
+            else if (servicePrimitive == SP_INDICATION)
+                setDispatchTableEntry(serviceIndicationGateIndexes, protocol.getId(), g->getIndex());
             if (forwardServiceRegistration) {
                 auto gateName = g->getType() == cGate::INPUT ? "out" : "in";
                 int size = gateSize(gateName);
@@ -333,6 +348,10 @@ void MessageDispatcher::handleRegisterAnyService(cGate *g, ServicePrimitive serv
         }
         else {
             serviceToGateIndex[key] = g->getIndex();
+            if (servicePrimitive == SP_REQUEST)
+                setDispatchTableEntry(serviceRequestGateIndexes, -1, g->getIndex());
+            else if (servicePrimitive == SP_INDICATION)
+                setDispatchTableEntry(serviceIndicationGateIndexes, -1, g->getIndex());
             if (forwardServiceRegistration) {
                 auto gateName = g->getType() == cGate::INPUT ? "out" : "in";
                 int size = gateSize(gateName);
@@ -362,6 +381,10 @@ void MessageDispatcher::handleRegisterProtocol(const Protocol& protocol, cGate *
         }
         else {
             protocolToGateIndex[key] = g->getIndex();
+            if (servicePrimitive == SP_REQUEST)
+                setDispatchTableEntry(protocolRequestGateIndexes, protocol.getId(), g->getIndex());
+            else if (servicePrimitive == SP_INDICATION)
+                setDispatchTableEntry(protocolIndicationGateIndexes, protocol.getId(), g->getIndex());
             if (forwardProtocolRegistration) {
                 auto gateName = g->getType() == cGate::INPUT ? "out" : "in";
                 int size = gateSize(gateName);
@@ -387,6 +410,10 @@ void MessageDispatcher::handleRegisterAnyProtocol(cGate *g, ServicePrimitive ser
         }
         else {
             protocolToGateIndex[key] = g->getIndex();
+            if (servicePrimitive == SP_REQUEST)
+                setDispatchTableEntry(protocolRequestGateIndexes, -1, g->getIndex());
+            else if (servicePrimitive == SP_INDICATION)
+                setDispatchTableEntry(protocolIndicationGateIndexes, -1, g->getIndex());
             if (forwardProtocolRegistration) {
                 auto gateName = g->getType() == cGate::INPUT ? "out" : "in";
                 int size = gateSize(gateName);
@@ -63,12 +63,28 @@ class INET_API MessageDispatcher :
     const Protocol *registeringProtocol = nullptr;
     bool registeringAny = false;
 
+    std::vector<cGate *> outGates; // cached out gate pointers to avoid the by-name gate lookup per dispatch
+    // flat dispatch tables derived from the maps above, indexed by protocol
+    // id + 1 with the wildcard "any" registration at index 0; -1 means no
+    // registration; protocol ids are small sequential integers, so resolving
+    // a packet is a single indexing operation instead of a map lookup
+    std::vector<int> serviceRequestGateIndexes;
+    std::vector<int> serviceIndicationGateIndexes;
+    std::vector<int> protocolRequestGateIndexes;
+    std::vector<int> protocolIndicationGateIndexes;
+
   protected:
     virtual void initialize(int stage) override;
     virtual void arrived(cMessage *message, cGate *gate, const SendOptions& options, simtime_t time) override;
     virtual cGate *handlePacket(Packet *packet, const cGate *inGate);
     virtual cGate *handleMessage(Message *request, cGate *inGate);
 
+    void setDispatchTableEntry(std::vector<int>& table, int protocolId, int gateIndex);
+    int findDispatchTableEntry(const std::vector<int>& table, int protocolId) const {
+        size_t index = protocolId + 1;
+        return index < table.size() ? table[index] : -1;
+    }
+
   public:
 #ifdef INET_WITH_QUEUEING
     virtual bool supportsPacketSending(const cGate *gate) const override { return true; }
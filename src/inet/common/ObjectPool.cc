@@ -0,0 +1,75 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#include "inet/common/ObjectPool.h"
+
+namespace inet {
+
+static bool readEnabledFromEnvironment()
+{
+#if OBJECT_POOL_ENABLED
+    return true;
+#else
+    const char *value = std::getenv("INET_OBJECT_POOL");
+    return value != nullptr && *value != '\0' && *value != '0';
+#endif
+}
+
+bool ObjectPool::enabled = readEnabledFromEnvironment();
+
+ObjectPool::~ObjectPool()
+{
+    for (char *block : blocks)
+        ::operator delete(block);
+}
+
+void *ObjectPool::allocateFromBlock(size_t size)
+{
+    if (blockPosition + size > blockEnd) {
+        char *block = static_cast<char *>(::operator new(BLOCK_SIZE));
+        blocks.push_back(block);
+        blockPosition = block;
+        blockEnd = block + BLOCK_SIZE;
+    }
+    void *pointer = blockPosition;
+    blockPosition += size;
+    return pointer;
+}
+
+void *ObjectPool::allocate(size_t size)
+{
+    if (size > MAX_POOLED_SIZE)
+        return ::operator new(size);
+    size_t sizeClass = getSizeClass(size);
+    if (sizeClass < freeLists.size() && freeLists[sizeClass] != nullptr) {
+        void *pointer = freeLists[sizeClass];
+        freeLists[sizeClass] = *static_cast<void **>(pointer);
+        return pointer;
+    }
+    return allocateFromBlock(sizeClass << SIZE_CLASS_SHIFT);
+}
+
+void ObjectPool::deallocate(void *pointer, size_t size)
+{
+    if (size > MAX_POOLED_SIZE) {
+        ::operator delete(pointer);
+        return;
+    }
+    size_t sizeClass = getSizeClass(size);
+    if (sizeClass >= freeLists.size())
+        freeLists.resize(sizeClass + 1, nullptr);
+    *static_cast<void **>(pointer) = freeLists[sizeClass];
+    freeLists[sizeClass] = pointer;
+}
+
+ObjectPool& ObjectPool::getInstance()
+{
+    static thread_local ObjectPool instance;
+    return instance;
+}
+
+} // namespace inet
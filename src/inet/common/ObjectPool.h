@@ -0,0 +1,99 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#ifndef __INET_OBJECTPOOL_H
+#define __INET_OBJECTPOOL_H
+
+#include <cstdlib>
+#include <vector>
+
+#include "inet/common/INETDefs.h"
+
+// pooled allocation of small objects is disabled by default, it can be enabled
+// globally at build time (e.g. -DOBJECT_POOL_ENABLED=1) or at run time via the
+// INET_OBJECT_POOL environment variable
+#ifndef OBJECT_POOL_ENABLED
+#define OBJECT_POOL_ENABLED    0
+#endif
+
+namespace inet {
+
+/**
+ * This class provides a per-thread arena allocator for small, frequently
+ * created objects such as chunks and tags. Memory is carved out of large
+ * blocks with a simple pointer bump, and deallocated objects are recycled
+ * through size-binned free lists. This avoids a heap round-trip for every
+ * chunk and tag when packets are constructed and destroyed at high rates.
+ * The pool never returns memory to the heap before the thread exits, which
+ * is acceptable because the working set of live objects in a simulation is
+ * bounded by the number of packets in flight.
+ *
+ * The pool is used by the operator new/delete overloads of FieldsChunk,
+ * SliceChunk, SequenceChunk and TagBase, so all message compiler generated
+ * chunks and tags benefit without any code changes. When the pool is
+ * disabled, allocations fall back to the global operator new/delete.
+ */
+class INET_API ObjectPool
+{
+  protected:
+    /**
+     * Free lists binned by size class, each entry is the head of a singly
+     * linked list threaded through the first word of the recycled objects.
+     */
+    std::vector<void *> freeLists;
+    /**
+     * Large memory blocks owned by the pool from which new objects are carved.
+     */
+    std::vector<char *> blocks;
+    char *blockPosition = nullptr;
+    char *blockEnd = nullptr;
+
+    static const size_t SIZE_CLASS_SHIFT = 4; // 16 byte granularity
+    static const size_t MAX_POOLED_SIZE = 1024;
+    static const size_t BLOCK_SIZE = 256 * 1024;
+
+    static bool enabled;
+
+  protected:
+    size_t getSizeClass(size_t size) const { return (size + (1 << SIZE_CLASS_SHIFT) - 1) >> SIZE_CLASS_SHIFT; }
+
+    void *allocateFromBlock(size_t size);
+
+  public:
+    ~ObjectPool();
+
+    void *allocate(size_t size);
+    void deallocate(void *pointer, size_t size);
+
+    /**
+     * Returns the pool instance of the current thread.
+     */
+    static ObjectPool& getInstance();
+
+    static bool isEnabled() { return enabled; }
+    static void setEnabled(bool enabled) { ObjectPool::enabled = enabled; }
+};
+
+inline void *poolAllocate(size_t size)
+{
+    if (ObjectPool::isEnabled())
+        return ObjectPool::getInstance().allocate(size);
+    else
+        return ::operator new(size);
+}
+
+inline void poolDeallocate(void *pointer, size_t size)
+{
+    if (ObjectPool::isEnabled())
+        ObjectPool::getInstance().deallocate(pointer, size);
+    else
+        ::operator delete(pointer);
+}
+
+} // namespace inet
+
+#endif
@@ -9,11 +9,22 @@
 
 namespace inet {
 
+bool hasPacketEvents(Packet *packet)
+{
+    // the region tag count is checked first because packets not subject to
+    // any measurement carry no region tags at all
+    return packet->getNumRegionTags() != 0 && packet->findRegionTag<PacketEventTag>() != nullptr;
+}
+
 void insertPacketEvent(const cModule *module, Packet *packet, int kind, simtime_t duration, PacketEvent *packetEvent)
 {
+    if (!hasPacketEvents(packet)) {
+        delete packetEvent;
+        return;
+    }
     auto simulation = module->getSimulation();
     packet->mapAllRegionTagsForUpdate<PacketEventTag>(b(0), packet->getTotalLength(), [&] (b offset, b length, const Ptr<PacketEventTag>& eventTag) {
-        auto packetEventCopy = packetEvent->dup();
+        auto packetEventCopy = packetEvent != nullptr ? packetEvent->dup() : new PacketEvent();
         packetEventCopy->setKind(kind);
         packetEventCopy->setModulePath(module->getFullPath().c_str());
         packetEventCopy->setEventNumber(simulation->getEventNumber());
@@ -26,4 +37,3 @@ void insertPacketEvent(const cModule *module, Packet *packet, int kind, simtime_
 }
 
 } // namespace inet
-
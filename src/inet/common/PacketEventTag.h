@@ -13,9 +13,10 @@
 
 namespace inet {
 
-INET_API void insertPacketEvent(const cModule *module, Packet *packet, int kind, simtime_t duration, PacketEvent *packetEvent = new PacketEvent());
+INET_API bool hasPacketEvents(Packet *packet);
+
+INET_API void insertPacketEvent(const cModule *module, Packet *packet, int kind, simtime_t duration, PacketEvent *packetEvent = nullptr);
 
 } // namespace inet
 
 #endif
-
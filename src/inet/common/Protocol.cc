@@ -9,9 +9,9 @@
 
 namespace inet {
 
-std::map<int, const Protocol *>& Protocol::getIdToProtocol()
+std::vector<const Protocol *>& Protocol::getIdToProtocol()
 {
-    static std::map<int, const Protocol *> idToProtocol;
+    static std::vector<const Protocol *> idToProtocol;
     return idToProtocol;
 }
 
@@ -27,7 +27,10 @@ Protocol::Protocol(const char *name, const char *descriptiveName, Layer layer) :
     descriptiveName(descriptiveName),
     layer(layer)
 {
-    getIdToProtocol()[id] = this;
+    auto& idToProtocol = getIdToProtocol();
+    if ((size_t)id >= idToProtocol.size())
+        idToProtocol.resize(id + 1, nullptr);
+    idToProtocol[id] = this;
     getNameToProtocol()[name] = this;
     if (strchr(name, ' ') != nullptr)
         throw cRuntimeError("Space is not allowed in protocol name");
@@ -42,8 +45,8 @@ std::string Protocol::str() const
 
 const Protocol *Protocol::findProtocol(int id)
 {
-    auto it = getIdToProtocol().find(id);
-    return it != getIdToProtocol().end() ? it->second : nullptr;
+    auto& idToProtocol = getIdToProtocol();
+    return 0 <= id && (size_t)id < idToProtocol.size() ? idToProtocol[id] : nullptr;
 }
 
 const Protocol *Protocol::getProtocol(int id)
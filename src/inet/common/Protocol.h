@@ -16,7 +16,9 @@ class INET_API Protocol
 {
   protected:
     static uint64_t getNextId();
-    static std::map<int, const Protocol *>& getIdToProtocol();
+    // protocol ids are small sequential integers, so a flat vector resolves
+    // them with a single indexing operation
+    static std::vector<const Protocol *>& getIdToProtocol();
     static std::map<std::string, const Protocol *>& getNameToProtocol();
 
   public:
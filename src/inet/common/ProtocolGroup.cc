@@ -19,11 +19,27 @@ ProtocolGroup::ProtocolGroup(const char *name, const Protocols& protocolNumberTo
     for (auto it : protocolNumberToProtocol) {
         protocols.push_back(it.second);
         protocolToProtocolNumber[it.second] = it.first;
+        addProtocolToTables(it.first, it.second);
     }
 }
 
+void ProtocolGroup::addProtocolToTables(int protocolNumber, const Protocol *protocol)
+{
+    if (0 <= protocolNumber && protocolNumber < protocolNumberTableLimit) {
+        if ((size_t)protocolNumber >= protocolNumberToProtocolTable.size())
+            protocolNumberToProtocolTable.resize(protocolNumber + 1, nullptr);
+        protocolNumberToProtocolTable[protocolNumber] = protocol;
+    }
+    size_t protocolId = protocol->getId();
+    if (protocolId >= protocolIdToProtocolNumberTable.size())
+        protocolIdToProtocolNumberTable.resize(protocolId + 1, -1);
+    protocolIdToProtocolNumberTable[protocolId] = protocolNumber;
+}
+
 const Protocol *ProtocolGroup::findProtocol(int protocolNumber) const
 {
+    if (0 <= protocolNumber && protocolNumber < protocolNumberTableLimit)
+        return (size_t)protocolNumber < protocolNumberToProtocolTable.size() ? protocolNumberToProtocolTable[protocolNumber] : nullptr;
     auto it = protocolNumberToProtocol.find(protocolNumber);
     return it != protocolNumberToProtocol.end() ? it->second : nullptr;
 }
@@ -39,8 +55,8 @@ const Protocol *ProtocolGroup::getProtocol(int protocolNumber) const
 
 int ProtocolGroup::findProtocolNumber(const Protocol *protocol) const
 {
-    auto it = protocolToProtocolNumber.find(protocol);
-    return it != protocolToProtocolNumber.end() ? it->second : -1;
+    size_t protocolId = protocol->getId();
+    return protocolId < protocolIdToProtocolNumberTable.size() ? protocolIdToProtocolNumberTable[protocolId] : -1;
 }
 
 int ProtocolGroup::getProtocolNumber(const Protocol *protocol) const
@@ -57,6 +73,7 @@ void ProtocolGroup::addProtocol(int protocolId, const Protocol *protocol)
     protocols.push_back(protocol);
     protocolNumberToProtocol[protocolId] = protocol;
     protocolToProtocolNumber[protocol] = protocolId;
+    addProtocolToTables(protocolId, protocol);
 }
 
 // FIXME use constants instead of numbers
@@ -19,6 +19,16 @@ class INET_API ProtocolGroup
     std::vector<const Protocol *> protocols;
     std::map<int, const Protocol *> protocolNumberToProtocol;
     std::map<const Protocol *, int> protocolToProtocolNumber;
+    // flat lookup tables for the hot per-packet directions: protocol numbers
+    // below the table limit (all but some 24-bit SNAP OUIs) resolve with a
+    // single indexing operation and the rest falls back to the map above;
+    // protocol ids are small sequential integers, so the reverse direction
+    // is always a table
+    static const int protocolNumberTableLimit = 65536;
+    std::vector<const Protocol *> protocolNumberToProtocolTable;
+    std::vector<int> protocolIdToProtocolNumberTable;
+
+    void addProtocolToTables(int protocolNumber, const Protocol *protocol);
 
   public:
     typedef std::map<int, const Protocol *> Protocols;
@@ -9,6 +9,7 @@
 #define __INET_PTR_H
 
 #include "inet/common/INETDefs.h"
+#include "inet/common/ObjectPool.h"
 
 #define INET_STD_SHARED_PTR        1
 #define INET_INTRUSIVE_PTR         2
@@ -111,6 +112,9 @@ Ptr<T> __checknull(const Ptr<T>& p, const char *expr, const char *file, int line
 template<typename T>
 class INET_API SharedVector : public std::vector<T>, public SharedBase<SharedVector<T>>
 {
+  public:
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
 };
 
 } // namespace inet
@@ -0,0 +1,76 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#include "inet/common/QuantileSketch.h"
+
+#include <cmath>
+
+namespace inet {
+
+// values below this threshold are counted in the zero bucket to keep the
+// logarithmic bucket indices in a sane range
+static const double MIN_TRACKABLE_VALUE = 1E-12;
+
+void QuantileSketch::setRelativeAccuracy(double relativeAccuracy)
+{
+    if (relativeAccuracy <= 0 || relativeAccuracy >= 1)
+        throw cRuntimeError("Invalid relative accuracy %g, it must be in the (0, 1) interval", relativeAccuracy);
+    this->relativeAccuracy = relativeAccuracy;
+    gamma = (1 + relativeAccuracy) / (1 - relativeAccuracy);
+    multiplier = 1 / std::log(gamma);
+    clear();
+}
+
+void QuantileSketch::clear()
+{
+    zeroWeight = 0;
+    totalWeight = 0;
+    minValue = NaN;
+    maxValue = NaN;
+    buckets.clear();
+}
+
+void QuantileSketch::collect(double value, double weight)
+{
+    if (value < 0)
+        throw cRuntimeError("Cannot collect negative value %g", value);
+    if (weight <= 0)
+        return;
+    if (value < MIN_TRACKABLE_VALUE)
+        zeroWeight += weight;
+    else {
+        int index = (int)std::ceil(std::log(value) * multiplier);
+        buckets[index] += weight;
+    }
+    totalWeight += weight;
+    if (std::isnan(minValue) || value < minValue)
+        minValue = value;
+    if (std::isnan(maxValue) || value > maxValue)
+        maxValue = value;
+}
+
+double QuantileSketch::computeQuantile(double q) const
+{
+    ASSERT(0 <= q && q <= 1);
+    if (totalWeight == 0)
+        return NaN;
+    double rank = q * totalWeight;
+    if (rank <= zeroWeight)
+        return 0;
+    double accumulatedWeight = zeroWeight;
+    for (const auto& bucket : buckets) {
+        accumulatedWeight += bucket.second;
+        if (accumulatedWeight >= rank) {
+            // the midpoint of the bucket is within relativeAccuracy of every value in it
+            double value = 2 * std::pow(gamma, bucket.first) / (gamma + 1);
+            return std::min(std::max(value, minValue), maxValue);
+        }
+    }
+    return maxValue;
+}
+
+} // namespace inet
+
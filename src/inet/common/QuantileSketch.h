@@ -0,0 +1,63 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#ifndef __INET_QUANTILESKETCH_H
+#define __INET_QUANTILESKETCH_H
+
+#include <map>
+
+#include "inet/common/INETMath.h"
+
+namespace inet {
+
+/**
+ * Streaming quantile sketch with logarithmically sized buckets (the DDSketch
+ * scheme). Collected values are counted in the bucket whose index is the
+ * logarithm of the value, so any quantile can be answered afterwards with a
+ * bounded relative error using memory that is independent of the number of
+ * collected values. Values may be collected with a weight, which allows
+ * time-weighted distributions (e.g. queue occupancy) to be tracked as well.
+ */
+class INET_API QuantileSketch
+{
+  protected:
+    double relativeAccuracy = 0.01;
+    double gamma = NaN; // bucket boundary growth factor, (1 + relativeAccuracy) / (1 - relativeAccuracy)
+    double multiplier = NaN; // 1 / ln(gamma), converts ln(value) to a bucket index
+    double zeroWeight = 0; // total weight of values too small to be bucketed logarithmically
+    double totalWeight = 0;
+    double minValue = NaN;
+    double maxValue = NaN;
+    std::map<int, double> buckets; // bucket index to total weight
+
+  public:
+    QuantileSketch() { setRelativeAccuracy(relativeAccuracy); }
+
+    /**
+     * Sets the maximum relative error of the computed quantile values and
+     * clears the sketch.
+     */
+    void setRelativeAccuracy(double relativeAccuracy);
+
+    void collect(double value, double weight = 1);
+    void clear();
+
+    bool isEmpty() const { return totalWeight == 0; }
+    double getTotalWeight() const { return totalWeight; }
+    double getMin() const { return minValue; }
+    double getMax() const { return maxValue; }
+
+    /**
+     * Returns the value at the given quantile (0 <= q <= 1) with the
+     * configured relative accuracy, or NaN if the sketch is empty.
+     */
+    double computeQuantile(double q) const;
+};
+
+} // namespace inet
+
+#endif
+
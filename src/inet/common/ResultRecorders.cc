@@ -6,8 +6,12 @@
 
 #include "inet/common/ResultRecorders.h"
 
+#include <cstring>
+#include <iomanip>
 #include <sstream>
 
+#include "inet/common/INETUtils.h"
+
 namespace inet {
 
 Register_ResultRecorder("groupCount", GroupCountRecorder);
@@ -122,5 +126,211 @@ std::string WeightedHistogramRecorder::str() const
     return os.str();
 }
 
+ColumnarVectorFileWriter& ColumnarVectorFileWriter::getInstance()
+{
+    static ColumnarVectorFileWriter instance;
+    return instance;
+}
+
+void ColumnarVectorFileWriter::open()
+{
+    const char *fileName = getActiveSimulationOrEnvir()->getConfig()->substituteVariables("${resultdir}/${configname}-${runnumber}.cvec");
+    inet::utils::makePathForFile(fileName);
+    stream.open(fileName, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open())
+        throw cRuntimeError("Cannot open columnar vector file '%s'", fileName);
+    stream.write("INETCVEC", 8);
+    writeUint32(1); // format version
+    writeUint32((uint32_t)(int32_t)SimTime::getScaleExp());
+}
+
+void ColumnarVectorFileWriter::writeUint32(uint32_t value)
+{
+    stream.write((const char *)&value, sizeof(value));
+}
+
+void ColumnarVectorFileWriter::writeVarint(uint64_t value)
+{
+    while (value >= 0x80) {
+        stream.put((char)(value | 0x80));
+        value >>= 7;
+    }
+    stream.put((char)value);
+}
+
+void ColumnarVectorFileWriter::writeString(const char *s)
+{
+    uint32_t length = strlen(s);
+    writeUint32(length);
+    stream.write(s, length);
+}
+
+uint32_t ColumnarVectorFileWriter::registerVector(const char *modulePath, const char *resultName)
+{
+    if (!stream.is_open())
+        open();
+    uint32_t vectorId = nextVectorId++;
+    stream.put('D');
+    writeUint32(vectorId);
+    writeString(modulePath);
+    writeString(resultName);
+    return vectorId;
+}
+
+void ColumnarVectorFileWriter::writeBlock(uint32_t vectorId, const std::vector<int64_t>& times, const std::vector<double>& values)
+{
+    ASSERT(times.size() == values.size());
+    if (times.empty())
+        return;
+    stream.put('B');
+    writeUint32(vectorId);
+    writeUint32(times.size());
+    int64_t previousTime = 0;
+    for (int64_t time : times) {
+        int64_t delta = time - previousTime;
+        writeVarint(((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63)); // zigzag encoding
+        previousTime = time;
+    }
+    stream.write((const char *)values.data(), values.size() * sizeof(double));
+}
+
+void ColumnarVectorFileWriter::flush()
+{
+    stream.flush();
+}
+
+uint32_t ColumnarVectorFileReader::readUint32()
+{
+    uint32_t value;
+    stream.read((char *)&value, sizeof(value));
+    if (!stream)
+        throw cRuntimeError("Unexpected end of columnar vector file");
+    return value;
+}
+
+uint64_t ColumnarVectorFileReader::readVarint()
+{
+    uint64_t value = 0;
+    int shift = 0;
+    while (true) {
+        int c = stream.get();
+        if (c == EOF)
+            throw cRuntimeError("Unexpected end of columnar vector file");
+        value |= (uint64_t)(c & 0x7f) << shift;
+        if (!(c & 0x80))
+            break;
+        shift += 7;
+    }
+    return value;
+}
+
+std::string ColumnarVectorFileReader::readString()
+{
+    uint32_t length = readUint32();
+    std::string s(length, '\0');
+    stream.read(&s[0], length);
+    if (!stream)
+        throw cRuntimeError("Unexpected end of columnar vector file");
+    return s;
+}
+
+std::string ColumnarVectorFileReader::formatSimtime(int64_t raw) const
+{
+    bool negative = raw < 0;
+    std::string digits = std::to_string(negative ? -raw : raw);
+    if (scaleExponent >= 0)
+        digits += std::string(scaleExponent, '0');
+    else {
+        size_t fractionDigits = -scaleExponent;
+        if (digits.length() <= fractionDigits)
+            digits.insert(0, fractionDigits + 1 - digits.length(), '0');
+        digits.insert(digits.length() - fractionDigits, ".");
+        size_t lastNonZero = digits.find_last_not_of('0');
+        if (digits[lastNonZero] == '.')
+            lastNonZero--;
+        digits.erase(lastNonZero + 1);
+    }
+    return negative ? "-" + digits : digits;
+}
+
+void ColumnarVectorFileReader::convertToVectorFile(const char *columnarFileName, const char *vectorFileName)
+{
+    stream.open(columnarFileName, std::ios::binary);
+    if (!stream.is_open())
+        throw cRuntimeError("Cannot open columnar vector file '%s'", columnarFileName);
+    char magic[8];
+    stream.read(magic, sizeof(magic));
+    if (!stream || strncmp(magic, "INETCVEC", sizeof(magic)))
+        throw cRuntimeError("File '%s' is not a columnar vector file", columnarFileName);
+    uint32_t version = readUint32();
+    if (version != 1)
+        throw cRuntimeError("Unsupported columnar vector file version %u", version);
+    scaleExponent = (int32_t)readUint32();
+    std::ofstream output(vectorFileName, std::ios::trunc);
+    if (!output.is_open())
+        throw cRuntimeError("Cannot open vector file '%s'", vectorFileName);
+    output << std::setprecision(15) << "version 2\n\n";
+    int c;
+    while ((c = stream.get()) != EOF) {
+        if (c == 'D') {
+            uint32_t vectorId = readUint32();
+            std::string modulePath = readString();
+            std::string resultName = readString();
+            output << "vector " << vectorId << " " << modulePath << " \"" << resultName << "\" TV\n";
+        }
+        else if (c == 'B') {
+            uint32_t vectorId = readUint32();
+            uint32_t count = readUint32();
+            std::vector<int64_t> rawTimes(count);
+            int64_t previousTime = 0;
+            for (uint32_t i = 0; i < count; i++) {
+                uint64_t encoded = readVarint();
+                previousTime += (int64_t)(encoded >> 1) ^ -(int64_t)(encoded & 1); // zigzag decoding
+                rawTimes[i] = previousTime;
+            }
+            std::vector<double> values(count);
+            stream.read((char *)values.data(), count * sizeof(double));
+            if (!stream)
+                throw cRuntimeError("Unexpected end of columnar vector file");
+            for (uint32_t i = 0; i < count; i++)
+                output << vectorId << "\t" << formatSimtime(rawTimes[i]) << "\t" << values[i] << "\n";
+        }
+        else
+            throw cRuntimeError("Unknown record type %d in columnar vector file '%s'", c, columnarFileName);
+    }
+    stream.close();
+}
+
+Register_ResultRecorder("columnarVector", ColumnarVectorRecorder);
+
+void ColumnarVectorRecorder::init(Context *ctx)
+{
+    cNumericResultRecorder::init(ctx);
+    vectorId = ColumnarVectorFileWriter::getInstance().registerVector(getComponent()->getFullPath().c_str(), getResultName().c_str());
+    times.reserve(BLOCKSIZE);
+    values.reserve(BLOCKSIZE);
+}
+
+void ColumnarVectorRecorder::collect(simtime_t_cref t, double value, cObject *details)
+{
+    times.push_back(t.raw());
+    values.push_back(value);
+    if (times.size() >= BLOCKSIZE)
+        writeBlock();
+}
+
+void ColumnarVectorRecorder::writeBlock()
+{
+    ColumnarVectorFileWriter::getInstance().writeBlock(vectorId, times, values);
+    times.clear();
+    values.clear();
+}
+
+void ColumnarVectorRecorder::finish(cResultFilter *prev)
+{
+    writeBlock();
+    ColumnarVectorFileWriter::getInstance().flush();
+}
+
 } // namespace inet
 
@@ -0,0 +1,60 @@
+//
+// Copyright (C) 2026 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#ifndef __INET_SIGNALEMISSIONCACHE_H
+#define __INET_SIGNALEMISSIONCACHE_H
+
+#include <algorithm>
+
+#include "inet/common/INETDefs.h"
+
+namespace inet {
+
+/**
+ * Caches which signals of a component had no listeners when the cache was
+ * built, so that per-packet emissions of unlistened signals can be skipped
+ * without walking the listener lists of the component and all its ancestors
+ * on every emission.
+ *
+ * The cache is intended to be built at the end of the initialization phase,
+ * after statistic recorders and visualizers have subscribed. Listeners added
+ * at runtime (e.g. by opening an inspector) are not seen by cached signals
+ * until the cache is rebuilt, which is why users of this class should make
+ * the caching opt-in.
+ */
+class INET_API SignalEmissionCache
+{
+  protected:
+    bool built = false;
+    std::vector<simsignal_t> silentSignals; // signals without listeners at build time
+
+  public:
+    void build(cComponent *component, std::initializer_list<simsignal_t> signals) {
+        silentSignals.clear();
+        for (auto signal : signals)
+            if (!component->hasListeners(signal))
+                silentSignals.push_back(signal);
+        built = true;
+    }
+
+    bool isSilent(simsignal_t signal) const {
+        return built && std::find(silentSignals.begin(), silentSignals.end(), signal) != silentSignals.end();
+    }
+
+    /**
+     * Emits the signal through the component unless it is known to have no
+     * listeners. Before the cache is built all signals pass through.
+     */
+    void emit(cComponent *component, simsignal_t signal, cObject *object, cObject *details = nullptr) const {
+        if (!isSilent(signal))
+            component->emit(signal, object, details);
+    }
+};
+
+} // namespace inet
+
+#endif
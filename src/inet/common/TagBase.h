@@ -9,6 +9,7 @@
 #define __INET_TAGBASE_H
 
 #include "inet/common/IPrintableObject.h"
+#include "inet/common/ObjectPool.h"
 #include "inet/common/Ptr.h"
 #include "inet/common/Units.h"
 
@@ -19,6 +20,9 @@ using namespace inet::units::values;
 class INET_API TagBase : public cObject, public SharedBase<TagBase>, public IPrintableObject
 {
   public:
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual const Ptr<TagBase> dupShared() const { return Ptr<TagBase>(static_cast<TagBase *>(dup())); }
 
     virtual const Ptr<TagBase> changeRegion(b offsetDelta, b lengthDelta) const { return const_cast<TagBase *>(this)->shared_from_this(); }
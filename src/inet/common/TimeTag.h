@@ -16,6 +16,9 @@ namespace inet {
 template<typename T>
 void increaseTimeTag(const Ptr<Chunk>& chunk, simtime_t bitDuration, simtime_t packetDuration)
 {
+    // fast path: chunks not subject to any measurement carry no tags at all
+    if (chunk->getNumTags() == 0)
+        return;
     chunk->mapAllTagsForUpdate<T>(b(0), chunk->getChunkLength(), [&] (b offset, b length, T *timeTag) {
         for (size_t i = 0; i < timeTag->getBitTotalTimesArraySize(); i++)
             timeTag->setBitTotalTimes(i, timeTag->getBitTotalTimes(i) + bitDuration);
@@ -27,6 +30,9 @@ void increaseTimeTag(const Ptr<Chunk>& chunk, simtime_t bitDuration, simtime_t p
 template<typename T>
 void increaseTimeTag(Packet *packet, simtime_t bitDuration, simtime_t packetDuration)
 {
+    // fast path: packets not subject to any measurement carry no region tags at all
+    if (packet->getNumRegionTags() == 0)
+        return;
     packet->mapAllRegionTagsForUpdate<T>(b(0), packet->getTotalLength(), [&] (b offset, b length, const Ptr<T>& timeTag) {
         for (size_t i = 0; i < timeTag->getBitTotalTimesArraySize(); i++)
             timeTag->setBitTotalTimes(i, timeTag->getBitTotalTimes(i) + bitDuration);
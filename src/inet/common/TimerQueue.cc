@@ -0,0 +1,83 @@
+//
+// Copyright (C) 2024 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#include "inet/common/TimerQueue.h"
+
+namespace inet {
+
+TimerQueue::TimerQueue(cSimpleModule *module, ICallback *callback, const char *name) :
+    module(module), callback(callback)
+{
+    sharedEvent = new cMessage(name);
+}
+
+TimerQueue::~TimerQueue()
+{
+    module->cancelAndDelete(sharedEvent);
+}
+
+void TimerQueue::rescheduleSharedEvent()
+{
+    if (sharedEvent->isScheduled())
+        module->cancelEvent(sharedEvent);
+    if (!scheduledTimers.empty())
+        module->scheduleAt(scheduledTimers.begin()->first, sharedEvent);
+}
+
+void TimerQueue::scheduleAt(simtime_t t, cMessage *timer)
+{
+    if (timerPositions.find(timer) != timerPositions.end())
+        throw cRuntimeError("Timer '%s' is already scheduled", timer->getName());
+    if (t < simTime())
+        throw cRuntimeError("Cannot schedule timer '%s' to the past", timer->getName());
+    auto it = scheduledTimers.insert(std::make_pair(t, timer));
+    timerPositions[timer] = it;
+    if (it == scheduledTimers.begin())
+        rescheduleSharedEvent();
+}
+
+void TimerQueue::scheduleAfter(simtime_t delay, cMessage *timer)
+{
+    scheduleAt(simTime() + delay, timer);
+}
+
+cMessage *TimerQueue::cancelEvent(cMessage *timer)
+{
+    auto it = timerPositions.find(timer);
+    if (it != timerPositions.end()) {
+        bool wasFirst = it->second == scheduledTimers.begin();
+        scheduledTimers.erase(it->second);
+        timerPositions.erase(it);
+        if (wasFirst)
+            rescheduleSharedEvent();
+    }
+    return timer;
+}
+
+void TimerQueue::cancelAndDelete(cMessage *timer)
+{
+    if (timer != nullptr)
+        delete cancelEvent(timer);
+}
+
+bool TimerQueue::handleMessage(cMessage *message)
+{
+    if (message != sharedEvent)
+        return false;
+    // dispatch the expired timers one by one, because a callback may schedule
+    // or cancel any of the still queued timers
+    while (!scheduledTimers.empty() && scheduledTimers.begin()->first <= simTime()) {
+        cMessage *timer = scheduledTimers.begin()->second;
+        timerPositions.erase(timer);
+        scheduledTimers.erase(scheduledTimers.begin());
+        callback->handleTimer(timer);
+    }
+    rescheduleSharedEvent();
+    return true;
+}
+
+} // namespace inet
@@ -0,0 +1,85 @@
+//
+// Copyright (C) 2024 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#ifndef __INET_TIMERQUEUE_H
+#define __INET_TIMERQUEUE_H
+
+#include <map>
+
+#include "inet/common/INETDefs.h"
+
+namespace inet {
+
+/**
+ * Multiplexes an arbitrary number of logical timers behind a single message
+ * scheduled into the future event set. Modules that maintain many near-identical
+ * periodic timers (e.g. routing protocol keepalives, one per peer or per
+ * interface) can use this class to keep a single event in the future event set
+ * instead of one per timer, which reduces the size of the simulation's central
+ * event queue in routing-heavy networks.
+ *
+ * The logical timers are ordinary cMessages owned by the user of this class,
+ * but they never enter the future event set themselves: scheduleAt() stores
+ * them in an internal queue ordered by expiry time (FIFO among timers expiring
+ * at the same time), and keeps the single shared message scheduled at the
+ * earliest expiry. The owning module must pass the messages it receives to
+ * handleMessage(), which dispatches the expired logical timers to the callback.
+ * Since expired timers are delivered by direct callback, their cMessage arrival
+ * fields are not updated, and a timer must not be scheduled both through this
+ * class and directly into the future event set.
+ *
+ * Note that multiplexing changes how the module's timers are ordered relative
+ * to other events scheduled for the same simulation time, so simulations using
+ * it are not expected to be fingerprint-compatible with ones that are not.
+ */
+class INET_API TimerQueue
+{
+  public:
+    class INET_API ICallback {
+      public:
+        virtual ~ICallback() {}
+
+        /**
+         * Called when a logical timer expires. The timer is no longer queued
+         * when this method is called, so the callback is free to reschedule,
+         * reuse or delete it.
+         */
+        virtual void handleTimer(cMessage *timer) = 0;
+    };
+
+  protected:
+    cSimpleModule *module = nullptr; // the module that owns the timers and schedules the shared event
+    ICallback *callback = nullptr; // expired logical timers are dispatched to this callback
+    cMessage *sharedEvent = nullptr; // the only message this class puts into the future event set
+    std::multimap<simtime_t, cMessage *> scheduledTimers; // the logical timers ordered by expiry time, FIFO among equal times
+    std::map<cMessage *, std::multimap<simtime_t, cMessage *>::iterator> timerPositions; // the queue position of each scheduled timer
+
+  protected:
+    virtual void rescheduleSharedEvent();
+
+  public:
+    TimerQueue(cSimpleModule *module, ICallback *callback, const char *name);
+    virtual ~TimerQueue();
+
+    virtual bool isScheduled(cMessage *timer) const { return timerPositions.find(timer) != timerPositions.end(); }
+
+    virtual void scheduleAt(simtime_t t, cMessage *timer);
+    virtual void scheduleAfter(simtime_t delay, cMessage *timer);
+    virtual cMessage *cancelEvent(cMessage *timer);
+    virtual void cancelAndDelete(cMessage *timer);
+
+    /**
+     * Dispatches the expired logical timers if the given message is the shared
+     * event of this queue, otherwise returns false. The owning module must call
+     * this from handleMessage() before its own self-message processing.
+     */
+    virtual bool handleMessage(cMessage *message);
+};
+
+} // namespace inet
+
+#endif
@@ -13,7 +13,7 @@
 
 #include <algorithm>
 #include <deque>
-#include <list>
+#include <queue>
 #include <sstream>
 
 #include "inet/common/PatternMatcher.h"
@@ -424,11 +424,25 @@ void Topology::calculateWeightedSingleShortestPaths(Node *initial, bool to) cons
     }
     initial->dist = 0;
 
-    std::list<Node *> q;
-    q.push_back(initial);
+    // binary heap of (distance, insertion order, node) entries; the insertion
+    // order makes nodes of equal distance come out in FIFO order, exactly as
+    // from the ordered list this function used before, but extraction and
+    // decrease-key take O(log n) instead of O(n)
+    struct QueueEntry {
+        double dist;
+        int seq;
+        Node *node;
+        bool operator>(const QueueEntry& other) const { return dist != other.dist ? dist > other.dist : seq > other.seq; }
+    };
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> q;
+    int seq = 0;
+    q.push({ 0.0, seq++, initial });
     while (!q.empty()) {
-        Node *current = q.front();
-        q.pop_front();
+        Node *current = q.top().node;
+        double currentDist = q.top().dist;
+        q.pop();
+        if (currentDist != current->dist)
+            continue; // stale entry, the node has been re-queued with a shorter distance since
         ASSERT(current->getWeight() >= 0.0);
 
         // for each w adjacent to v...
@@ -449,20 +463,14 @@ void Topology::calculateWeightedSingleShortestPaths(Node *initial, bool to) cons
             if (current != initial)
                 newdist += current->getWeight(); // current is not the target, uses weight of current node as price of routing (infinity means current node doesn't route between interfaces)
             if (newdist != INFINITY && remote->dist > newdist) { // it's a valid shorter path from remote to target node
-                if (remote->dist != INFINITY)
-                    q.remove(remote); // remote is in the queue
                 remote->dist = newdist;
                 // the first one will be the shortest
                 remote->outPaths.erase(std::remove(remote->outPaths.begin(), remote->outPaths.end(), to ? current->inLinks[i] : current->outLinks[i]), remote->outPaths.end());
                 remote->outPaths.insert(remote->outPaths.begin(), to ? current->inLinks[i] : current->outLinks[i]);
 
-                // insert remote node to ordered list
-                auto it = q.begin();
-                for (; it != q.end(); ++it)
-                    if ((*it)->dist > newdist)
-                        break;
-
-                q.insert(it, remote);
+                // any previously queued entry for remote is left in the heap
+                // and recognized as stale when popped
+                q.push({ newdist, seq++, remote });
             }
             else if (!contains(remote->outPaths, to ? current->inLinks[i] : current->outLinks[i]))
                 (to ? remote : current)->outPaths.push_back(to ? current->inLinks[i] : current->outLinks[i]);
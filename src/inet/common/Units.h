@@ -84,16 +84,16 @@ class value
     typedef Value value_type;
     typedef Units unit;
 
-    value() : m_rep()
+    constexpr value() : m_rep()
     {
     }
 
-    explicit value(const value_type& v) : m_rep(v)
+    constexpr explicit value(const value_type& v) : m_rep(v)
     {
     }
 
     template<typename OtherValue, typename OtherUnits>
-    value(const value<OtherValue, OtherUnits>& v) :
+    constexpr value(const value<OtherValue, OtherUnits>& v) :
         m_rep(internal::convert<OtherUnits, Units>::fn(v.get()))
     {
     }
@@ -105,147 +105,147 @@ class value
         return ss.str();
     }
 
-    const value_type& get() const
+    constexpr const value_type& get() const
     {
         return m_rep;
     }
 
-    void set(const value_type& v)
+    constexpr void set(const value_type& v)
     {
         m_rep = v;
     }
 
     template<typename OtherValue, typename OtherUnits>
-    value& operator=(const value<OtherValue, OtherUnits>& other)
+    constexpr value& operator=(const value<OtherValue, OtherUnits>& other)
     {
         m_rep = value(other).get();
         return *this;
     }
 
     template<typename OtherValue, typename OtherUnits, typename ResultValue = typename std::remove_cv<decltype(Value() + OtherValue())>::type>
-    value<ResultValue, Units> operator+(const value<OtherValue, OtherUnits>& other) const
+    constexpr value<ResultValue, Units> operator+(const value<OtherValue, OtherUnits>& other) const
     {
         return value<ResultValue, Units>(get() + value<OtherValue, Units>(other).get());
     }
 
     template<typename OtherValue, typename OtherUnits>
-    value& operator+=(const value<OtherValue, OtherUnits>& other)
+    constexpr value& operator+=(const value<OtherValue, OtherUnits>& other)
     {
         m_rep += value(other).get();
         return *this;
     }
 
     template<typename OtherValue, typename OtherUnits>
-    value& operator-=(const value<OtherValue, OtherUnits>& other)
+    constexpr value& operator-=(const value<OtherValue, OtherUnits>& other)
     {
         m_rep -= value(other).get();
         return *this;
     }
 
     template<typename OtherValue, typename OtherUnits, typename ResultValue = typename std::remove_cv<decltype(Value() - OtherValue())>::type>
-    value<ResultValue, Units> operator-(const value<OtherValue, OtherUnits>& other) const
+    constexpr value<ResultValue, Units> operator-(const value<OtherValue, OtherUnits>& other) const
     {
         return value<ResultValue, Units>(get() - value<OtherValue, Units>(other).get());
     }
 
-    value operator-() const
+    constexpr value operator-() const
     {
         return value(-get());
     }
 
     template<typename OtherValue, typename OtherUnits, typename ResultValue = typename std::remove_cv<decltype(Value() * OtherValue())>::type>
-    value<ResultValue, compose<Units, OtherUnits>>
+    constexpr value<ResultValue, compose<Units, OtherUnits>>
     operator*(const value<OtherValue, OtherUnits>& other) const
     {
         return value<ResultValue, compose<Units, OtherUnits>>(get() * other.get());
     }
 
     template<typename OtherValue>
-    value operator*(OtherValue v) const
+    constexpr value operator*(OtherValue v) const
     {
         return value(get() * v);
     }
 
-    value& operator*=(const value_type& v)
+    constexpr value& operator*=(const value_type& v)
     {
         m_rep *= v;
         return *this;
     }
 
     template<typename OtherValue, typename OtherUnits, typename ResultValue = typename std::remove_cv<decltype(Value() / OtherValue())>::type>
-    value<ResultValue, compose<Units, pow<OtherUnits, -1>>>
+    constexpr value<ResultValue, compose<Units, pow<OtherUnits, -1>>>
     operator/(const value<OtherValue, OtherUnits>& other) const
     {
         return value<ResultValue, compose<Units, pow<OtherUnits, -1>>>(get() / other.get());
     }
 
-    value operator/(const value_type& v) const
+    constexpr value operator/(const value_type& v) const
     {
         return value(get() / v);
     }
 
-    value& operator/=(const value_type& v)
+    constexpr value& operator/=(const value_type& v)
     {
         m_rep /= v;
         return *this;
     }
 
     template<typename OtherValue, typename OtherUnits>
-    bool operator==(const value<OtherValue, OtherUnits>& other) const
+    constexpr bool operator==(const value<OtherValue, OtherUnits>& other) const
     {
         return get() == value(other).get();
     }
 
     template<typename OtherValue, typename OtherUnits>
-    bool operator!=(const value<OtherValue, OtherUnits>& other) const
+    constexpr bool operator!=(const value<OtherValue, OtherUnits>& other) const
     {
         return get() != value(other).get();
     }
 
     template<typename OtherValue, typename OtherUnits>
-    bool operator<(const value<OtherValue, OtherUnits>& other) const
+    constexpr bool operator<(const value<OtherValue, OtherUnits>& other) const
     {
         return get() < value(other).get();
     }
 
     template<typename OtherValue, typename OtherUnits>
-    bool operator<=(const value<OtherValue, OtherUnits>& other) const
+    constexpr bool operator<=(const value<OtherValue, OtherUnits>& other) const
     {
         return get() <= value(other).get();
     }
 
     template<typename OtherValue, typename OtherUnits>
-    bool operator>(const value<OtherValue, OtherUnits>& other) const
+    constexpr bool operator>(const value<OtherValue, OtherUnits>& other) const
     {
         return get() > value(other).get();
     }
 
     template<typename OtherValue, typename OtherUnits>
-    bool operator>=(const value<OtherValue, OtherUnits>& other) const
+    constexpr bool operator>=(const value<OtherValue, OtherUnits>& other) const
     {
         return get() >= value(other).get();
     }
 
-    value& operator++()
+    constexpr value& operator++()
     {
         ++m_rep;
         return *this;
     }
 
-    value operator++(int)
+    constexpr value operator++(int)
     {
         value v = *this;
         ++m_rep;
         return v;
     }
 
-    value& operator--()
+    constexpr value& operator--()
     {
         --m_rep;
         return *this;
     }
 
-    value operator--(int)
+    constexpr value operator--(int)
     {
         value v = *this;
         --m_rep;
@@ -257,13 +257,13 @@ class value
 };
 
 template<typename Value, typename Unit>
-value<Value, pow<Unit, -1>> operator/(const Value& a, const value<Value, Unit>& b)
+constexpr value<Value, pow<Unit, -1>> operator/(const Value& a, const value<Value, Unit>& b)
 {
     return value<Value, pow<Unit, -1>>(a / b.get());
 }
 
 template<typename Value, typename Unit>
-value<Value, Unit> operator*(const Value& a, const value<Value, Unit>& b)
+constexpr value<Value, Unit> operator*(const Value& a, const value<Value, Unit>& b)
 {
     return value<Value, Unit>(a * b.get());
 }
@@ -275,7 +275,7 @@ value<Value, pow<Unit, 1, 2>> sqrt(const value<Value, Unit>& a)
 }
 
 template<int Num, int Den, typename Value, typename Unit>
-value<Value, pow<Unit, Num, Den>> raise(const value<Value, Unit>& a)
+constexpr value<Value, pow<Unit, Num, Den>> raise(const value<Value, Unit>& a)
 {
     return value<Value, pow<Unit, Num, Den>>(internal::fixed_power<Num, Den>::pow(a.get()));
 }
@@ -325,7 +325,7 @@ struct convert3
     // The default implementation assumes that the two quantities are in compatible
     // units up to some scaling factor.  Find the scaling factor and apply it.
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         return v * scaling_factor<T2>::template fn<V>() / scaling_factor<T1>::template fn<V>();
     }
@@ -338,7 +338,7 @@ template<typename T1, typename T2>
 struct convert2
 {
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         return convert3<T1, T2>::fn(v);
     }
@@ -355,7 +355,7 @@ struct convert
     legacy_static_assert<convertible<T1, T2>::value> check_convertible;
 
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         return convert2<T1, T2>::fn(v);
     }
@@ -367,7 +367,7 @@ template<typename T>
 struct convert<T, T>
 {
     template<typename U>
-    static const U& fn(const U& u) { return u; }
+    static constexpr const U& fn(const U& u) { return u; }
 };
 
 // Convert to same type.
@@ -375,7 +375,7 @@ template<typename T>
 struct convert3<T, T>
 {
     template<typename U>
-    static const U& fn(const U& u) { return u; }
+    static constexpr const U& fn(const U& u) { return u; }
 };
 
 // Convert from a scaled unit
@@ -383,7 +383,7 @@ template<typename T, typename U, int Num, int Den>
 struct convert2<scale<T, Num, Den>, U>
 {
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         return convert<T, U>::fn((v * Den) / Num);
     }
@@ -394,7 +394,7 @@ template<typename T, typename U, int Num, int Den>
 struct convert3<T, scale<U, Num, Den>>
 {
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         return (convert<T, U>::fn(v) * Num) / Den;
     }
@@ -405,7 +405,7 @@ template<typename T, typename U, double F()>
 struct convert2<fscale<T, F>, U>
 {
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         auto t = v / F();
         return convert<T, U>::fn(t);
@@ -417,7 +417,7 @@ template<typename T, typename U, double F()>
 struct convert3<T, fscale<U, F>>
 {
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         auto t = convert<T, U>::fn(v);
         return t * F();
@@ -429,7 +429,7 @@ template<typename T, typename U, int Num, int Den>
 struct convert2<intscale<T, Num, Den>, U>
 {
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         auto t = v * Den;
         if (t % Num != 0)
@@ -443,7 +443,7 @@ template<typename T, typename U, int Num, int Den>
 struct convert3<T, intscale<U, Num, Den>>
 {
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         auto t = convert<T, U>::fn(v) * Num;
         if (t % Den != 0)
@@ -457,7 +457,7 @@ template<typename T, typename U, int Num, int Den>
 struct convert2<translate<T, Num, Den>, U>
 {
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         return convert<T, U>::fn(v - static_cast<V>(Num) / static_cast<V>(Den));
     }
@@ -468,7 +468,7 @@ template<typename T, typename U, int Num, int Den>
 struct convert3<T, translate<U, Num, Den>>
 {
     template<typename V>
-    static V fn(const V& v)
+    static constexpr V fn(const V& v)
     {
         return convert<T, U>::fn(v) + static_cast<V>(Num) / static_cast<V>(Den);
     }
@@ -616,7 +616,7 @@ struct convertible
 template<int Num, int Den, int Div, int Mod>
 struct fixed_power
 {
-    template<typename T> static T pow(const T& t)
+    template<typename T> static constexpr T pow(const T& t)
     {
         return std::pow(t, static_cast<T>(Num) / static_cast<T>(Den));
     }
@@ -625,7 +625,7 @@ struct fixed_power
 template<int N, int D>
 struct fixed_power<N, D, 1, 0>
 {
-    template<typename T> static const T& pow(const T& t)
+    template<typename T> static constexpr const T& pow(const T& t)
     {
         return t;
     }
@@ -634,7 +634,7 @@ struct fixed_power<N, D, 1, 0>
 template<int N, int D>
 struct fixed_power<N, D, 2, 0>
 {
-    template<typename T> static T pow(const T& t)
+    template<typename T> static constexpr T pow(const T& t)
     {
         return t * t;
     }
@@ -643,7 +643,7 @@ struct fixed_power<N, D, 2, 0>
 template<int N, int D>
 struct fixed_power<N, D, 3, 0>
 {
-    template<typename T> static T pow(const T& t)
+    template<typename T> static constexpr T pow(const T& t)
     {
         return t * t * t;
     }
@@ -652,7 +652,7 @@ struct fixed_power<N, D, 3, 0>
 template<int N, int D>
 struct fixed_power<N, D, 4, 0>
 {
-    template<typename T> static const T& pow(const T& t)
+    template<typename T> static constexpr const T& pow(const T& t)
     {
         T u = t * t;
         return u * u;
@@ -662,7 +662,7 @@ struct fixed_power<N, D, 4, 0>
 template<int N, int D>
 struct fixed_power<N, D, -1, 0>
 {
-    template<typename T> static T pow(const T& t)
+    template<typename T> static constexpr T pow(const T& t)
     {
         return 1 / t;
     }
@@ -671,7 +671,7 @@ struct fixed_power<N, D, -1, 0>
 template<int N, int D>
 struct fixed_power<N, D, -2, 0>
 {
-    template<typename T> static T pow(const T& t)
+    template<typename T> static constexpr T pow(const T& t)
     {
         return 1 / (t * t);
     }
@@ -680,7 +680,7 @@ struct fixed_power<N, D, -2, 0>
 template<int N, int D>
 struct fixed_power<N, D, 0, 0>
 {
-    template<typename T> static T pow(const T& t)
+    template<typename T> static constexpr T pow(const T& t)
     {
         return 1;
     }
@@ -692,14 +692,14 @@ template<typename U>
 struct scaling_factor
 {
     template<typename T>
-    static T fn() { return 1; }
+    static constexpr T fn() { return 1; }
 };
 
 template<typename U1, typename U2>
 struct scaling_factor<compose<U1, U2>>
 {
     template<typename T>
-    static T fn()
+    static constexpr T fn()
     {
         return scaling_factor<U1>::template fn<T>()
                * scaling_factor<U2>::template fn<T>();
@@ -710,7 +710,7 @@ template<typename U, int N, int D>
 struct scaling_factor<scale<U, N, D>>
 {
     template<typename T>
-    static T fn()
+    static constexpr T fn()
     {
         return scaling_factor<U>::template fn<T>()
                * static_cast<T>(N) / static_cast<T>(D);
@@ -721,7 +721,7 @@ template<typename U, double F()>
 struct scaling_factor<fscale<U, F>>
 {
     template<typename T>
-    static T fn()
+    static constexpr T fn()
     {
         return scaling_factor<U>::template fn<T>() * F();
     }
@@ -731,7 +731,7 @@ template<typename U, int N, int D>
 struct scaling_factor<intscale<U, N, D>>
 {
     template<typename T>
-    static T fn()
+    static constexpr T fn()
     {
         auto t = scaling_factor<U>::template fn<T>() * static_cast<T>(N);
         if (t % static_cast<T>(D) != 0)
@@ -744,7 +744,7 @@ template<typename U, int N, int D>
 struct scaling_factor<pow<U, N, D>>
 {
     template<typename T>
-    static T fn()
+    static constexpr T fn()
     {
         return fixed_power<N, D>::pow(scaling_factor<U>::template fn<T>());
     }
@@ -754,7 +754,7 @@ template<typename U, int N, int D>
 struct scaling_factor<translate<U, N, D>>
 {
     template<typename T>
-    static T fn()
+    static constexpr T fn()
     {
         return scaling_factor<U>::template fn<T>();
     }
@@ -55,11 +55,50 @@ const uint32_t crc32_tab[] = {
     0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
 };
 
+namespace {
+
+/**
+ * Extended lookup tables for the slicing-by-8 CRC32 algorithm, derived from
+ * crc32_tab on first use. Processing 8 input bytes per iteration with 8
+ * independent table lookups breaks the byte-at-a-time dependency chain and
+ * speeds up FCS computation several times over on frame-sized buffers.
+ */
+struct Crc32SlicingTables
+{
+    uint32_t tab[8][256];
+
+    Crc32SlicingTables()
+    {
+        for (int i = 0; i < 256; i++) {
+            uint32_t crc = crc32_tab[i];
+            tab[0][i] = crc;
+            for (int k = 1; k < 8; k++) {
+                crc = crc32_tab[crc & 0xFF] ^ (crc >> 8);
+                tab[k][i] = crc;
+            }
+        }
+    }
+};
+
+} // namespace
+
 uint32_t ethernetCRC(const unsigned char *buf, unsigned int bufsize, uint32_t crc)
 {
+    static const Crc32SlicingTables tables;
     const uint8_t *p = buf;
     crc = (crc >> 24) | ((crc >> 8) & 0x0000FF00) | ((crc << 8) & 0x00FF0000) | (crc << 24);
     crc = crc ^ ~0U;
+    while (bufsize >= 8) {
+        uint32_t low = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+        uint32_t high = p[4] | (p[5] << 8) | (p[6] << 16) | ((uint32_t)p[7] << 24);
+        crc ^= low;
+        crc = tables.tab[7][crc & 0xFF] ^ tables.tab[6][(crc >> 8) & 0xFF] ^
+              tables.tab[5][(crc >> 16) & 0xFF] ^ tables.tab[4][crc >> 24] ^
+              tables.tab[3][high & 0xFF] ^ tables.tab[2][(high >> 8) & 0xFF] ^
+              tables.tab[1][(high >> 16) & 0xFF] ^ tables.tab[0][high >> 24];
+        p += 8;
+        bufsize -= 8;
+    }
     while (bufsize--)
         crc = crc32_tab[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
     crc = crc ^ ~0U;
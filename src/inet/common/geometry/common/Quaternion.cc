@@ -125,10 +125,11 @@ void Quaternion::getRotationAxisAndAngle(Coord& axis, double& angle) const
 
 Coord Quaternion::rotate(const Coord& v) const
 {
-    Quaternion V(0, v);
-    Quaternion conjugate(*this);
-    conjugate.conjugate();
-    return (*this * V * conjugate).v;
+    // for a unit quaternion (s, u) the product q * (0, v) * q' expands to
+    // v + 2s * (u x v) + 2 * (u x (u x v)), which takes about half as many
+    // multiplications as the two full quaternion products
+    Coord t = (this->v % v) * 2;
+    return v + t * s + this->v % t;
 }
 
 EulerAngles Quaternion::toEulerAngles(bool homogenous) const
@@ -10,8 +10,6 @@
 #include <algorithm>
 #include <limits>
 
-#include "inet/common/geometry/shape/Cuboid.h"
-
 namespace inet {
 
 using namespace physicalenvironment;
@@ -35,8 +33,10 @@ BvhTree::BvhTree(const Coord& boundingMin, const Coord& boundingMax, std::vector
 void BvhTree::buildHierarchy(std::vector<const IPhysicalObject *>& objects, unsigned int start, unsigned int end, Axis axis)
 {
     if (end - start + 1 <= leafCapacity) {
-        for (unsigned int i = start; i <= end; i++)
+        for (unsigned int i = start; i <= end; i++) {
             this->objects.push_back(objects[i]);
+            this->objectRepresentations.push_back(dynamic_cast<const cObject *>(objects[i]));
+        }
     }
     else {
         auto s = objects.begin();
@@ -87,28 +87,66 @@ void BvhTree::computeBoundingBox(Coord& boundingMin, Coord& boundingMax, std::ve
 
 bool BvhTree::intersectWithLineSegment(const LineSegment& lineSegment) const
 {
-    Coord size = Coord(boundingMax.x - boundingMin.x, boundingMax.y - boundingMin.y, boundingMax.z - boundingMin.z);
-    Coord p0 = lineSegment.getPoint1() - center;
-    Coord p1 = lineSegment.getPoint2() - center;
-    Cuboid cuboid(size);
-    LineSegment translatedLineSegment(p0, p1);
-    Coord intersection1, intersection2, normal1, normal2; // TODO implement a bool computeIntersection(lineSegment) function
-    return cuboid.computeIntersection(translatedLineSegment, intersection1, intersection2, normal1, normal2);
+    // slab test against the axis-aligned bounding box; unlike going through
+    // Cuboid::computeIntersection it computes neither the intersection points
+    // nor the normal vectors, and it does not construct temporary objects
+    const Coord& p0 = lineSegment.getPoint1();
+    const Coord& p1 = lineSegment.getPoint2();
+    double points0[3] = { p0.x, p0.y, p0.z };
+    double points1[3] = { p1.x, p1.y, p1.z };
+    double mins[3] = { boundingMin.x, boundingMin.y, boundingMin.z };
+    double maxs[3] = { boundingMax.x, boundingMax.y, boundingMax.z };
+    double tMin = 0;
+    double tMax = 1;
+    for (int i = 0; i < 3; i++) {
+        double direction = points1[i] - points0[i];
+        if (direction == 0) {
+            if (points0[i] < mins[i] || points0[i] > maxs[i])
+                return false;
+        }
+        else {
+            double t1 = (mins[i] - points0[i]) / direction;
+            double t2 = (maxs[i] - points0[i]) / direction;
+            if (t1 > t2)
+                std::swap(t1, t2);
+            if (t1 > tMin)
+                tMin = t1;
+            if (t2 < tMax)
+                tMax = t2;
+            if (tMin > tMax)
+                return false;
+        }
+    }
+    return true;
 }
 
 void BvhTree::lineSegmentQuery(const LineSegment& lineSegment, const IVisitor *visitor) const
 {
+    if (!intersectWithLineSegment(lineSegment))
+        return;
     if (isLeaf()) {
-        for (auto& elem : objects)
-            // TODO avoid dynamic_cast
-            visitor->visit(dynamic_cast<const cObject *>(elem));
+        for (auto& elem : objectRepresentations)
+            visitor->visit(elem);
     }
-    else if (intersectWithLineSegment(lineSegment)) {
+    else {
         left->lineSegmentQuery(lineSegment, visitor);
         right->lineSegmentQuery(lineSegment, visitor);
     }
 }
 
+void BvhTree::refit()
+{
+    if (isLeaf())
+        computeBoundingBox(boundingMin, boundingMax, objects, 0, objects.size() - 1);
+    else {
+        left->refit();
+        right->refit();
+        boundingMin = Coord(std::min(left->boundingMin.x, right->boundingMin.x), std::min(left->boundingMin.y, right->boundingMin.y), std::min(left->boundingMin.z, right->boundingMin.z));
+        boundingMax = Coord(std::max(left->boundingMax.x, right->boundingMax.x), std::max(left->boundingMax.y, right->boundingMax.y), std::max(left->boundingMax.z, right->boundingMax.z));
+    }
+    center = (boundingMax - boundingMin) / 2 + boundingMin;
+}
+
 BvhTree::~BvhTree()
 {
     delete left;
@@ -74,6 +74,7 @@ class INET_API BvhTree
     BvhTree *left;
     BvhTree *right;
     std::vector<const physicalenvironment::IPhysicalObject *> objects;
+    std::vector<const cObject *> objectRepresentations; // the leaf objects as cObject pointers, cast once at build time
 
   protected:
     bool isLeaf() const;
@@ -84,7 +85,21 @@ class INET_API BvhTree
   public:
     BvhTree(const Coord& boundingMin, const Coord& boundingMax, std::vector<const physicalenvironment::IPhysicalObject *>& objects, unsigned int start, unsigned int end, Axis axis, unsigned int leafCapacity);
     virtual ~BvhTree();
+
+    /**
+     * Visits the objects whose bounding volumes intersect the line segment.
+     * The query is read-only and allocation-free, so once the tree is built
+     * it can be issued concurrently from multiple threads.
+     */
     void lineSegmentQuery(const LineSegment& lineSegment, const IVisitor *visitor) const;
+
+    /**
+     * Recomputes the bounding volumes bottom-up from the current object
+     * positions without changing the topology of the hierarchy. Much cheaper
+     * than a rebuild when only a few objects moved; the tree quality degrades
+     * gracefully as the bounding volumes grow.
+     */
+    void refit();
 };
 
 } /* namespace inet */
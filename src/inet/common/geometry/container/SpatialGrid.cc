@@ -65,17 +65,34 @@ bool SpatialGrid::insertPoint(const cObject *point, const Coord& pos)
         return false;
     }
     grid[ind].push_back(point);
+    pointVoxelIndices[point] = ind;
     return true;
 }
 
 bool SpatialGrid::removePoint(const cObject *point)
 {
-    throw cRuntimeError("Unimplemented");
+    auto it = pointVoxelIndices.find(point);
+    if (it == pointVoxelIndices.end())
+        return false;
+    grid[it->second].remove(point);
+    pointVoxelIndices.erase(it);
+    return true;
 }
 
 bool SpatialGrid::movePoint(const cObject *point, const Coord& newPos)
 {
-    throw cRuntimeError("Unimplemented");
+    auto it = pointVoxelIndices.find(point);
+    if (it == pointVoxelIndices.end())
+        return false;
+    unsigned int newInd = coordToRowMajorIndex(newPos);
+    if (newInd >= gridVectorLength)
+        throw cRuntimeError("Out of range with index: %d", newInd);
+    if (newInd != it->second) {
+        grid[it->second].remove(point);
+        grid[newInd].push_back(point);
+        it->second = newInd;
+    }
+    return true;
 }
 
 void SpatialGrid::rangeQuery(const Coord& pos, double range, const IVisitor *visitor) const
@@ -171,6 +188,7 @@ void SpatialGrid::clearGrid()
 {
     for (unsigned int i = 0; i < gridVectorLength; i++)
         grid[i].clear();
+    pointVoxelIndices.clear();
 }
 
 SpatialGrid::Triplet<int> SpatialGrid::coordToMatrixIndices(const Coord& pos) const
@@ -81,6 +81,7 @@ class INET_API SpatialGrid
 
   protected:
     Grid grid;
+    std::map<const cObject *, unsigned int> pointVoxelIndices; // maps points inserted with insertPoint() to their voxel index
     unsigned int gridVectorLength;
     Triplet<double> voxelSizes;
     Coord constraintAreaSideLengths;
@@ -49,16 +49,29 @@ bool LifecycleController::initiateOperation(LifecycleOperation *operation, IDone
     operation->currentStage = 0;
     operation->operationCompletionCallback = completionCallback;
     operation->insideInitiateOperation = true;
+    // collect the participating modules once, instead of traversing the whole
+    // module tree and testing each module for ILifecycle in every stage
+    collectParticipants(operation, operation->rootModule);
     return resumeOperation(operation);
 }
 
+void LifecycleController::collectParticipants(LifecycleOperation *operation, cModule *submodule)
+{
+    ILifecycle *subject = dynamic_cast<ILifecycle *>(submodule);
+    if (subject)
+        operation->participants.push_back(std::make_pair(submodule, subject));
+
+    for (cModule::SubmoduleIterator i(submodule); !i.end(); i++)
+        collectParticipants(operation, *i);
+}
+
 bool LifecycleController::resumeOperation(LifecycleOperation *operation)
 {
     int numStages = operation->getNumStages();
     while (operation->currentStage < numStages) {
         EV << "Doing stage " << operation->currentStage << "/" << operation->getNumStages()
            << " of operation " << operation->getClassName() << " on " << operation->rootModule->getFullPath() << endl;
-        doOneStage(operation, operation->rootModule);
+        doOneStage(operation);
         if (operation->pendingList.empty())
             operation->currentStage++;
         else
@@ -72,25 +85,19 @@ bool LifecycleController::resumeOperation(LifecycleOperation *operation)
     return true; // done
 }
 
-void LifecycleController::doOneStage(LifecycleOperation *operation, cModule *submodule)
+void LifecycleController::doOneStage(LifecycleOperation *operation)
 {
-    ILifecycle *subject = dynamic_cast<ILifecycle *>(submodule);
-    if (subject) {
+    for (auto& participant : operation->participants) {
         Callback *callback = spareCallback ? spareCallback : new Callback();
-        bool done = subject->handleOperationStage(operation, callback);
+        bool done = participant.second->handleOperationStage(operation, callback);
         if (!done) {
-            callback->init(this, operation, submodule);
+            callback->init(this, operation, participant.first);
             operation->pendingList.push_back(callback);
             spareCallback = nullptr;
         }
         else
             spareCallback = callback;
     }
-
-    for (cModule::SubmoduleIterator i(submodule); !i.end(); i++) {
-        cModule *child = *i;
-        doOneStage(operation, child);
-    }
 }
 
 void LifecycleController::moduleOperationStageCompleted(Callback *callback)
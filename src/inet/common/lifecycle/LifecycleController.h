@@ -67,7 +67,8 @@ class INET_API LifecycleController
 
   protected:
     virtual bool resumeOperation(LifecycleOperation *operation);
-    virtual void doOneStage(LifecycleOperation *operation, cModule *submodule);
+    virtual void collectParticipants(LifecycleOperation *operation, cModule *submodule);
+    virtual void doOneStage(LifecycleOperation *operation);
     virtual void moduleOperationStageCompleted(Callback *callback); // invoked from the callback
 
   public:
@@ -12,6 +12,7 @@
 
 namespace inet {
 
+class ILifecycle;
 class LifecycleController;
 class IDoneCallback;
 
@@ -30,6 +31,7 @@ class INET_API LifecycleOperation : public cObject, public noncopyable
   private:
     cModule *rootModule = nullptr;
     int currentStage = 0;
+    std::vector<std::pair<cModule *, ILifecycle *>> participants; // the ILifecycle modules under rootModule, collected once when the operation is initiated and reused for all stages
     std::vector<IDoneCallback *> pendingList;
     bool insideInitiateOperation = false;
     IDoneCallback *operationCompletionCallback = nullptr;
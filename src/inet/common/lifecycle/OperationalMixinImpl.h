@@ -8,6 +8,7 @@
 #ifndef __INET_OPERATIONALMIXINIMPL_H
 #define __INET_OPERATIONALMIXINIMPL_H
 
+#include "inet/common/HotPathProfiler.h"
 #include "inet/common/ModuleAccess.h"
 #include "inet/common/lifecycle/ModuleOperations.h"
 #include "inet/common/lifecycle/NodeStatus.h"
@@ -44,6 +45,7 @@ void OperationalMixin<T>::initialize(int stage)
 template<typename T>
 void OperationalMixin<T>::handleMessage(cMessage *message)
 {
+    HotPathProfiler::Measurement measurement(this);
     if (message == activeOperationExtraTimer)
         finishActiveOperation();
     else if (message == activeOperationTimeout) {
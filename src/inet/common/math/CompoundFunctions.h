@@ -639,6 +639,182 @@ class INET_API Rasterized2DFunction : public FunctionBase<R, Domain<X, Y>>
     }
 };
 
+/**
+ * Eagerly samples a function into a grid of constant valued cells stored in a
+ * contiguous array. Each cell holds the mean of the original function over the
+ * cell, computed once at construction time; afterwards the original function
+ * is no longer referenced, so evaluation doesn't recurse into it. Algebraic
+ * operations between two functions sampled over the same grid are carried out
+ * as tight loops over the value arrays.
+ */
+template<typename R, typename X, typename Y>
+class INET_API Sampled2DFunction : public FunctionBase<R, Domain<X, Y>>
+{
+  protected:
+    const X startX;
+    const X endX;
+    const X stepX;
+    int sizeX; // number of cells along the X axis
+    const Y startY;
+    const Y endY;
+    const Y stepY;
+    int sizeY; // number of cells along the Y axis
+    std::vector<R> values; // row-major cell values
+
+  protected:
+    void call(const Interval<X, Y>& i, const std::function<void(const Interval<X, Y>&, const IFunction<R, Domain<X, Y>> *)> callback) const {
+        if (!i.isEmpty()) {
+            ConstantFunction<R, Domain<X, Y>> g(R(0));
+            callback(i, &g);
+        }
+    }
+
+    bool hasSameGrid(const Sampled2DFunction<R, X, Y>& o) const {
+        return startX == o.startX && endX == o.endX && sizeX == o.sizeX &&
+               startY == o.startY && endY == o.endY && sizeY == o.sizeY;
+    }
+
+    template<typename RO>
+    bool hasSameGrid(const Sampled2DFunction<RO, X, Y>& o) const {
+        return startX == o.getStartX() && endX == o.getEndX() && sizeX == o.getSizeX() &&
+               startY == o.getStartY() && endY == o.getEndY() && sizeY == o.getSizeY();
+    }
+
+  public:
+    Sampled2DFunction(X startX, X endX, int sizeX, Y startY, Y endY, int sizeY, std::vector<R>&& values) :
+        startX(startX), endX(endX), stepX((endX - startX) / sizeX), sizeX(sizeX),
+        startY(startY), endY(endY), stepY((endY - startY) / sizeY), sizeY(sizeY),
+        values(std::move(values))
+    {
+        ASSERT((int)this->values.size() == sizeX * sizeY);
+    }
+
+    Sampled2DFunction(X startX, X endX, int sizeX, Y startY, Y endY, int sizeY, const Ptr<const IFunction<R, Domain<X, Y>>>& function) :
+        startX(startX), endX(endX), stepX((endX - startX) / sizeX), sizeX(sizeX),
+        startY(startY), endY(endY), stepY((endY - startY) / sizeY), sizeY(sizeY)
+    {
+        values.assign(sizeX * sizeY, R(0));
+        Point<X, Y> lower(startX, startY);
+        Point<X, Y> upper(endX, endY);
+        Interval<X, Y> gridInterval(lower, upper, 0b11, 0b00, 0b00);
+        function->partition(gridInterval, [&] (const Interval<X, Y>& i2, const IFunction<R, Domain<X, Y>> *f2) {
+            if (f2->isNonZero(i2)) {
+                int partitionStartIndexX = std::max(0, (int)std::floor(toDouble(std::get<0>(i2.getLower()) - startX) / toDouble(stepX)));
+                int partitionEndIndexX = std::min(sizeX - 1, (int)std::ceil(toDouble(std::get<0>(i2.getUpper()) - startX) / toDouble(stepX)));
+                int partitionStartIndexY = std::max(0, (int)std::floor(toDouble(std::get<1>(i2.getLower()) - startY) / toDouble(stepY)));
+                int partitionEndIndexY = std::min(sizeY - 1, (int)std::ceil(toDouble(std::get<1>(i2.getUpper()) - startY) / toDouble(stepY)));
+                for (int indexX = partitionStartIndexX; indexX <= partitionEndIndexX; indexX++) {
+                    for (int indexY = partitionStartIndexY; indexY <= partitionEndIndexY; indexY++) {
+                        Point<X, Y> lowerCell(startX + stepX * indexX, startY + stepY * indexY);
+                        Point<X, Y> upperCell(startX + stepX * (indexX + 1), startY + stepY * (indexY + 1));
+                        Interval<X, Y> cellInterval(lowerCell, upperCell, 0b11, 0b00, 0b00);
+                        const auto& i3 = i2.getIntersected(cellInterval);
+                        if (!i3.isEmpty())
+                            values[indexY * sizeX + indexX] += f2->getMean(i3) * i3.getVolume();
+                    }
+                }
+            }
+        });
+        double cellVolume = toDouble(stepX) * toDouble(stepY);
+        for (auto& value : values)
+            value = value / cellVolume;
+    }
+
+    X getStartX() const { return startX; }
+    X getEndX() const { return endX; }
+    int getSizeX() const { return sizeX; }
+    Y getStartY() const { return startY; }
+    Y getEndY() const { return endY; }
+    int getSizeY() const { return sizeY; }
+    const std::vector<R>& getValues() const { return values; }
+
+    virtual R getValue(const Point<X, Y>& p) const override {
+        X x = std::get<0>(p);
+        Y y = std::get<1>(p);
+        int indexX = std::floor(toDouble(x - startX) / toDouble(stepX));
+        int indexY = std::floor(toDouble(y - startY) / toDouble(stepY));
+        if (indexX < 0 || indexX > sizeX - 1 || indexY < 0 || indexY > sizeY - 1)
+            return R(0);
+        else
+            return values[indexY * sizeX + indexX];
+    }
+
+    virtual void partition(const Interval<X, Y>& i, const std::function<void(const Interval<X, Y>&, const IFunction<R, Domain<X, Y>> *)> callback) const override {
+        call(i.getIntersected(Interval<X, Y>(Point<X, Y>(getLowerBound<X>(), getLowerBound<Y>()), Point<X, Y>(X(startX), Y(startY)), 0b00, 0b00, 0b00)), callback);
+        call(i.getIntersected(Interval<X, Y>(Point<X, Y>(X(startX), getLowerBound<Y>()), Point<X, Y>(X(endX), Y(startY)), 0b10, 0b00, 0b00)), callback);
+        call(i.getIntersected(Interval<X, Y>(Point<X, Y>(X(endX), getLowerBound<Y>()), Point<X, Y>(getUpperBound<X>(), Y(startY)), 0b10, 0b00, 0b00)), callback);
+
+        call(i.getIntersected(Interval<X, Y>(Point<X, Y>(getLowerBound<X>(), Y(startY)), Point<X, Y>(X(startX), Y(endY)), 0b01, 0b00, 0b00)), callback);
+        const auto& i1 = i.getIntersected(Interval<X, Y>(Point<X, Y>(X(startX), Y(startY)), Point<X, Y>(X(endX), Y(endY)), 0b11, 0b00, 0b00));
+        if (!i1.isEmpty()) {
+            int startIndexX = std::max(0, (int)std::floor(toDouble(std::get<0>(i1.getLower()) - startX) / toDouble(stepX)));
+            int endIndexX = std::min(sizeX - 1, (int)std::ceil(toDouble(std::get<0>(i1.getUpper()) - startX) / toDouble(stepX)));
+            int startIndexY = std::max(0, (int)std::floor(toDouble(std::get<1>(i1.getLower()) - startY) / toDouble(stepY)));
+            int endIndexY = std::min(sizeY - 1, (int)std::ceil(toDouble(std::get<1>(i1.getUpper()) - startY) / toDouble(stepY)));
+            for (int indexX = startIndexX; indexX <= endIndexX; indexX++) {
+                for (int indexY = startIndexY; indexY <= endIndexY; indexY++) {
+                    Point<X, Y> lowerCell(startX + stepX * indexX, startY + stepY * indexY);
+                    Point<X, Y> upperCell(startX + stepX * (indexX + 1), startY + stepY * (indexY + 1));
+                    Interval<X, Y> cellInterval(lowerCell, upperCell, 0b11, 0b00, 0b00);
+                    const auto& i2 = i1.getIntersected(cellInterval);
+                    if (!i2.isEmpty()) {
+                        ConstantFunction<R, Domain<X, Y>> h(values[indexY * sizeX + indexX]);
+                        callback(i2, &h);
+                    }
+                }
+            }
+        }
+        call(i.getIntersected(Interval<X, Y>(Point<X, Y>(X(endX), Y(startY)), Point<X, Y>(getUpperBound<X>(), Y(endY)), 0b11, 0b00, 0b00)), callback);
+
+        call(i.getIntersected(Interval<X, Y>(Point<X, Y>(getLowerBound<X>(), Y(endY)), Point<X, Y>(X(startX), getUpperBound<Y>()), 0b01, 0b00, 0b00)), callback);
+        call(i.getIntersected(Interval<X, Y>(Point<X, Y>(X(startX), Y(endY)), Point<X, Y>(X(endX), getUpperBound<Y>()), 0b11, 0b00, 0b00)), callback);
+        call(i.getIntersected(Interval<X, Y>(Point<X, Y>(X(endX), Y(endY)), Point<X, Y>(getUpperBound<X>(), getUpperBound<Y>()), 0b11, 0b00, 0b00)), callback);
+    }
+
+    virtual const Ptr<const IFunction<R, Domain<X, Y>>> add(const Ptr<const IFunction<R, Domain<X, Y>>>& o) const override {
+        if (const auto& os = dynamicPtrCast<const Sampled2DFunction<R, X, Y>>(o)) {
+            if (hasSameGrid(*os)) {
+                std::vector<R> result(values);
+                const std::vector<R>& otherValues = os->getValues();
+                for (size_t i = 0; i < result.size(); i++)
+                    result[i] += otherValues[i];
+                return makeShared<Sampled2DFunction<R, X, Y>>(startX, endX, sizeX, startY, endY, sizeY, std::move(result));
+            }
+        }
+        return FunctionBase<R, Domain<X, Y>>::add(o);
+    }
+
+    virtual const Ptr<const IFunction<R, Domain<X, Y>>> multiply(const Ptr<const IFunction<double, Domain<X, Y>>>& o) const override {
+        if (const auto& os = dynamicPtrCast<const Sampled2DFunction<double, X, Y>>(o)) {
+            if (hasSameGrid(*os)) {
+                std::vector<R> result(values);
+                const std::vector<double>& otherValues = os->getValues();
+                for (size_t i = 0; i < result.size(); i++)
+                    result[i] = result[i] * otherValues[i];
+                return makeShared<Sampled2DFunction<R, X, Y>>(startX, endX, sizeX, startY, endY, sizeY, std::move(result));
+            }
+        }
+        return FunctionBase<R, Domain<X, Y>>::multiply(o);
+    }
+
+    virtual const Ptr<const IFunction<double, Domain<X, Y>>> divide(const Ptr<const IFunction<R, Domain<X, Y>>>& o) const override {
+        if (const auto& os = dynamicPtrCast<const Sampled2DFunction<R, X, Y>>(o)) {
+            if (hasSameGrid(*os)) {
+                std::vector<double> result(values.size());
+                const std::vector<R>& otherValues = os->getValues();
+                for (size_t i = 0; i < result.size(); i++)
+                    result[i] = toDouble(values[i]) / toDouble(otherValues[i]);
+                return makeShared<Sampled2DFunction<double, X, Y>>(startX, endX, sizeX, startY, endY, sizeY, std::move(result));
+            }
+        }
+        return FunctionBase<R, Domain<X, Y>>::divide(o);
+    }
+
+    virtual void printStructure(std::ostream& os, int level = 0) const override {
+        os << "(Sampled2D " << sizeX << "x" << sizeY << ")";
+    }
+};
+
 /**
  * Fixes the parameters of a function from the left.
  */
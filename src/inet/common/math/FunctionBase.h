@@ -113,14 +113,26 @@ class INET_API FunctionBase : public IFunction<R, D>
     }
 
     virtual const Ptr<const IFunction<R, D>> add(const Ptr<const IFunction<R, D>>& o) const override {
+        // NOTE: simplification for x + 0, the tree node would be eliminated again in every partition anyway
+        if (auto oc = dynamicPtrCast<const ConstantFunction<R, D>>(o))
+            if (toDouble(oc->getConstantValue()) == 0)
+                return const_cast<FunctionBase<R, D> *>(this)->shared_from_this();
         return makeShared<AddedFunction<R, D>>(const_cast<FunctionBase<R, D> *>(this)->shared_from_this(), o);
     }
 
     virtual const Ptr<const IFunction<R, D>> subtract(const Ptr<const IFunction<R, D>>& o) const override {
+        // NOTE: simplification for x - 0
+        if (auto oc = dynamicPtrCast<const ConstantFunction<R, D>>(o))
+            if (toDouble(oc->getConstantValue()) == 0)
+                return const_cast<FunctionBase<R, D> *>(this)->shared_from_this();
         return makeShared<SubtractedFunction<R, D>>(const_cast<FunctionBase<R, D> *>(this)->shared_from_this(), o);
     }
 
     virtual const Ptr<const IFunction<R, D>> multiply(const Ptr<const IFunction<double, D>>& o) const override {
+        // NOTE: simplification for x * 1
+        if (auto oc = dynamicPtrCast<const ConstantFunction<double, D>>(o))
+            if (oc->getConstantValue() == 1)
+                return const_cast<FunctionBase<R, D> *>(this)->shared_from_this();
         return makeShared<MultipliedFunction<R, D>>(const_cast<FunctionBase<R, D> *>(this)->shared_from_this(), o);
     }
 
@@ -41,6 +41,29 @@ class INET_API ConstantFunction : public FunctionBase<R, D>
     virtual R getMean(const typename D::I& i) const override { return value; }
     virtual R getIntegral(const typename D::I& i) const override { return value == R(0) ? value : value *i.getVolume(); }
 
+    virtual const Ptr<const IFunction<R, D>> add(const Ptr<const IFunction<R, D>>& o) const override {
+        // NOTE: simplification for 0 + x and folding constant + constant into a single constant
+        if (toDouble(value) == 0)
+            return o;
+        if (auto oc = dynamicPtrCast<const ConstantFunction<R, D>>(o))
+            return makeShared<ConstantFunction<R, D>>(value + oc->getConstantValue());
+        return FunctionBase<R, D>::add(o);
+    }
+
+    virtual const Ptr<const IFunction<R, D>> subtract(const Ptr<const IFunction<R, D>>& o) const override {
+        // NOTE: folding constant - constant into a single constant
+        if (auto oc = dynamicPtrCast<const ConstantFunction<R, D>>(o))
+            return makeShared<ConstantFunction<R, D>>(value - oc->getConstantValue());
+        return FunctionBase<R, D>::subtract(o);
+    }
+
+    virtual const Ptr<const IFunction<R, D>> multiply(const Ptr<const IFunction<double, D>>& o) const override {
+        // NOTE: folding constant * constant into a single constant
+        if (auto oc = dynamicPtrCast<const ConstantFunction<double, D>>(o))
+            return makeShared<ConstantFunction<R, D>>(value * oc->getConstantValue());
+        return FunctionBase<R, D>::multiply(o);
+    }
+
     virtual void printPartition(std::ostream& os, const typename D::I& i, int level = 0) const override {
         os << "constant over " << i << "\n" << std::string(level + 2, ' ') << "→ " << value << std::endl;
     }
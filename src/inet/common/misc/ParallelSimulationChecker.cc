@@ -0,0 +1,67 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#include "inet/common/misc/ParallelSimulationChecker.h"
+
+namespace inet {
+
+Define_Module(ParallelSimulationChecker);
+
+ParallelSimulationChecker::~ParallelSimulationChecker()
+{
+    for (auto matcher : unsafeModuleTypeMatchers)
+        delete matcher;
+}
+
+void ParallelSimulationChecker::initialize(int stage)
+{
+    if (stage == INITSTAGE_LOCAL) {
+        failOnUnsafeModuleTypes = par("failOnUnsafeModuleTypes");
+        cStringTokenizer tokenizer(par("unsafeModuleTypes"));
+        while (tokenizer.hasMoreTokens()) {
+            auto matcher = new cPatternMatcher();
+            matcher->setPattern(tokenizer.nextToken(), true, true, true);
+            unsafeModuleTypeMatchers.push_back(matcher);
+        }
+    }
+    else if (stage == INITSTAGE_LAST) {
+        // run after all other modules have resolved their module references, so
+        // that the check covers the network as it will actually execute
+        int numUnsafeModules = checkModuleTree(getSimulation()->getSystemModule());
+        if (numUnsafeModules > 0) {
+            if (failOnUnsafeModuleTypes)
+                throw cRuntimeError("Found %d module(s) unsafe for parallel simulation, see log for details", numUnsafeModules);
+            else
+                EV_WARN << "Found " << numUnsafeModules << " module(s) unsafe for parallel simulation, see log for details" << EV_ENDL;
+        }
+        else
+            EV_INFO << "No modules unsafe for parallel simulation were found" << EV_ENDL;
+    }
+}
+
+bool ParallelSimulationChecker::isUnsafeModuleType(const char *nedTypeName) const
+{
+    for (auto matcher : unsafeModuleTypeMatchers)
+        if (matcher->matches(nedTypeName))
+            return true;
+    return false;
+}
+
+int ParallelSimulationChecker::checkModuleTree(cModule *module) const
+{
+    int numUnsafeModules = 0;
+    auto nedTypeName = module->getComponentType()->getFullName();
+    if (module != this && isUnsafeModuleType(nedTypeName)) {
+        EV_WARN << "Module is unsafe for parallel simulation" << EV_FIELD(module) << EV_FIELD(nedTypeName) << EV_ENDL;
+        numUnsafeModules++;
+    }
+    for (cModule::SubmoduleIterator it(module); !it.end(); ++it)
+        numUnsafeModules += checkModuleTree(*it);
+    return numUnsafeModules;
+}
+
+} // namespace inet
+
@@ -0,0 +1,43 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#ifndef __INET_PARALLELSIMULATIONCHECKER_H
+#define __INET_PARALLELSIMULATIONCHECKER_H
+
+#include <vector>
+
+#include "inet/common/INETDefs.h"
+
+namespace inet {
+
+/**
+ * Walks the module tree at the end of initialization and reports module types
+ * that are known to be unsafe for parallel distributed simulation, i.e. that
+ * are global singletons accessed through direct C++ pointers across what would
+ * become partition boundaries. See the NED documentation for details.
+ */
+class INET_API ParallelSimulationChecker : public cSimpleModule
+{
+  protected:
+    bool failOnUnsafeModuleTypes = false;
+    std::vector<cPatternMatcher *> unsafeModuleTypeMatchers;
+
+  protected:
+    virtual int numInitStages() const override { return NUM_INIT_STAGES; }
+    virtual void initialize(int stage) override;
+    virtual void handleMessage(cMessage *msg) override { throw cRuntimeError("This module doesn't handle messages"); }
+
+    virtual bool isUnsafeModuleType(const char *nedTypeName) const;
+    virtual int checkModuleTree(cModule *module) const;
+
+  public:
+    virtual ~ParallelSimulationChecker();
+};
+
+} // namespace inet
+
+#endif
+
@@ -15,6 +15,7 @@ ThruputMeteringChannel::ThruputMeteringChannel(const char *name) : cDatarateChan
 {
     displayAsTooltip = false;
     fmt = nullptr;
+    metering = false;
     batchSize = 10; // packets
     maxInterval = 0.1; // seconds
 
@@ -46,15 +47,20 @@ void ThruputMeteringChannel::initialize()
     cDatarateChannel::initialize();
     displayAsTooltip = par("displayAsTooltip");
     fmt = par("thruputDisplayFormat");
+    // the counters feed refreshDisplay() only, which never runs under Cmdenv,
+    // so don't burn cycles on them without a GUI
+    metering = fmt != nullptr && *fmt != 0 && getEnvir()->isGUI();
 }
 
 cChannel::Result ThruputMeteringChannel::processMessage(cMessage *msg, const SendOptions& options, simtime_t t)
 {
     cChannel::Result result = cDatarateChannel::processMessage(msg, options, t);
 
+    if (!metering || result.discard)
+        return result;
     cPacket *pkt = dynamic_cast<cPacket *>(msg);
     // TODO handle disabled state (show with different style?/color? or print "disabled"?)
-    if (!pkt || !fmt || *fmt == 0 || result.discard)
+    if (!pkt)
         return result;
 
     // count packets and bits
@@ -41,6 +41,7 @@ class INET_API ThruputMeteringChannel : public cDatarateChannel
     // configuration
     bool displayAsTooltip;
     const char *fmt; // display format
+    bool metering; // collect the counters below; off when there is no GUI to display them in
     unsigned int batchSize; // number of packets in a batch
     simtime_t maxInterval; // max length of measurement interval (measurement ends
                            // if either batchSize or maxInterval is reached, whichever
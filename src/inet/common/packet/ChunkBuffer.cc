@@ -150,12 +150,13 @@ void ChunkBuffer::clear(b offset, b length)
 {
     CHUNK_CHECK_USAGE(offset >= b(0), "offset is invalid");
     CHUNK_CHECK_USAGE(length >= b(0), "length is invalid");
-    for (auto it = regions.begin(); it != regions.end(); it++) {
-        auto region = *it;
-        if (region.offset == offset && region.data->getChunkLength() == length) {
-            regions.erase(it);
-            return;
-        }
+    // the regions are sorted by start offset, so an exactly matching region
+    // can be found with a binary search
+    Region searchedRegion(offset, nullptr);
+    auto it = std::lower_bound(regions.begin(), regions.end(), searchedRegion, Region::compareStartOffset);
+    if (it != regions.end() && it->offset == offset && it->data->getChunkLength() == length) {
+        regions.erase(it);
+        return;
     }
     auto data = makeShared<ByteCountChunk>(length);
     Region clearedRegion(offset, data);
@@ -75,6 +75,13 @@ const Ptr<const Chunk> ChunkQueue::pop(b length, int flags)
     return chunk;
 }
 
+void ChunkQueue::eraseAtFront(b length)
+{
+    CHUNK_CHECK_USAGE(b(0) <= length && length <= getLength(), "length is invalid");
+    if (length > b(0))
+        moveIteratorOrRemove(length);
+}
+
 void ChunkQueue::clear()
 {
     poppedLength += getLength();
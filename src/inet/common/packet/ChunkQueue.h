@@ -180,6 +180,13 @@ class INET_API ChunkQueue : public cNamedObject
         return chunk;
     }
 
+    /**
+     * Erases the requested amount of data from the head of the queue without
+     * returning it. This is cheaper than pop() when the data is not needed,
+     * because the head of the queue is not materialized as a chunk.
+     */
+    void eraseAtFront(b length);
+
     /**
      * Erases all data from the queue.
      */
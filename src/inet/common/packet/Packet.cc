@@ -9,6 +9,7 @@
 
 #include "inet/common/ProtocolTag_m.h"
 #include "inet/common/packet/Message.h"
+#include "inet/common/packet/chunk/ChunkInterningRegistry.h"
 #include "inet/common/packet/chunk/SequenceChunk.h"
 #include "inet/common/packet/dissector/PacketDissector.h"
 
@@ -158,6 +159,7 @@ void Packet::parsimUnpack(cCommBuffer *buffer)
     backIterator.setIndex(index);
     buffer->unpack(position);
     backIterator.setPosition(b(position));
+    invalidateFrontPeekCache();
     tags.parsimUnpack(buffer);
     regionTags.parsimUnpack(buffer);
 }
@@ -169,6 +171,7 @@ void Packet::setFrontOffset(b offset)
     SELFDOC_FUNCTION;
     CHUNK_CHECK_USAGE(b(0) <= offset && offset <= getTotalLength() - backIterator.getPosition(), "offset is out of range");
     content->seekIterator(frontIterator, offset);
+    invalidateFrontPeekCache();
     CHUNK_CHECK_IMPLEMENTATION(isConsistent());
 }
 
@@ -190,40 +193,44 @@ void Packet::insertAt(const Ptr<const Chunk>& chunk, b offset)
     CHUNK_CHECK_USAGE(chunk->getChunkLength() > b(0), "chunk is empty");
     CHUNK_CHECK_USAGE(b(0) <= offset && offset <= totalLength, "offset is out of range");
     constPtrCast<Chunk>(chunk)->markImmutable();
+    // invalidating before changing the content avoids holding an extra
+    // reference, which would force a copy when the content is made mutable
+    invalidateFrontPeekCache();
+    const auto& internedChunk = internChunk(chunk);
     if (content->getChunkType() == Chunk::CT_EMPTY)
-        content = chunk;
-    else if (offset == b(0) && content->canInsertAtFront(chunk)) {
+        content = internedChunk;
+    else if (offset == b(0) && content->canInsertAtFront(internedChunk)) {
         const auto& newContent = makeExclusivelyOwnedMutableChunk(content);
-        newContent->insertAtFront(chunk);
+        newContent->insertAtFront(internedChunk);
         newContent->markImmutable();
         content = newContent->simplify();
-        regionTags.moveTags(chunk->getChunkLength());
+        regionTags.moveTags(internedChunk->getChunkLength());
     }
-    else if (offset == totalLength && content->canInsertAtBack(chunk)) {
+    else if (offset == totalLength && content->canInsertAtBack(internedChunk)) {
         const auto& newContent = makeExclusivelyOwnedMutableChunk(content);
-        newContent->insertAtBack(chunk);
+        newContent->insertAtBack(internedChunk);
         newContent->markImmutable();
         content = newContent->simplify();
     }
-    else if (content->canInsertAt(chunk, offset)) {
-        regionTags.moveTags(offset, content->getChunkLength() - offset, chunk->getChunkLength());
+    else if (content->canInsertAt(internedChunk, offset)) {
+        regionTags.moveTags(offset, content->getChunkLength() - offset, internedChunk->getChunkLength());
         const auto& newContent = makeExclusivelyOwnedMutableChunk(content);
-        newContent->insertAt(chunk, offset);
+        newContent->insertAt(internedChunk, offset);
         newContent->markImmutable();
         content = newContent->simplify();
     }
     else {
-        regionTags.moveTags(offset, content->getChunkLength() - offset, chunk->getChunkLength());
+        regionTags.moveTags(offset, content->getChunkLength() - offset, internedChunk->getChunkLength());
         auto sequenceChunk = makeShared<SequenceChunk>();
         if (offset != b(0))
             sequenceChunk->insertAtBack(content->peek(Chunk::ForwardIterator(b(0), 0), offset, Chunk::PF_ALLOW_ALL));
-        sequenceChunk->insertAtBack(chunk);
+        sequenceChunk->insertAtBack(internedChunk);
         if (offset != totalLength)
             sequenceChunk->insertAtBack(content->peek(Chunk::ForwardIterator(offset, -1), totalLength - offset, Chunk::PF_ALLOW_ALL));
         sequenceChunk->markImmutable();
         content = sequenceChunk;
     }
-    b chunkLength = chunk->getChunkLength();
+    b chunkLength = internedChunk->getChunkLength();
     if (offset < getFrontOffset())
         content->moveIterator(frontIterator, chunkLength);
     if (offset > getBackOffset())
@@ -240,6 +247,9 @@ void Packet::eraseAt(b offset, b length)
     auto totalLength = getTotalLength();
     CHUNK_CHECK_USAGE(b(0) <= offset && offset <= totalLength, "offset is out of range");
     CHUNK_CHECK_USAGE(b(-1) <= length && offset + length <= totalLength, "length is invalid");
+    // invalidating before changing the content avoids holding an extra
+    // reference, which would force a copy when the content is made mutable
+    invalidateFrontPeekCache();
     if (content->getChunkLength() == length) {
         content = makeShared<EmptyChunk>();
         regionTags.clearTags(b(0), length);
@@ -11,6 +11,7 @@
 #include <functional>
 
 #include "inet/common/IPrintableObject.h"
+#include "inet/common/ObjectPool.h"
 #include "inet/common/TagBase.h"
 #include "inet/common/packet/chunk/BitsChunk.h"
 #include "inet/common/packet/chunk/BytesChunk.h"
@@ -121,6 +122,19 @@ class INET_API Packet : public cPacket, public IPrintableObject, public ITaggedO
      */
     b totalLength;
 
+    /**
+     * Cached result of the most recent front peek along with its arguments.
+     * Protocol modules tend to peek the same header several times per hop
+     * (e.g. checker, processor, and dispatcher), the cache allows returning
+     * the already resolved chunk without walking the content again. The cache
+     * is invalidated whenever the content or the front separator changes.
+     * Moving the back separator doesn't affect the resolved front part, so it
+     * doesn't invalidate the cache.
+     */
+    mutable Ptr<const Chunk> frontPeekCache;
+    mutable b frontPeekCacheLength = b(-1);
+    mutable int frontPeekCacheFlags = -1;
+
     /**
      * The set of tags attached to the packet as whole.
      */
@@ -162,6 +176,8 @@ class INET_API Packet : public cPacket, public IPrintableObject, public ITaggedO
     }
     //@}
 
+    void invalidateFrontPeekCache() const { frontPeekCache = nullptr; }
+
 #ifdef INET_WITH_SELFDOC
     static void selfDoc(const char * packetAction, const char *typeName);
 #endif
@@ -172,6 +188,9 @@ class INET_API Packet : public cPacket, public IPrintableObject, public ITaggedO
     explicit Packet(const char *name = nullptr, short kind = 0);
     Packet(const char *name, const Ptr<const Chunk>& content);
     Packet(const Packet& other);
+
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
     //@}
 
     /** @name Supported cPacket interface functions */
@@ -367,8 +386,20 @@ class INET_API Packet : public cPacket, public IPrintableObject, public ITaggedO
         SELFDOC_FUNCTION_T;
         auto dataLength = getDataLength();
         CHUNK_CHECK_USAGE(b(-1) <= length && length <= dataLength, "length is invalid");
-        const auto& chunk = content->peek<T>(frontIterator, length == b(-1) ? -dataLength : length, flags);
+        b peekLength = length == b(-1) ? -dataLength : length;
+        if (frontPeekCache != nullptr && frontPeekCacheLength == peekLength && frontPeekCacheFlags == flags) {
+            // neither the content nor the front separator changed since the
+            // cached peek, so resolving again would find the same chunk
+            if (const auto& chunk = dynamicPtrCast<const T>(frontPeekCache))
+                return chunk;
+        }
+        const auto& chunk = content->peek<T>(frontIterator, peekLength, flags);
         CHUNK_CHECK_IMPLEMENTATION(chunk == nullptr || chunk->getChunkLength() <= dataLength);
+        if (chunk != nullptr) {
+            frontPeekCache = chunk;
+            frontPeekCacheLength = peekLength;
+            frontPeekCacheFlags = flags;
+        }
         return chunk;
     }
 
@@ -483,6 +514,7 @@ class INET_API Packet : public cPacket, public IPrintableObject, public ITaggedO
         const auto& chunk = peekAtFront<T>(length, flags);
         if (chunk != nullptr) {
             content->moveIterator(frontIterator, chunk->getChunkLength());
+            invalidateFrontPeekCache();
             CHUNK_CHECK_IMPLEMENTATION(getDataLength() >= b(0));
         }
         return chunk;
@@ -956,6 +988,9 @@ class INET_API Packet : public cPacket, public IPrintableObject, public ITaggedO
         CHUNK_CHECK_USAGE(b(0) <= offset && offset <= totalLength, "offset is out of range");
         CHUNK_CHECK_USAGE(b(-1) <= length && offset + length <= totalLength, "length is invalid");
         constPtrCast<Chunk>(chunk)->markImmutable();
+        // invalidating before peeking avoids holding an extra reference to the
+        // old chunk, which would force a copy when it's made mutable below
+        invalidateFrontPeekCache();
         const auto& oldChunk = peekAt<T>(offset, length, flags);
         b chunkLength = oldChunk->getChunkLength();
         b frontLength = offset;
@@ -1144,6 +1179,9 @@ class INET_API Packet : public cPacket, public IPrintableObject, public ITaggedO
         auto totalLength = getTotalLength();
         CHUNK_CHECK_USAGE(b(0) <= offset && offset <= totalLength, "offset is out of range");
         CHUNK_CHECK_USAGE(b(-1) <= length && offset + length <= totalLength, "length is invalid");
+        // invalidating before peeking avoids holding an extra reference to the
+        // updated chunk, which would force a copy when it's made mutable below
+        invalidateFrontPeekCache();
         const auto& chunk = peekAt<T>(offset, length, flags);
         b chunkLength = chunk->getChunkLength();
         b frontLength = offset;
@@ -91,6 +91,7 @@ void PacketFilter::setExpression(cValue& expression)
 bool PacketFilter::matches(const cPacket *cpacket) const
 {
     this->cpacket = cpacket;
+    dissected = false;
     protocolToChunkMap.clear();
     classNameToChunkMap.clear();
     if (matchExpression == nullptr && filterExpression == nullptr)
@@ -101,17 +102,24 @@ bool PacketFilter::matches(const cPacket *cpacket) const
             cMatchableString matchableString(cpacket->getFullName());
             result &= matchExpression->matches(&matchableString);
         }
-        if (filterExpression != nullptr) {
-            if (auto packet = dynamic_cast<const Packet *>(cpacket)) {
-                PacketDissector packetDissector(ProtocolDissectorRegistry::getInstance(), *packetDissectorCallback);
-                packetDissector.dissectPacket(const_cast<Packet *>(packet));
-            }
+        if (filterExpression != nullptr)
+            // NOTE: the packet is dissected lazily when the expression refers to a protocol or chunk
             result &= filterExpression->evaluate().boolValue();
-        }
         return result;
     }
 }
 
+void PacketFilter::ensureDissected() const
+{
+    if (!dissected) {
+        dissected = true;
+        if (auto packet = dynamic_cast<const Packet *>(cpacket)) {
+            PacketDissector packetDissector(ProtocolDissectorRegistry::getInstance(), *packetDissectorCallback);
+            packetDissector.dissectPacket(const_cast<Packet *>(packet));
+        }
+    }
+}
+
 void PacketFilter::PacketDissectorCallback::visitChunk(const Ptr<const Chunk>& chunk, const Protocol *protocol)
 {
     packetFilter->protocolToChunkMap.insert({protocol, chunk});
@@ -129,6 +137,7 @@ cValue PacketFilter::DynamicExpressionResolver::readVariable(cExpression::Contex
     else {
         bool isClassName = isupper(name[0]);
         if (isClassName) {
+            packetFilter->ensureDissected();
             auto it = packetFilter->classNameToChunkMap.find(name);
             if (it != packetFilter->classNameToChunkMap.end())
                 return const_cast<Chunk *>(it->second.get());
@@ -138,6 +147,7 @@ cValue PacketFilter::DynamicExpressionResolver::readVariable(cExpression::Contex
         else {
             auto protocol = Protocol::findProtocol(name);
             if (protocol != nullptr) {
+                packetFilter->ensureDissected();
                 auto it = packetFilter->protocolToChunkMap.find(protocol);
                 if (it != packetFilter->protocolToChunkMap.end())
                     return const_cast<Chunk *>(it->second.get());
@@ -159,6 +169,7 @@ cValue PacketFilter::DynamicExpressionResolver::readVariable(cExpression::Contex
     ASSERT(index >= 0);
     bool isClassName = isupper(name[0]);
     if (isClassName) {
+        packetFilter->ensureDissected();
         if ((size_t)index < packetFilter->classNameToChunkMap.count(name)) {
             auto it = packetFilter->classNameToChunkMap.lower_bound(name);
             while (index-- > 0)
@@ -171,6 +182,7 @@ cValue PacketFilter::DynamicExpressionResolver::readVariable(cExpression::Contex
     else {
         auto protocol = Protocol::findProtocol(name);
         if (protocol != nullptr) {
+            packetFilter->ensureDissected();
             if ((size_t)index < packetFilter->protocolToChunkMap.count(protocol)) {
                 auto it = packetFilter->protocolToChunkMap.lower_bound(protocol);
                 while (index-- > 0)
@@ -192,6 +204,7 @@ cValue PacketFilter::DynamicExpressionResolver::readMember(cExpression::Context
             if (dynamic_cast<Packet *>(cobject)) {
                 bool isClassName = isupper(name[0]);
                 if (isClassName) {
+                    packetFilter->ensureDissected();
                     auto it = packetFilter->classNameToChunkMap.find(name);
                     if (it != packetFilter->classNameToChunkMap.end())
                         return const_cast<Chunk *>(it->second.get());
@@ -201,6 +214,7 @@ cValue PacketFilter::DynamicExpressionResolver::readMember(cExpression::Context
                 else {
                     auto protocol = Protocol::findProtocol(name);
                     if (protocol != nullptr) {
+                        packetFilter->ensureDissected();
                         auto it = packetFilter->protocolToChunkMap.find(protocol);
                         if (it != packetFilter->protocolToChunkMap.end())
                             return const_cast<Chunk *>(it->second.get());
@@ -227,6 +241,7 @@ cValue PacketFilter::DynamicExpressionResolver::readMember(cExpression::Context
             if (dynamic_cast<Packet *>(cobject)) {
                 bool isClassName = isupper(name[0]);
                 if (isClassName) {
+                    packetFilter->ensureDissected();
                     if ((size_t)index < packetFilter->classNameToChunkMap.count(name)) {
                         auto it = packetFilter->classNameToChunkMap.lower_bound(name);
                         while (index-- > 0)
@@ -239,6 +254,7 @@ cValue PacketFilter::DynamicExpressionResolver::readMember(cExpression::Context
                 else {
                     auto protocol = Protocol::findProtocol(name);
                     if (protocol != nullptr) {
+                        packetFilter->ensureDissected();
                         if ((size_t)index < packetFilter->protocolToChunkMap.count(protocol)) {
                             auto it = packetFilter->protocolToChunkMap.lower_bound(protocol);
                             while (index-- > 0)
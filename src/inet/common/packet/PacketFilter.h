@@ -58,6 +58,7 @@ class INET_API PacketFilter
     cMatchExpression *matchExpression = nullptr;
     PacketDissectorCallback *packetDissectorCallback = nullptr;
     mutable const cPacket *cpacket = nullptr;
+    mutable bool dissected = false;
     mutable std::multimap<const Protocol *, Ptr<const Chunk>> protocolToChunkMap;
     mutable std::multimap<std::string, Ptr<const Chunk>> classNameToChunkMap;
 
@@ -76,6 +77,14 @@ class INET_API PacketFilter
     bool matches(const cPacket *packet) const;
 
   protected:
+    /**
+     * Dissects the current packet into the chunk maps on first use. Dissection
+     * is deferred until the filter expression actually refers to a protocol or
+     * chunk, so filters that only examine packet level attributes don't pay
+     * for it.
+     */
+    void ensureDissected() const;
+
     const cObject *findPacketTag(const char *className) const;
 };
 
@@ -20,15 +20,24 @@ b ReorderBuffer::getAvailableDataLength() const
 const Ptr<const Chunk> ReorderBuffer::popAvailableData(b length)
 {
     if (regions.size() > 0 && regions[0].offset == expectedOffset) {
-        auto data = regions[0].data;
-        b dataLength = data->getChunkLength();
-        if (length != b(-1)) {
-            data = data->peek(Chunk::ForwardIterator(b(0)), length);
-            dataLength = length;
+        b dataLength = regions[0].data->getChunkLength();
+        if (length == b(-1) || length == dataLength) {
+            // pop the whole first region: move the chunk out and drop the region
+            // without searching the region list
+            auto data = std::move(regions[0].data);
+            regions.erase(regions.begin());
+            expectedOffset += dataLength;
+            return data;
+        }
+        else {
+            // pop the beginning of the first region: trim the region in place
+            // instead of re-slicing the region list with a cleared region
+            auto data = regions[0].data->peek(Chunk::ForwardIterator(b(0)), length);
+            regions[0].data = regions[0].data->peek(Chunk::ForwardIterator(length), dataLength - length);
+            regions[0].offset += length;
+            expectedOffset += length;
+            return data;
         }
-        clear(expectedOffset, dataLength);
-        expectedOffset += dataLength;
-        return data;
     }
     else
         return nullptr;
@@ -8,6 +8,7 @@
 #ifndef __INET_BITCOUNTCHUNK_H
 #define __INET_BITCOUNTCHUNK_H
 
+#include "inet/common/ObjectPool.h"
 #include "inet/common/packet/chunk/Chunk.h"
 
 namespace inet {
@@ -47,6 +48,9 @@ class INET_API BitCountChunk : public Chunk
     BitCountChunk(const BitCountChunk& other) = default;
     BitCountChunk(b length, bool data = false);
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual BitCountChunk *dup() const override { return new BitCountChunk(*this); }
     virtual const Ptr<Chunk> dupShared() const override { return makeShared<BitCountChunk>(*this); }
 
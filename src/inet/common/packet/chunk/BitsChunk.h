@@ -8,6 +8,7 @@
 #ifndef __INET_BITSCHUNK_H
 #define __INET_BITSCHUNK_H
 
+#include "inet/common/ObjectPool.h"
 #include "inet/common/packet/chunk/Chunk.h"
 
 namespace inet {
@@ -47,6 +48,9 @@ class INET_API BitsChunk : public Chunk
     BitsChunk(const BitsChunk& other) = default;
     BitsChunk(const std::vector<bool>& bits);
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual BitsChunk *dup() const override { return new BitsChunk(*this); }
     virtual const Ptr<Chunk> dupShared() const override { return makeShared<BitsChunk>(*this); }
 
@@ -8,6 +8,7 @@
 #ifndef __INET_BYTECOUNTCHUNK_H
 #define __INET_BYTECOUNTCHUNK_H
 
+#include "inet/common/ObjectPool.h"
 #include "inet/common/packet/chunk/Chunk.h"
 
 namespace inet {
@@ -47,6 +48,9 @@ class INET_API ByteCountChunk : public Chunk
     ByteCountChunk(const ByteCountChunk& other) = default;
     ByteCountChunk(B length, uint8_t data = '?');
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual ByteCountChunk *dup() const override { return new ByteCountChunk(*this); }
     virtual const Ptr<Chunk> dupShared() const override { return makeShared<ByteCountChunk>(*this); }
 
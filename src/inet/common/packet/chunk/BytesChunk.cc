@@ -25,6 +25,12 @@ BytesChunk::BytesChunk(const std::vector<uint8_t>& bytes) :
 {
 }
 
+BytesChunk::BytesChunk(std::vector<uint8_t>&& bytes) :
+    Chunk(),
+    bytes(std::move(bytes))
+{
+}
+
 void BytesChunk::parsimPack(cCommBuffer *buffer) const
 {
     Chunk::parsimPack(buffer);
@@ -85,7 +91,7 @@ const Ptr<Chunk> BytesChunk::convertChunk(const std::type_info& typeInfo, const
     MemoryOutputStream outputStream(chunkLength);
     Chunk::serialize(outputStream, chunk, offset, resultLength);
     // TODO this can return data which is contains garbage because the data length is not divisible by 8
-    return makeShared<BytesChunk>(outputStream.getData());
+    return makeShared<BytesChunk>(outputStream.extractData());
 }
 
 void BytesChunk::setBytes(const std::vector<uint8_t>& bytes)
@@ -94,6 +100,12 @@ void BytesChunk::setBytes(const std::vector<uint8_t>& bytes)
     this->bytes = bytes;
 }
 
+void BytesChunk::setBytes(std::vector<uint8_t>&& bytes)
+{
+    handleChange();
+    this->bytes = std::move(bytes);
+}
+
 void BytesChunk::setByte(int index, uint8_t byte)
 {
     handleChange();
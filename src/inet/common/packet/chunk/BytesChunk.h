@@ -8,6 +8,7 @@
 #ifndef __INET_BYTESCHUNK_H
 #define __INET_BYTESCHUNK_H
 
+#include "inet/common/ObjectPool.h"
 #include "inet/common/packet/chunk/Chunk.h"
 
 namespace inet {
@@ -46,8 +47,12 @@ class INET_API BytesChunk : public Chunk
     BytesChunk();
     BytesChunk(const BytesChunk& other) = default;
     BytesChunk(const std::vector<uint8_t>& bytes);
+    BytesChunk(std::vector<uint8_t>&& bytes);
     BytesChunk(const uint8_t *buffer, size_t bufLen) : Chunk(), bytes(buffer, buffer + bufLen) {}
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual BytesChunk *dup() const override { return new BytesChunk(*this); }
     virtual const Ptr<Chunk> dupShared() const override { return makeShared<BytesChunk>(*this); }
 
@@ -59,6 +64,7 @@ class INET_API BytesChunk : public Chunk
     //@{
     const std::vector<uint8_t>& getBytes() const { return bytes; }
     void setBytes(const std::vector<uint8_t>& bytes);
+    void setBytes(std::vector<uint8_t>&& bytes);
 
     size_t getByteArraySize() const { return bytes.size(); }
     uint8_t getByte(int index) const { return bytes.at(index); }
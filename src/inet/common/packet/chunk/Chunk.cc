@@ -5,6 +5,7 @@
 //
 
 
+#include "inet/common/packet/chunk/BytesChunk.h"
 #include "inet/common/packet/chunk/SliceChunk.h"
 #include "inet/common/packet/serializer/ChunkSerializer.h"
 #include "inet/common/packet/serializer/ChunkSerializerRegistry.h"
@@ -129,8 +130,16 @@ const Ptr<Chunk> Chunk::convertChunk(const std::type_info& typeInfo, const Ptr<C
                 "The automatic conversion is disabled by default to prevent unexpected behavior due to unintended data reinterpretation.",
                 opp_typename(typeid(*chunkObject)), opp_typename(typeInfo));
     }
-    MemoryOutputStream outputStream;
-    serialize(outputStream, chunk, offset, length < b(0) ? std::min(-length, chunk->getChunkLength() - offset) : length);
+    b dataLength = length < b(0) ? std::min(-length, chunk->getChunkLength() - offset) : length;
+    MemoryOutputStream outputStream(dataLength);
+    serialize(outputStream, chunk, offset, dataLength);
+    // converting to a BytesChunk can adopt the serialized bytes without copying
+    // them through a MemoryInputStream and the deserializer
+    if (typeInfo == typeid(BytesChunk) && b(outputStream.getLength()).get() % 8 == 0) {
+        auto result = makeShared<BytesChunk>(outputStream.extractData());
+        result->regionTags.copyTags(chunk->regionTags, offset, b(0), result->getChunkLength());
+        return result;
+    }
     MemoryInputStream inputStream(outputStream.getData());
     const auto& result = deserialize(inputStream, typeInfo);
     result->regionTags.copyTags(chunk->regionTags, offset, b(0), result->getChunkLength());
@@ -0,0 +1,64 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#include "inet/common/packet/chunk/ChunkInterningRegistry.h"
+
+#include <typeinfo>
+
+namespace inet {
+
+static bool readEnabledFromEnvironment()
+{
+#if CHUNK_INTERNING_ENABLED
+    return true;
+#else
+    const char *value = std::getenv("INET_CHUNK_INTERNING");
+    return value != nullptr && *value != '\0' && *value != '0';
+#endif
+}
+
+bool ChunkInterningRegistry::enabled = readEnabledFromEnvironment();
+
+size_t ChunkInterningRegistry::computeHash(const Chunk *chunk) const
+{
+    return typeid(*chunk).hash_code() ^ std::hash<int64_t>()(chunk->getChunkLength().get());
+}
+
+bool ChunkInterningRegistry::isInternable(const Chunk *chunk) const
+{
+    // region tags are stored on the chunk itself, so a tagged chunk cannot be
+    // shared with an equal chunk carrying different tags
+    return chunk->getChunkType() == Chunk::CT_FIELDS && chunk->isImmutable() &&
+           chunk->isComplete() && chunk->isCorrect() && chunk->getNumTags() == 0;
+}
+
+Ptr<const Chunk> ChunkInterningRegistry::intern(const Ptr<const Chunk>& chunk)
+{
+    if (!isInternable(chunk.get()))
+        return chunk;
+    auto& bucket = chunks[computeHash(chunk.get())];
+    for (const auto& canonicalChunk : bucket)
+        if (canonicalChunk->containsSameData(*chunk))
+            return canonicalChunk;
+    if (numChunks >= MAX_NUM_CHUNKS) {
+        chunks.clear();
+        numChunks = 0;
+        return intern(chunk);
+    }
+    bucket.push_back(chunk);
+    numChunks++;
+    return chunk;
+}
+
+ChunkInterningRegistry& ChunkInterningRegistry::getInstance()
+{
+    static thread_local ChunkInterningRegistry instance;
+    return instance;
+}
+
+} // namespace
+
@@ -0,0 +1,89 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#ifndef __INET_CHUNKINTERNINGREGISTRY_H
+#define __INET_CHUNKINTERNINGREGISTRY_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "inet/common/packet/chunk/Chunk.h"
+
+// interning of immutable chunks is disabled by default, it can be enabled
+// globally at build time (e.g. -DCHUNK_INTERNING_ENABLED=1) or at run time
+// via the INET_CHUNK_INTERNING environment variable
+#ifndef CHUNK_INTERNING_ENABLED
+#define CHUNK_INTERNING_ENABLED    0
+#endif
+
+namespace inet {
+
+/**
+ * This class maintains a per-thread registry of canonical immutable chunks so
+ * that identical fields chunks (same type and same field values) are shared by
+ * reference instead of being duplicated. Packets already share their content
+ * chunks on duplication, but independently constructed headers with the same
+ * contents (e.g. the ARP and MAC headers of a broadcast storm, beacon frames,
+ * or flooding protocol headers) are separate objects; interning them at packet
+ * insertion time collapses these copies into one instance.
+ *
+ * Only immutable, complete, correct fields chunks without region tags are
+ * interned, and equality is decided by Chunk::containsSameData(), so sharing
+ * is conservative: a chunk for which equality cannot be determined is simply
+ * not shared. The registry keeps a strong reference to each canonical chunk
+ * and is flushed wholesale when it reaches its size limit, which bounds the
+ * retained memory while still serving workloads where a small set of headers
+ * is inserted over and over again.
+ */
+class INET_API ChunkInterningRegistry
+{
+  protected:
+    /**
+     * Canonical chunks bucketed by a hash of the chunk type and length, each
+     * bucket is searched linearly using Chunk::containsSameData().
+     */
+    std::unordered_map<size_t, std::vector<Ptr<const Chunk>>> chunks;
+    size_t numChunks = 0;
+
+    static const size_t MAX_NUM_CHUNKS = 16384;
+
+    static bool enabled;
+
+  protected:
+    size_t computeHash(const Chunk *chunk) const;
+
+    bool isInternable(const Chunk *chunk) const;
+
+  public:
+    /**
+     * Returns the canonical chunk equal to the provided chunk, registering the
+     * provided chunk as canonical if no equal chunk is known. Chunks that are
+     * not eligible for interning are returned unchanged.
+     */
+    Ptr<const Chunk> intern(const Ptr<const Chunk>& chunk);
+
+    /**
+     * Returns the registry instance of the current thread.
+     */
+    static ChunkInterningRegistry& getInstance();
+
+    static bool isEnabled() { return enabled; }
+    static void setEnabled(bool enabled) { ChunkInterningRegistry::enabled = enabled; }
+};
+
+inline Ptr<const Chunk> internChunk(const Ptr<const Chunk>& chunk)
+{
+    if (ChunkInterningRegistry::isEnabled())
+        return ChunkInterningRegistry::getInstance().intern(chunk);
+    else
+        return chunk;
+}
+
+} // namespace
+
+#endif
+
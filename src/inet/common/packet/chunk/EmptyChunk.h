@@ -8,6 +8,7 @@
 #ifndef __INET_EMPTYCHUNK_H
 #define __INET_EMPTYCHUNK_H
 
+#include "inet/common/ObjectPool.h"
 #include "inet/common/packet/chunk/Chunk.h"
 
 namespace inet {
@@ -30,6 +31,9 @@ class INET_API EmptyChunk : public Chunk
     EmptyChunk();
     EmptyChunk(const EmptyChunk& other);
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual EmptyChunk *dup() const override { return new EmptyChunk(*this); }
     virtual const Ptr<Chunk> dupShared() const override { return makeShared<EmptyChunk>(*this); }
     //@}
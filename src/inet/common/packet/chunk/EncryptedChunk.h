@@ -8,6 +8,7 @@
 #ifndef __INET_ENCRYPTEDCHUNK_H
 #define __INET_ENCRYPTEDCHUNK_H
 
+#include "inet/common/ObjectPool.h"
 #include "inet/common/packet/chunk/Chunk.h"
 
 namespace inet {
@@ -43,6 +44,9 @@ class INET_API EncryptedChunk : public Chunk
     EncryptedChunk(const EncryptedChunk& other) = default;
     EncryptedChunk(const Ptr<Chunk>& chunk, b length);
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual EncryptedChunk *dup() const override { return new EncryptedChunk(*this); }
     virtual const Ptr<Chunk> dupShared() const override { return makeShared<EncryptedChunk>(*this); }
 
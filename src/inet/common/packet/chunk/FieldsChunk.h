@@ -8,6 +8,7 @@
 #ifndef __INET_FIELDSCHUNK_H
 #define __INET_FIELDSCHUNK_H
 
+#include "inet/common/ObjectPool.h"
 #include "inet/common/packet/chunk/Chunk.h"
 
 namespace inet {
@@ -52,6 +53,9 @@ class INET_API FieldsChunk : public Chunk
     FieldsChunk(const FieldsChunk& other);
     virtual ~FieldsChunk();
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual void parsimPack(cCommBuffer *buffer) const override;
     virtual void parsimUnpack(cCommBuffer *buffer) override;
     //@}
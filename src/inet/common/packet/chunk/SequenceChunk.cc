@@ -7,6 +7,8 @@
 
 #include "inet/common/packet/chunk/SequenceChunk.h"
 
+#include <algorithm>
+
 #include "inet/common/packet/chunk/EmptyChunk.h"
 
 namespace inet {
@@ -20,7 +22,8 @@ SequenceChunk::SequenceChunk() :
 
 SequenceChunk::SequenceChunk(const SequenceChunk& other) :
     Chunk(other),
-    chunks(other.isImmutable() ? other.chunks : other.dupChunks())
+    chunks(other.isImmutable() ? other.chunks : other.dupChunks()),
+    length(other.length)
 {
 }
 
@@ -28,6 +31,8 @@ SequenceChunk::SequenceChunk(const std::deque<Ptr<const Chunk>>& chunks) :
     Chunk(),
     chunks(chunks)
 {
+    for (const auto& chunk : chunks)
+        length += chunk->getChunkLength();
 }
 
 void SequenceChunk::parsimPack(cCommBuffer *buffer) const
@@ -44,9 +49,11 @@ void SequenceChunk::parsimUnpack(cCommBuffer *buffer)
     size_t size;
     buffer->unpack(size);
     chunks.clear();
+    length = b(0);
     for (size_t i = 0; i < size; i++) {
         const auto& chunk = check_and_cast<Chunk *>(buffer->unpackObject())->shared_from_this();
         chunks.push_back(chunk);
+        length += chunk->getChunkLength();
     }
 }
 
@@ -57,6 +64,51 @@ void SequenceChunk::forEachChild(cVisitor *v)
         v->visit(const_cast<Chunk *>(chunk.get()));
 }
 
+void SequenceChunk::handleChange()
+{
+    Chunk::handleChange();
+    cumulativeEndOffsets.clear();
+}
+
+const std::vector<b>& SequenceChunk::getCumulativeEndOffsets() const
+{
+    if (cumulativeEndOffsets.empty() && !chunks.empty()) {
+        cumulativeEndOffsets.reserve(chunks.size());
+        b offset = b(0);
+        for (const auto& chunk : chunks) {
+            auto chunkLength = chunk->getChunkLength();
+            CHUNK_CHECK_IMPLEMENTATION(chunkLength > b(0));
+            offset += chunkLength;
+            cumulativeEndOffsets.push_back(offset);
+        }
+    }
+    return cumulativeEndOffsets;
+}
+
+b SequenceChunk::getElementStartOffset(bool isForward, size_t index) const
+{
+    const auto& endOffsets = getCumulativeEndOffsets();
+    size_t elementIndex = getElementIndex(isForward, index);
+    if (isForward)
+        return elementIndex == 0 ? b(0) : endOffsets[elementIndex - 1];
+    else
+        return endOffsets.back() - endOffsets[elementIndex];
+}
+
+int SequenceChunk::findElementIndex(bool isForward, b offset) const
+{
+    const auto& endOffsets = getCumulativeEndOffsets();
+    if (endOffsets.empty() || offset >= endOffsets.back())
+        return -1;
+    if (isForward)
+        return std::upper_bound(endOffsets.begin(), endOffsets.end(), offset) - endOffsets.begin();
+    else {
+        b reverseOffset = endOffsets.back() - offset;
+        int i = std::lower_bound(endOffsets.begin(), endOffsets.end(), reverseOffset) - endOffsets.begin();
+        return endOffsets.size() - 1 - i;
+    }
+}
+
 bool SequenceChunk::containsSameData(const Chunk& other) const
 {
     if (&other == this)
@@ -102,10 +154,11 @@ const Ptr<Chunk> SequenceChunk::peekUnchecked(PeekPredicate predicate, PeekConve
         }
     }
     // 4. peeking a part represented by an element chunk returns part of that element chunk
-    b position = b(0);
-    for (size_t i = 0; i < chunks.size(); i++) {
+    int elementIndex = findElementIndex(iterator.isForward(), iterator.getPosition());
+    if (elementIndex != -1) {
         // KLUDGE constPtrCast<Chunk>
-        const auto& chunk = constPtrCast<Chunk>(chunks[getElementIndex(iterator.isForward(), i)]);
+        const auto& chunk = constPtrCast<Chunk>(chunks[getElementIndex(iterator.isForward(), elementIndex)]);
+        b position = getElementStartOffset(iterator.isForward(), elementIndex);
         b elementChunkLength = chunk->getChunkLength();
         // 4.1 peeking the whole part of an element chunk returns that element chunk
         if (iterator.getPosition() == position && (-length >= elementChunkLength || length == elementChunkLength)) {
@@ -113,10 +166,8 @@ const Ptr<Chunk> SequenceChunk::peekUnchecked(PeekPredicate predicate, PeekConve
                 return chunk;
         }
         // 4.2 peeking a part of an element chunk returns the part of that element chunk
-        if (position <= iterator.getPosition() && iterator.getPosition() < position + elementChunkLength &&
-            (-length >= elementChunkLength || iterator.getPosition() + length <= position + elementChunkLength))
+        if ((-length >= elementChunkLength || iterator.getPosition() + length <= position + elementChunkLength))
             return chunk->peekUnchecked(predicate, converter, Iterator(iterator.isForward(), iterator.getPosition() - position, -1), length, flags);
-        position += elementChunkLength;
     }
     // 5. peeking without conversion returns a SequenceChunk
     if (converter == nullptr)
@@ -149,6 +200,9 @@ void SequenceChunk::setChunks(const std::deque<Ptr<const Chunk>>& chunks)
 {
     handleChange();
     this->chunks = chunks;
+    length = b(0);
+    for (const auto& chunk : chunks)
+        length += chunk->getChunkLength();
 }
 
 bool SequenceChunk::isIncomplete() const
@@ -183,12 +237,6 @@ bool SequenceChunk::isImproperlyRepresented() const
 
 b SequenceChunk::getChunkLength() const
 {
-    b length = b(0);
-    for (const auto& chunk : chunks) {
-        auto chunkLength = chunk->getChunkLength();
-        CHUNK_CHECK_IMPLEMENTATION(chunkLength > b(0));
-        length += chunkLength;
-    }
     return length;
 }
 
@@ -199,20 +247,15 @@ void SequenceChunk::seekIterator(Iterator& iterator, b offset) const
     if (offset == b(0))
         iterator.setIndex(0);
     else {
-        b p = b(0);
-        for (size_t i = 0; i < chunks.size(); i++) {
-            const auto& chunk = chunks[getElementIndex(iterator.isForward(), i)];
-            p += chunk->getChunkLength();
-            if (p == offset) {
-                iterator.setIndex(i + 1);
-                return;
-            }
-            else if (p > offset) {
-                iterator.setIndex(-1);
-                return;
-            }
+        int i = findElementIndex(iterator.isForward(), offset);
+        if (i == -1) {
+            // the offset range check above guarantees this is the total length
+            iterator.setIndex(chunks.size());
         }
-        CHUNK_CHECK_IMPLEMENTATION(false);
+        else if (getElementStartOffset(iterator.isForward(), i) == offset)
+            iterator.setIndex(i);
+        else
+            iterator.setIndex(-1);
     }
 }
 
@@ -229,6 +272,7 @@ void SequenceChunk::doInsertChunkAtFront(const Ptr<const Chunk>& chunk)
 {
     CHUNK_CHECK_USAGE(chunk->isImmutable(), "chunk is mutable");
     CHUNK_CHECK_USAGE(chunk->getChunkLength() > b(0), "chunk is empty");
+    length += chunk->getChunkLength();
     if (chunks.empty())
         chunks.push_front(chunk);
     else {
@@ -291,6 +335,7 @@ void SequenceChunk::doInsertChunkAtBack(const Ptr<const Chunk>& chunk)
 {
     CHUNK_CHECK_USAGE(chunk->isImmutable(), "chunk is mutable");
     CHUNK_CHECK_USAGE(chunk->getChunkLength() > b(0), "chunk is empty");
+    length += chunk->getChunkLength();
     if (chunks.empty())
         chunks.push_back(chunk);
     else {
@@ -350,6 +395,7 @@ void SequenceChunk::doInsertAtBack(const Ptr<const Chunk>& chunk)
 
 void SequenceChunk::doRemoveAtFront(b length)
 {
+    this->length -= length;
     auto it = chunks.begin();
     while (it != chunks.end()) {
         auto chunk = *it;
@@ -370,6 +416,7 @@ void SequenceChunk::doRemoveAtFront(b length)
 
 void SequenceChunk::doRemoveAtBack(b length)
 {
+    this->length -= length;
     auto it = chunks.rbegin();
     while (it != chunks.rend()) {
         auto chunk = *it;
@@ -9,6 +9,7 @@
 #define __INET_SEQUENCECHUNK_H
 
 #include <deque>
+#include <vector>
 
 #include "inet/common/packet/chunk/SliceChunk.h"
 
@@ -29,8 +30,24 @@ class INET_API SequenceChunk : public Chunk
      * The list of chunks that make up this chunk.
      */
     std::deque<Ptr<const Chunk>> chunks;
+    /**
+     * The total length of the element chunks, maintained incrementally by the
+     * mutation functions, so length queries don't have to sum the elements.
+     */
+    b length = b(0);
+    /**
+     * The cumulative end offsets of the element chunks in forward order, or
+     * empty if not yet computed. This lazily built index maps offsets to
+     * element chunks in O(log n) time, so repeated peeks into deeply nested
+     * packets don't re-walk the chunk list. It is invalidated on mutation.
+     */
+    mutable std::vector<b> cumulativeEndOffsets;
 
   protected:
+    const std::vector<b>& getCumulativeEndOffsets() const;
+    b getElementStartOffset(bool isForward, size_t index) const;
+    int findElementIndex(bool isForward, b offset) const;
+
     int getNumChunks() const { return chunks.size(); } // only for class descriptor
     const Chunk *getChunk(int i) const { return chunks[i].get(); } // only for class descriptor
 
@@ -64,6 +81,9 @@ class INET_API SequenceChunk : public Chunk
     SequenceChunk(const SequenceChunk& other);
     SequenceChunk(const std::deque<Ptr<const Chunk>>& chunks);
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual SequenceChunk *dup() const override { return new SequenceChunk(*this); }
     virtual const Ptr<Chunk> dupShared() const override { return makeShared<SequenceChunk>(*this); }
 
@@ -73,6 +93,8 @@ class INET_API SequenceChunk : public Chunk
 
     virtual void forEachChild(cVisitor *v) override;
 
+    virtual void handleChange() override;
+
     virtual bool containsSameData(const Chunk& other) const override;
 
     /** @name Field accessor functions */
@@ -8,6 +8,7 @@
 #ifndef __INET_SLICECHUNK_H
 #define __INET_SLICECHUNK_H
 
+#include "inet/common/ObjectPool.h"
 #include "inet/common/packet/chunk/Chunk.h"
 
 namespace inet {
@@ -58,6 +59,9 @@ class INET_API SliceChunk : public Chunk
     SliceChunk(const SliceChunk& other) = default;
     SliceChunk(const Ptr<Chunk>& chunk, b offset, b length);
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual SliceChunk *dup() const override { return new SliceChunk(*this); }
     virtual const Ptr<Chunk> dupShared() const override { return makeShared<SliceChunk>(*this); }
 
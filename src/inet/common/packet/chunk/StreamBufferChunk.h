@@ -8,6 +8,7 @@
 #ifndef __INET_STREAMBUFFERCHUNK_H
 #define __INET_STREAMBUFFERCHUNK_H
 
+#include "inet/common/ObjectPool.h"
 #include "inet/common/packet/chunk/Chunk.h"
 
 namespace inet {
@@ -46,6 +47,9 @@ class INET_API StreamBufferChunk : public Chunk
     StreamBufferChunk(const StreamBufferChunk& other) = default;
     StreamBufferChunk(const Ptr<Chunk>& chunk, simtime_t startTime, bps datarate);
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual StreamBufferChunk *dup() const override { return new StreamBufferChunk(*this); }
     virtual const Ptr<Chunk> dupShared() const override { return makeShared<StreamBufferChunk>(*this); }
 
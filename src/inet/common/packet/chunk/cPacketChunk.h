@@ -8,6 +8,7 @@
 #ifndef __INET_CPACKETCHUNK_H
 #define __INET_CPACKETCHUNK_H
 
+#include "inet/common/ObjectPool.h"
 #include "inet/common/packet/chunk/Chunk.h"
 
 namespace inet {
@@ -33,6 +34,9 @@ class INET_API cPacketChunk : public Chunk
     cPacketChunk(const cPacketChunk& other);
     ~cPacketChunk();
 
+    void *operator new(size_t size) { return poolAllocate(size); }
+    void operator delete(void *pointer, size_t size) { poolDeallocate(pointer, size); }
+
     virtual cPacketChunk *dup() const override { return new cPacketChunk(*this); }
     virtual const Ptr<Chunk> dupShared() const override { return makeShared<cPacketChunk>(*this); }
 
@@ -40,6 +40,14 @@ class INET_API PacketDissector
          */
         virtual bool shouldDissectProtocolDataUnit(const Protocol *protocol) = 0;
 
+        /**
+         * True means the callback has already seen everything it needs and the
+         * packet dissector may stop descending into further protocol data
+         * units; the remaining data is still visited using the default
+         * dissector without a protocol to keep the dissection complete.
+         */
+        virtual bool isDissectionComplete() const { return false; }
+
         /**
          * Notifies about the start of a new protocol data unit (PDU).
          */
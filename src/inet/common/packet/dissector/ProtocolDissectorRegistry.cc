@@ -11,28 +11,31 @@ namespace inet {
 
 ProtocolDissectorRegistry::~ProtocolDissectorRegistry()
 {
-    for (auto it : protocolDissectors)
-        delete it.second;
+    for (auto protocolDissector : protocolDissectors)
+        delete protocolDissector;
 }
 
 void ProtocolDissectorRegistry::registerProtocolDissector(const Protocol *protocol, const ProtocolDissector *dissector)
 {
-    protocolDissectors[protocol] = dissector;
+    size_t index = getIndex(protocol);
+    if (index >= protocolDissectors.size())
+        protocolDissectors.resize(index + 1, nullptr);
+    protocolDissectors[index] = dissector;
 }
 
 const ProtocolDissector *ProtocolDissectorRegistry::findProtocolDissector(const Protocol *protocol) const
 {
-    auto it = protocolDissectors.find(protocol);
-    return (it != protocolDissectors.end()) ? it->second : nullptr;
+    size_t index = getIndex(protocol);
+    return index < protocolDissectors.size() ? protocolDissectors[index] : nullptr;
 }
 
 const ProtocolDissector *ProtocolDissectorRegistry::getProtocolDissector(const Protocol *protocol) const
 {
-    auto it = protocolDissectors.find(protocol);
-    if (it != protocolDissectors.end())
-        return it->second;
+    auto protocolDissector = findProtocolDissector(protocol);
+    if (protocolDissector != nullptr)
+        return protocolDissector;
     else
-        throw cRuntimeError("Cannot find protocol dissector for %s", protocol->getName());
+        throw cRuntimeError("Cannot find protocol dissector for %s", protocol != nullptr ? protocol->getName() : "<default>");
 }
 
 ProtocolDissectorRegistry& ProtocolDissectorRegistry::getInstance()
@@ -8,6 +8,8 @@
 #ifndef __INET_PROTOCOLDISSECTORREGISTRY_H
 #define __INET_PROTOCOLDISSECTORREGISTRY_H
 
+#include <vector>
+
 #include "inet/common/Protocol.h"
 #include "inet/common/packet/dissector/ProtocolDissector.h"
 
@@ -18,7 +20,16 @@ namespace inet {
 class INET_API ProtocolDissectorRegistry
 {
   protected:
-    std::map<const Protocol *, const ProtocolDissector *> protocolDissectors;
+    /**
+     * Dissectors indexed by protocol id + 1, index 0 holds the default
+     * dissector registered for the nullptr protocol. Protocol ids are small
+     * sequential integers, so the flat table resolves a protocol with a
+     * single indexing operation instead of a map lookup.
+     */
+    std::vector<const ProtocolDissector *> protocolDissectors;
+
+  protected:
+    size_t getIndex(const Protocol *protocol) const { return protocol != nullptr ? protocol->getId() + 1 : 0; }
 
   public:
     ~ProtocolDissectorRegistry();
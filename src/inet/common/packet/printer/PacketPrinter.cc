@@ -193,18 +193,48 @@ void PacketPrinter::printPacket(std::ostream& stream, Packet *packet, const Opti
 
 void PacketPrinter::printPacket(Packet *packet, const Options *options, Context& context) const
 {
-    PacketDissector::PduTreeBuilder pduTreeBuilder;
-    try {
-        PacketDissector packetDissector(ProtocolDissectorRegistry::getInstance(), pduTreeBuilder);
-        packetDissector.dissectPacket(packet);
+    const auto& packetProtocolTag = packet->findTag<PacketProtocolTag>();
+    auto protocol = packetProtocolTag != nullptr ? packetProtocolTag->getProtocol() : nullptr;
+    b frontOffset = packet->getFrontOffset() + (packetProtocolTag != nullptr ? packetProtocolTag->getFrontOffset() : b(0));
+    b backOffset = packet->getBackOffset() + (packetProtocolTag != nullptr ? packetProtocolTag->getBackOffset() : b(0));
+    Ptr<const PacketDissector::ProtocolDataUnit> protocolDataUnit;
+    bool isSimplyEncapsulatedPacket = false;
+    // Qtenv prints the same packet several times (e.g. whenever the log window is redrawn), so the
+    // dissection result is cached; the packet content is immutable and the cache entry keeps it
+    // alive, therefore the content pointer identifies the dissected data
+    auto it = dissectionCache.find(packet->getContent());
+    if (it != dissectionCache.end() && it->second.protocol == protocol && it->second.frontOffset == frontOffset && it->second.backOffset == backOffset) {
+        protocolDataUnit = it->second.protocolDataUnit;
+        isSimplyEncapsulatedPacket = it->second.isSimplyEncapsulatedPacket;
     }
-    catch (cRuntimeError& e) {
-        // NOTE: don't propagate errors from printPacket, becaue it can break Qtenv for example
-        context.infoColumn << e.what() << ": ";
+    else {
+        PacketDissector::PduTreeBuilder pduTreeBuilder;
+        bool isDissectedSuccessfully = true;
+        try {
+            PacketDissector packetDissector(ProtocolDissectorRegistry::getInstance(), pduTreeBuilder);
+            packetDissector.dissectPacket(packet);
+        }
+        catch (cRuntimeError& e) {
+            // NOTE: don't propagate errors from printPacket, becaue it can break Qtenv for example
+            context.infoColumn << e.what() << ": ";
+            isDissectedSuccessfully = false;
+        }
+        protocolDataUnit = pduTreeBuilder.getTopLevelPdu();
+        isSimplyEncapsulatedPacket = pduTreeBuilder.isSimplyEncapsulatedPacket();
+        if (isDissectedSuccessfully) {
+            if (dissectionCache.size() >= dissectionCacheLimit)
+                dissectionCache.clear();
+            auto& entry = dissectionCache[packet->getContent()];
+            entry.content = const_cast<Chunk *>(packet->getContent())->shared_from_this();
+            entry.protocol = protocol;
+            entry.frontOffset = frontOffset;
+            entry.backOffset = backOffset;
+            entry.protocolDataUnit = protocolDataUnit;
+            entry.isSimplyEncapsulatedPacket = isSimplyEncapsulatedPacket;
+        }
     }
-    const auto& protocolDataUnit = pduTreeBuilder.getTopLevelPdu();
     if (protocolDataUnit != nullptr) {
-        if (pduTreeBuilder.isSimplyEncapsulatedPacket() && isEnabledOption(options, "Print inside out"))
+        if (isSimplyEncapsulatedPacket && isEnabledOption(options, "Print inside out"))
             const_cast<PacketPrinter *>(this)->printPacketInsideOut(protocolDataUnit, options, context);
         else
             const_cast<PacketPrinter *>(this)->printPacketLeftToRight(protocolDataUnit, options, context);
@@ -8,6 +8,8 @@
 #ifndef __INET_PACKETPRINTER_H
 #define __INET_PACKETPRINTER_H
 
+#include <map>
+
 #include "inet/common/StringFormat.h"
 #include "inet/common/packet/dissector/PacketDissector.h"
 #include "inet/common/packet/printer/ProtocolPrinter.h"
@@ -44,8 +46,21 @@ class INET_API PacketPrinter : public cMessagePrinter
         virtual std::string resolveDirective(char directive) const override;
     };
 
+    class INET_API DissectionCacheEntry {
+      public:
+        Ptr<const Chunk> content; // keeps the packet content alive so that the key pointer cannot be reused for another chunk
+        const Protocol *protocol = nullptr;
+        b frontOffset = b(0);
+        b backOffset = b(0);
+        Ptr<const PacketDissector::ProtocolDataUnit> protocolDataUnit;
+        bool isSimplyEncapsulatedPacket = false;
+    };
+
   protected:
+    static constexpr size_t dissectionCacheLimit = 1024;
+
     mutable int numPacket = 0;
+    mutable std::map<const Chunk *, DissectionCacheEntry> dissectionCache; // dissection results of recently printed packets, see printPacket()
 
   protected:
     virtual bool isEnabledOption(const Options *options, const char *name) const;
@@ -11,31 +11,31 @@ namespace inet {
 
 ProtocolPrinterRegistry::~ProtocolPrinterRegistry()
 {
-    for (auto it : protocolPrinters)
-        delete it.second;
+    for (auto protocolPrinter : protocolPrinters)
+        delete protocolPrinter;
 }
 
 void ProtocolPrinterRegistry::registerProtocolPrinter(const Protocol *protocol, const ProtocolPrinter *printer)
 {
-    protocolPrinters[protocol] = printer;
+    size_t index = getIndex(protocol);
+    if (index >= protocolPrinters.size())
+        protocolPrinters.resize(index + 1, nullptr);
+    protocolPrinters[index] = printer;
 }
 
 const ProtocolPrinter *ProtocolPrinterRegistry::findProtocolPrinter(const Protocol *protocol) const
 {
-    auto it = protocolPrinters.find(protocol);
-    if (it != protocolPrinters.end())
-        return it->second;
-    else
-        return nullptr;
+    size_t index = getIndex(protocol);
+    return index < protocolPrinters.size() ? protocolPrinters[index] : nullptr;
 }
 
 const ProtocolPrinter *ProtocolPrinterRegistry::getProtocolPrinter(const Protocol *protocol) const
 {
-    auto it = protocolPrinters.find(protocol);
-    if (it != protocolPrinters.end())
-        return it->second;
+    auto protocolPrinter = findProtocolPrinter(protocol);
+    if (protocolPrinter != nullptr)
+        return protocolPrinter;
     else
-        throw cRuntimeError("Cannot find protocol printer for %s", protocol->getName());
+        throw cRuntimeError("Cannot find protocol printer for %s", protocol != nullptr ? protocol->getName() : "<default>");
 }
 
 ProtocolPrinterRegistry& ProtocolPrinterRegistry::getInstance()
@@ -210,6 +210,7 @@ class INET_API IPcapWriter
     virtual bool isOpen() const = 0;
 
     virtual void setFlush(bool flush) = 0;
+    virtual void setWriteBufferSize(size_t writeBufferSize) = 0;
 
     virtual void writePacket(simtime_t time, const Packet *packet, Direction direction, NetworkInterface *ie, PcapLinkType linkType) = 0;
 };
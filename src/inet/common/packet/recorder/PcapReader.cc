@@ -7,6 +7,7 @@
 
 #include "inet/common/packet/recorder/PcapReader.h"
 
+#include <algorithm>
 #include <cerrno>
 
 #include "inet/common/INETUtils.h"
@@ -51,6 +52,7 @@ void PcapReader::openPcap(const char *filename, const char *packetNameFormat)
         fh.snaplen = swapByteOrder32(fh.snaplen);
         fh.network = swapByteOrder32(fh.network);
     }
+    fileHeader = fh;
 }
 
 std::pair<simtime_t, Packet *> PcapReader::readPacket()
@@ -63,11 +65,6 @@ std::pair<simtime_t, Packet *> PcapReader::readPacket()
     auto err = fread(&packetHeader, sizeof(packetHeader), 1, file);
     if (err != 1)
         throw cRuntimeError("Cannot read packetheader, errno is %zu.", err);
-    uint8_t buffer[1 << 16];
-    memset(buffer, 0, sizeof(buffer));
-    err = fread(buffer, packetHeader.incl_len, 1, file);
-    if (err != 1)
-        throw cRuntimeError("Cannot read packet, errno is %zu.", err);
     if (swapByteOrder) {
         packetHeader.ts_sec = swapByteOrder32(packetHeader.ts_sec);
         packetHeader.ts_usec = swapByteOrder32(packetHeader.ts_usec);
@@ -75,13 +72,17 @@ std::pair<simtime_t, Packet *> PcapReader::readPacket()
         packetHeader.incl_len = swapByteOrder32(packetHeader.incl_len);
     }
     simtime_t time = SimTime(packetHeader.ts_sec, SIMTIME_S) + SimTime(packetHeader.ts_usec, SIMTIME_US);
-    std::vector<uint8_t> bytes;
     const Protocol *protocol = nullptr;
-    int offset = 0;
+    uint32_t offset = 0;
     switch (fileHeader.network) {
         case 0: {
             offset = 4;
-            auto type = *((uint32_t *)buffer);
+            uint32_t type;
+            err = fread(&type, sizeof(type), 1, file);
+            if (err != 1)
+                throw cRuntimeError("Cannot read packet, errno is %zu.", err);
+            if (swapByteOrder)
+                type = swapByteOrder32(type);
             switch (type) {
                 case 2: protocol = &Protocol::ipv4; break;
                 case 24: case 28: case 30: protocol = &Protocol::ipv6; break;
@@ -92,16 +93,25 @@ std::pair<simtime_t, Packet *> PcapReader::readPacket()
         case 105: protocol = &Protocol::ieee80211Mac; break;
         case 204: protocol = &Protocol::ppp; break;
     }
-    bytes.resize(packetHeader.orig_len - offset);
-    for (size_t i = 0; i < bytes.size(); i++)
-        bytes[i] = buffer[i + offset];
+    // read the captured bytes directly into the chunk data; the zero-initialized
+    // vector provides the padding of packets truncated at the capture snaplen
+    std::vector<uint8_t> bytes(packetHeader.orig_len - offset);
+    uint32_t numCapturedBytes = std::min(packetHeader.incl_len, packetHeader.orig_len);
+    numCapturedBytes = numCapturedBytes >= offset ? numCapturedBytes - offset : 0;
+    if (numCapturedBytes > 0) {
+        err = fread(bytes.data(), numCapturedBytes, 1, file);
+        if (err != 1)
+            throw cRuntimeError("Cannot read packet, errno is %zu.", err);
+    }
     const auto& data = makeShared<BytesChunk>(bytes);
     if (packetHeader.orig_len > packetHeader.incl_len)
         data->markIncomplete();
     auto packet = new Packet(nullptr, data);
     if (protocol != nullptr)
         packet->addTag<PacketProtocolTag>()->setProtocol(protocol);
-    packet->setName(packetPrinter.printPacketToString(packet, packetNameFormat).c_str());
+    // formatting the name dissects the packet, don't pay for it when no name is asked for
+    if (!opp_isempty(packetNameFormat))
+        packet->setName(packetPrinter.printPacketToString(packet, packetNameFormat).c_str());
     return { time, packet };
 }
 
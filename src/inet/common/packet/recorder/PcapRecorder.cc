@@ -44,6 +44,8 @@ void PcapRecorder::initialize()
     verbose = par("verbose");
     snaplen = this->par("snaplen");
     dumpBadFrames = par("dumpBadFrames");
+    startTime = par("startTime");
+    stopTime = par("stopTime");
     signalList.clear();
     packetFilter.setExpression(par("packetFilter").objectValue());
 
@@ -121,6 +123,7 @@ void PcapRecorder::initialize()
         throw cRuntimeError("Unknown fileFormat parameter");
     recordPcap = *file != '\0';
     if (recordPcap) {
+        pcapWriter->setWriteBufferSize(par("writeBufferSize").intValue());
         pcapWriter->open(file, snaplen);
         pcapWriter->setFlush(par("alwaysFlush"));
     }
@@ -160,6 +163,11 @@ void PcapRecorder::receiveSignal(cComponent *source, simsignal_t signalID, cObje
 {
     Enter_Method("%s", cComponent::getSignalName(signalID));
 
+    // ignore packets outside the recording interval before any filtering or dumping work
+    simtime_t now = simTime();
+    if (now < startTime || (stopTime >= SIMTIME_ZERO && now > stopTime))
+        return;
+
     if (pcapWriter->isOpen()) {
         cPacket *packet = dynamic_cast<cPacket *>(obj);
 
@@ -43,6 +43,8 @@ class INET_API PcapRecorder : public cSimpleModule, protected cListener, public
     IPcapWriter *pcapWriter = nullptr;
     unsigned int snaplen = 0;
     bool dumpBadFrames = false;
+    simtime_t startTime;
+    simtime_t stopTime;
     PacketFilter packetFilter;
     int numRecorded = 0;
     bool verbose = false;
@@ -17,9 +17,7 @@
 
 namespace inet {
 
-#define MAXBUFLENGTH    65536
-
-#define PCAP_MAGIC      0xa1b2c3d4
+#define PCAP_MAGIC    0xa1b2c3d4
 
 /* "libpcap" file header (minus magic number). */
 struct pcap_hdr
@@ -59,6 +57,11 @@ void PcapWriter::open(const char *filename, unsigned int snaplen_par)
     if (!dumpfile)
         throw cRuntimeError("Cannot open pcap file [%s] for writing: %s", filename, strerror(errno));
 
+    if (writeBufferSize != 0) {
+        writeBuffer.resize(writeBufferSize);
+        setvbuf(dumpfile, writeBuffer.data(), _IOFBF, writeBufferSize);
+    }
+
     snaplen = snaplen_par;
     needHeader = true;
     network = LINKTYPE_INVALID;
@@ -101,22 +104,17 @@ void PcapWriter::writePacket(simtime_t stime, const Packet *packet, Direction di
     (void)ie; // unused
 
     EV_INFO << "Writing packet" << EV_FIELD(packet) << EV_FIELD(fileName) << EV_ENDL;
-    uint8_t buf[MAXBUFLENGTH];
-    memset(buf, 0, sizeof(buf));
 
     struct pcaprec_hdr ph;
     ph.ts_sec = (int32_t)stime.inUnit(SIMTIME_S);
     ph.ts_usec = (uint32_t)(stime.inUnit(SIMTIME_US) - (uint32_t)1000000 * stime.inUnit(SIMTIME_S));
     auto data = packet->peekDataAsBytes();
     auto bytes = data->getBytes();
-    for (size_t i = 0; i < bytes.size(); i++) {
-        buf[i] = bytes[i];
-    }
     ph.orig_len = B(data->getChunkLength()).get();
 
     ph.incl_len = ph.orig_len > snaplen ? snaplen : ph.orig_len;
     fwrite(&ph, sizeof(ph), 1, dumpfile);
-    fwrite(buf, ph.incl_len, 1, dumpfile);
+    fwrite(bytes.data(), ph.incl_len, 1, dumpfile);
     if (flush)
         fflush(dumpfile);
 }
@@ -31,6 +31,8 @@ class INET_API PcapWriter : public IPcapWriter
     PcapLinkType network = LINKTYPE_INVALID; // the network type header field in the PCAP file, see http://www.tcpdump.org/linktypes.html
     bool flush = false;
     bool needHeader = true;
+    size_t writeBufferSize = 0; // size of the stdio output buffer, 0 means the stdio default
+    std::vector<char> writeBuffer;
 
   protected:
     void writeHeader(PcapLinkType linkType);
@@ -73,6 +75,13 @@ class INET_API PcapWriter : public IPcapWriter
      * Force flushing of pcap dump.
      */
     void setFlush(bool flush) override { this->flush = flush; }
+
+    /**
+     * Sets the size of the stdio output buffer used by subsequent open()
+     * calls; 0 means the stdio default. Larger buffers reduce the number
+     * of write system calls when recording large traces.
+     */
+    void setWriteBufferSize(size_t writeBufferSize) override { this->writeBufferSize = writeBufferSize; }
 };
 
 } // namespace inet
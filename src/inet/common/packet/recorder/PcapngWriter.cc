@@ -95,6 +95,11 @@ void PcapngWriter::open(const char *filename, unsigned int snaplen)
     if (!dumpfile)
         throw cRuntimeError("Cannot open pcap file [%s] for writing: %s", filename, strerror(errno));
 
+    if (writeBufferSize != 0) {
+        writeBuffer.resize(writeBufferSize);
+        setvbuf(dumpfile, writeBuffer.data(), _IOFBF, writeBufferSize);
+    }
+
     flush = false;
 
     // header
@@ -24,6 +24,8 @@ class INET_API PcapngWriter : public IPcapWriter
     std::string fileName;
     FILE *dumpfile = nullptr; // pcap file
     bool flush = false;
+    size_t writeBufferSize = 0; // size of the stdio output buffer, 0 means the stdio default
+    std::vector<char> writeBuffer;
     int nextPcapngInterfaceId = 0;
     std::map<int, int> interfaceModuleIdToPcapngInterfaceId;
 
@@ -69,6 +71,13 @@ class INET_API PcapngWriter : public IPcapWriter
      * Force flushing of pcap dump.
      */
     void setFlush(bool flush) override { this->flush = flush; }
+
+    /**
+     * Sets the size of the stdio output buffer used by subsequent open()
+     * calls; 0 means the stdio default. Larger buffers reduce the number
+     * of write system calls when recording large traces.
+     */
+    void setWriteBufferSize(size_t writeBufferSize) override { this->writeBufferSize = writeBufferSize; }
 };
 
 } // namespace inet
@@ -28,7 +28,7 @@ const Ptr<Chunk> BytesChunkSerializer::deserialize(MemoryInputStream& stream, co
     B length = stream.getRemainingLength();
     std::vector<uint8_t> chunkBytes;
     stream.readBytes(chunkBytes, length);
-    bytesChunk->setBytes(chunkBytes);
+    bytesChunk->setBytes(std::move(chunkBytes));
     ChunkSerializer::totalDeserializedLength += length;
     return bytesChunk;
 }
@@ -18,14 +18,21 @@ ChunkSerializerRegistry::~ChunkSerializerRegistry()
 void ChunkSerializerRegistry::registerSerializer(const std::type_info& typeInfo, const ChunkSerializer *serializer)
 {
     CHUNK_CHECK_USAGE(serializer != nullptr, "invalid serializer");
-    serializers[&typeInfo] = serializer;
+    serializers[std::type_index(typeInfo)] = serializer;
+    lastTypeInfo = nullptr;
+    lastSerializer = nullptr;
 }
 
 const ChunkSerializer *ChunkSerializerRegistry::getSerializer(const std::type_info& typeInfo) const
 {
-    auto it = serializers.find(&typeInfo);
-    if (it != serializers.end())
+    if (&typeInfo == lastTypeInfo)
+        return lastSerializer;
+    auto it = serializers.find(std::type_index(typeInfo));
+    if (it != serializers.end()) {
+        lastTypeInfo = &typeInfo;
+        lastSerializer = it->second;
         return it->second;
+    }
     else
         throw cRuntimeError("Cannot find serializer for %s", opp_typename(typeInfo));
 }
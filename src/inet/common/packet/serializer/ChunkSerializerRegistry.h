@@ -8,6 +8,9 @@
 #ifndef __INET_CHUNKSERIALIZERREGISTRY_H
 #define __INET_CHUNKSERIALIZERREGISTRY_H
 
+#include <typeindex>
+#include <unordered_map>
+
 #include "inet/common/packet/serializer/ChunkSerializer.h"
 
 namespace inet {
@@ -17,7 +20,12 @@ namespace inet {
 class INET_API ChunkSerializerRegistry
 {
   protected:
-    std::map<const std::type_info *, const ChunkSerializer *> serializers;
+    std::unordered_map<std::type_index, const ChunkSerializer *> serializers;
+    // memo of the last successful lookup; serialization typically processes
+    // runs of chunks of the same class, so most lookups are answered with a
+    // single pointer comparison instead of a hash table search
+    mutable const std::type_info *lastTypeInfo = nullptr;
+    mutable const ChunkSerializer *lastSerializer = nullptr;
 
   public:
     ~ChunkSerializerRegistry();
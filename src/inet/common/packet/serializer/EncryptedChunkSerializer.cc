@@ -0,0 +1,63 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#include "inet/common/packet/serializer/EncryptedChunkSerializer.h"
+
+#include "inet/common/packet/chunk/BytesChunk.h"
+#include "inet/common/packet/chunk/EncryptedChunk.h"
+#include "inet/common/packet/serializer/ChunkSerializerRegistry.h"
+
+namespace inet {
+
+Register_Serializer(EncryptedChunk, EncryptedChunkSerializer);
+
+// The model doesn't implement real cryptography; the serialized bytes of the
+// wrapped chunk are XORed with this mask as a stand-in, so the plaintext
+// doesn't appear verbatim in the output but deserialization can recover it.
+static const uint8_t encryptionMask = 0x3A;
+
+void EncryptedChunkSerializer::serialize(MemoryOutputStream& stream, const Ptr<const Chunk>& chunk, b offset, b length) const
+{
+    const auto& encryptedChunk = staticPtrCast<const EncryptedChunk>(chunk);
+    b encryptedLength = encryptedChunk->getChunkLength();
+    b dataLength = length == b(-1) ? encryptedLength - offset : length;
+    MemoryOutputStream chunkStream(encryptedLength);
+    Chunk::serialize(chunkStream, encryptedChunk->getChunk());
+    // the encrypted representation may be longer than the original data
+    // (e.g. initialization vector, cipher block padding), fill the difference
+    if (chunkStream.getLength() < encryptedLength)
+        chunkStream.writeBitRepeatedly(false, b(encryptedLength - chunkStream.getLength()).get());
+    if (offset.get() % 8 == 0 && dataLength.get() % 8 == 0) {
+        std::vector<uint8_t> bytes;
+        chunkStream.copyData(bytes, B(offset), B(dataLength));
+        for (auto& byte : bytes)
+            byte ^= encryptionMask;
+        stream.writeBytes(bytes);
+    }
+    else {
+        std::vector<bool> bits;
+        chunkStream.copyData(bits, offset, dataLength);
+        for (size_t i = 0; i < bits.size(); i++)
+            stream.writeBit(bits[i] != (((encryptionMask >> (7 - i % 8)) & 1) != 0));
+    }
+}
+
+const Ptr<Chunk> EncryptedChunkSerializer::deserialize(MemoryInputStream& stream, const std::type_info& typeInfo) const
+{
+    b encryptedLength = stream.getRemainingLength();
+    if (encryptedLength.get() % 8 != 0)
+        throw cRuntimeError("Cannot deserialize encrypted chunk: length is not byte aligned");
+    std::vector<uint8_t> bytes;
+    stream.readBytes(bytes, B(encryptedLength));
+    for (auto& byte : bytes)
+        byte ^= encryptionMask;
+    auto data = makeShared<BytesChunk>(bytes);
+    data->markImmutable();
+    return makeShared<EncryptedChunk>(data, encryptedLength);
+}
+
+} // namespace
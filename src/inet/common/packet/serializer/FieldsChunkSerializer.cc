@@ -45,8 +45,7 @@ void FieldsChunkSerializer::serialize(MemoryOutputStream& stream, const Ptr<cons
         serialize(chunkStream, fieldsChunk);
         stream.writeBytes(chunkStream.getData(), offset, length);
         ChunkSerializer::totalSerializedLength += chunkStream.getLength();
-        auto serializedBytes = new std::vector<uint8_t>();
-        chunkStream.copyData(*serializedBytes);
+        auto serializedBytes = new std::vector<uint8_t>(chunkStream.extractData());
         fieldsChunk->setSerializedBytes(serializedBytes);
         CHUNK_CHECK_USAGE(B(serializedBytes->size()) == chunk->getChunkLength(), "serialized length is incorrect: serialized=%zu, chunk=%" PRId64, serializedBytes->size(), B(chunk->getChunkLength()).get());
     }
@@ -60,58 +60,113 @@ void ScenarioManager::initialize()
     WATCH(numChanges);
     WATCH(numDone);
 
+    // compile the script into the typed operation schedule, grouping all
+    // commands scheduled for the same time into a single entry
+    std::map<simtime_t, int> timeToScheduleIndex;
     for (cXMLElement *node = script->getFirstChild(); node; node = node->getNextSibling()) {
         // check attr t is present
         const char *tAttr = node->getAttribute(ATTR_T);
         if (!tAttr)
             throw cRuntimeError("Attribute 't' missing at %s", node->getSourceLocation());
 
-        // schedule self-message
         simtime_t t = SimTime::parse(tAttr);
-        auto msg = new ScenarioTimer("scenario-event");
-        msg->setXmlNode(node);
-        scheduleAt(t, msg);
+        auto it = timeToScheduleIndex.find(t);
+        if (it == timeToScheduleIndex.end()) {
+            it = timeToScheduleIndex.insert(std::make_pair(t, (int)schedule.size())).first;
+            schedule.push_back(ScheduleEntry());
+            schedule.back().time = t;
+        }
+        schedule[it->second].commands.push_back(compileCommand(node));
 
         // count it
         numChanges++;
     }
+
+    // schedule one self-message per schedule entry
+    for (size_t i = 0; i < schedule.size(); i++) {
+        auto msg = new ScenarioTimer("scenario-event");
+        msg->setScheduleIndex(i);
+        scheduleAt(schedule[i].time, msg);
+    }
 }
 
 void ScenarioManager::handleMessage(cMessage *msg)
 {
-    auto node = check_and_cast<ScenarioTimer *>(msg)->getXmlNode();
+    int scheduleIndex = check_and_cast<ScenarioTimer *>(msg)->getScheduleIndex();
     delete msg;
 
-    processCommand(node);
+    for (auto& command : schedule[scheduleIndex].commands) {
+        processCommand(command);
+        numDone++;
+    }
+}
 
-    numDone++;
+ScenarioManager::Command ScenarioManager::compileCommand(const cXMLElement *node)
+{
+    Command command;
+    command.node = node;
+    std::string tag = node->getTagName();
+    if (tag == CMD_AT) {
+        command.kind = CK_AT;
+        for (const cXMLElement *child = node->getFirstChild(); child; child = child->getNextSibling())
+            command.commands.push_back(compileCommand(child));
+    }
+    else if (tag == CMD_SET_PARAM)
+        command.kind = CK_SET_PARAM;
+    else if (tag == CMD_SET_CHANNEL_PARAM)
+        command.kind = CK_SET_CHANNEL_PARAM;
+    else if (tag == CMD_CREATE_MODULE)
+        command.kind = CK_CREATE_MODULE;
+    else if (tag == CMD_DELETE_MODULE)
+        command.kind = CK_DELETE_MODULE;
+    else if (tag == CMD_CONNECT)
+        command.kind = CK_CONNECT;
+    else if (tag == CMD_DISCONNECT)
+        command.kind = CK_DISCONNECT;
+    else if (tag == CMD_INITIATE || tag == OP_START || tag == OP_STARTUP || tag == OP_STOP
+             || tag == OP_SHUTDOWN || tag == OP_CRASH || tag == OP_SUSPEND || tag == OP_RESUME)
+        command.kind = CK_LIFECYCLE;
+    else
+        command.kind = CK_MODULE_SPECIFIC; // resolved at runtime, the target module may not exist yet
+    return command;
 }
 
-void ScenarioManager::processCommand(const cXMLElement *node)
+void ScenarioManager::processCommand(const Command& command)
 {
+    const cXMLElement *node = command.node;
     try {
-        std::string tag = node->getTagName();
-        EV << "processing <" << tag << "> command...\n";
-
-        if (tag == CMD_AT)
-            processAtCommand(node);
-        else if (tag == CMD_SET_PARAM)
-            processSetParamCommand(node);
-        else if (tag == CMD_SET_CHANNEL_PARAM)
-            processSetChannelParamCommand(node);
-        else if (tag == CMD_CREATE_MODULE)
-            processCreateModuleCommand(node);
-        else if (tag == CMD_DELETE_MODULE)
-            processDeleteModuleCommand(node);
-        else if (tag == CMD_CONNECT)
-            processConnectCommand(node);
-        else if (tag == CMD_DISCONNECT)
-            processDisconnectCommand(node);
-        else if (tag == CMD_INITIATE || tag == OP_START || tag == OP_STARTUP || tag == OP_STOP
-                 || tag == OP_SHUTDOWN || tag == OP_CRASH || tag == OP_SUSPEND || tag == OP_RESUME)
-            processLifecycleCommand(node);
-        else
-            processModuleSpecificCommand(node);
+        EV << "processing <" << node->getTagName() << "> command...\n";
+
+        switch (command.kind) {
+            case CK_AT:
+                for (auto& child : command.commands)
+                    processCommand(child);
+                break;
+            case CK_SET_PARAM:
+                processSetParamCommand(node);
+                break;
+            case CK_SET_CHANNEL_PARAM:
+                processSetChannelParamCommand(node);
+                break;
+            case CK_CREATE_MODULE:
+                processCreateModuleCommand(node);
+                break;
+            case CK_DELETE_MODULE:
+                processDeleteModuleCommand(node);
+                break;
+            case CK_CONNECT:
+                processConnectCommand(node);
+                break;
+            case CK_DISCONNECT:
+                processDisconnectCommand(node);
+                break;
+            case CK_LIFECYCLE:
+                processLifecycleCommand(node);
+                break;
+            case CK_MODULE_SPECIFIC:
+                processModuleSpecificCommand(node);
+                break;
+        }
     }
     catch (std::exception& e) {
         throw cRuntimeError("%s, in command <%s> at %s", e.what(), node->getTagName(), node->getSourceLocation());
@@ -219,12 +274,6 @@ ScenarioManager::GatePair ScenarioManager::getConnection(const cXMLElement *node
     }
 }
 
-void ScenarioManager::processAtCommand(const cXMLElement *node)
-{
-    for (const cXMLElement *child = node->getFirstChild(); child; child = child->getNextSibling())
-        processCommand(child);
-}
-
 void ScenarioManager::processModuleSpecificCommand(const cXMLElement *node)
 {
     // find which module we'll need to invoke
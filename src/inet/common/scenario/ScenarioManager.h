@@ -34,6 +34,10 @@ class INET_API cPostModuleInitNotification : public cModelChangeNotification
  * the IScriptable interface. The \<at> built-in command can be used to
  * group commands to be carried out at the same simulation time.
  *
+ * The script is compiled at initialization into a typed operation schedule,
+ * so command tags are resolved once and all commands scheduled for the same
+ * time are applied in a single event.
+ *
  * See NED file for details.
  *
  * @see IScriptable
@@ -41,6 +45,32 @@ class INET_API cPostModuleInitNotification : public cModelChangeNotification
 class INET_API ScenarioManager : public cSimpleModule, public LifecycleController
 {
   protected:
+    enum CommandKind {
+        CK_AT,
+        CK_SET_PARAM,
+        CK_SET_CHANNEL_PARAM,
+        CK_CREATE_MODULE,
+        CK_DELETE_MODULE,
+        CK_CONNECT,
+        CK_DISCONNECT,
+        CK_LIFECYCLE,
+        CK_MODULE_SPECIFIC,
+    };
+
+    struct Command {
+        CommandKind kind = CK_MODULE_SPECIFIC;
+        const cXMLElement *node = nullptr;
+        std::vector<Command> commands; // compiled children of an <at> block
+    };
+
+    struct ScheduleEntry {
+        simtime_t time;
+        std::vector<Command> commands; // commands of all script nodes scheduled for this time, in document order
+    };
+
+    // precompiled operation schedule, one entry per distinct time
+    std::vector<ScheduleEntry> schedule;
+
     // total number of changes, and number of changes already done
     int numChanges = 0;
     int numDone = 0;
@@ -57,11 +87,13 @@ class INET_API ScenarioManager : public cSimpleModule, public LifecycleControlle
     void disconnect(cGate *srcGate);
     void createConnection(const cXMLElementList& paramList, cChannelType *channelType, cGate *srcGate, cGate *destGate);
 
+    // compilation of the script into the typed operation schedule
+    virtual Command compileCommand(const cXMLElement *node);
+
     // dispatch to command processors
-    virtual void processCommand(const cXMLElement *node);
+    virtual void processCommand(const Command& command);
 
     // command processors
-    virtual void processAtCommand(const cXMLElement *node);
     virtual void processSetParamCommand(const cXMLElement *node);
     virtual void processSetChannelParamCommand(const cXMLElement *node);
     virtual void processCreateModuleCommand(const cXMLElement *node);
@@ -83,4 +115,3 @@ class INET_API ScenarioManager : public cSimpleModule, public LifecycleControlle
 } // namespace inet
 
 #endif
-
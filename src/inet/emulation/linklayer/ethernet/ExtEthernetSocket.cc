@@ -66,12 +66,15 @@ void ExtEthernetSocket::handleMessage(cMessage *message)
     socket_address.sll_addr[4] = macAddress.getAddressByte(4);
     socket_address.sll_addr[5] = macAddress.getAddressByte(5);
 
-    uint8_t buffer[packet->getByteLength()];
-    auto bytesChunk = packet->peekAllAsBytes();
-    size_t packetLength = bytesChunk->copyToBuffer(buffer, sizeof(buffer));
+    // serialize directly into the send buffer; chunks deserialized at ingress
+    // reuse their cached backing bytes, only mutated chunks are re-serialized
+    MemoryOutputStream stream(packet->getTotalLength());
+    Chunk::serialize(stream, packet->peekAll());
+    const std::vector<uint8_t>& bytes = stream.getData();
+    size_t packetLength = bytes.size();
     ASSERT(packetLength == (size_t)packet->getByteLength());
 
-    int sent = sendto(fd, buffer, packetLength, 0, (struct sockaddr *)&socket_address, sizeof(socket_address));
+    int sent = sendto(fd, bytes.data(), packetLength, 0, (struct sockaddr *)&socket_address, sizeof(socket_address));
     if ((size_t)sent == packetLength)
         EV_INFO << "Sent " << packetLength << " packet to '" << device << "' device.\n";
     else
@@ -148,28 +151,39 @@ bool ExtEthernetSocket::notify(int fd)
 {
     Enter_Method("notify");
     ASSERT(this->fd == fd);
+    bool receivedAny = false;
     uint8_t buffer[1 << 16];
-    memset(&buffer, 0, sizeof(buffer));
-    // type of buffer in recvfrom(): win: char *, linux: void *
-    int n = ::recv(fd, (char *)buffer, sizeof(buffer), 0);
-    if (n < 0)
-        throw cRuntimeError("Calling recvfrom failed: %d", n);
-    n = std::max(n, ETHER_MIN_LEN - 4);
-    uint32_t checksum = htonl(ethernetCRC(buffer, n));
-    memcpy(&buffer[n], &checksum, sizeof(checksum));
-    auto data = makeShared<BytesChunk>(static_cast<const uint8_t *>(buffer), n + 4);
-    auto packet = new Packet(nullptr, data);
-    auto networkInterface = check_and_cast<NetworkInterface *>(getContainingNicModule(this));
-    packet->addTag<InterfaceInd>()->setInterfaceId(networkInterface->getInterfaceId());
-    packet->addTag<PacketProtocolTag>()->setProtocol(&Protocol::ethernetMac);
-    packet->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ethernetMac);
-    packet->setName(packetPrinter.printPacketToString(packet, packetNameFormat).c_str());
-    emit(packetReceivedSignal, packet);
-    numReceived++;
-    EV_INFO << "Received " << packet->getDataLength() << " packet from '" << device << "' device.\n";
-    send(packet, "upperLayerOut");
-    emit(packetSentToUpperSignal, packet);
-    return true;
+    // drain all frames queued on the socket to avoid a scheduler poll cycle per frame
+    while (true) {
+        // zero the padding of frames shorter than the minimum ethernet frame length
+        memset(&buffer, 0, ETHER_MIN_LEN);
+        // type of buffer in recvfrom(): win: char *, linux: void *
+        int n = ::recv(fd, (char *)buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            throw cRuntimeError("Calling recvfrom failed: %d", n);
+        }
+        n = std::max(n, ETHER_MIN_LEN - 4);
+        uint32_t checksum = htonl(ethernetCRC(buffer, n));
+        memcpy(&buffer[n], &checksum, sizeof(checksum));
+        auto data = makeShared<BytesChunk>(static_cast<const uint8_t *>(buffer), n + 4);
+        auto packet = new Packet(nullptr, data);
+        auto networkInterface = check_and_cast<NetworkInterface *>(getContainingNicModule(this));
+        packet->addTag<InterfaceInd>()->setInterfaceId(networkInterface->getInterfaceId());
+        packet->addTag<PacketProtocolTag>()->setProtocol(&Protocol::ethernetMac);
+        packet->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ethernetMac);
+        // formatting the name dissects the packet, don't pay for it when no name is asked for
+        if (!opp_isempty(packetNameFormat))
+            packet->setName(packetPrinter.printPacketToString(packet, packetNameFormat).c_str());
+        emit(packetReceivedSignal, packet);
+        numReceived++;
+        EV_INFO << "Received " << packet->getDataLength() << " packet from '" << device << "' device.\n";
+        send(packet, "upperLayerOut");
+        emit(packetSentToUpperSignal, packet);
+        receivedAny = true;
+    }
+    return receivedAny;
 }
 
 } // namespace inet
@@ -59,16 +59,18 @@ void ExtEthernetTapDevice::handleMessage(cMessage *msg)
         throw cRuntimeError("Accepts ethernet packets only");
     const auto& ethHeader = packet->peekAtFront<EthernetMacHeader>();
     packet->popAtBack<EthernetFcs>(ETHER_FCS_BYTES);
-    auto bytesChunk = packet->peekDataAsBytes();
-    uint8_t buffer[packet->getByteLength() + 4];
-    buffer[0] = 0;
-    buffer[1] = 0;
-    buffer[2] = 0x86; // Ethernet
-    buffer[3] = 0xdd;
-    size_t packetLength = bytesChunk->copyToBuffer(buffer + 4, packet->getByteLength());
-    ASSERT(packetLength == (size_t)packet->getByteLength());
-    packetLength += 4;
-    ssize_t nwrite = write(fd, buffer, packetLength);
+    // serialize directly into the send buffer; chunks deserialized at ingress
+    // reuse their cached backing bytes, only mutated chunks are re-serialized
+    MemoryOutputStream stream(packet->getDataLength() + B(4));
+    stream.writeByte(0);
+    stream.writeByte(0);
+    stream.writeByte(0x86); // Ethernet
+    stream.writeByte(0xdd);
+    Chunk::serialize(stream, packet->peekData());
+    const std::vector<uint8_t>& buffer = stream.getData();
+    size_t packetLength = buffer.size();
+    ASSERT(packetLength == (size_t)packet->getByteLength() + 4);
+    ssize_t nwrite = write(fd, buffer.data(), packetLength);
     if ((size_t)nwrite == packetLength) {
         emit(packetSentSignal, packet);
         EV_INFO << "Sent a " << incomingPacketLength << " packet from " << ethHeader->getSrc() << " to " << ethHeader->getDest() << " to TAP device '" << device << "'.\n";
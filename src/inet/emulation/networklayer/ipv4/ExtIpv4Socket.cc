@@ -60,13 +60,16 @@ void ExtIpv4Socket::handleMessage(cMessage *msg)
 #endif // if !defined(linux) && !defined(__linux__) && !defined(_WIN32)
     ip_addr.sin_port = htons(0);
 
-    auto bytesChunk = packet->peekAllAsBytes();
-    uint8_t buffer[1 << 16];
-    size_t packetLength = bytesChunk->copyToBuffer(buffer, sizeof(buffer));
+    // serialize directly into the send buffer; chunks deserialized at ingress
+    // reuse their cached backing bytes, only mutated chunks are re-serialized
+    MemoryOutputStream stream(packet->getTotalLength());
+    Chunk::serialize(stream, packet->peekAll());
+    const std::vector<uint8_t>& buffer = stream.getData();
+    size_t packetLength = buffer.size();
     ASSERT(packetLength == (size_t)packet->getByteLength());
 
-//    int sent = ::send(fd, buffer, packetLength, 0);
-    int sent = sendto(fd, buffer, packetLength, 0, (struct sockaddr *)&ip_addr, sizeof(ip_addr));
+//    int sent = ::send(fd, buffer.data(), packetLength, 0);
+    int sent = sendto(fd, buffer.data(), packetLength, 0, (struct sockaddr *)&ip_addr, sizeof(ip_addr));
     if ((size_t)sent == packetLength)
         EV << "Sent " << sent << " bytes packet.\n";
     else
@@ -116,7 +119,6 @@ bool ExtIpv4Socket::notify(int fd)
     Enter_Method("notify");
     ASSERT(this->fd == fd);
     uint8_t buffer[1 << 16];
-    memset(&buffer, 0, sizeof(buffer));
     // type of buffer in recvfrom(): win: char *, linux: void *
     int n = ::recv(fd, (char *)buffer, sizeof(buffer), 0);
     if (n < 0)
@@ -125,7 +127,9 @@ bool ExtIpv4Socket::notify(int fd)
     auto packet = new Packet(nullptr, data);
     packet->addTag<PacketProtocolTag>()->setProtocol(&Protocol::ipv4);
     packet->addTag<DispatchProtocolReq>()->setProtocol(&Protocol::ipv4);
-    packet->setName(packetPrinter.printPacketToString(packet, packetNameFormat).c_str());
+    // formatting the name dissects the packet, don't pay for it when no name is asked for
+    if (!opp_isempty(packetNameFormat))
+        packet->setName(packetPrinter.printPacketToString(packet, packetNameFormat).c_str());
     emit(packetReceivedSignal, packet);
     send(packet, "upperLayerOut");
     emit(packetSentToUpperSignal, packet);
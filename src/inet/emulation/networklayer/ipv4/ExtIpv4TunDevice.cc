@@ -61,11 +61,14 @@ void ExtIpv4TunDevice::handleMessage(cMessage *msg)
     if (protocol != &Protocol::ipv4)
         throw cRuntimeError("Accepts IPv4 packets only");
     const auto& ipv4Header = packet->peekAtFront<Ipv4Header>();
-    auto bytesChunk = packet->peekDataAsBytes();
-    uint8_t buffer[packet->getByteLength()];
-    size_t packetLength = bytesChunk->copyToBuffer(buffer, packet->getByteLength());
+    // serialize directly into the send buffer; chunks deserialized at ingress
+    // reuse their cached backing bytes, only mutated chunks are re-serialized
+    MemoryOutputStream stream(packet->getDataLength());
+    Chunk::serialize(stream, packet->peekData());
+    const std::vector<uint8_t>& buffer = stream.getData();
+    size_t packetLength = buffer.size();
     ASSERT(packetLength == (size_t)packet->getByteLength());
-    ssize_t nwrite = write(fd, buffer, packetLength);
+    ssize_t nwrite = write(fd, buffer.data(), packetLength);
     if ((size_t)nwrite == packetLength) {
         emit(packetSentSignal, packet);
         EV_INFO << "Sent a " << packet->getDataLength() << " packet from " << ipv4Header->getSrcAddress() << " to " << ipv4Header->getDestAddress() << " to TUN device '" << device << "'.\n";
@@ -141,10 +144,12 @@ bool ExtIpv4TunDevice::notify(int fd)
         // KLUDGE
         packet->addTag<InterfaceReq>()->setInterfaceId(101);
         packet->addTag<PacketProtocolTag>()->setProtocol(&Protocol::ipv4);
-        packet->setName(packetPrinter.printPacketToString(packet, packetNameFormat).c_str());
+        // formatting the name dissects the packet, don't pay for it when no name is asked for
+        if (!opp_isempty(packetNameFormat))
+            packet->setName(packetPrinter.printPacketToString(packet, packetNameFormat).c_str());
         emit(packetReceivedSignal, packet);
-        const auto& ipv4Header = packet->peekAtFront<Ipv4Header>();
-        EV_INFO << "Received a " << packet->getDataLength() << " packet from " << ipv4Header->getSrcAddress() << " to " << ipv4Header->getDestAddress() << ".\n";
+        // the peek deserializes the header, only do it when the log is actually written
+        EV_INFO << "Received a " << packet->getDataLength() << " packet from " << packet->peekAtFront<Ipv4Header>()->getSrcAddress() << " to " << packet->peekAtFront<Ipv4Header>()->getDestAddress() << ".\n";
         send(packet, "lowerLayerOut");
         emit(packetSentToLowerSignal, packet);
         numReceived++;
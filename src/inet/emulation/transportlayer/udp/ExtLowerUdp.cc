@@ -36,6 +36,9 @@ void ExtLowerUdp::initialize(int stage)
     cSimpleModule::initialize(stage);
     if (stage == INITSTAGE_LOCAL) {
         packetNameFormat = par("packetNameFormat");
+        receiveBatchSize = par("receiveBatchSize");
+        if (receiveBatchSize < 1)
+            throw cRuntimeError("Invalid receiveBatchSize: %d", receiveBatchSize);
         if (auto scheduler = dynamic_cast<RealTimeScheduler *>(getSimulation()->getScheduler())) {
             rtScheduler = scheduler;
         }
@@ -255,9 +258,12 @@ void ExtLowerUdp::processPacketFromUpper(Packet *packet)
         throw cRuntimeError("Unknown socket");
     else {
         auto socket = it->second;
-        auto bytesChunk = packet->peekAllAsBytes();
-        uint8_t buffer[packet->getByteLength()];
-        size_t packetLength = bytesChunk->copyToBuffer(buffer, packet->getByteLength());
+        // serialize directly into the send buffer; chunks deserialized at ingress
+        // reuse their cached backing bytes, only mutated chunks are re-serialized
+        MemoryOutputStream stream(packet->getTotalLength());
+        Chunk::serialize(stream, packet->peekAll());
+        const std::vector<uint8_t>& buffer = stream.getData();
+        size_t packetLength = buffer.size();
         ASSERT(packetLength == (size_t)packet->getByteLength());
         if (auto addressReq = packet->findTag<L3AddressReq>()) {
             struct sockaddr_in sockaddr;
@@ -268,13 +274,13 @@ void ExtLowerUdp::processPacketFromUpper(Packet *packet)
             sockaddr.sin_len = sizeof(struct sockaddr_in);
 #endif
             // type of buffer in sendto(): win: char *, linux: void *
-            int n = ::sendto(socket->fd, (char *)buffer, packetLength, 0, (struct sockaddr *)&sockaddr, sizeof(sockaddr));
+            int n = ::sendto(socket->fd, (char *)buffer.data(), packetLength, 0, (struct sockaddr *)&sockaddr, sizeof(sockaddr));
             if (n < 0)
                 throw cRuntimeError("Calling sendto failed: %d", n);
         }
         else {
             // type of buffer in send(): win: char *, linux: void *
-            int n = ::send(socket->fd, (char *)buffer, packetLength, 0);
+            int n = ::send(socket->fd, (char *)buffer.data(), packetLength, 0);
             if (n < 0)
                 throw cRuntimeError("Calling send failed: %d", n);
         }
@@ -288,25 +294,57 @@ void ExtLowerUdp::processPacketFromLower(int fd)
     auto it = fdToSocketMap.find(fd);
     if (it == fdToSocketMap.end())
         throw cRuntimeError("Unknown socket");
-    else {
-        auto socket = it->second;
-        uint8_t buffer[1 << 16];
-        struct sockaddr_in sockaddr;
-        socklen_t socklen = sizeof(sockaddr);
-        // type of buffer in recvfrom(): win: char *, linux: void *
-        int n = ::recvfrom(fd, (char *)buffer, sizeof(buffer), 0, (struct sockaddr *)&sockaddr, &socklen);
+    auto socket = it->second;
+#if defined(__linux__)
+    if (receiveBatchSize > 1) {
+        // read several datagrams with a single syscall; MSG_DONTWAIT makes the call
+        // return with the datagrams available instead of waiting for a full batch
+        const size_t bufferSize = 1 << 16;
+        if (receiveBuffer.size() != receiveBatchSize * bufferSize)
+            receiveBuffer.resize(receiveBatchSize * bufferSize);
+        std::vector<struct mmsghdr> messageHeaders(receiveBatchSize);
+        std::vector<struct iovec> iovecs(receiveBatchSize);
+        std::vector<struct sockaddr_in> sockaddrs(receiveBatchSize);
+        for (int i = 0; i < receiveBatchSize; i++) {
+            iovecs[i].iov_base = receiveBuffer.data() + i * bufferSize;
+            iovecs[i].iov_len = bufferSize;
+            memset(&messageHeaders[i], 0, sizeof(messageHeaders[i]));
+            messageHeaders[i].msg_hdr.msg_iov = &iovecs[i];
+            messageHeaders[i].msg_hdr.msg_iovlen = 1;
+            messageHeaders[i].msg_hdr.msg_name = &sockaddrs[i];
+            messageHeaders[i].msg_hdr.msg_namelen = sizeof(sockaddrs[i]);
+        }
+        int n = recvmmsg(fd, messageHeaders.data(), receiveBatchSize, MSG_DONTWAIT, nullptr);
         if (n < 0)
-            throw cRuntimeError("Calling recv failed: %d", n);
-        auto data = makeShared<BytesChunk>(static_cast<const uint8_t *>(buffer), n);
-        auto packet = new Packet(nullptr, data);
-        packet->addTag<SocketInd>()->setSocketId(socket->socketId);
-        packet->addTag<L3AddressInd>()->setSrcAddress(Ipv4Address(ntohl(sockaddr.sin_addr.s_addr)));
-        packet->addTag<L4PortInd>()->setSrcPort(ntohs(sockaddr.sin_port));
-        packet->setName(packetPrinter.printPacketToString(packet, packetNameFormat).c_str());
-        emit(packetReceivedSignal, packet);
-        send(packet, "appOut");
-        emit(packetSentToUpperSignal, packet);
+            throw cRuntimeError("Calling recvmmsg failed: %d", n);
+        for (int i = 0; i < n; i++)
+            deliverPacket(socket, (uint8_t *)iovecs[i].iov_base, messageHeaders[i].msg_len, ntohl(sockaddrs[i].sin_addr.s_addr), ntohs(sockaddrs[i].sin_port));
+        return;
     }
+#endif
+    uint8_t buffer[1 << 16];
+    struct sockaddr_in sockaddr;
+    socklen_t socklen = sizeof(sockaddr);
+    // type of buffer in recvfrom(): win: char *, linux: void *
+    int n = ::recvfrom(fd, (char *)buffer, sizeof(buffer), 0, (struct sockaddr *)&sockaddr, &socklen);
+    if (n < 0)
+        throw cRuntimeError("Calling recv failed: %d", n);
+    deliverPacket(socket, buffer, n, ntohl(sockaddr.sin_addr.s_addr), ntohs(sockaddr.sin_port));
+}
+
+void ExtLowerUdp::deliverPacket(Socket *socket, const uint8_t *buffer, size_t length, uint32_t srcAddress, uint16_t srcPort)
+{
+    auto data = makeShared<BytesChunk>(buffer, length);
+    auto packet = new Packet(nullptr, data);
+    packet->addTag<SocketInd>()->setSocketId(socket->socketId);
+    packet->addTag<L3AddressInd>()->setSrcAddress(Ipv4Address(srcAddress));
+    packet->addTag<L4PortInd>()->setSrcPort(srcPort);
+    // formatting the name dissects the packet, don't pay for it when no name is asked for
+    if (!opp_isempty(packetNameFormat))
+        packet->setName(packetPrinter.printPacketToString(packet, packetNameFormat).c_str());
+    emit(packetReceivedSignal, packet);
+    send(packet, "appOut");
+    emit(packetSentToUpperSignal, packet);
 }
 
 } // namespace inet
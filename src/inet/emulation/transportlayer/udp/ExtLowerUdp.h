@@ -30,6 +30,8 @@ class INET_API ExtLowerUdp : public cSimpleModule, public ILifecycle, public Rea
     const char *packetNameFormat = nullptr;
     PacketPrinter packetPrinter;
     RealTimeScheduler *rtScheduler = nullptr;
+    int receiveBatchSize = 1;
+    std::vector<uint8_t> receiveBuffer; // receiveBatchSize slots of 64K each for batched reads, allocated on demand
     std::map<int, Socket *> socketIdToSocketMap;
     std::map<int, Socket *> fdToSocketMap;
 
@@ -46,6 +48,7 @@ class INET_API ExtLowerUdp : public cSimpleModule, public ILifecycle, public Rea
     virtual void close(int socketId);
     virtual void processPacketFromUpper(Packet *packet);
     virtual void processPacketFromLower(int fd);
+    virtual void deliverPacket(Socket *socket, const uint8_t *buffer, size_t length, uint32_t srcAddress, uint16_t srcPort);
 
   public:
     virtual ~ExtLowerUdp();
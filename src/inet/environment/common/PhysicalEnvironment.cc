@@ -251,7 +251,15 @@ void PhysicalEnvironment::parseObjects(cXMLElement *xml)
             throw cRuntimeError("Missing shape attribute of object");
         cStringTokenizer shapeTokenizer(shapeAttribute);
         const char *shapeType = shapeTokenizer.nextToken();
-        if (!strcmp(shapeType, "cuboid")) {
+        auto shapeIt = attributeToShapeMap.find(shapeAttribute);
+        if (shapeIt != attributeToShapeMap.end()) {
+            // identical shape definitions are shared between objects, so large
+            // models with many repeated shapes (e.g. city buildings) are built
+            // only once and stored only once
+            shape = shapeIt->second.first;
+            size = shapeIt->second.second;
+        }
+        else if (!strcmp(shapeType, "cuboid")) {
             if ((tok = shapeTokenizer.nextToken()) == nullptr)
                 throw cRuntimeError("Missing cuboid x at %s", element->getSourceLocation());
             size.x = atof(tok);
@@ -320,6 +328,8 @@ void PhysicalEnvironment::parseObjects(cXMLElement *xml)
         }
         if (!shape)
             throw cRuntimeError("Unknown shape '%s'", shapeAttribute);
+        if (shapeIt == attributeToShapeMap.end())
+            attributeToShapeMap[shapeAttribute] = std::make_pair(shape, size);
         // position
         Coord position = Coord::NIL;
         const char *positionAttribute = element->getAttribute("position");
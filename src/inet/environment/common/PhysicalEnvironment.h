@@ -60,6 +60,7 @@ class INET_API PhysicalEnvironment : public cModule, public IPhysicalEnvironment
     std::map<int, const Material *> idToMaterialMap;
     std::map<int, const PhysicalObject *> idToObjectMap;
     std::map<std::string, const Material *> nameToMaterialMap;
+    std::map<std::string, std::pair<const ShapeBase *, Coord>> attributeToShapeMap; // shares identical inline shape definitions (and their parsed sizes) between objects
     //@}
 
   protected:
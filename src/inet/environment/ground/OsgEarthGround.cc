@@ -28,9 +28,38 @@ void OsgEarthGround::initialize()
     map = sceneVisualizer->getMapNode()->getMap();
     elevationQuery = new osgEarth::ElevationQuery(map);
     coordinateSystem.reference(this, "coordinateSystemModule", true);
+    elevationCacheCellSize = par("elevationCacheCellSize");
 }
 
 Coord OsgEarthGround::computeGroundProjection(const Coord& position) const
+{
+    if (elevationCacheCellSize <= 0)
+        return computeRawGroundProjection(position);
+    // interpolate bilinearly between the lazily sampled projections of the
+    // surrounding cache grid points instead of querying the terrain dataset
+    double u = position.x / elevationCacheCellSize;
+    double v = position.y / elevationCacheCellSize;
+    int i = (int)std::floor(u);
+    int j = (int)std::floor(v);
+    double fx = u - i;
+    double fy = v - j;
+    const Coord& p00 = getGridProjection(i, j);
+    const Coord& p10 = getGridProjection(i + 1, j);
+    const Coord& p01 = getGridProjection(i, j + 1);
+    const Coord& p11 = getGridProjection(i + 1, j + 1);
+    return p00 * ((1 - fx) * (1 - fy)) + p10 * (fx * (1 - fy)) + p01 * ((1 - fx) * fy) + p11 * (fx * fy);
+}
+
+const Coord& OsgEarthGround::getGridProjection(int i, int j) const
+{
+    auto key = std::make_pair(i, j);
+    auto it = projectionCache.find(key);
+    if (it == projectionCache.end())
+        it = projectionCache.emplace(key, computeRawGroundProjection(Coord(i * elevationCacheCellSize, j * elevationCacheCellSize, 0))).first;
+    return it->second;
+}
+
+Coord OsgEarthGround::computeRawGroundProjection(const Coord& position) const
 {
     double elevation = 0;
     auto geoCoord = coordinateSystem->computeGeographicCoordinate(position);
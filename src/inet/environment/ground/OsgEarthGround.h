@@ -29,9 +29,15 @@ class INET_API OsgEarthGround : public IGround, public cModule
     osgEarth::Map *map = nullptr;
     osgEarth::ElevationQuery *elevationQuery = nullptr;
     ModuleRefByPar<IGeographicCoordinateSystem> coordinateSystem;
+    double elevationCacheCellSize = NaN;
+    // ground projections sampled lazily at the grid points of the cache lattice
+    mutable std::map<std::pair<int, int>, Coord> projectionCache;
 
     virtual void initialize() override;
 
+    virtual Coord computeRawGroundProjection(const Coord& position) const;
+    virtual const Coord& getGridProjection(int i, int j) const;
+
   public:
     virtual Coord computeGroundProjection(const Coord& position) const override;
     virtual Coord computeGroundNormal(const Coord& position) const override;
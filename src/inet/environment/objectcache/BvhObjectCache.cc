@@ -37,6 +37,10 @@ void BvhObjectCache::initialize(int stage)
     else if (stage == INITSTAGE_PHYSICAL_OBJECT_CACHE) {
         for (int i = 0; i < physicalEnvironment->getNumObjects(); i++)
             insertObject(physicalEnvironment->getObject(i));
+        // build the tree eagerly so queries only read an immutable snapshot
+        // and can be issued concurrently (e.g. from omp parallel sections)
+        if (!objects.empty())
+            bvhTree = new BvhTree(physicalEnvironment->getSpaceMin(), physicalEnvironment->getSpaceMax(), objects, 0, objects.size() - 1, BvhTree::Axis(axisOrder), leafCapacity);
     }
 }
 
@@ -60,6 +64,12 @@ void BvhObjectCache::visitObjects(const IVisitor *visitor, const LineSegment& li
     bvhTree->lineSegmentQuery(lineSegment, visitor);
 }
 
+void BvhObjectCache::refitCache()
+{
+    if (bvhTree != nullptr)
+        bvhTree->refit();
+}
+
 } // namespace physicalenvironment
 
 } // namespace inet
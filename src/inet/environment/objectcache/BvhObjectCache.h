@@ -46,6 +46,13 @@ class INET_API BvhObjectCache : public IObjectCache, public cModule
     virtual ~BvhObjectCache();
 
     virtual void visitObjects(const IVisitor *visitor, const LineSegment& lineSegment) const override;
+
+    /**
+     * Refits the bounding volumes of the tree to the current object positions
+     * without rebuilding it. To be called when objects moved; adding or
+     * removing objects still requires a rebuild (see insertObject()).
+     */
+    virtual void refitCache();
 };
 
 } // namespace physicalenvironment
@@ -104,9 +104,20 @@ void AckingMac::startTransmitting()
 {
     // if there's any control info, remove it; then encapsulate the packet
     MacAddress dest = currentTxFrame->getTag<MacAddressReq>()->getDestAddress();
-    Packet *msg = currentTxFrame->dup();
-    if (useAck && !dest.isBroadcast() && !dest.isMulticast() && !dest.isUnspecified()) // unicast
+    Packet *msg;
+    if (useAck && !dest.isBroadcast() && !dest.isMulticast() && !dest.isUnspecified()) { // unicast
+        // keep the original frame until the ack arrives, it may have to be reported lost
+        msg = currentTxFrame->dup();
         scheduleAfter(ackTimeout, ackTimeoutMsg);
+    }
+    else {
+        // no ack expected, transmit the frame itself instead of a copy; the radio only
+        // signals the transmission when the frame reaches it, so preset the cached
+        // transmission state to prevent dequeueing a second frame in between
+        msg = currentTxFrame;
+        currentTxFrame = nullptr;
+        transmissionState = IRadio::TRANSMISSION_STATE_TRANSMITTING;
+    }
 
     encapsulate(msg);
 
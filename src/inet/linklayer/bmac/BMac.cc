@@ -17,6 +17,7 @@
 #include "inet/linklayer/common/InterfaceTag_m.h"
 #include "inet/linklayer/common/MacAddressTag_m.h"
 #include "inet/networklayer/common/NetworkInterface.h"
+#include "inet/physicallayer/wireless/common/contract/packetlevel/IRadioMedium.h"
 
 namespace inet {
 
@@ -37,6 +38,7 @@ void BMac::initialize(int stage)
         checkInterval = par("checkInterval");
         useMacAcks = par("useMACAcks");
         maxTxAttempts = par("maxTxAttempts");
+        suppressIdleWakeUps = par("suppressIdleWakeUps");
         EV_DETAIL << "headerLength: " << headerLength << ", bitrate: " << bitrate << endl;
 
         nbTxDataPackets = 0;
@@ -61,6 +63,10 @@ void BMac::initialize(int stage)
         cModule *radioModule = check_and_cast<cModule *>(radio.get());
         radioModule->subscribe(IRadio::radioModeChangedSignal, this);
         radioModule->subscribe(IRadio::transmissionStateChangedSignal, this);
+        if (suppressIdleWakeUps) {
+            cModule *mediumModule = const_cast<cModule *>(check_and_cast<const cModule *>(radio->getMedium()));
+            mediumModule->subscribe(IRadioMedium::signalAddedSignal, this);
+        }
 
         // init the dropped packet info
         WATCH(macState);
@@ -243,7 +249,7 @@ void BMac::handleSelfMessage(cMessage *msg)
                 else {
                     EV_DETAIL << "State CCA, message CCA_TIMEOUT, new state SLEEP"
                               << endl;
-                    scheduleAfter(slotDuration, wakeup);
+                    scheduleWakeUp();
                     macState = SLEEP;
                     radio->setRadioMode(IRadio::RADIO_MODE_SLEEP);
                     return;
@@ -557,6 +563,18 @@ void BMac::receiveSignal(cComponent *source, simsignal_t signalID, intval_t valu
     }
 }
 
+void BMac::receiveSignal(cComponent *source, simsignal_t signalID, cObject *value, cObject *details)
+{
+    Enter_Method("%s", cComponent::getSignalName(signalID));
+
+    if (signalID == IRadioMedium::signalAddedSignal) {
+        // another node started transmitting; resume the duty cycle of a
+        // dormant node, so the preamble train is caught by the next CCA
+        if (macState == SLEEP && !wakeup->isScheduled() && isRelevantTransmission(check_and_cast<const ITransmission *>(value)))
+            scheduleAfter(SIMTIME_ZERO, wakeup);
+    }
+}
+
 void BMac::attachSignal(Packet *macPkt)
 {
     // calc signal duration
@@ -685,10 +703,26 @@ void BMac::scheduleWakeUp()
     // if something in the queue, wakeup soon.
     if (!txQueue->isEmpty())
         scheduleAfter(dblrand() * checkInterval, wakeup);
+    // nothing to send: stay dormant until a transmission starts on the medium
+    else if (suppressIdleWakeUps)
+        EV_DETAIL << "Queue empty, suppressing periodic wakeup until medium activity" << endl;
     else
         scheduleAfter(slotDuration, wakeup);
 }
 
+/**
+ * Check whether a transmission that just started on the medium may be audible
+ * at this node, based on the medium's maximum communication range.
+ */
+bool BMac::isRelevantTransmission(const ITransmission *transmission) const
+{
+    if (transmission->getTransmitterRadioId() == radio->getId())
+        return false;
+    m maxCommunicationRange = radio->getMedium()->getMediumLimitCache()->getMaxCommunicationRange();
+    return std::isnan(maxCommunicationRange.get()) ||
+           transmission->getStartPosition().distance(radio->getAntenna()->getMobility()->getCurrentPosition()) < maxCommunicationRange.get();
+}
+
 queueing::IPassivePacketSource *BMac::getProvider(const cGate *gate)
 {
     return (gate->getId() == upperLayerInGateId) ? txQueue.get() : nullptr;
@@ -698,10 +732,12 @@ void BMac::handleCanPullPacketChanged(const cGate *gate)
 {
     Enter_Method("handleCanPullPacketChanged");
     // force wakeup now
-    if (gate->getId() == upperLayerInGateId && (macState == SLEEP) && wakeup->isScheduled()
-            && canDequeuePacket())
-    {
-        rescheduleAfter(dblrand() * 0.1f, wakeup);
+    if (gate->getId() == upperLayerInGateId && (macState == SLEEP) && canDequeuePacket()) {
+        if (wakeup->isScheduled())
+            rescheduleAfter(dblrand() * 0.1f, wakeup);
+        // wake a dormant node that suppressed its periodic wakeup
+        else if (suppressIdleWakeUps)
+            scheduleAfter(dblrand() * 0.1f, wakeup);
     }
 }
 
@@ -81,6 +81,9 @@ class INET_API BMac : public MacProtocolBase, public IMacProtocol, public queuei
     /** @brief Handle control messages from lower layer */
     virtual void receiveSignal(cComponent *source, simsignal_t signalID, intval_t value, cObject *details) override;
 
+    /** @brief Handle medium activity notifications when idle wakeups are suppressed */
+    virtual void receiveSignal(cComponent *source, simsignal_t signalID, cObject *value, cObject *details) override;
+
     // IActivePacketSink:
     virtual queueing::IPassivePacketSource *getProvider(const cGate *gate) override;
     virtual void handleCanPullPacketChanged(const cGate *gate) override;
@@ -88,6 +91,7 @@ class INET_API BMac : public MacProtocolBase, public IMacProtocol, public queuei
 
   protected:
     void scheduleWakeUp();
+    bool isRelevantTransmission(const physicallayer::ITransmission *transmission) const;
 
     /** @brief The radio. */
     ModuleRefByPar<physicallayer::IRadio> radio;
@@ -182,6 +186,9 @@ class INET_API BMac : public MacProtocolBase, public IMacProtocol, public queuei
     /** @brief Maximum transmission attempts per data packet, when ACKs are
      * used */
     int maxTxAttempts = 0;
+    /** @brief Suppress the periodic wakeup while the queue is empty and resume
+     * the duty cycle when a transmission starts within communication range */
+    bool suppressIdleWakeUps = false;
     /** @brief Gather stats at the end of the simulation */
     bool stats = false;
 
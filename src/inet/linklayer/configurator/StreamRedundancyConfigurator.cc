@@ -7,6 +7,8 @@
 
 #include "inet/linklayer/configurator/StreamRedundancyConfigurator.h"
 
+#include <sstream>
+
 namespace inet {
 
 Define_Module(StreamRedundancyConfigurator);
@@ -17,6 +19,7 @@ void StreamRedundancyConfigurator::initialize(int stage)
     if (stage == INITSTAGE_LOCAL) {
         minVlanId = par("minVlanId");
         maxVlanId = par("maxVlanId");
+        incrementalReconfiguration = par("incrementalReconfiguration");
         configuration = check_and_cast<cValueArray *>(par("configuration").objectValue());
     }
     else if (stage == INITSTAGE_NETWORK_CONFIGURATION) {
@@ -29,17 +32,44 @@ void StreamRedundancyConfigurator::handleParameterChange(const char *name)
 {
     if (!strcmp(name, "configuration")) {
         configuration = check_and_cast<cValueArray *>(par("configuration").objectValue());
-        clearConfiguration();
-        computeConfiguration();
-        configureStreams();
+        if (incrementalReconfiguration)
+            updateConfiguration();
+        else {
+            clearConfiguration();
+            computeConfiguration();
+            configureStreams();
+        }
     }
 }
 
+void StreamRedundancyConfigurator::updateConfiguration()
+{
+    // keep the VLAN ID assignments of streams that are still present, so that
+    // unchanged streams produce identical stream tables and the node level
+    // comparison in configureStreams() can skip reconfiguring those nodes
+    std::set<std::string> streamNames;
+    for (int i = 0; i < configuration->size(); i++) {
+        cValueMap *streamConfiguration = check_and_cast<cValueMap *>(configuration->get(i).objectValue());
+        streamNames.insert(streamConfiguration->get("name").stringValue());
+    }
+    for (auto it = assignedVlanIds.begin(); it != assignedVlanIds.end(); )
+        if (streamNames.find(std::get<3>(it->first)) == streamNames.end())
+            it = assignedVlanIds.erase(it);
+        else
+            ++it;
+    streams.clear();
+    if (topology != nullptr)
+        topology->clear();
+    computeConfiguration();
+    configureStreams();
+}
+
 void StreamRedundancyConfigurator::clearConfiguration()
 {
     streams.clear();
     nextVlanIds.clear();
     assignedVlanIds.clear();
+    appliedNodeConfigurations.clear();
     if (topology != nullptr)
         topology->clear();
 }
@@ -175,10 +205,25 @@ void StreamRedundancyConfigurator::computeStreamEncodings(cValueMap *streamConfi
                 });
                 if (it != node->streamEncodings.end())
                     continue;
-                auto jt = nextVlanIds.emplace(std::pair<std::string, std::string>{networkNodeName, destinationAddress}, 0);
-                int vlanId = jt.first->second++;
-                if (vlanId > maxVlanId)
-                    throw cRuntimeError("Cannot assign VLAN ID in the available range");
+                int vlanId = -1;
+                if (incrementalReconfiguration) {
+                    // reuse the VLAN ID assigned in a previous computation unless another
+                    // stream encoding towards the same destination already claimed it
+                    auto kt = assignedVlanIds.find({networkNodeName, receiverNetworkNodeNames[0], destinationAddress, streamName});
+                    if (kt != assignedVlanIds.end()) {
+                        bool conflicting = std::any_of(node->streamEncodings.begin(), node->streamEncodings.end(), [&] (const StreamEncoding& streamEncoding) {
+                            return streamEncoding.destination == destinationAddress && streamEncoding.vlanId == kt->second;
+                        });
+                        if (!conflicting)
+                            vlanId = kt->second;
+                    }
+                }
+                if (vlanId == -1) {
+                    auto jt = nextVlanIds.emplace(std::pair<std::string, std::string>{networkNodeName, destinationAddress}, 0);
+                    vlanId = jt.first->second++;
+                    if (vlanId > maxVlanId)
+                        throw cRuntimeError("Cannot assign VLAN ID in the available range");
+                }
                 for (size_t k = 0; k < receiverNetworkNodeNames.size(); k++) {
                     auto receiverNetworkNodeName = receiverNetworkNodeNames[k];
                     EV_DEBUG << "Assigning VLAN id" << EV_FIELD(streamName) << EV_FIELD(networkNodeName) << EV_FIELD(receiverNetworkNodeName) << EV_FIELD(destinationAddress) << EV_FIELD(vlanId) << EV_ENDL;
@@ -256,8 +301,45 @@ void StreamRedundancyConfigurator::configureStreams()
 {
     for (int i = 0; i < topology->getNumNodes(); i++) {
         auto node = (Node *)topology->getNode(i);
-        configureStreams(node);
+        if (incrementalReconfiguration) {
+            // batch the node table updates: only touch nodes whose computed tables changed
+            auto networkNodeName = node->module->getFullName();
+            auto digest = computeNodeConfigurationDigest(node);
+            auto it = appliedNodeConfigurations.find(networkNodeName);
+            if (it != appliedNodeConfigurations.end() && it->second == digest) {
+                EV_DETAIL << "Skipping reconfiguration of unchanged node" << EV_FIELD(networkNodeName) << EV_ENDL;
+                continue;
+            }
+            configureStreams(node);
+            appliedNodeConfigurations[networkNodeName] = digest;
+        }
+        else
+            configureStreams(node);
+    }
+}
+
+std::string StreamRedundancyConfigurator::computeNodeConfigurationDigest(Node *node)
+{
+    std::stringstream stream;
+    for (auto& streamIdentification : node->streamIdentifications)
+        stream << "identification " << streamIdentification.stream << " " << streamIdentification.packetFilter.str() << ";";
+    for (auto& streamEncoding : node->streamEncodings)
+        stream << "encoding " << streamEncoding.name << " " << streamEncoding.networkInterface->getInterfaceName() << " " << streamEncoding.destination << " " << streamEncoding.vlanId << " " << streamEncoding.pcp << ";";
+    for (auto& streamDecoding : node->streamDecodings)
+        stream << "decoding " << streamDecoding.name << " " << streamDecoding.networkInterface->getInterfaceName() << " " << streamDecoding.vlanId << ";";
+    for (auto& streamMerging : node->streamMergings) {
+        stream << "merging " << streamMerging.outputStream;
+        for (auto& inputStream : streamMerging.inputStreams)
+            stream << " " << inputStream;
+        stream << ";";
+    }
+    for (auto& streamSplitting : node->streamSplittings) {
+        stream << "splitting " << streamSplitting.inputStream;
+        for (auto& outputStream : streamSplitting.outputStreams)
+            stream << " " << outputStream;
+        stream << ";";
     }
+    return stream.str();
 }
 
 void StreamRedundancyConfigurator::configureStreams(Node *node)
@@ -104,11 +104,13 @@ class INET_API StreamRedundancyConfigurator : public NetworkConfiguratorBase
   protected:
     int minVlanId = -1;
     int maxVlanId = -1;
+    bool incrementalReconfiguration = false;
     cValueArray *configuration;
 
     std::map<std::string, Stream> streams;
     std::map<std::pair<std::string, std::string>, int> nextVlanIds; // maps network node name and destination node name to next available VLAN ID
     std::map<std::tuple<std::string, std::string, std::string, std::string>, int> assignedVlanIds; // maps network node name, receiver network node name, destination network node name and stream name to VLAN ID
+    std::map<std::string, std::string> appliedNodeConfigurations; // maps network node name to a digest of the most recently applied stream tables, used to skip unchanged nodes on incremental reconfiguration
 
   protected:
     virtual void initialize(int stage) override;
@@ -121,6 +123,13 @@ class INET_API StreamRedundancyConfigurator : public NetworkConfiguratorBase
     virtual void computeConfiguration();
     virtual void clearConfiguration();
 
+    /**
+     * Recomputes the configuration after the configuration parameter has changed,
+     * keeping the VLAN ID assignments of unchanged streams and reconfiguring only
+     * the network nodes whose stream tables actually changed.
+     */
+    virtual void updateConfiguration();
+
     virtual void computeStreams();
     virtual void computeStreamSendersAndReceivers(cValueMap *streamConfiguration);
     virtual void computeStreamEncodings(cValueMap *streamConfiguration);
@@ -128,6 +137,7 @@ class INET_API StreamRedundancyConfigurator : public NetworkConfiguratorBase
 
     virtual void configureStreams();
     virtual void configureStreams(Node *node);
+    virtual std::string computeNodeConfigurationDigest(Node *node);
 
   public:
     virtual std::vector<std::string> getStreamNames();
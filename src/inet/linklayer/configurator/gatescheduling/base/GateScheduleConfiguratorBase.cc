@@ -7,6 +7,9 @@
 
 #include "inet/linklayer/configurator/gatescheduling/base/GateScheduleConfiguratorBase.h"
 
+#include <fstream>
+#include <sstream>
+
 #include "inet/common/PatternMatcher.h"
 #include "inet/queueing/gate/PeriodicGate.h"
 
@@ -17,6 +20,7 @@ void GateScheduleConfiguratorBase::initialize(int stage)
     if (stage == INITSTAGE_LOCAL) {
         gateCycleDuration = par("gateCycleDuration");
         configuration = check_and_cast<cValueArray *>(par("configuration").objectValue());
+        gateScheduleCacheDirectory = par("gateScheduleCacheDirectory").stdstringValue();
     }
     else if (stage == INITSTAGE_GATE_SCHEDULE_CONFIGURATION) {
         computeConfiguration();
@@ -53,7 +57,16 @@ void GateScheduleConfiguratorBase::computeConfiguration()
     topology = new Topology();
     TIME(extractTopology(*topology));
     TIME(gateSchedulingInput = createGateSchedulingInput());
-    TIME(gateSchedulingOutput = computeGateScheduling(*gateSchedulingInput));
+    if (!gateScheduleCacheDirectory.empty()) {
+        std::string cacheFileName = computeGateScheduleCacheFileName(*gateSchedulingInput);
+        TIME(gateSchedulingOutput = readGateScheduleFromCache(*gateSchedulingInput, cacheFileName));
+        if (gateSchedulingOutput == nullptr) {
+            TIME(gateSchedulingOutput = computeGateScheduling(*gateSchedulingInput));
+            writeGateScheduleToCache(cacheFileName, *gateSchedulingOutput);
+        }
+    }
+    else
+        TIME(gateSchedulingOutput = computeGateScheduling(*gateSchedulingInput));
     printElapsedTime("computeConfiguration", startTime);
 }
 
@@ -318,5 +331,135 @@ void GateScheduleConfiguratorBase::configureApplicationOffsets()
     }
 }
 
+static uint64_t computeFnv1aHash(const std::string& string)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (char c : string) {
+        hash ^= (uint8_t)c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string GateScheduleConfiguratorBase::computeGateScheduleCacheFileName(const Input& input) const
+{
+    // the digest contains everything the scheduling algorithm depends on, so any
+    // change in the topology, ports or flows results in a different cache file
+    std::stringstream digest;
+    digest << getClassName() << "\n";
+    digest << gateCycleDuration.raw() << " " << SimTime::getScaleExp() << "\n";
+    for (auto port : input.ports) {
+        digest << "port " << port->module->getFullPath() << " " << port->datarate.get() << " " << port->propagationTime.raw() << " "
+               << port->numGates << " " << port->maxPacketLength.get() << " " << port->guardBand.raw() << " "
+               << port->cutthroughSwitchingEnabled << " " << port->endNode->module->getFullPath() << "\n";
+    }
+    for (auto flow : input.flows) {
+        auto application = flow->startApplication;
+        digest << "flow " << flow->name << " " << flow->gateIndex << " " << application->pcp << " "
+               << application->packetLength.get() << " " << application->packetInterval.raw() << " "
+               << application->maxLatency.raw() << " " << application->maxJitter.raw() << " "
+               << flow->cutthroughSwitchingHeaderSize.get() << " " << application->module->getFullPath() << " "
+               << flow->endDevice->module->getFullPath();
+        for (auto pathFragment : flow->pathFragments) {
+            digest << " [";
+            for (auto networkNode : pathFragment->networkNodes)
+                digest << " " << networkNode->module->getFullName();
+            digest << " ]";
+        }
+        digest << "\n";
+    }
+    std::stringstream fileName;
+    fileName << gateScheduleCacheDirectory << "/" << getClassName() << "-" << std::hex << computeFnv1aHash(digest.str()) << ".txt";
+    return fileName.str();
+}
+
+GateScheduleConfiguratorBase::Output *GateScheduleConfiguratorBase::readGateScheduleFromCache(const Input& input, const std::string& fileName) const
+{
+    std::ifstream stream(fileName);
+    if (!stream.is_open())
+        return nullptr;
+    EV_INFO << "Reading gate schedule from cache" << EV_FIELD(fileName) << EV_ENDL;
+    auto output = new Output();
+    try {
+        int scaleExp;
+        std::string keyword;
+        if (!(stream >> keyword >> scaleExp) || keyword != "simtimescale" || scaleExp != SimTime::getScaleExp())
+            throw cRuntimeError("Invalid cache file header");
+        while (stream >> keyword) {
+            if (keyword == "application") {
+                std::string modulePath;
+                int64_t startTimeRaw;
+                if (!(stream >> modulePath >> startTimeRaw))
+                    throw cRuntimeError("Invalid application line");
+                auto it = std::find_if(input.applications.begin(), input.applications.end(), [&] (const Input::Application *application) {
+                    return application->module->getFullPath() == modulePath;
+                });
+                if (it == input.applications.end())
+                    throw cRuntimeError("Cannot find application '%s'", modulePath.c_str());
+                output->applicationStartTimes[*it] = SimTime::fromRaw(startTimeRaw);
+            }
+            else if (keyword == "schedule") {
+                std::string modulePath;
+                int gateIndex, open, numSlots;
+                int64_t cycleStartRaw, cycleDurationRaw;
+                if (!(stream >> modulePath >> gateIndex >> cycleStartRaw >> cycleDurationRaw >> open >> numSlots))
+                    throw cRuntimeError("Invalid schedule line");
+                auto it = std::find_if(input.ports.begin(), input.ports.end(), [&] (const Input::Port *port) {
+                    return port->module->getFullPath() == modulePath;
+                });
+                if (it == input.ports.end())
+                    throw cRuntimeError("Cannot find port '%s'", modulePath.c_str());
+                auto schedule = new Output::Schedule();
+                schedule->port = *it;
+                schedule->gateIndex = gateIndex;
+                schedule->cycleStart = SimTime::fromRaw(cycleStartRaw);
+                schedule->cycleDuration = SimTime::fromRaw(cycleDurationRaw);
+                schedule->open = open;
+                output->gateSchedules[*it].push_back(schedule);
+                for (int i = 0; i < numSlots; i++) {
+                    int64_t startRaw, durationRaw;
+                    if (!(stream >> startRaw >> durationRaw))
+                        throw cRuntimeError("Invalid slot");
+                    Output::Slot slot;
+                    slot.start = SimTime::fromRaw(startRaw);
+                    slot.duration = SimTime::fromRaw(durationRaw);
+                    schedule->slots.push_back(slot);
+                }
+            }
+            else
+                throw cRuntimeError("Unknown keyword '%s'", keyword.c_str());
+        }
+        return output;
+    }
+    catch (const std::exception& e) {
+        EV_WARN << "Ignoring invalid gate schedule cache file" << EV_FIELD(fileName) << EV_FIELD(error, e.what()) << EV_ENDL;
+        delete output;
+        return nullptr;
+    }
+}
+
+void GateScheduleConfiguratorBase::writeGateScheduleToCache(const std::string& fileName, const Output& output) const
+{
+    std::ofstream stream(fileName);
+    if (!stream.is_open()) {
+        EV_WARN << "Cannot write gate schedule cache file" << EV_FIELD(fileName) << EV_ENDL;
+        return;
+    }
+    EV_INFO << "Writing gate schedule to cache" << EV_FIELD(fileName) << EV_ENDL;
+    stream << "simtimescale " << SimTime::getScaleExp() << "\n";
+    for (const auto& it : output.applicationStartTimes)
+        stream << "application " << it.first->module->getFullPath() << " " << it.second.raw() << "\n";
+    for (const auto& it : output.gateSchedules) {
+        for (auto schedule : it.second) {
+            stream << "schedule " << it.first->module->getFullPath() << " " << schedule->gateIndex << " "
+                   << schedule->cycleStart.raw() << " " << schedule->cycleDuration.raw() << " "
+                   << schedule->open << " " << schedule->slots.size();
+            for (const auto& slot : schedule->slots)
+                stream << " " << slot.start.raw() << " " << slot.duration.raw();
+            stream << "\n";
+        }
+    }
+}
+
 } // namespace inet
 
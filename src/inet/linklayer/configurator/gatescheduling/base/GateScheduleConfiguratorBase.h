@@ -202,6 +202,7 @@ class INET_API GateScheduleConfiguratorBase : public NetworkConfiguratorBase
     // parameters
     simtime_t gateCycleDuration;
     cValueArray *configuration = nullptr;
+    std::string gateScheduleCacheDirectory;
 
     // state
     Input *gateSchedulingInput = nullptr;
@@ -225,6 +226,10 @@ class INET_API GateScheduleConfiguratorBase : public NetworkConfiguratorBase
     virtual void configureGateScheduling(cModule *networkNode, cModule *gate, Interface *interface);
     virtual void configureApplicationOffsets();
 
+    virtual std::string computeGateScheduleCacheFileName(const Input& input) const;
+    virtual Output *readGateScheduleFromCache(const Input& input, const std::string& fileName) const;
+    virtual void writeGateScheduleToCache(const std::string& fileName, const Output& output) const;
+
     virtual Output *computeGateScheduling(const Input& input) const = 0;
 
   public:
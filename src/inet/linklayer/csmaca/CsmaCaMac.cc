@@ -33,6 +33,8 @@ CsmaCaMac::~CsmaCaMac()
     cancelAndDelete(endAckTimeout);
     cancelAndDelete(endData);
     cancelAndDelete(mediumStateChange);
+    for (auto& elem : ackTemplates)
+        delete elem.second;
 }
 
 /****************************************************************
@@ -352,7 +354,8 @@ void CsmaCaMac::handleWithFsm(cMessage *msg)
     }
     if (isLowerMessage(msg) && frame->getOwner() == this && endSifs->getContextPointer() != frame)
         delete frame;
-    getDisplayString().setTagArg("t", 0, fsm.getStateName());
+    if (getEnvir()->isGUI())
+        getDisplayString().setTagArg("t", 0, fsm.getStateName());
 }
 
 void CsmaCaMac::receiveSignal(cComponent *source, simsignal_t signalID, intval_t value, cObject *details)
@@ -508,21 +511,27 @@ void CsmaCaMac::sendAckFrame()
     EV << "sending Ack frame\n";
     auto frameToAck = static_cast<Packet *>(endSifs->getContextPointer());
     endSifs->setContextPointer(nullptr);
-    auto macHeader = makeShared<CsmaCaMacAckHeader>();
-    macHeader->setChunkLength(ackLength);
-    macHeader->setHeaderLengthField(B(ackLength).get());
-    macHeader->setReceiverAddress(frameToAck->peekAtFront<CsmaCaMacHeader>()->getTransmitterAddress());
-    auto frame = new Packet("CsmaAck");
-    frame->insertAtFront(macHeader);
-    auto macTrailer = makeShared<CsmaCaMacTrailer>();
-    macTrailer->setFcsMode(fcsMode);
-    if (fcsMode == FCS_COMPUTED)
-        macTrailer->setFcs(computeFcs(frame->peekAllAsBytes()));
-    frame->insertAtBack(macTrailer);
-    auto macAddressInd = frame->addTag<MacAddressInd>();
-    macAddressInd->setSrcAddress(macHeader->getTransmitterAddress());
-    macAddressInd->setDestAddress(macHeader->getReceiverAddress());
-    frame->addTag<PacketProtocolTag>()->setProtocol(&Protocol::csmaCaMac);
+    auto receiverAddress = frameToAck->peekAtFront<CsmaCaMacHeader>()->getTransmitterAddress();
+    auto it = ackTemplates.find(receiverAddress);
+    if (it == ackTemplates.end()) {
+        auto macHeader = makeShared<CsmaCaMacAckHeader>();
+        macHeader->setChunkLength(ackLength);
+        macHeader->setHeaderLengthField(B(ackLength).get());
+        macHeader->setReceiverAddress(receiverAddress);
+        auto ackTemplate = new Packet("CsmaAck");
+        ackTemplate->insertAtFront(macHeader);
+        auto macTrailer = makeShared<CsmaCaMacTrailer>();
+        macTrailer->setFcsMode(fcsMode);
+        if (fcsMode == FCS_COMPUTED)
+            macTrailer->setFcs(computeFcs(ackTemplate->peekAllAsBytes()));
+        ackTemplate->insertAtBack(macTrailer);
+        auto macAddressInd = ackTemplate->addTag<MacAddressInd>();
+        macAddressInd->setSrcAddress(macHeader->getTransmitterAddress());
+        macAddressInd->setDestAddress(macHeader->getReceiverAddress());
+        ackTemplate->addTag<PacketProtocolTag>()->setProtocol(&Protocol::csmaCaMac);
+        it = ackTemplates.emplace(receiverAddress, ackTemplate).first;
+    }
+    auto frame = it->second->dup();
     radio->setRadioMode(IRadio::RADIO_MODE_TRANSMITTER);
     sendDown(frame);
     delete frameToAck;
@@ -90,6 +90,9 @@ class INET_API CsmaCaMac : public MacProtocolBase, public IMacProtocol, public q
     cMessage *mediumStateChange = nullptr;
     //@}
 
+    /** The ack content only depends on the acked frame's transmitter, prebuilt frames are cloned on use. */
+    std::map<MacAddress, Packet *> ackTemplates;
+
     /** @name Statistics */
     //@{
     long numRetry;
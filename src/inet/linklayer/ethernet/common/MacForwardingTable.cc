@@ -48,6 +48,22 @@ std::ostream& operator<<(std::ostream& os, const MacForwardingTable::MulticastAd
     return os << "{interfaceIds=" << entry.interfaceIds << "}";
 }
 
+std::ostream& operator<<(std::ostream& os, const MacForwardingTable::ForwardingTable& table)
+{
+    os << "{";
+    for (auto it = table.begin(); it != table.end(); ++it)
+        os << (it == table.begin() ? "" : ", ") << it->first << " -> " << it->second;
+    return os << "}";
+}
+
+std::ostream& operator<<(std::ostream& os, const MacForwardingTable::MulticastForwardingTable& table)
+{
+    os << "{";
+    for (auto it = table.begin(); it != table.end(); ++it)
+        os << (it == table.begin() ? "" : ", ") << it->first << " -> " << it->second;
+    return os << "}";
+}
+
 void MacForwardingTable::initialize(int stage)
 {
     OperationalBase::initialize(stage);
@@ -55,8 +71,8 @@ void MacForwardingTable::initialize(int stage)
         agingTime = par("agingTime");
         lastPurge = SIMTIME_ZERO;
         ifTable.reference(this, "interfaceTableModule", true);
-        WATCH_MAP(forwardingTable);
-        WATCH_MAP(multicastForwardingTable);
+        WATCH(forwardingTable);
+        WATCH(multicastForwardingTable);
     }
 }
 
@@ -128,13 +144,24 @@ std::string MacForwardingTable::resolveDirective(char directive) const
     }
 }
 
+uint32_t MacForwardingTable::getInterfaceGeneration(int interfaceId) const
+{
+    auto it = interfaceGenerations.find(interfaceId);
+    return it != interfaceGenerations.end() ? it->second : 0;
+}
+
+bool MacForwardingTable::isEntryStale(const AddressEntry& entry) const
+{
+    return entry.generation != getInterfaceGeneration(entry.interfaceId);
+}
+
 int MacForwardingTable::getUnicastAddressForwardingInterface(const MacAddress& address, unsigned int vid) const
 {
     Enter_Method("getUnicastAddressForwardingInterface");
     ASSERT(!address.isMulticast());
     ForwardingTableKey key(vid, address);
     auto it = forwardingTable.find(key);
-    if (it == forwardingTable.end())
+    if (it == forwardingTable.end() || isEntryStale(it->second))
         return -1;
     else if (it->second.insertionTime <= simTime() - agingTime) {
         EV_TRACE << "Ignoring aged entry: " << it->first << " --> " << it->second << "\n";
@@ -151,10 +178,11 @@ void MacForwardingTable::setUnicastAddressForwardingInterface(int interfaceId, c
     ForwardingTableKey key(vid, address);
     auto it = forwardingTable.find(key);
     if (it == forwardingTable.end())
-        forwardingTable[key] = AddressEntry(vid, interfaceId, -1);
+        forwardingTable[key] = AddressEntry(vid, interfaceId, -1, getInterfaceGeneration(interfaceId));
     else {
         it->second.interfaceId = interfaceId;
         it->second.insertionTime = SimTime::getMaxTime();
+        it->second.generation = getInterfaceGeneration(interfaceId);
     }
 }
 
@@ -164,7 +192,7 @@ void MacForwardingTable::removeUnicastAddressForwardingInterface(int interfaceId
     ASSERT(!address.isMulticast());
     ForwardingTableKey key(vid, address);
     auto it = forwardingTable.find(key);
-    if (it == forwardingTable.end())
+    if (it == forwardingTable.end() || isEntryStale(it->second))
         throw cRuntimeError("Cannot find entry");
     forwardingTable.erase(it);
 }
@@ -176,9 +204,9 @@ void MacForwardingTable::learnUnicastAddressForwardingInterface(int interfaceId,
     removeAgedEntriesIfNeeded();
     ForwardingTableKey key(vid, address);
     auto it = forwardingTable.find(key);
-    if (it == forwardingTable.end()) {
+    if (it == forwardingTable.end() || isEntryStale(it->second)) {
         EV << "Adding entry" << EV_FIELD(address) << EV_FIELD(interfaceId) << EV_FIELD(vid) << EV_ENDL;
-        forwardingTable[key] = AddressEntry(vid, interfaceId, simTime());
+        forwardingTable[key] = AddressEntry(vid, interfaceId, simTime(), getInterfaceGeneration(interfaceId));
     }
     else if (it->second.insertionTime != SimTime::getMaxTime()) {
         EV << "Updating entry" << EV_FIELD(address) << EV_FIELD(interfaceId) << EV_FIELD(vid) << EV_ENDL;
@@ -233,12 +261,9 @@ void MacForwardingTable::removeMulticastAddressForwardingInterface(int interface
 void MacForwardingTable::removeForwardingInterface(int interfaceId)
 {
     Enter_Method("removeForwardingInterface");
-    for (auto cur = forwardingTable.begin(); cur != forwardingTable.end();) {
-        if (cur->second.interfaceId == interfaceId)
-            cur = forwardingTable.erase(cur);
-        else
-            ++cur;
-    }
+    // bump the interface generation instead of walking the table; the stale
+    // entries are ignored by lookups and erased by the next aging purge
+    interfaceGenerations[interfaceId]++;
 }
 
 void MacForwardingTable::printState()
@@ -246,15 +271,23 @@ void MacForwardingTable::printState()
     EV << endl << "MAC Address Table" << endl;
     EV << "VLAN ID    MAC    IfId    Inserted" << endl;
     for (auto& elem : forwardingTable)
-        EV << elem.first.first << "   " << elem.first.second << "   " << elem.second.interfaceId << "   " << elem.second.insertionTime << endl;
+        if (!isEntryStale(elem.second))
+            EV << elem.first.first << "   " << elem.first.second << "   " << elem.second.interfaceId << "   " << elem.second.insertionTime << endl;
 }
 
 void MacForwardingTable::replaceForwardingInterface(int oldInterfaceId, int newInterfaceId)
 {
     Enter_Method("replaceForwardingInterface");
-    for (auto& elem : forwardingTable) {
-        if (elem.second.interfaceId == oldInterfaceId)
-            elem.second.interfaceId = newInterfaceId;
+    for (auto cur = forwardingTable.begin(); cur != forwardingTable.end();) {
+        if (isEntryStale(cur->second))
+            cur = forwardingTable.erase(cur);
+        else {
+            if (cur->second.interfaceId == oldInterfaceId) {
+                cur->second.interfaceId = newInterfaceId;
+                cur->second.generation = getInterfaceGeneration(newInterfaceId);
+            }
+            ++cur;
+        }
     }
 }
 
@@ -262,7 +295,9 @@ void MacForwardingTable::removeAgedEntriesFromAllVlans()
 {
     for (auto cur = forwardingTable.begin(); cur != forwardingTable.end();) {
         AddressEntry& entry = cur->second;
-        if (entry.insertionTime <= simTime() - agingTime) {
+        if (isEntryStale(entry))
+            cur = forwardingTable.erase(cur);
+        else if (entry.insertionTime <= simTime() - agingTime) {
             EV << "Removing aged entry from Address Table: "
                << cur->first.first << " " << cur->first.second << " --> interfaceId " << cur->second.interfaceId << "\n";
             cur = forwardingTable.erase(cur);
@@ -340,7 +375,7 @@ void MacForwardingTable::readForwardingTable(const char *fileName)
         interfaceId = ie->getInterfaceId();
 
         // Create an entry with address and interfaceId and insert into table
-        AddressEntry entry(vlanId, interfaceId, 0);
+        AddressEntry entry(vlanId, interfaceId, 0, getInterfaceGeneration(interfaceId));
         ForwardingTableKey key(vlanId, macAddress);
         forwardingTable[key] = entry;
     }
@@ -390,6 +425,7 @@ void MacForwardingTable::clearTable()
 {
     forwardingTable.clear();
     multicastForwardingTable.clear();
+    interfaceGenerations.clear();
 }
 
 void MacForwardingTable::setAgingTime(simtime_t agingTime)
@@ -8,6 +8,8 @@
 #ifndef __INET_MACFORWARDINGTABLE_H
 #define __INET_MACFORWARDINGTABLE_H
 
+#include <unordered_map>
+
 #include "inet/common/StringFormat.h"
 #include "inet/common/lifecycle/ModuleOperations.h"
 #include "inet/common/lifecycle/OperationalBase.h"
@@ -28,9 +30,10 @@ class INET_API MacForwardingTable : public OperationalBase, public IMacForwardin
     struct AddressEntry {
         int interfaceId = -1;
         simtime_t insertionTime;
+        uint32_t generation = 0; // copy of the interface generation taken when the entry was stamped; see interfaceGenerations
         AddressEntry() {}
-        AddressEntry(unsigned int vid, int interfaceId, simtime_t insertionTime) :
-            interfaceId(interfaceId), insertionTime(insertionTime) {}
+        AddressEntry(unsigned int vid, int interfaceId, simtime_t insertionTime, uint32_t generation = 0) :
+            interfaceId(interfaceId), insertionTime(insertionTime), generation(generation) {}
     };
 
     struct MulticastAddressEntry {
@@ -49,13 +52,25 @@ class INET_API MacForwardingTable : public OperationalBase, public IMacForwardin
 
     typedef std::pair<unsigned int, MacAddress> ForwardingTableKey;
     friend std::ostream& operator<<(std::ostream& os, const ForwardingTableKey& key);
-    typedef std::map<ForwardingTableKey, AddressEntry> ForwardingTable;
-    typedef std::map<ForwardingTableKey, MulticastAddressEntry> MulticastForwardingTable;
+
+    struct ForwardingTableKeyHash {
+        size_t operator()(const ForwardingTableKey& key) const { return std::hash<uint64_t>()(((uint64_t)key.first << 48) ^ key.second.getInt()); }
+    };
+
+    typedef std::unordered_map<ForwardingTableKey, AddressEntry, ForwardingTableKeyHash> ForwardingTable;
+    typedef std::unordered_map<ForwardingTableKey, MulticastAddressEntry, ForwardingTableKeyHash> MulticastForwardingTable;
+
+    friend std::ostream& operator<<(std::ostream& os, const ForwardingTable& table);
+    friend std::ostream& operator<<(std::ostream& os, const MulticastForwardingTable& table);
 
     simtime_t agingTime; // Max idle time for address table entries
     simtime_t lastPurge; // Time of the last call of removeAgedEntriesFromAllVlans()
     ForwardingTable forwardingTable;
     MulticastForwardingTable multicastForwardingTable;
+    // per-interface generation counters: removeForwardingInterface() just bumps
+    // the counter instead of walking the table, and entries stamped with an
+    // older generation count as removed and are erased lazily
+    std::unordered_map<int, uint32_t> interfaceGenerations;
     ModuleRefByPar<IInterfaceTable> ifTable;
 
   protected:
@@ -70,6 +85,9 @@ class INET_API MacForwardingTable : public OperationalBase, public IMacForwardin
 
     virtual void parseForwardingTableParameter();
 
+    virtual uint32_t getInterfaceGeneration(int interfaceId) const;
+    virtual bool isEntryStale(const AddressEntry& entry) const;
+
   public:
     // IMacForwardingTable
     virtual int getUnicastAddressForwardingInterface(const MacAddress& address, unsigned int vid = 0) const override;
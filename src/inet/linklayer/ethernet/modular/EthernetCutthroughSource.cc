@@ -19,6 +19,7 @@ void EthernetCutthroughSource::initialize(int stage)
     PacketDestreamer::initialize(stage);
     if (stage == INITSTAGE_LOCAL) {
         cutthroughSwitchingHeaderSize = b(par("cutthroughSwitchingHeaderSize"));
+        coalesceStreaming = par("coalesceStreaming");
         networkInterface = getContainingNicModule(this);
         macForwardingTable.reference(this, "macTableModule", true);
         cutthroughTimer = new cMessage("CutthroughTimer");
@@ -27,23 +28,27 @@ void EthernetCutthroughSource::initialize(int stage)
 
 void EthernetCutthroughSource::handleMessage(cMessage *message)
 {
-    if (message == cutthroughTimer) {
-        auto cutthroughPacket = streamedPacket->dup();
-        b cutthroughPosition = getCutthroughSwitchingHeaderSize(cutthroughPacket);
-        auto cutthroughData = cutthroughPacket->removeAt(cutthroughPosition, cutthroughPacket->getDataLength() - cutthroughPosition - ETHER_FCS_BYTES);
-        cutthroughData->markImmutable();
-        cutthroughBuffer = makeShared<StreamBufferChunk>(cutthroughData, simTime(), datarate);
-        cutthroughPacket->insertAt(cutthroughBuffer, cutthroughPosition);
-        cutthroughPacket->copyRegionTags(*streamedPacket, cutthroughPosition, cutthroughPosition, cutthroughData->getChunkLength());
-        cutthroughPacket->addTag<CutthroughTag>()->setCutthroughPosition(cutthroughPosition);
-        EV_INFO << "Sending cut-through packet" << EV_FIELD(packet, *cutthroughPacket) << EV_ENDL;
-        pushOrSendPacket(cutthroughPacket, outputGate, consumer);
-        cutthroughInProgress = true;
-    }
+    if (message == cutthroughTimer)
+        startCutthrough(simTime());
     else
         PacketDestreamer::handleMessage(message);
 }
 
+void EthernetCutthroughSource::startCutthrough(simtime_t streamStartTime)
+{
+    auto cutthroughPacket = streamedPacket->dup();
+    b cutthroughPosition = getCutthroughSwitchingHeaderSize(cutthroughPacket);
+    auto cutthroughData = cutthroughPacket->removeAt(cutthroughPosition, cutthroughPacket->getDataLength() - cutthroughPosition - ETHER_FCS_BYTES);
+    cutthroughData->markImmutable();
+    cutthroughBuffer = makeShared<StreamBufferChunk>(cutthroughData, streamStartTime, datarate);
+    cutthroughPacket->insertAt(cutthroughBuffer, cutthroughPosition);
+    cutthroughPacket->copyRegionTags(*streamedPacket, cutthroughPosition, cutthroughPosition, cutthroughData->getChunkLength());
+    cutthroughPacket->addTag<CutthroughTag>()->setCutthroughPosition(cutthroughPosition);
+    EV_INFO << "Sending cut-through packet" << EV_FIELD(packet, *cutthroughPacket) << EV_ENDL;
+    pushOrSendPacket(cutthroughPacket, outputGate, consumer);
+    cutthroughInProgress = true;
+}
+
 b EthernetCutthroughSource::getCutthroughSwitchingHeaderSize(Packet *packet) const
 {
     if (cutthroughSwitchingHeaderSize != b(0))
@@ -69,7 +74,7 @@ void EthernetCutthroughSource::EthernetCutthroughDissectorCallback::visitChunk(c
     {
         cutthroughSwitchingHeaderSize += chunk->getChunkLength();
     }
-    else
+    else if (protocol != nullptr)
         payloadProtocol = protocol;
 }
 
@@ -79,7 +84,14 @@ void EthernetCutthroughSource::pushPacketStart(Packet *packet, const cGate *gate
     if (!cutthroughInProgress && isEligibleForCutthrough(packet)) {
         b cutthroughPosition = getCutthroughSwitchingHeaderSize(packet);
         simtime_t delay = s(cutthroughPosition / datarate).get();
-        scheduleAt(simTime() + delay, cutthroughTimer);
+        if (coalesceStreaming)
+            // the cut-through packet is eligible, so its contents are the same at
+            // reception start and end; sending it right away with a stream buffer
+            // that starts streaming at header completion saves the timer event
+            // while the downstream sink and barrier compute the same latency
+            startCutthrough(simTime() + delay);
+        else
+            scheduleAt(simTime() + delay, cutthroughTimer);
         updateDisplayString();
     }
 }
@@ -109,6 +121,7 @@ void EthernetCutthroughSource::pushPacketEnd(Packet *packet, const cGate *gate)
 bool EthernetCutthroughSource::isEligibleForCutthrough(Packet *packet) const
 {
     EthernetCutthroughDissectorCallback callback;
+    callback.stopAtPayload = true;
     PacketDissector packetDissector(ProtocolDissectorRegistry::getInstance(), callback);
     packetDissector.dissectPacket(packet);
     return callback.payloadProtocol != &Protocol::gptp;
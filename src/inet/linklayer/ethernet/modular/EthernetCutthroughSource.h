@@ -28,9 +28,15 @@ class INET_API EthernetCutthroughSource : public PacketDestreamer
       public:
         b cutthroughSwitchingHeaderSize = b(0);
         const Protocol *payloadProtocol = nullptr;
+        // when only the payload protocol is of interest, the dissection can
+        // stop as soon as the first payload chunk has been seen; it must run
+        // to completion when the header size is accumulated, because the
+        // trailing FCS chunk contributes to it
+        bool stopAtPayload = false;
 
       public:
         virtual bool shouldDissectProtocolDataUnit(const Protocol *protocol) override;
+        virtual bool isDissectionComplete() const override { return stopAtPayload && payloadProtocol != nullptr; }
         virtual void startProtocolDataUnit(const Protocol *protocol) override {}
         virtual void endProtocolDataUnit(const Protocol *protocol) override {}
         virtual void markIncorrect() override {}
@@ -41,6 +47,7 @@ class INET_API EthernetCutthroughSource : public PacketDestreamer
     ModuleRefByPar<IMacForwardingTable> macForwardingTable;
 
     b cutthroughSwitchingHeaderSize;
+    bool coalesceStreaming = false;
     bool cutthroughInProgress = false;
     cMessage *cutthroughTimer = nullptr;
 
@@ -52,6 +59,12 @@ class INET_API EthernetCutthroughSource : public PacketDestreamer
 
     virtual b getCutthroughSwitchingHeaderSize(Packet *packet) const;
 
+    /**
+     * Sends the cut-through packet towards the egress interface with a stream
+     * buffer that starts streaming at the given time.
+     */
+    virtual void startCutthrough(simtime_t streamStartTime);
+
     /**
      * Packets are eligible for cut-through switching if the contents of the
      * packet and the meta data on the packet are the same for the reception
@@ -38,6 +38,13 @@ void EthernetSocketPacketProcessor::pushPacket(Packet *packet, const cGate *gate
 {
     Enter_Method("pushPacket");
     take(packet);
+    // fast path: on most nodes no Ethernet sockets are registered at all
+    if (!socketTable->hasSockets()) {
+        handlePacketProcessed(packet);
+        pushOrSendPacket(packet, outputGate, consumer);
+        updateDisplayString();
+        return;
+    }
     const auto& protocolTag = packet->findTag<PacketProtocolTag>();
     auto protocol = protocolTag ? protocolTag->getProtocol() : nullptr;
     MacAddress localAddress, remoteAddress;
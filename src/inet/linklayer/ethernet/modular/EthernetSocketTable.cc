@@ -7,6 +7,8 @@
 
 #include "inet/linklayer/ethernet/modular/EthernetSocketTable.h"
 
+#include <algorithm>
+
 #include "inet/common/stlutils.h"
 
 namespace inet {
@@ -42,13 +44,21 @@ void EthernetSocketTable::addSocket(int socketId, MacAddress localAddress, MacAd
     socket->protocol = protocol;
     socket->steal = steal;
     socketIdToSocketMap[socketId] = socket;
+    auto& sockets = protocolToSocketsMap[protocol];
+    sockets.insert(std::upper_bound(sockets.begin(), sockets.end(), socket,
+            [] (const Socket *a, const Socket *b) { return a->socketId < b->socketId; }), socket);
 }
 
 void EthernetSocketTable::removeSocket(int socketId)
 {
     auto it = socketIdToSocketMap.find(socketId);
     if (it != socketIdToSocketMap.end()) {
-        delete it->second;
+        auto socket = it->second;
+        auto jt = protocolToSocketsMap.find(socket->protocol);
+        jt->second.erase(find(jt->second, socket));
+        if (jt->second.empty())
+            protocolToSocketsMap.erase(jt);
+        delete socket;
         socketIdToSocketMap.erase(it);
     }
     else
@@ -58,15 +68,29 @@ void EthernetSocketTable::removeSocket(int socketId)
 std::vector<EthernetSocketTable::Socket *> EthernetSocketTable::findSockets(MacAddress localAddress, MacAddress remoteAddress, const Protocol *protocol) const
 {
     std::vector<EthernetSocketTable::Socket *> result;
-    for (auto& it : socketIdToSocketMap) {
-        auto socket = it.second;
+    static const std::vector<Socket *> emptySockets;
+    auto protocolIt = protocol != nullptr ? protocolToSocketsMap.find(protocol) : protocolToSocketsMap.end();
+    auto wildcardIt = protocolToSocketsMap.find(nullptr);
+    const auto& protocolSockets = protocolIt != protocolToSocketsMap.end() ? protocolIt->second : emptySockets;
+    const auto& wildcardSockets = wildcardIt != protocolToSocketsMap.end() ? wildcardIt->second : emptySockets;
+    auto matches = [&] (const Socket *socket) {
         if (!socket->localAddress.isUnspecified() && !localAddress.isBroadcast() && localAddress != socket->localAddress)
-            continue;
+            return false;
         if (!socket->remoteAddress.isUnspecified() && !remoteAddress.isBroadcast() && remoteAddress != socket->remoteAddress)
-            continue;
-        if (socket->protocol != nullptr && protocol != socket->protocol)
-            continue;
-        result.push_back(socket);
+            return false;
+        return true;
+    };
+    // merge the two socket id ordered buckets to preserve the dispatch order
+    size_t i = 0;
+    size_t j = 0;
+    while (i < protocolSockets.size() || j < wildcardSockets.size()) {
+        Socket *socket;
+        if (j == wildcardSockets.size() || (i != protocolSockets.size() && protocolSockets[i]->socketId < wildcardSockets[j]->socketId))
+            socket = protocolSockets[i++];
+        else
+            socket = wildcardSockets[j++];
+        if (matches(socket))
+            result.push_back(socket);
     }
     return result;
 }
@@ -30,6 +30,10 @@ class INET_API EthernetSocketTable : public cSimpleModule
 
   protected:
     std::map<int, Socket *> socketIdToSocketMap;
+    // sockets bucketed by their protocol (nullptr bucket holds the protocol
+    // wildcard sockets), each bucket ordered by socket id so that lookups
+    // preserve the dispatch order of a linear scan
+    std::map<const Protocol *, std::vector<Socket *>> protocolToSocketsMap;
 
   protected:
     virtual void initialize(int stage) override;
@@ -37,6 +41,8 @@ class INET_API EthernetSocketTable : public cSimpleModule
   public:
     virtual ~EthernetSocketTable();
 
+    virtual bool hasSockets() const { return !socketIdToSocketMap.empty(); }
+
     virtual void addSocket(int socketId, MacAddress localAddress, MacAddress remoteAddress, const Protocol *protocol, bool steal);
     virtual void removeSocket(int socketId);
     virtual std::vector<Socket *> findSockets(MacAddress localAddress, MacAddress remoteAddress, const Protocol *protocol) const;
@@ -8,6 +8,7 @@
 #include "inet/linklayer/ieee80211/mac/aggregation/MpduAggregation.h"
 
 #include "inet/common/packet/chunk/ByteCountChunk.h"
+#include "inet/common/packet/chunk/SequenceChunk.h"
 
 namespace inet {
 namespace ieee80211 {
@@ -18,25 +19,34 @@ Packet *MpduAggregation::aggregateFrames(std::vector<Packet *> *frames)
 {
     EV_DEBUG << "Aggregating " << frames->size() << " packets into A-MPDU.\n";
     auto aggregatedFrame = new Packet();
+    // the subframe chunk references are accumulated into a single mutable
+    // SequenceChunk that is inserted into the packet in one step; appending to
+    // the mutable sequence is a plain deque operation, while inserting into
+    // the packet re-checks and re-wraps the aggregated content on every call
+    auto aggregatedChunk = makeShared<SequenceChunk>();
     std::string aggregatedName;
     for (size_t i = 0; i < frames->size(); i++) {
         auto mpduSubframeHeader = makeShared<Ieee80211MpduSubframeHeader>();
         auto frame = frames->at(i);
         auto mpdu = frame->peekAll();
         mpduSubframeHeader->setLength(B(mpdu->getChunkLength()).get());
-        aggregatedFrame->insertAtBack(mpduSubframeHeader);
-        aggregatedFrame->insertAtBack(mpdu);
+        mpduSubframeHeader->markImmutable();
+        aggregatedChunk->insertAtBack(mpduSubframeHeader);
+        aggregatedChunk->insertAtBack(mpdu);
         aggregatedFrame->getRegionTags().copyTags(frame->getRegionTags(), B(0), aggregatedFrame->getFrontOffset() - frame->getDataLength(), frame->getDataLength());
         int paddingLength = 4 - B(mpduSubframeHeader->getChunkLength() + mpdu->getChunkLength()).get() % 4;
         if (i + 1 != frames->size() && paddingLength != 4) {
             auto padding = makeShared<ByteCountChunk>(B(paddingLength));
-            aggregatedFrame->insertAtBack(padding);
+            padding->markImmutable();
+            aggregatedChunk->insertAtBack(padding);
         }
         if (i != 0)
             aggregatedName.append("+");
         aggregatedName.append(frame->getName());
         delete frame;
     }
+    aggregatedChunk->markImmutable();
+    aggregatedFrame->insertAtBack(aggregatedChunk);
     aggregatedFrame->setName(aggregatedName.c_str());
     EV_TRACE << "Created A-MPDU " << *aggregatedFrame << ".\n";
     return aggregatedFrame;
@@ -8,6 +8,7 @@
 #include "inet/linklayer/ieee80211/mac/aggregation/MsduAggregation.h"
 
 #include "inet/common/packet/chunk/ByteCountChunk.h"
+#include "inet/common/packet/chunk/SequenceChunk.h"
 
 namespace inet {
 namespace ieee80211 {
@@ -53,6 +54,12 @@ Packet *MsduAggregation::aggregateFrames(std::vector<Packet *> *frames)
     auto fromDS = firstHeader->getFromDS();
     auto ra = firstHeader->getReceiverAddress();
     auto aggregatedFrame = new Packet();
+    // the subframe chunk references are accumulated into a single mutable
+    // SequenceChunk that is inserted into the packet in one step; appending to
+    // the mutable sequence is a plain deque operation, while inserting into
+    // the packet re-checks and re-wraps the aggregated content on every call
+    auto aggregatedChunk = makeShared<SequenceChunk>();
+    b backOffset = b(0); // tracks what Packet::getBackOffset() would be if the subframes were inserted one by one
     std::string aggregatedName;
     for (size_t i = 0; i < frames->size(); i++) {
         auto msduSubframeHeader = makeShared<Ieee80211MsduSubframeHeader>();
@@ -62,19 +69,25 @@ Packet *MsduAggregation::aggregateFrames(std::vector<Packet *> *frames)
         auto msdu = frame->peekData();
         msduSubframeHeader->setLength(B(msdu->getChunkLength()).get());
         setSubframeAddress(msduSubframeHeader, header);
-        aggregatedFrame->insertAtBack(msduSubframeHeader);
-        aggregatedFrame->insertAtBack(msdu);
-        aggregatedFrame->getRegionTags().copyTags(frame->getRegionTags(), frame->getFrontOffset(), aggregatedFrame->getBackOffset() - frame->getDataLength(), frame->getDataLength());
+        msduSubframeHeader->markImmutable();
+        aggregatedChunk->insertAtBack(msduSubframeHeader);
+        aggregatedChunk->insertAtBack(msdu);
+        backOffset += msduSubframeHeader->getChunkLength() + msdu->getChunkLength();
+        aggregatedFrame->getRegionTags().copyTags(frame->getRegionTags(), frame->getFrontOffset(), backOffset - frame->getDataLength(), frame->getDataLength());
         int paddingLength = 4 - B(msduSubframeHeader->getChunkLength() + msdu->getChunkLength()).get() % 4;
         if (i + 1 != frames->size() && paddingLength != 4) {
             auto padding = makeShared<ByteCountChunk>(B(paddingLength));
-            aggregatedFrame->insertAtBack(padding);
+            padding->markImmutable();
+            aggregatedChunk->insertAtBack(padding);
+            backOffset += B(paddingLength);
         }
         if (i != 0)
             aggregatedName.append("+");
         aggregatedName.append(frame->getName());
         delete frame;
     }
+    aggregatedChunk->markImmutable();
+    aggregatedFrame->insertAtBack(aggregatedChunk);
     // The MPDU containing the A-MSDU is carried in any of the following data frame subtypes: QoS Data,
     // QoS Data + CF-Ack, QoS Data + CF-Poll, QoS Data + CF-Ack + CF-Poll. The A-MSDU structure is
     // contained in the frame body of a single MPDU.
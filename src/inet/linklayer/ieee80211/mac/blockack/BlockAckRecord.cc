@@ -7,8 +7,6 @@
 
 #include "inet/linklayer/ieee80211/mac/blockack/BlockAckRecord.h"
 
-#include "inet/common/stlutils.h"
-
 namespace inet {
 namespace ieee80211 {
 
@@ -16,13 +14,36 @@ BlockAckRecord::BlockAckRecord(MacAddress originatorAddress, Tid tid) :
     originatorAddress(originatorAddress),
     tid(tid)
 {
+    acknowledgmentStates.fill(0);
+    occupiedSequenceNumbers.fill(0);
 }
 
 void BlockAckRecord::blockAckPolicyFrameReceived(const Ptr<const Ieee80211DataHeader>& header)
 {
-    SequenceNumberCyclic sequenceNumber = header->getSequenceNumber();
+    int sequenceNumber = header->getSequenceNumber().get();
     FragmentNumber fragmentNumber = header->getFragmentNumber();
-    acknowledgmentState[SequenceControlField(sequenceNumber.get(), fragmentNumber)] = true;
+    uint16_t& fragmentBits = acknowledgmentStates[sequenceNumber];
+    if (fragmentBits == 0) {
+        occupiedSequenceNumbers[sequenceNumber / 64] |= (uint64_t)1 << (sequenceNumber % 64);
+        numOccupied++;
+    }
+    fragmentBits |= (uint16_t)1 << fragmentNumber;
+}
+
+SequenceNumber BlockAckRecord::getEarliestSequenceNumber() const
+{
+    for (int i = 0; i < (int)occupiedSequenceNumbers.size(); i++) {
+        uint64_t word = occupiedSequenceNumbers[i];
+        if (word != 0) {
+            int j = 0;
+            while ((word & 1) == 0) {
+                word >>= 1;
+                j++;
+            }
+            return i * 64 + j;
+        }
+    }
+    return -1;
 }
 
 bool BlockAckRecord::getAckState(SequenceNumberCyclic sequenceNumber, FragmentNumber fragmentNumber)
@@ -30,29 +51,30 @@ bool BlockAckRecord::getAckState(SequenceNumberCyclic sequenceNumber, FragmentNu
     // The status of MPDUs that are considered “old” and prior to the sequence number
     // range for which the receiver maintains status shall be reported as successfully
     // received (i.e., the corresponding bit in the bitmap shall be set to 1).
-    if (containsKey(acknowledgmentState, SequenceControlField(sequenceNumber.get(), fragmentNumber))) {
+    if (acknowledgmentStates[sequenceNumber.get()] & ((uint16_t)1 << fragmentNumber)) {
         return true;
     }
-    else if (acknowledgmentState.size() == 0) {
+    else if (numOccupied == 0) {
         return true; // TODO old?
     }
     else {
-        auto earliest = acknowledgmentState.begin();
-        return SequenceNumberCyclic(earliest->first.getSequenceNumber()) > sequenceNumber; // old = true
+        return SequenceNumberCyclic(getEarliestSequenceNumber()) > sequenceNumber; // old = true
     }
 }
 
 void BlockAckRecord::removeAckStates(SequenceNumberCyclic sequenceNumber)
 {
-    auto it = acknowledgmentState.begin();
-    while (it != acknowledgmentState.end()) {
-        if (SequenceNumberCyclic(it->first.getSequenceNumber()) < sequenceNumber)
-            it = acknowledgmentState.erase(it);
-        else
-            it++;
+    for (int i = 0; i < (int)occupiedSequenceNumbers.size() && numOccupied > 0; i++) {
+        uint64_t word = occupiedSequenceNumbers[i];
+        for (int j = 0; word != 0; j++, word >>= 1) {
+            if ((word & 1) && SequenceNumberCyclic(i * 64 + j) < sequenceNumber) {
+                acknowledgmentStates[i * 64 + j] = 0;
+                occupiedSequenceNumbers[i] &= ~((uint64_t)1 << j);
+                numOccupied--;
+            }
+        }
     }
 }
 
 } /* namespace ieee80211 */
 } /* namespace inet */
-
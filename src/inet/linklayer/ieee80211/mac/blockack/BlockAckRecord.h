@@ -8,6 +8,8 @@
 #ifndef __INET_BLOCKACKRECORD_H
 #define __INET_BLOCKACKRECORD_H
 
+#include <array>
+
 #include "inet/linklayer/ieee80211/mac/common/SequenceControlField.h"
 #include "inet/linklayer/ieee80211/mac/Ieee80211Frame_m.h"
 
@@ -24,7 +26,15 @@ class INET_API BlockAckRecord
   protected:
     MacAddress originatorAddress = MacAddress::UNSPECIFIED_ADDRESS;
     Tid tid = -1;
-    std::map<SequenceControlField, bool> acknowledgmentState;
+    // fixed window scoreboard covering the whole 4096 entry sequence number
+    // space: one fragment bitmask per sequence number, plus an occupancy bitmap
+    // to find the stored sequence numbers without scanning all the masks
+    std::array<uint16_t, 4096> acknowledgmentStates;
+    std::array<uint64_t, 64> occupiedSequenceNumbers;
+    int numOccupied = 0;
+
+  protected:
+    SequenceNumber getEarliestSequenceNumber() const;
 
   public:
     BlockAckRecord(MacAddress originatorAddress, Tid tid);
@@ -42,4 +52,3 @@ class INET_API BlockAckRecord
 } /* namespace inet */
 
 #endif
-
@@ -7,6 +7,8 @@
 
 #include "inet/linklayer/ieee80211/mac/blockack/OriginatorBlockAckAgreementHandler.h"
 
+#include <algorithm>
+
 #include "inet/linklayer/ieee80211/mac/blockack/OriginatorBlockAckAgreement.h"
 
 namespace inet {
@@ -40,15 +42,17 @@ void OriginatorBlockAckAgreementHandler::blockAckAgreementExpired(IProcedureCall
     // primitive with the ReasonCode parameter having a value of TIMEOUT.
     // The procedure is illustrated in Figure 10-14.
     simtime_t now = simTime();
+    std::vector<std::pair<MacAddress, Tid>> expiredAgreementIds;
     for (auto id : blockAckAgreements) {
-        auto agreement = id.second;
-        if (agreement->getExpirationTime() == now) {
-            MacAddress receiverAddr = id.first.first;
-            Tid tid = id.first.second;
-            const auto& delba = buildDelba(receiverAddr, tid, 39);
-            auto delbaPacket = new Packet("Delba", delba);
-            procedureCallback->processMgmtFrame(delbaPacket, delba); // 39 - TIMEOUT see: Table 8-36—Reason codes
-        }
+        if (id.second->getExpirationTime() == now)
+            expiredAgreementIds.push_back(id.first);
+    }
+    // send the DELBA frames in (address, TID) order, the hash map iteration order is arbitrary
+    std::sort(expiredAgreementIds.begin(), expiredAgreementIds.end());
+    for (auto& id : expiredAgreementIds) {
+        const auto& delba = buildDelba(id.first, id.second, 39);
+        auto delbaPacket = new Packet("Delba", delba);
+        procedureCallback->processMgmtFrame(delbaPacket, delba); // 39 - TIMEOUT see: Table 8-36—Reason codes
     }
     scheduleInactivityTimer(agreementHandlerCallback);
 }
@@ -8,6 +8,8 @@
 #ifndef __INET_ORIGINATORBLOCKACKAGREEMENTHANDLER_H
 #define __INET_ORIGINATORBLOCKACKAGREEMENTHANDLER_H
 
+#include <unordered_map>
+
 #include "inet/linklayer/ieee80211/mac/contract/IOriginatorBlockAckAgreementHandler.h"
 
 namespace inet {
@@ -20,7 +22,10 @@ namespace ieee80211 {
 class INET_API OriginatorBlockAckAgreementHandler : public IOriginatorBlockAckAgreementHandler
 {
   protected:
-    std::map<std::pair<MacAddress, Tid>, OriginatorBlockAckAgreement *> blockAckAgreements;
+    struct AgreementIdHash {
+        size_t operator()(const std::pair<MacAddress, Tid>& id) const { return std::hash<uint64_t>()(((uint64_t)id.second << 48) ^ id.first.getInt()); }
+    };
+    std::unordered_map<std::pair<MacAddress, Tid>, OriginatorBlockAckAgreement *, AgreementIdHash> blockAckAgreements;
 
   protected:
     virtual const Ptr<Ieee80211AddbaRequest> buildAddbaRequest(MacAddress receiverAddr, Tid tid, SequenceNumberCyclic startingSequenceNumber, IOriginatorBlockAckAgreementPolicy *blockAckAgreementPolicy);
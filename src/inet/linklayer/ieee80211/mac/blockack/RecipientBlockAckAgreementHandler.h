@@ -8,6 +8,8 @@
 #ifndef __INET_RECIPIENTBLOCKACKAGREEMENTHANDLER_H
 #define __INET_RECIPIENTBLOCKACKAGREEMENTHANDLER_H
 
+#include <unordered_map>
+
 #include "inet/linklayer/ieee80211/mac/blockackreordering/BlockAckReordering.h"
 #include "inet/linklayer/ieee80211/mac/contract/IRecipientBlockAckAgreementHandler.h"
 
@@ -25,7 +27,10 @@ class RecipientBlockAckAgreement;
 class INET_API RecipientBlockAckAgreementHandler : public IRecipientBlockAckAgreementHandler
 {
   protected:
-    std::map<std::pair<MacAddress, Tid>, RecipientBlockAckAgreement *> blockAckAgreements;
+    struct AgreementIdHash {
+        size_t operator()(const std::pair<MacAddress, Tid>& id) const { return std::hash<uint64_t>()(((uint64_t)id.second << 48) ^ id.first.getInt()); }
+    };
+    std::unordered_map<std::pair<MacAddress, Tid>, RecipientBlockAckAgreement *, AgreementIdHash> blockAckAgreements;
 
   protected:
     virtual void terminateAgreement(MacAddress originatorAddr, Tid tid);
@@ -33,6 +33,13 @@ static std::ostream& operator<<(std::ostream& os, const Ieee80211MgmtAp::StaInfo
     return os;
 }
 
+static std::ostream& operator<<(std::ostream& os, const Ieee80211MgmtAp::StaList& staList)
+{
+    for (auto& entry : staList)
+        os << "{" << entry.second << "} ";
+    return os;
+}
+
 Ieee80211MgmtAp::~Ieee80211MgmtAp()
 {
     cancelAndDelete(beaconTimer);
@@ -54,7 +61,7 @@ void Ieee80211MgmtAp::initialize(int stage)
         WATCH(channelNumber);
         WATCH(beaconInterval);
         WATCH(numAuthSteps);
-        WATCH_MAP(staList);
+        WATCH(staList);
 
         // TODO fill in supportedRates
 
@@ -90,16 +97,23 @@ void Ieee80211MgmtAp::receiveSignal(cComponent *source, simsignal_t signalID, in
     if (signalID == Ieee80211Radio::radioChannelChangedSignal) {
         EV << "updating channel number\n";
         channelNumber = value;
+        invalidateFrameBodies();
     }
 }
 
+void Ieee80211MgmtAp::invalidateFrameBodies()
+{
+    beaconBody = nullptr;
+    probeResponseBody = nullptr;
+}
+
 Ieee80211MgmtAp::StaInfo *Ieee80211MgmtAp::lookupSenderSTA(const Ptr<const Ieee80211MgmtHeader>& header)
 {
     auto it = staList.find(header->getTransmitterAddress());
     return it == staList.end() ? nullptr : &(it->second);
 }
 
-void Ieee80211MgmtAp::sendManagementFrame(const char *name, const Ptr<Ieee80211MgmtFrame>& body, int subtype, const MacAddress& destAddr)
+void Ieee80211MgmtAp::sendManagementFrame(const char *name, const Ptr<const Ieee80211MgmtFrame>& body, int subtype, const MacAddress& destAddr)
 {
     auto packet = new Packet(name);
     packet->addTag<MacAddressReq>()->setDestAddress(destAddr);
@@ -111,13 +125,16 @@ void Ieee80211MgmtAp::sendManagementFrame(const char *name, const Ptr<Ieee80211M
 void Ieee80211MgmtAp::sendBeacon()
 {
     EV << "Sending beacon\n";
-    const auto& body = makeShared<Ieee80211BeaconFrame>();
-    body->setSSID(ssid.c_str());
-    body->setSupportedRates(supportedRates);
-    body->setBeaconInterval(beaconInterval);
-    body->setChannelNumber(channelNumber);
-    body->setChunkLength(B(8 + 2 + 2 + (2 + ssid.length()) + (2 + supportedRates.numRates)));
-    sendManagementFrame("Beacon", body, ST_BEACON, MacAddress::BROADCAST_ADDRESS);
+    if (beaconBody == nullptr) {
+        const auto& body = makeShared<Ieee80211BeaconFrame>();
+        body->setSSID(ssid.c_str());
+        body->setSupportedRates(supportedRates);
+        body->setBeaconInterval(beaconInterval);
+        body->setChannelNumber(channelNumber);
+        body->setChunkLength(B(8 + 2 + 2 + (2 + ssid.length()) + (2 + supportedRates.numRates)));
+        beaconBody = body;
+    }
+    sendManagementFrame("Beacon", beaconBody, ST_BEACON, MacAddress::BROADCAST_ADDRESS);
 }
 
 void Ieee80211MgmtAp::handleAuthenticationFrame(Packet *packet, const Ptr<const Ieee80211MgmtHeader>& header)
@@ -308,13 +325,16 @@ void Ieee80211MgmtAp::handleProbeRequestFrame(Packet *packet, const Ptr<const Ie
     delete packet;
 
     EV << "Sending ProbeResponse frame\n";
-    const auto& body = makeShared<Ieee80211ProbeResponseFrame>();
-    body->setSSID(ssid.c_str());
-    body->setSupportedRates(supportedRates);
-    body->setBeaconInterval(beaconInterval);
-    body->setChannelNumber(channelNumber);
-    body->setChunkLength(B(8 + 2 + 2 + (2 + ssid.length()) + (2 + supportedRates.numRates)));
-    sendManagementFrame("ProbeResp", body, ST_PROBERESPONSE, staAddress);
+    if (probeResponseBody == nullptr) {
+        const auto& body = makeShared<Ieee80211ProbeResponseFrame>();
+        body->setSSID(ssid.c_str());
+        body->setSupportedRates(supportedRates);
+        body->setBeaconInterval(beaconInterval);
+        body->setChannelNumber(channelNumber);
+        body->setChunkLength(B(8 + 2 + 2 + (2 + ssid.length()) + (2 + supportedRates.numRates)));
+        probeResponseBody = body;
+    }
+    sendManagementFrame("ProbeResp", probeResponseBody, ST_PROBERESPONSE, staAddress);
 }
 
 void Ieee80211MgmtAp::handleProbeResponseFrame(Packet *packet, const Ptr<const Ieee80211MgmtHeader>& header)
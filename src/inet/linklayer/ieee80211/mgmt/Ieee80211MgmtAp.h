@@ -8,7 +8,7 @@
 #ifndef __INET_IEEE80211MGMTAP_H
 #define __INET_IEEE80211MGMTAP_H
 
-#include <map>
+#include <unordered_map>
 
 #include "inet/linklayer/ieee80211/mgmt/Ieee80211MgmtApBase.h"
 
@@ -42,11 +42,11 @@ class INET_API Ieee80211MgmtAp : public Ieee80211MgmtApBase, protected cListener
         const MacAddress& getStaAddress() const { return staAddress; }
     };
 
-    class INET_API MacCompare {
+    class INET_API MacAddressHash {
       public:
-        bool operator()(const MacAddress& u1, const MacAddress& u2) const { return u1.compareTo(u2) < 0; }
+        size_t operator()(const MacAddress& address) const { return std::hash<uint64_t>()(address.getInt()); }
     };
-    typedef std::map<MacAddress, StaInfo, MacCompare> StaList;
+    typedef std::unordered_map<MacAddress, StaInfo, MacAddressHash> StaList;
 
   protected:
     // configuration
@@ -60,6 +60,12 @@ class INET_API Ieee80211MgmtAp : public Ieee80211MgmtApBase, protected cListener
     StaList staList; ///< list of STAs
     cMessage *beaconTimer = nullptr;
 
+    // cached frame bodies, they only depend on the configuration, so the same
+    // immutable chunk is shared by all beacon/probe response frames sent until
+    // the configuration changes
+    Ptr<const Ieee80211BeaconFrame> beaconBody = nullptr;
+    Ptr<const Ieee80211ProbeResponseFrame> probeResponseBody = nullptr;
+
   public:
     Ieee80211MgmtAp() {}
     virtual ~Ieee80211MgmtAp();
@@ -81,7 +87,10 @@ class INET_API Ieee80211MgmtAp : public Ieee80211MgmtApBase, protected cListener
     virtual StaInfo *lookupSenderSTA(const Ptr<const Ieee80211MgmtHeader>& header);
 
     /** Utility function: set fields in the given frame and send it out to the address */
-    virtual void sendManagementFrame(const char *name, const Ptr<Ieee80211MgmtFrame>& body, int subtype, const MacAddress& destAddr);
+    virtual void sendManagementFrame(const char *name, const Ptr<const Ieee80211MgmtFrame>& body, int subtype, const MacAddress& destAddr);
+
+    /** Utility function: drops the cached beacon and probe response bodies after a configuration change */
+    virtual void invalidateFrameBodies();
 
     /** Utility function: creates and sends a beacon frame */
     virtual void sendBeacon();
@@ -153,6 +153,8 @@ Ieee802154Mac::~Ieee802154Mac()
     cancelAndDelete(rxAckTimer);
     if (ackMessage)
         delete ackMessage;
+    for (auto& elem : ackTemplates)
+        delete elem.second;
 }
 
 void Ieee802154Mac::configureNetworkInterface()
@@ -826,13 +828,18 @@ void Ieee802154Mac::handleLowerPacket(Packet *packet)
 
                 if (ackMessage != nullptr)
                     delete ackMessage;
-                auto csmaHeader = makeShared<Ieee802154MacHeader>();
-                csmaHeader->setSrcAddr(address);
-                csmaHeader->setDestAddr(src);
-                csmaHeader->setChunkLength(b(ackLength));
-                ackMessage = new Packet("CSMA-Ack");
-                ackMessage->insertAtFront(csmaHeader);
-                ackMessage->addTag<PacketProtocolTag>()->setProtocol(&Protocol::ieee802154);
+                auto it = ackTemplates.find(src);
+                if (it == ackTemplates.end()) {
+                    auto csmaHeader = makeShared<Ieee802154MacHeader>();
+                    csmaHeader->setSrcAddr(address);
+                    csmaHeader->setDestAddr(src);
+                    csmaHeader->setChunkLength(b(ackLength));
+                    auto ackTemplate = new Packet("CSMA-Ack");
+                    ackTemplate->insertAtFront(csmaHeader);
+                    ackTemplate->addTag<PacketProtocolTag>()->setProtocol(&Protocol::ieee802154);
+                    it = ackTemplates.emplace(src, ackTemplate).first;
+                }
+                ackMessage = it->second->dup();
                 // Check for duplicates by checking expected seqNr of sender
                 if (!containsKey(SeqNrChild, src)) {
                     // no record of current child -> add expected next number to map
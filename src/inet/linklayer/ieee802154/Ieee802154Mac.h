@@ -277,6 +277,9 @@ class INET_API Ieee802154Mac : public MacProtocolBase, public IMacProtocol, publ
 
     Packet *ackMessage = nullptr;
 
+    // the ack content only depends on the sender, prebuilt frames are cloned on use
+    std::map<MacAddress, Packet *> ackTemplates;
+
     // sequence number for sending, map for the general case with more senders
     // also in initialisation phase multiple potential parents
     std::map<MacAddress, unsigned long> SeqNrParent; // parent -> sequence number
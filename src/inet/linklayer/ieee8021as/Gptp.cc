@@ -104,6 +104,9 @@ void Gptp::initialize(int stage)
 
         gmRateRatio = 1.0;
 
+        followUpTemplate = makeShared<GptpFollowUp>();
+        followUpTemplate->setDomainNumber(domainNumber);
+
         registerProtocol(Protocol::gptp, gate("socketOut"), gate("socketIn"));
 
         /* Only grandmaster in the domain can initialize the synchronization message periodically
@@ -261,8 +264,10 @@ void Gptp::sendFollowUp(int portId, const GptpSync *sync, clocktime_t preciseOri
 {
     auto packet = new Packet("GptpFollowUp");
     packet->addTag<MacAddressReq>()->setDestAddress(GPTP_MULTICAST_ADDRESS);
-    auto gptp = makeShared<GptpFollowUp>();
-    gptp->setDomainNumber(domainNumber);
+    // all master ports send the same follow-up content for a given sync, so
+    // copy the shared template and patch only the varying fields instead of
+    // rebuilding the whole message per port
+    auto gptp = staticPtrCast<GptpFollowUp>(followUpTemplate->dupShared());
     gptp->setPreciseOriginTimestamp(preciseOriginTimestamp);
     gptp->setSequenceId(sync->getSequenceId());
 
@@ -66,6 +66,10 @@ class INET_API Gptp : public ClockUserModuleBase, public cListener
     bool rcvdGptpSync = false;
     uint16_t lastReceivedGptpSyncSequenceId = 0xffff;
 
+    // follow-up message template shared by all master ports; sendFollowUp() only
+    // patches the per-sync and per-port fields on a copy instead of rebuilding the message
+    Ptr<GptpFollowUp> followUpTemplate;
+
     // self timers:
     ClockEvent* selfMsgSync = nullptr;
     ClockEvent* selfMsgDelayReq = nullptr;
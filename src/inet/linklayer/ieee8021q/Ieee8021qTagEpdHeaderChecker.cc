@@ -34,6 +34,7 @@ void Ieee8021qTagEpdHeaderChecker::initialize(int stage)
         else
             throw cRuntimeError("Unknown tag type");
         vlanIdFilter = check_and_cast<cValueArray *>(par("vlanIdFilter").objectValue());
+        updateAcceptedVlanIds();
     }
     else if (stage == INITSTAGE_LINK_LAYER)
         registerProtocol(*qtagProtocol, nullptr, inputGate);
@@ -41,8 +42,17 @@ void Ieee8021qTagEpdHeaderChecker::initialize(int stage)
 
 void Ieee8021qTagEpdHeaderChecker::handleParameterChange(const char *name)
 {
-    if (!strcmp(name, "vlanIdFilter"))
+    if (!strcmp(name, "vlanIdFilter")) {
         vlanIdFilter = check_and_cast<cValueArray *>(par("vlanIdFilter").objectValue());
+        updateAcceptedVlanIds();
+    }
+}
+
+void Ieee8021qTagEpdHeaderChecker::updateAcceptedVlanIds()
+{
+    acceptedVlanIds.reset();
+    for (int i = 0; i < vlanIdFilter->size(); i++)
+        acceptedVlanIds.set(vlanIdFilter->get(i).intValue());
 }
 
 void Ieee8021qTagEpdHeaderChecker::processPacket(Packet *packet)
@@ -83,12 +93,8 @@ bool Ieee8021qTagEpdHeaderChecker::matchesPacket(const Packet *packet) const
         auto vlanId = header->getVid();
         if (vlanIdFilter->size() == 0)
             return true;
-        else {
-            for (int i = 0; i < vlanIdFilter->size(); i++)
-                if (vlanIdFilter->get(i).intValue() == vlanId)
-                    return true;
-            return false;
-        }
+        else
+            return vlanId >= 0 && vlanId < (int)acceptedVlanIds.size() && acceptedVlanIds.test(vlanId);
     }
 }
 
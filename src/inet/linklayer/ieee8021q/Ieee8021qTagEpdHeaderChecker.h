@@ -8,6 +8,8 @@
 #ifndef __INET_IEEE8021QTAGEPDHEADERCHECKER_H
 #define __INET_IEEE8021QTAGEPDHEADERCHECKER_H
 
+#include <bitset>
+
 #include "inet/common/Protocol.h"
 #include "inet/common/packet/Packet.h"
 #include "inet/queueing/base/PacketFilterBase.h"
@@ -21,10 +23,12 @@ class INET_API Ieee8021qTagEpdHeaderChecker : public PacketFilterBase
   protected:
     const Protocol *qtagProtocol = nullptr;
     cValueArray *vlanIdFilter = nullptr;
+    std::bitset<4096> acceptedVlanIds; // accepted VLAN ids precomputed from vlanIdFilter, directly indexed by VLAN id
 
   protected:
     virtual void initialize(int stage) override;
     virtual void handleParameterChange(const char *name) override;
+    virtual void updateAcceptedVlanIds();
     virtual void processPacket(Packet *packet) override;
     virtual void dropPacket(Packet *packet) override;
 
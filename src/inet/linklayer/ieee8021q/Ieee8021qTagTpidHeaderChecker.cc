@@ -30,9 +30,17 @@ void Ieee8021qTagTpidHeaderChecker::initialize(int stage)
         else
             throw cRuntimeError("Unknown tag type");
         vlanIdFilter = check_and_cast<cValueArray *>(par("vlanIdFilter").objectValue());
+        updateAcceptedVlanIds();
     }
 }
 
+void Ieee8021qTagTpidHeaderChecker::updateAcceptedVlanIds()
+{
+    acceptedVlanIds.reset();
+    for (int i = 0; i < vlanIdFilter->size(); i++)
+        acceptedVlanIds.set(vlanIdFilter->get(i).intValue());
+}
+
 void Ieee8021qTagTpidHeaderChecker::processPacket(Packet *packet)
 {
     const auto& header = packet->popAtFront<Ieee8021qTagTpidHeader>();
@@ -59,12 +67,8 @@ bool Ieee8021qTagTpidHeaderChecker::matchesPacket(const Packet *packet) const
         auto vlanId = header->getVid();
         if (vlanIdFilter->size() == 0)
             return true;
-        else {
-            for (int i = 0; i < vlanIdFilter->size(); i++)
-                if (vlanIdFilter->get(i).intValue() == vlanId)
-                    return true;
-            return false;
-        }
+        else
+            return vlanId >= 0 && vlanId < (int)acceptedVlanIds.size() && acceptedVlanIds.test(vlanId);
     }
 }
 
@@ -8,6 +8,8 @@
 #ifndef __INET_IEEE8021QTAGTPIDHEADERCHECKER_H
 #define __INET_IEEE8021QTAGTPIDHEADERCHECKER_H
 
+#include <bitset>
+
 #include "inet/queueing/base/PacketFilterBase.h"
 
 namespace inet {
@@ -19,9 +21,11 @@ class INET_API Ieee8021qTagTpidHeaderChecker : public PacketFilterBase
   protected:
     int tpid = -1;
     cValueArray *vlanIdFilter = nullptr;
+    std::bitset<4096> acceptedVlanIds; // accepted VLAN ids precomputed from vlanIdFilter, directly indexed by VLAN id
 
   protected:
     virtual void initialize(int stage) override;
+    virtual void updateAcceptedVlanIds();
     virtual void processPacket(Packet *packet) override;
     virtual void dropPacket(Packet *packet) override;
 
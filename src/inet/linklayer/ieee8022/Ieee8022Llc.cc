@@ -14,7 +14,6 @@
 #include "inet/common/Simsignals.h"
 #include "inet/common/lifecycle/NodeStatus.h"
 #include "inet/common/socket/SocketTag_m.h"
-#include "inet/common/stlutils.h"
 #include "inet/linklayer/common/Ieee802SapTag_m.h"
 #include "inet/linklayer/ieee8022/Ieee8022LlcSocketCommand_m.h"
 
@@ -133,7 +132,10 @@ bool Ieee8022Llc::deliverCopyToSockets(Packet *packet)
 bool Ieee8022Llc::isDeliverableToUpperLayer(Packet *packet)
 {
     const auto& protocolTag = packet->findTag<PacketProtocolTag>();
-    return (protocolTag != nullptr && contains(upperProtocols, protocolTag->getProtocol()));
+    if (protocolTag == nullptr)
+        return false;
+    int protocolId = protocolTag->getProtocol()->getId();
+    return protocolId < (int)upperProtocolIdTable.size() && upperProtocolIdTable[protocolId];
 }
 
 void Ieee8022Llc::processPacketFromMac(Packet *packet)
@@ -255,6 +257,10 @@ void Ieee8022Llc::handleRegisterProtocol(const Protocol& protocol, cGate *gate,
     // KLUDGE this should be here: if (!strcmp("upperLayerOut", gate->getBaseName()))
     // but then the register protocol calls are lost, because they can't go through the traffic conditioner
     upperProtocols.insert(&protocol);
+    int protocolId = protocol.getId();
+    if (protocolId >= (int)upperProtocolIdTable.size())
+        upperProtocolIdTable.resize(protocolId + 1, false);
+    upperProtocolIdTable[protocolId] = true;
 }
 
 std::ostream& operator<<(std::ostream& o, const Ieee8022Llc::SocketDescriptor& t)
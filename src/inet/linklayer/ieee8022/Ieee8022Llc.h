@@ -34,6 +34,7 @@ class INET_API Ieee8022Llc : public OperationalBase, public DefaultProtocolRegis
     friend std::ostream& operator<<(std::ostream& o, const SocketDescriptor& t);
 
     std::set<const Protocol *> upperProtocols; // where to send packets after decapsulation
+    std::vector<bool> upperProtocolIdTable; // dense protocol id membership for the per-frame lookup, kept in sync with upperProtocols
     std::map<int, SocketDescriptor *> socketIdToSocketDescriptor;
 
   protected:
@@ -30,7 +30,6 @@ simsignal_t Ppp::rxPkOkSignal = registerSignal("rxPkOk");
 Ppp::~Ppp()
 {
     cancelAndDelete(endTransmissionEvent);
-    delete curTxPacket;
 }
 
 void Ppp::initialize(int stage)
@@ -133,15 +132,16 @@ void Ppp::refreshOutGateConnection(bool connected)
 
     if (!connected) {
         if (endTransmissionEvent->isScheduled()) {
-            ASSERT(curTxPacket != nullptr);
+            ASSERT(currentTxFrame != nullptr);
+            // no copy of the transmitted frame is kept around, rebuild it for the truncated transmission update
+            Packet *curTxPacket = prepareTxPacket();
             simtime_t startTransmissionTime = endTransmissionEvent->getSendingTime();
             simtime_t sentDuration = simTime() - startTransmissionTime;
             double sentPart = sentDuration / (endTransmissionEvent->getArrivalTime() - startTransmissionTime);
             b newLength = b(floor(curTxPacket->getBitLength() * sentPart));
             curTxPacket->removeAtBack(curTxPacket->getDataLength() - newLength);
             curTxPacket->setBitError(true);
-            send(curTxPacket, SendOptions().finishTx(curTxPacket->getId()), physOutGate);
-            curTxPacket = nullptr;
+            send(curTxPacket, SendOptions().finishTx(curTxId), physOutGate);
             cancelEvent(endTransmissionEvent);
         }
 
@@ -170,16 +170,11 @@ void Ppp::refreshOutGateConnection(bool connected)
     }
 }
 
-void Ppp::startTransmitting()
+Packet *Ppp::prepareTxPacket()
 {
     // if there's any control info, remove it; then encapsulate the packet
     Packet *pppFrame = currentTxFrame->dup();
     encapsulate(pppFrame);
-
-    // send
-    EV_INFO << "Transmission of " << pppFrame << " started.\n";
-    emit(transmissionStateChangedSignal, 1L);
-    emit(packetSentToLowerSignal, pppFrame);
     auto& oldPacketProtocolTag = pppFrame->removeTag<PacketProtocolTag>();
     pppFrame->clearTags();
     auto newPacketProtocolTag = pppFrame->addTag<PacketProtocolTag>();
@@ -189,8 +184,19 @@ void Ppp::startTransmitting()
         pppFrame->eraseAll();
         pppFrame->insertAtFront(bytes);
     }
-    curTxPacket = pppFrame->dup();
-    send(pppFrame, SendOptions().transmissionId(curTxPacket->getId()), physOutGate);
+    return pppFrame;
+}
+
+void Ppp::startTransmitting()
+{
+    Packet *pppFrame = prepareTxPacket();
+
+    // send
+    EV_INFO << "Transmission of " << pppFrame << " started.\n";
+    emit(transmissionStateChangedSignal, 1L);
+    emit(packetSentToLowerSignal, pppFrame);
+    curTxId = pppFrame->getId();
+    send(pppFrame, SendOptions().transmissionId(curTxId), physOutGate);
 
     ASSERT(datarateChannel == physOutGate->getTransmissionChannel()); // FIXME reread datarateChannel when changed
 
@@ -216,8 +222,6 @@ void Ppp::handleSelfMessage(cMessage *message)
 {
     if (message == endTransmissionEvent) {
         deleteCurrentTxFrame();
-        delete curTxPacket;
-        curTxPacket = nullptr;
         // Transmission finished, we can start next one.
         EV_INFO << "Transmission successfully completed.\n";
         emit(transmissionStateChangedSignal, 0L);
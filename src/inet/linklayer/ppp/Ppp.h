@@ -31,8 +31,8 @@ class INET_API Ppp : public MacProtocolBase, public queueing::IActivePacketSink
 
     cMessage *endTransmissionEvent = nullptr;
 
-    // saved current transmission
-    Packet *curTxPacket = nullptr;
+    // transmission id of the frame currently being transmitted
+    long curTxId = -1;
 
     std::string oldConnColor;
 
@@ -47,6 +47,7 @@ class INET_API Ppp : public MacProtocolBase, public queueing::IActivePacketSink
 
   protected:
     virtual void startTransmitting();
+    virtual Packet *prepareTxPacket();
     virtual void encapsulate(Packet *msg);
     virtual void decapsulate(Packet *packet);
     virtual void refreshDisplay() const override;
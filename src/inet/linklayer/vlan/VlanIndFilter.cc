@@ -26,6 +26,14 @@ void VlanIndFilter::initialize(int stage)
     }
 }
 
+void VlanIndFilter::handleParameterChange(const char *name)
+{
+    if (!strcmp(name, "acceptedVlanIds")) {
+        acceptedVlanIds = check_and_cast<cValueMap *>(par("acceptedVlanIds").objectValue());
+        interfaceVlanIdFilters.clear();
+    }
+}
+
 cGate *VlanIndFilter::getRegistrationForwardingGate(cGate *gate)
 {
     if (gate == outputGate)
@@ -42,21 +50,40 @@ void VlanIndFilter::dropPacket(Packet *packet)
     PacketFilterBase::dropPacket(packet, OTHER_PACKET_DROP);
 }
 
+const VlanIndFilter::InterfaceVlanIdFilter& VlanIndFilter::getInterfaceVlanIdFilter(int interfaceId) const
+{
+    auto it = interfaceVlanIdFilters.find(interfaceId);
+    if (it == interfaceVlanIdFilters.end()) {
+        InterfaceVlanIdFilter vlanIdFilter;
+        auto networkInterface = interfaceId != -1 ? interfaceTable->getInterfaceById(interfaceId) : nullptr;
+        auto interfaceName = networkInterface != nullptr ? networkInterface->getInterfaceName() : "";
+        auto key = acceptedVlanIds->containsKey(interfaceName) ? interfaceName : "*";
+        if (acceptedVlanIds->containsKey(key)) {
+            auto interfaceVlanIdList = check_and_cast<cValueArray *>(acceptedVlanIds->get(key).objectValue());
+            for (int i = 0; i < interfaceVlanIdList->size(); i++) {
+                auto vlanId = interfaceVlanIdList->get(i).intValue();
+                if (vlanId == -1)
+                    vlanIdFilter.acceptsUntagged = true;
+                else
+                    vlanIdFilter.acceptedVlanIds.set(vlanId);
+            }
+        }
+        it = interfaceVlanIdFilters.emplace(interfaceId, vlanIdFilter).first;
+    }
+    return it->second;
+}
+
 bool VlanIndFilter::matchesPacket(const Packet *packet) const
 {
     auto interfaceInd = packet->findTag<InterfaceInd>();
-    auto networkInterface = interfaceInd != nullptr ? interfaceTable->getInterfaceById(interfaceInd->getInterfaceId()) : nullptr;
-    auto interfaceName = networkInterface != nullptr ? networkInterface->getInterfaceName() : "";
-    auto key = acceptedVlanIds->containsKey(interfaceName) ? interfaceName : "*";
-    if (acceptedVlanIds->containsKey(key)) {
-        auto vlanInd = packet->findTag<VlanInd>();
-        auto vlanId = vlanInd != nullptr ? vlanInd->getVlanId() : -1;
-        auto interfaceVlanIdList = check_and_cast<cValueArray *>(acceptedVlanIds->get(key).objectValue());
-        for (int i = 0; i < interfaceVlanIdList->size(); i++)
-            if (interfaceVlanIdList->get(i).intValue() == vlanId)
-                return true;
-    }
-    return false;
+    auto interfaceId = interfaceInd != nullptr ? interfaceInd->getInterfaceId() : -1;
+    const auto& vlanIdFilter = getInterfaceVlanIdFilter(interfaceId);
+    auto vlanInd = packet->findTag<VlanInd>();
+    auto vlanId = vlanInd != nullptr ? vlanInd->getVlanId() : -1;
+    if (vlanId == -1)
+        return vlanIdFilter.acceptsUntagged;
+    else
+        return vlanId >= 0 && vlanId < (int)vlanIdFilter.acceptedVlanIds.size() && vlanIdFilter.acceptedVlanIds.test(vlanId);
 }
 
 } // namespace inet
@@ -26,6 +26,14 @@ void VlanReqFilter::initialize(int stage)
     }
 }
 
+void VlanReqFilter::handleParameterChange(const char *name)
+{
+    if (!strcmp(name, "acceptedVlanIds")) {
+        acceptedVlanIds = check_and_cast<cValueMap *>(par("acceptedVlanIds").objectValue());
+        interfaceVlanIdFilters.clear();
+    }
+}
+
 cGate *VlanReqFilter::getRegistrationForwardingGate(cGate *gate)
 {
     if (gate == outputGate)
@@ -42,21 +50,40 @@ void VlanReqFilter::dropPacket(Packet *packet)
     PacketFilterBase::dropPacket(packet, OTHER_PACKET_DROP);
 }
 
+const VlanReqFilter::InterfaceVlanIdFilter& VlanReqFilter::getInterfaceVlanIdFilter(int interfaceId) const
+{
+    auto it = interfaceVlanIdFilters.find(interfaceId);
+    if (it == interfaceVlanIdFilters.end()) {
+        InterfaceVlanIdFilter vlanIdFilter;
+        auto networkInterface = interfaceId != -1 ? interfaceTable->getInterfaceById(interfaceId) : nullptr;
+        auto interfaceName = networkInterface != nullptr ? networkInterface->getInterfaceName() : "";
+        auto key = acceptedVlanIds->containsKey(interfaceName) ? interfaceName : "*";
+        if (acceptedVlanIds->containsKey(key)) {
+            auto interfaceVlanIdList = check_and_cast<cValueArray *>(acceptedVlanIds->get(key).objectValue());
+            for (int i = 0; i < interfaceVlanIdList->size(); i++) {
+                auto vlanId = interfaceVlanIdList->get(i).intValue();
+                if (vlanId == -1)
+                    vlanIdFilter.acceptsUntagged = true;
+                else
+                    vlanIdFilter.acceptedVlanIds.set(vlanId);
+            }
+        }
+        it = interfaceVlanIdFilters.emplace(interfaceId, vlanIdFilter).first;
+    }
+    return it->second;
+}
+
 bool VlanReqFilter::matchesPacket(const Packet *packet) const
 {
     auto interfaceReq = packet->findTag<InterfaceReq>();
-    auto networkInterface = interfaceReq != nullptr ? interfaceTable->getInterfaceById(interfaceReq->getInterfaceId()) : nullptr;
-    auto interfaceName = networkInterface != nullptr ? networkInterface->getInterfaceName() : "";
-    auto key = acceptedVlanIds->containsKey(interfaceName) ? interfaceName : "*";
-    if (acceptedVlanIds->containsKey(key)) {
-        auto vlanReq = packet->findTag<VlanReq>();
-        auto vlanId = vlanReq != nullptr ? vlanReq->getVlanId() : -1;
-        auto interfaceVlanIdList = check_and_cast<cValueArray *>(acceptedVlanIds->get(key).objectValue());
-        for (int i = 0; i < interfaceVlanIdList->size(); i++)
-            if (interfaceVlanIdList->get(i).intValue() == vlanId)
-                return true;
-    }
-    return false;
+    auto interfaceId = interfaceReq != nullptr ? interfaceReq->getInterfaceId() : -1;
+    const auto& vlanIdFilter = getInterfaceVlanIdFilter(interfaceId);
+    auto vlanReq = packet->findTag<VlanReq>();
+    auto vlanId = vlanReq != nullptr ? vlanReq->getVlanId() : -1;
+    if (vlanId == -1)
+        return vlanIdFilter.acceptsUntagged;
+    else
+        return vlanId >= 0 && vlanId < (int)vlanIdFilter.acceptedVlanIds.size() && vlanIdFilter.acceptedVlanIds.test(vlanId);
 }
 
 } // namespace inet
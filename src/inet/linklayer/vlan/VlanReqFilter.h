@@ -8,6 +8,8 @@
 #ifndef __INET_VLANREQFILTER_H
 #define __INET_VLANREQFILTER_H
 
+#include <bitset>
+
 #include "inet/common/IProtocolRegistrationListener.h"
 #include "inet/common/ModuleRefByPar.h"
 #include "inet/networklayer/contract/IInterfaceTable.h"
@@ -20,14 +22,24 @@ using namespace inet::queueing;
 class INET_API VlanReqFilter : public PacketFilterBase, public TransparentProtocolRegistrationListener
 {
   protected:
+    class INET_API InterfaceVlanIdFilter {
+      public:
+        std::bitset<4096> acceptedVlanIds; // accepted VLAN ids, directly indexed by VLAN id
+        bool acceptsUntagged = false; // accepts packets without a VLAN id (-1 in the parameter)
+    };
+
     ModuleRefByPar<IInterfaceTable> interfaceTable;
     cValueMap *acceptedVlanIds = nullptr;
+    mutable std::map<int, InterfaceVlanIdFilter> interfaceVlanIdFilters; // flat per-interface filters precomputed from acceptedVlanIds, indexed by interface id
 
   protected:
     virtual void initialize(int stage) override;
+    virtual void handleParameterChange(const char *name) override;
     virtual void processPacket(Packet *packet) override {}
     virtual void dropPacket(Packet *packet) override;
 
+    virtual const InterfaceVlanIdFilter& getInterfaceVlanIdFilter(int interfaceId) const;
+
     virtual cGate *getRegistrationForwardingGate(cGate *gate) override;
 
   public:
@@ -29,6 +29,14 @@ void VlanReqMapper::initialize(int stage)
     }
 }
 
+void VlanReqMapper::handleParameterChange(const char *name)
+{
+    if (!strcmp(name, "mappedVlanIds")) {
+        mappedVlanIds = check_and_cast<cValueMap *>(par("mappedVlanIds").objectValue());
+        interfaceVlanIdMaps.clear();
+    }
+}
+
 cGate *VlanReqMapper::getRegistrationForwardingGate(cGate *gate)
 {
     if (gate == outputGate)
@@ -39,24 +47,46 @@ cGate *VlanReqMapper::getRegistrationForwardingGate(cGate *gate)
         throw cRuntimeError("Unknown gate");
 }
 
+const VlanReqMapper::InterfaceVlanIdMap& VlanReqMapper::getInterfaceVlanIdMap(int interfaceId)
+{
+    auto it = interfaceVlanIdMaps.find(interfaceId);
+    if (it == interfaceVlanIdMaps.end()) {
+        InterfaceVlanIdMap vlanIdMap;
+        vlanIdMap.mappedVlanIds.fill(InterfaceVlanIdMap::UNMAPPED);
+        auto networkInterface = interfaceId != -1 ? interfaceTable->getInterfaceById(interfaceId) : nullptr;
+        auto interfaceName = networkInterface != nullptr ? networkInterface->getInterfaceName() : "";
+        auto key = mappedVlanIds->containsKey(interfaceName) ? interfaceName : "*";
+        if (mappedVlanIds->containsKey(key)) {
+            auto interfaceMappedVlanIds = check_and_cast<cValueMap *>(mappedVlanIds->get(key).objectValue());
+            for (const auto& entry : interfaceMappedVlanIds->getFields()) {
+                int oldVlanId = std::stoi(entry.first);
+                int newVlanId = entry.second.intValue();
+                if (oldVlanId == -1)
+                    vlanIdMap.untaggedVlanId = newVlanId;
+                else
+                    vlanIdMap.mappedVlanIds[oldVlanId] = newVlanId;
+            }
+        }
+        it = interfaceVlanIdMaps.emplace(interfaceId, vlanIdMap).first;
+    }
+    return it->second;
+}
+
 void VlanReqMapper::processPacket(Packet *packet)
 {
     auto interfaceReq = packet->findTag<InterfaceReq>();
-    auto networkInterface = interfaceReq != nullptr ? interfaceTable->getInterfaceById(interfaceReq->getInterfaceId()) : nullptr;
-    auto interfaceName = networkInterface != nullptr ? networkInterface->getInterfaceName() : "";
-    auto key = mappedVlanIds->containsKey(interfaceName) ? interfaceName : "*";
-    if (mappedVlanIds->containsKey(key)) {
-        auto interfaceMappedVlanIds = check_and_cast<cValueMap *>(mappedVlanIds->get(key).objectValue());
-        auto vlanReq = packet->findTag<VlanReq>();
-        auto oldVlanId = vlanReq != nullptr ? vlanReq->getVlanId() : -1;
-        auto key = std::to_string(oldVlanId);
-        if (interfaceMappedVlanIds->containsKey(key.c_str())) {
-            auto newVlanId = interfaceMappedVlanIds->get(key.c_str()).intValue();
-            if (newVlanId == -1)
-                packet->removeTagIfPresent<VlanReq>();
-            else
-                packet->addTagIfAbsent<VlanReq>()->setVlanId(newVlanId);
-        }
+    auto interfaceId = interfaceReq != nullptr ? interfaceReq->getInterfaceId() : -1;
+    const auto& vlanIdMap = getInterfaceVlanIdMap(interfaceId);
+    auto vlanReq = packet->findTag<VlanReq>();
+    auto oldVlanId = vlanReq != nullptr ? vlanReq->getVlanId() : -1;
+    auto newVlanId = oldVlanId == -1 ? vlanIdMap.untaggedVlanId :
+                     oldVlanId >= 0 && oldVlanId < (int)vlanIdMap.mappedVlanIds.size() ? vlanIdMap.mappedVlanIds[oldVlanId] :
+                     (int)InterfaceVlanIdMap::UNMAPPED;
+    if (newVlanId != InterfaceVlanIdMap::UNMAPPED) {
+        if (newVlanId == -1)
+            packet->removeTagIfPresent<VlanReq>();
+        else
+            packet->addTagIfAbsent<VlanReq>()->setVlanId(newVlanId);
     }
     ensureEncapsulationProtocolReq(packet, protocol, packet->hasTag<VlanReq>() || packet->hasTag<PcpReq>());
     setDispatchProtocol(packet);
@@ -8,6 +8,8 @@
 #ifndef __INET_VLANREQMAPPER_H
 #define __INET_VLANREQMAPPER_H
 
+#include <array>
+
 #include "inet/common/IProtocolRegistrationListener.h"
 #include "inet/common/ModuleRefByPar.h"
 #include "inet/networklayer/contract/IInterfaceTable.h"
@@ -20,14 +22,26 @@ using namespace inet::queueing;
 class INET_API VlanReqMapper : public PacketFlowBase, public TransparentProtocolRegistrationListener
 {
   protected:
+    class INET_API InterfaceVlanIdMap {
+      public:
+        static constexpr int UNMAPPED = -2;
+
+        std::array<int, 4096> mappedVlanIds; // new VLAN ids, directly indexed by old VLAN id, UNMAPPED where the parameter has no mapping
+        int untaggedVlanId = UNMAPPED; // new VLAN id for packets without a VLAN id (key -1 in the parameter)
+    };
+
     const Protocol *protocol = nullptr;
     ModuleRefByPar<IInterfaceTable> interfaceTable;
     cValueMap *mappedVlanIds = nullptr;
+    std::map<int, InterfaceVlanIdMap> interfaceVlanIdMaps; // flat per-interface maps precomputed from mappedVlanIds, indexed by interface id
 
   protected:
     virtual void initialize(int stage) override;
+    virtual void handleParameterChange(const char *name) override;
     virtual void processPacket(Packet *packet) override;
 
+    virtual const InterfaceVlanIdMap& getInterfaceVlanIdMap(int interfaceId);
+
     virtual cGate *getRegistrationForwardingGate(cGate *gate) override;
 };
 
@@ -7,6 +7,7 @@
 
 #include "inet/linklayer/xmac/XMac.h"
 
+#include "inet/common/INETMath.h"
 #include "inet/common/INETUtils.h"
 #include "inet/common/ModuleAccess.h"
 #include "inet/common/ProtocolTag_m.h"
@@ -15,6 +16,7 @@
 #include "inet/linklayer/common/MacAddressTag_m.h"
 #include "inet/linklayer/xmac/XMacHeader_m.h"
 #include "inet/networklayer/contract/IInterfaceTable.h"
+#include "inet/physicallayer/wireless/common/contract/packetlevel/IRadioMedium.h"
 
 namespace inet {
 
@@ -38,6 +40,7 @@ void XMac::initialize(int stage)
         txPower = par("txPower");
         useMacAcks = par("useMACAcks");
         maxTxAttempts = par("maxTxAttempts");
+        suppressIdleWakeUps = par("suppressIdleWakeUps");
         EV_DEBUG << "headerLength: " << headerLength << "ctrlFrameLength: " << ctrlFrameLength << ", bitrate: " << bitrate << endl;
 
         stats = par("stats");
@@ -64,6 +67,10 @@ void XMac::initialize(int stage)
         cModule *radioModule = check_and_cast<cModule *>(radio.get());
         radioModule->subscribe(IRadio::radioModeChangedSignal, this);
         radioModule->subscribe(IRadio::transmissionStateChangedSignal, this);
+        if (suppressIdleWakeUps) {
+            cModule *mediumModule = const_cast<cModule *>(check_and_cast<const cModule *>(radio->getMedium()));
+            mediumModule->subscribe(IRadioMedium::signalAddedSignal, this);
+        }
 
         wakeup = new cMessage("wakeup", XMAC_WAKE_UP);
 
@@ -258,7 +265,7 @@ void XMac::handleStateEvent(cMessage *msg)
                 // if anything to send, go back to sleep and wake up after a full period
                 else {
                     EV_DEBUG << "node " << address << " : State CCA, message XMAC_CCA_TIMEOUT, new state SLEEP" << endl;
-                    scheduleAfter(slotDuration, wakeup);
+                    scheduleWakeUp();
                     macState = SLEEP;
                     radio->setRadioMode(IRadio::RADIO_MODE_SLEEP);
                     changeDisplayColor(BLACK);
@@ -418,11 +425,7 @@ void XMac::handleStateEvent(cMessage *msg)
                 EV_DEBUG << "node " << address << " : State WAIT_TX_DATA_OVER, message XMAC_DATA_TX_OVER, new state  SLEEP" << endl;
                 // remove the packet just served from the queue
                 deleteCurrentTxFrame();
-                // if something in the queue, wakeup soon.
-                if (!txQueue->isEmpty())
-                    scheduleAfter(dblrand() * checkInterval, wakeup);
-                else
-                    scheduleAfter(slotDuration, wakeup);
+                scheduleWakeUp();
                 macState = SLEEP;
                 radio->setRadioMode(IRadio::RADIO_MODE_SLEEP);
                 changeDisplayColor(BLACK);
@@ -460,11 +463,7 @@ void XMac::handleStateEvent(cMessage *msg)
                     nbRxDataPackets++;
                     cancelEvent(data_timeout);
 
-                    // if something in the queue, wakeup soon.
-                    if (!txQueue->isEmpty())
-                        scheduleAfter(dblrand() * checkInterval, wakeup);
-                    else
-                        scheduleAfter(slotDuration, wakeup);
+                    scheduleWakeUp();
                     macState = SLEEP;
                     radio->setRadioMode(IRadio::RADIO_MODE_SLEEP);
                     changeDisplayColor(BLACK);
@@ -482,11 +481,7 @@ void XMac::handleStateEvent(cMessage *msg)
             // data does not arrives in time
             else if (kind == XMAC_DATA_TIMEOUT) {
                 EV << "node " << address << " : State WAIT_DATA, message XMAC_DATA_TIMEOUT, new state SLEEP" << endl;
-                // if something in the queue, wakeup soon.
-                if (!txQueue->isEmpty())
-                    scheduleAfter(dblrand() * checkInterval, wakeup);
-                else
-                    scheduleAfter(slotDuration, wakeup);
+                scheduleWakeUp();
                 macState = SLEEP;
                 radio->setRadioMode(IRadio::RADIO_MODE_SLEEP);
                 changeDisplayColor(BLACK);
@@ -601,12 +596,49 @@ void XMac::receiveSignal(cComponent *source, simsignal_t signalID, intval_t valu
     }
 }
 
+void XMac::receiveSignal(cComponent *source, simsignal_t signalID, cObject *value, cObject *details)
+{
+    Enter_Method("%s", cComponent::getSignalName(signalID));
+
+    if (signalID == IRadioMedium::signalAddedSignal) {
+        // another node started transmitting; resume the duty cycle of a
+        // dormant node, so the preamble train is caught by the next CCA
+        if (macState == SLEEP && !wakeup->isScheduled() && isRelevantTransmission(check_and_cast<const ITransmission *>(value)))
+            scheduleAfter(SIMTIME_ZERO, wakeup);
+    }
+}
+
 void XMac::attachSignal(Packet *packet, simtime_t_cref startTime)
 {
     simtime_t duration = packet->getBitLength() / bitrate;
     packet->setDuration(duration);
 }
 
+void XMac::scheduleWakeUp()
+{
+    // if something in the queue, wakeup soon.
+    if (!txQueue->isEmpty())
+        scheduleAfter(dblrand() * checkInterval, wakeup);
+    // nothing to send: stay dormant until a transmission starts on the medium
+    else if (suppressIdleWakeUps)
+        EV_DEBUG << "Queue empty, suppressing periodic wakeup until medium activity" << endl;
+    else
+        scheduleAfter(slotDuration, wakeup);
+}
+
+/**
+ * Check whether a transmission that just started on the medium may be audible
+ * at this node, based on the medium's maximum communication range.
+ */
+bool XMac::isRelevantTransmission(const ITransmission *transmission) const
+{
+    if (transmission->getTransmitterRadioId() == radio->getId())
+        return false;
+    m maxCommunicationRange = radio->getMedium()->getMediumLimitCache()->getMaxCommunicationRange();
+    return std::isnan(maxCommunicationRange.get()) ||
+           transmission->getStartPosition().distance(radio->getAntenna()->getMobility()->getCurrentPosition()) < maxCommunicationRange.get();
+}
+
 /**
  * Change the color of the node for animation purposes.
  */
@@ -710,10 +742,12 @@ void XMac::handleCanPullPacketChanged(const cGate *gate)
 {
     Enter_Method("handleCanPullPacketChanged");
     // force wakeup now
-    if (gate->getId() == upperLayerInGateId && (macState == SLEEP) && wakeup->isScheduled()
-            && canDequeuePacket())
-    {
-        rescheduleAfter(dblrand() * 0.01f, wakeup);
+    if (gate->getId() == upperLayerInGateId && (macState == SLEEP) && canDequeuePacket()) {
+        if (wakeup->isScheduled())
+            rescheduleAfter(dblrand() * 0.01f, wakeup);
+        // wake a dormant node that suppressed its periodic wakeup
+        else if (suppressIdleWakeUps)
+            scheduleAfter(dblrand() * 0.01f, wakeup);
     }
 }
 
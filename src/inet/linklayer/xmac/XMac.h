@@ -90,6 +90,9 @@ class INET_API XMac : public MacProtocolBase, public IMacProtocol, public queuei
 
     void receiveSignal(cComponent *source, simsignal_t signalID, intval_t value, cObject *details) override;
 
+    /** @brief Handle medium activity notifications when idle wakeups are suppressed */
+    void receiveSignal(cComponent *source, simsignal_t signalID, cObject *value, cObject *details) override;
+
     // IActivePacketSink:
     virtual queueing::IPassivePacketSource *getProvider(const cGate *gate) override;
     virtual void handleCanPullPacketChanged(const cGate *gate) override;
@@ -201,6 +204,9 @@ class INET_API XMac : public MacProtocolBase, public IMacProtocol, public queuei
     /** @brief Maximum transmission attempts per data packet, when ACKs are
      * used */
     int maxTxAttempts;
+    /** @brief Suppress the periodic wakeup while the queue is empty and resume
+     * the duty cycle when a transmission starts within communication range */
+    bool suppressIdleWakeUps = false;
     /** @brief Gather stats at the end of the simulation */
     bool stats;
 
@@ -216,6 +222,12 @@ class INET_API XMac : public MacProtocolBase, public IMacProtocol, public queuei
     /** @brief Internal function: state machine */
     void handleStateEvent(cMessage *msg);
 
+    /** @brief Internal function to schedule the next wakeup before sleeping */
+    void scheduleWakeUp();
+
+    /** @brief Internal function to decide whether a transmission may be audible */
+    bool isRelevantTransmission(const physicallayer::ITransmission *transmission) const;
+
     /** @brief Internal function to change the color of the node */
     void changeDisplayColor(XMAC_COLORS color);
 
@@ -7,17 +7,15 @@
 
 #include "inet/mobility/single/BonnMotionFileCache.h"
 
+#include <cstdlib>
+
 #include <fstream>
-#include <sstream>
 
 namespace inet {
 
 const BonnMotionFile::Line *BonnMotionFile::getLine(int nodeId) const
 {
-    LineList::const_iterator it = lines.begin();
-    for (int i = 0; i < nodeId && it != lines.end(); i++)
-        it++;
-    return (it == lines.end()) ? nullptr : &(*it);
+    return (nodeId < 0 || nodeId >= (int)lines.size()) ? nullptr : &lines[nodeId];
 }
 
 const BonnMotionFile *BonnMotionFileCache::getFile(const char *filename)
@@ -44,13 +42,18 @@ void BonnMotionFileCache::parseFile(const char *filename, BonnMotionFile& bmFile
         bmFile.lines.push_back(BonnMotionFile::Line());
         BonnMotionFile::Line& vec = bmFile.lines.back();
 
-        std::stringstream linestream(line);
-        double d;
-        while (linestream >> d)
+        // strtod is considerably faster than stringstream extraction and
+        // dominates the startup time of large trace files
+        const char *s = line.c_str();
+        char *end;
+        for (double d = strtod(s, &end); s != end; d = strtod(s, &end)) {
             vec.push_back(d);
+            s = end;
+        }
+        vec.shrink_to_fit();
     }
+    bmFile.lines.shrink_to_fit();
     in.close();
 }
 
 } // namespace inet
-
@@ -8,7 +8,6 @@
 #ifndef __INET_BONNMOTIONFILECACHE_H
 #define __INET_BONNMOTIONFILECACHE_H
 
-#include <list>
 #include <vector>
 
 #include "inet/common/INETDefs.h"
@@ -28,8 +27,8 @@ class INET_API BonnMotionFile
 
   protected:
     friend class BonnMotionFileCache;
-    typedef std::list<Line> LineList;
-    LineList lines;
+    typedef std::vector<Line> LineList;
+    LineList lines; // indexed by node id
 
   public:
     const Line *getLine(int nodeId) const;
@@ -55,4 +54,3 @@ class INET_API BonnMotionFileCache
 } // namespace inet
 
 #endif
-
@@ -31,6 +31,8 @@ static std::ostream& operator<<(std::ostream& out, const Arp::ArpCacheEntry& e)
 {
     if (e.pending)
         out << "pending (" << e.numRetries << " retries)";
+    else if (e.negative)
+        out << "failed  age:" << floor(simTime() - e.lastUpdate) << "s";
     else
         out << "MAC:" << e.macAddress << "  age:" << floor(simTime() - e.lastUpdate) << "s";
     return out;
@@ -50,10 +52,13 @@ void Arp::initialize(int stage)
         retryTimeout = par("retryTimeout");
         retryCount = par("retryCount");
         cacheTimeout = par("cacheTimeout");
+        negativeCacheTimeout = par("negativeCacheTimeout");
         proxyArpInterfaces = par("proxyArpInterfaces").stdstringValue();
 
         proxyArpInterfacesMatcher.setPattern(proxyArpInterfaces.c_str(), false, true, false);
 
+        pendingQueueTimer = new cMessage("ARP timeout");
+
         // init statistics
         numRequestsSent = numRepliesSent = 0;
         numResolutions = numFailedResolutions = 0;
@@ -80,12 +85,14 @@ Arp::~Arp()
 {
     for (auto& elem : arpCache)
         delete elem.second;
+    cancelAndDelete(pendingQueueTimer);
 }
 
 void Arp::handleMessageWhenUp(cMessage *msg)
 {
     if (msg->isSelfMessage()) {
-        requestTimedOut(msg);
+        ASSERT(msg == pendingQueueTimer);
+        processPendingQueue();
     }
     else {
         Packet *packet = check_and_cast<Packet *>(msg);
@@ -110,14 +117,11 @@ void Arp::handleCrashOperation(LifecycleOperation *operation)
 
 void Arp::flush()
 {
-    while (!arpCache.empty()) {
-        auto i = arpCache.begin();
-        ArpCacheEntry *entry = i->second;
-        cancelAndDelete(entry->timer);
-        entry->timer = nullptr;
-        delete entry;
-        arpCache.erase(i);
-    }
+    for (auto& elem : arpCache)
+        delete elem.second;
+    arpCache.clear();
+    pendingQueue.clear();
+    cancelEvent(pendingQueueTimer);
 }
 
 void Arp::refreshDisplay() const
@@ -135,17 +139,20 @@ void Arp::refreshDisplay() const
 void Arp::initiateArpResolution(Ipv4Address nextHopAddr, ArpCacheEntry *entry)
 {
     entry->pending = true;
+    entry->negative = false;
     entry->numRetries = 0;
     entry->lastUpdate = SIMTIME_ZERO;
     entry->macAddress = MacAddress::UNSPECIFIED_ADDRESS;
     entry->ipv4Address = nextHopAddr;
     sendArpRequest(entry->ie, nextHopAddr);
 
-    // start timer
-    ASSERT(entry->timer == nullptr);
-    entry->timer = new cMessage("ARP timeout");
-    entry->timer->setContextPointer(entry);
-    scheduleAfter(retryTimeout, entry->timer);
+    // append to the shared pending queue and make sure the timer serves the
+    // front of the queue
+    entry->dueTime = simTime() + retryTimeout;
+    pendingQueue.push_back(entry);
+    entry->pendingQueuePos = --pendingQueue.end();
+    if (!pendingQueueTimer->isScheduled())
+        scheduleAt(entry->dueTime, pendingQueueTimer);
 
     numResolutions++;
     Notification signal(nextHopAddr, MacAddress::UNSPECIFIED_ADDRESS, entry->ie);
@@ -188,28 +195,47 @@ void Arp::sendArpRequest(const NetworkInterface *ie, Ipv4Address ipAddress)
     numRequestsSent++;
 }
 
-void Arp::requestTimedOut(cMessage *selfmsg)
+void Arp::processPendingQueue()
+{
+    while (!pendingQueue.empty() && pendingQueue.front()->dueTime <= simTime()) {
+        ArpCacheEntry *entry = pendingQueue.front();
+        pendingQueue.pop_front();
+        requestTimedOut(entry);
+    }
+    if (!pendingQueue.empty())
+        scheduleAt(pendingQueue.front()->dueTime, pendingQueueTimer);
+}
+
+void Arp::requestTimedOut(ArpCacheEntry *entry)
 {
-    ArpCacheEntry *entry = (ArpCacheEntry *)selfmsg->getContextPointer();
     entry->numRetries++;
     if (entry->numRetries < retryCount) {
         // retry
         Ipv4Address nextHopAddr = entry->ipv4Address;
         EV_INFO << "ARP request for " << nextHopAddr << " timed out, resending\n";
         sendArpRequest(entry->ie, nextHopAddr);
-        scheduleAfter(retryTimeout, selfmsg);
+        entry->dueTime = simTime() + retryTimeout;
+        pendingQueue.push_back(entry);
+        entry->pendingQueuePos = --pendingQueue.end();
         return;
     }
 
-    delete selfmsg;
-
     // max retry count reached: ARP failure.
-    // throw out entry from cache
     EV << "ARP timeout, max retry count " << retryCount << " for " << entry->ipv4Address << " reached.\n";
     Notification signal(entry->ipv4Address, MacAddress::UNSPECIFIED_ADDRESS, entry->ie);
     emit(arpResolutionFailedSignal, &signal);
-    arpCache.erase(entry->ipv4Address);
-    delete entry;
+    if (negativeCacheTimeout > SIMTIME_ZERO) {
+        // keep the entry as a cached negative result so that subsequent
+        // resolution attempts don't restart the full retry cycle immediately
+        entry->pending = false;
+        entry->negative = true;
+        entry->lastUpdate = simTime();
+    }
+    else {
+        // throw out entry from cache
+        arpCache.erase(entry->ipv4Address);
+        delete entry;
+    }
     numFailedResolutions++;
 }
 
@@ -309,7 +335,6 @@ void Arp::processArpPacket(Packet *packet)
                 entry->ie = ie;
 
                 entry->pending = false;
-                entry->timer = nullptr;
                 entry->numRetries = 0;
             }
             updateArpCache(entry, srcMacAddress);
@@ -389,16 +414,36 @@ void Arp::updateArpCache(ArpCacheEntry *entry, const MacAddress& macAddress)
     // update entry
     if (entry->pending) {
         entry->pending = false;
-        cancelAndDelete(entry->timer);
-        entry->timer = nullptr;
+        pendingQueue.erase(entry->pendingQueuePos);
         entry->numRetries = 0;
     }
+    entry->negative = false;
     entry->macAddress = macAddress;
     entry->lastUpdate = simTime();
     Notification signal(entry->ipv4Address, macAddress, entry->ie);
     emit(arpResolutionCompletedSignal, &signal);
 }
 
+void Arp::setArpCacheEntry(Ipv4Address ipv4Address, const MacAddress& macAddress, const NetworkInterface *ie)
+{
+    Enter_Method("setArpCacheEntry(%s)", ipv4Address.str().c_str());
+
+    auto it = arpCache.find(ipv4Address);
+    ArpCacheEntry *entry;
+    if (it != arpCache.end())
+        entry = it->second;
+    else {
+        entry = new ArpCacheEntry();
+        entry->owner = this;
+        arpCache.insert(std::make_pair(ipv4Address, entry));
+        entry->ipv4Address = ipv4Address;
+        entry->pending = false;
+        entry->numRetries = 0;
+    }
+    entry->ie = ie;
+    updateArpCache(entry, macAddress);
+}
+
 MacAddress Arp::resolveL3Address(const L3Address& address, const NetworkInterface *ie)
 {
     Enter_Method("resolveMACAddress(%s,%s)", address.str().c_str(), ie->getInterfaceName());
@@ -422,6 +467,18 @@ MacAddress Arp::resolveL3Address(const L3Address& address, const NetworkInterfac
         EV << "ARP resolution for " << addr << " is already pending\n";
         return MacAddress::UNSPECIFIED_ADDRESS;
     }
+    else if (it->second->negative) {
+        if (it->second->lastUpdate + negativeCacheTimeout >= simTime()) {
+            // the last resolution failed recently, don't restart the retry cycle yet
+            EV << "ARP resolution for " << addr << " failed recently, suppressing new ARP resolution\n";
+            return MacAddress::UNSPECIFIED_ADDRESS;
+        }
+        EV << "Negative ARP cache entry for " << addr << " expired, starting new ARP resolution\n";
+        ArpCacheEntry *entry = it->second;
+        entry->ie = ie; // routing table may have changed
+        initiateArpResolution(addr, entry);
+        return MacAddress::UNSPECIFIED_ADDRESS;
+    }
     else if (it->second->lastUpdate + cacheTimeout >= simTime()) {
         return it->second->macAddress;
     }
@@ -484,7 +541,6 @@ void Arp::sendArpGratuitous(const NetworkInterface *ie, MacAddress srcAddr, Ipv4
     entry->ie = ie;
 
     entry->pending = false;
-    entry->timer = nullptr;
     entry->numRetries = 0;
 
     entry->lastUpdate = simTime();
@@ -9,6 +9,7 @@
 #ifndef __INET_ARP_H
 #define __INET_ARP_H
 
+#include <list>
 #include <map>
 #include <vector>
 
@@ -47,10 +48,12 @@ class INET_API Arp : public OperationalBase, public IArp
         Arp *owner = nullptr; // owner ARP module of this cache entry
         const NetworkInterface *ie = nullptr; // NIC to send the packet to
         bool pending = false; // true if resolution is pending
+        bool negative = false; // true if the last resolution failed and the failure is cached
         MacAddress macAddress; // MAC address
         simtime_t lastUpdate; // entries should time out after cacheTimeout
         int numRetries = 0; // if pending==true: 0 after first ARP request, 1 after second, etc.
-        cMessage *timer = nullptr; // if pending==true: request timeout msg
+        simtime_t dueTime; // if pending==true: when the current ARP request times out
+        std::list<ArpCacheEntry *>::iterator pendingQueuePos; // if pending==true: position in the shared pending queue
         Ipv4Address ipv4Address;
     };
 
@@ -58,6 +61,7 @@ class INET_API Arp : public OperationalBase, public IArp
     simtime_t retryTimeout;
     int retryCount = 0;
     simtime_t cacheTimeout;
+    simtime_t negativeCacheTimeout;
     std::string proxyArpInterfaces = "";
     long numResolutions = 0;
     long numFailedResolutions = 0;
@@ -71,6 +75,12 @@ class INET_API Arp : public OperationalBase, public IArp
 
     ArpCache arpCache;
 
+    // pending entries ordered by due time (retryTimeout is the same for all
+    // entries, so FIFO order is due time order); a single shared timer serves
+    // the whole queue instead of one timeout message per pending entry
+    std::list<ArpCacheEntry *> pendingQueue;
+    cMessage *pendingQueueTimer = nullptr;
+
     ModuleRefByPar<IInterfaceTable> ift;
     ModuleRefByPar<IIpv4RoutingTable> rt; // for answering ProxyARP requests
 
@@ -91,6 +101,19 @@ class INET_API Arp : public OperationalBase, public IArp
     void sendArpGratuitous(const NetworkInterface *ie, MacAddress srcAddr, Ipv4Address ipAddr, ArpOpcode opCode = ARP_REQUEST);
     void sendArpProbe(const NetworkInterface *ie, MacAddress srcAddr, Ipv4Address probedAddr);
 
+    /**
+     * Returns the address resolution cache; used by NetworkStateSnapshotManager
+     * to save warm protocol state.
+     */
+    const ArpCache& getArpCache() const { return arpCache; }
+
+    /**
+     * Adds or updates a completed (non-pending) cache entry without any
+     * protocol exchange; used by NetworkStateSnapshotManager to restore warm
+     * protocol state.
+     */
+    virtual void setArpCacheEntry(Ipv4Address ipv4Address, const MacAddress& macAddress, const NetworkInterface *ie);
+
   protected:
     virtual void initialize(int stage) override;
     virtual void handleMessageWhenUp(cMessage *msg) override;
@@ -107,7 +130,8 @@ class INET_API Arp : public OperationalBase, public IArp
 
     virtual void initiateArpResolution(Ipv4Address ipv4Address, ArpCacheEntry *entry);
     virtual void sendArpRequest(const NetworkInterface *ie, Ipv4Address ipAddress);
-    virtual void requestTimedOut(cMessage *selfmsg);
+    virtual void processPendingQueue();
+    virtual void requestTimedOut(ArpCacheEntry *entry);
     virtual bool addressRecognized(Ipv4Address destAddr, NetworkInterface *ie);
     virtual void processArpPacket(Packet *packet);
     virtual void updateArpCache(ArpCacheEntry *entry, const MacAddress& macAddress);
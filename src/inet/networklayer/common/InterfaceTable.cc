@@ -372,9 +372,23 @@ void InterfaceTable::invalidateTmpInterfaceList()
 void InterfaceTable::interfaceChanged(simsignal_t signalID, const NetworkInterfaceChangeDetails *details)
 {
     Enter_Method("interfaceChanged");
+    for (auto& entry : interfaceChangeListeners)
+        if (entry.fieldMask & getFieldMask(details->getFieldId()))
+            entry.listener->interfaceChanged(signalID, details);
     emit(signalID, const_cast<NetworkInterfaceChangeDetails *>(details));
 }
 
+void InterfaceTable::addInterfaceChangeListener(IInterfaceChangeListener *listener, uint64_t fieldMask)
+{
+    interfaceChangeListeners.push_back({ listener, fieldMask });
+}
+
+void InterfaceTable::removeInterfaceChangeListener(IInterfaceChangeListener *listener)
+{
+    interfaceChangeListeners.erase(std::remove_if(interfaceChangeListeners.begin(), interfaceChangeListeners.end(),
+            [&] (const InterfaceChangeListenerEntry& entry) { return entry.listener == listener; }), interfaceChangeListeners.end());
+}
+
 void InterfaceTable::updateLinkDisplayString(NetworkInterface *entry) const
 {
     int outputGateId = entry->getNodeOutputGateId();
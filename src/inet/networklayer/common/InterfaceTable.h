@@ -17,6 +17,20 @@
 
 namespace inet {
 
+/**
+ * Interface for clients that want pre-filtered interface change notifications
+ * from an InterfaceTable. Unlike subscribing to interfaceStateChangedSignal or
+ * interfaceConfigChangedSignal on the host module, a listener registered with
+ * a field mask is only called for changes of the fields it asked for, so
+ * frequent changes of uninteresting fields don't wake it up at all.
+ */
+class INET_API IInterfaceChangeListener
+{
+  public:
+    virtual ~IInterfaceChangeListener() {}
+    virtual void interfaceChanged(simsignal_t signalID, const NetworkInterfaceChangeDetails *details) = 0;
+};
+
 /**
  * Represents the interface table. This object has one instance per host
  * or router. It has methods to manage the interface table,
@@ -50,7 +64,9 @@ namespace inet {
  * the following signals on host module: interfaceCreatedSignal,
  * interfaceDeletedSignal, interfaceStateChangedSignal, interfaceConfigChangedSignal.
  * State change gets fired for up/down events; all other changes fire as
- * config change.
+ * config change. Clients interested in changes of specific fields only can
+ * register an IInterfaceChangeListener with a field mask instead (see
+ * addInterfaceChangeListener()) to receive pre-filtered notifications.
  *
  * @see NetworkInterface
  */
@@ -69,6 +85,14 @@ class INET_API InterfaceTable : public OperationalBase, public IInterfaceTable,
     mutable int tmpNumInterfaces; // caches number of non-nullptr elements of idToInterface; -1 if invalid
     mutable NetworkInterface **tmpInterfaceList; // caches non-nullptr elements of idToInterface; nullptr if invalid
 
+    // listeners registered for pre-filtered change notifications, each with the
+    // bitmask of the NetworkInterface::F_... fields it is interested in
+    struct InterfaceChangeListenerEntry {
+        IInterfaceChangeListener *listener;
+        uint64_t fieldMask;
+    };
+    std::vector<InterfaceChangeListenerEntry> interfaceChangeListeners;
+
   protected:
     // displays summary above the icon
     virtual void refreshDisplay() const override;
@@ -234,6 +258,26 @@ class INET_API InterfaceTable : public OperationalBase, public IInterfaceTable,
      * Returns all multicast group address, with it's interfaceId
      */
     virtual MulticastGroupList collectMulticastGroups() const override;
+
+    /**
+     * Returns the field mask bit for a NetworkInterface::F_... field id,
+     * for use with addInterfaceChangeListener(). Bits can be combined
+     * with bitwise or to subscribe to several fields.
+     */
+    static uint64_t getFieldMask(int fieldId) { return uint64_t(1) << fieldId; }
+
+    /**
+     * Registers a listener to be notified about interface changes of the
+     * fields included in the field mask only. Changes of other fields are
+     * filtered out here, before delivery, in contrast to signal listeners
+     * that receive all state/config changes and must filter themselves.
+     */
+    virtual void addInterfaceChangeListener(IInterfaceChangeListener *listener, uint64_t fieldMask);
+
+    /**
+     * Removes a previously registered interface change listener.
+     */
+    virtual void removeInterfaceChangeListener(IInterfaceChangeListener *listener);
 };
 
 } // namespace inet
@@ -265,74 +265,6 @@ bool L3Address::isLinkLocal() const
     }
 }
 
-bool L3Address::operator<(const L3Address& other) const
-{
-    AddressType type = getType();
-    AddressType otherType = other.getType();
-    if (type != otherType)
-        return type < otherType;
-    else {
-        switch (type) {
-            case L3Address::NONE:
-                throw cRuntimeError("Address contains no value");
-
-            case L3Address::IPv4:
-                return toIpv4() < other.toIpv4();
-
-            case L3Address::IPv6:
-                return toIpv6() < other.toIpv6();
-
-            case L3Address::MAC:
-                return toMac() < other.toMac();
-
-            case L3Address::MODULEID:
-                return toModuleId() < other.toModuleId();
-
-            case L3Address::MODULEPATH:
-                return toModulePath() < other.toModulePath();
-
-            default:
-                throw cRuntimeError("Unknown type");
-        }
-    }
-}
-
-bool L3Address::operator==(const L3Address& other) const
-{
-    AddressType type = getType();
-    if (type != other.getType())
-        return false;
-    else {
-        switch (type) {
-            case L3Address::NONE:
-                return true;
-
-            case L3Address::IPv4:
-                return toIpv4() == other.toIpv4();
-
-            case L3Address::IPv6:
-                return toIpv6() == other.toIpv6();
-
-            case L3Address::MAC:
-                return toMac() == other.toMac();
-
-            case L3Address::MODULEID:
-                return toModuleId() == other.toModuleId();
-
-            case L3Address::MODULEPATH:
-                return toModulePath() == other.toModulePath();
-
-            default:
-                throw cRuntimeError("Unknown type");
-        }
-    }
-}
-
-bool L3Address::operator!=(const L3Address& other) const
-{
-    return !operator==(other);
-}
-
 bool L3Address::matches(const L3Address& other, int prefixLength) const
 {
     switch (getType()) {
@@ -93,10 +93,14 @@ class INET_API L3Address
 
     L3Address& operator=(const L3Address& other) { hi = other.hi; lo = other.lo; return *this; }
 
-    bool operator<(const L3Address& other) const;
+    // the (hi, lo) representation is canonical: the type and the value fully
+    // determine the stored bits, so addresses can be compared as raw 128 bit
+    // integers without dispatching on the address type; these comparisons key
+    // many hot tables (ARP, sockets, routing protocols) across the framework
+    bool operator<(const L3Address& other) const { return hi != other.hi ? hi < other.hi : lo < other.lo; }
     bool operator>(const L3Address& other) const { return other < *this; };
-    bool operator==(const L3Address& other) const;
-    bool operator!=(const L3Address& other) const;
+    bool operator==(const L3Address& other) const { return hi == other.hi && lo == other.lo; }
+    bool operator!=(const L3Address& other) const { return hi != other.hi || lo != other.lo; }
 
     bool matches(const L3Address& other, int prefixLength) const;
 
@@ -8,6 +8,7 @@
 
 #include "inet/networklayer/common/L3AddressResolver.h"
 
+#include "inet/common/Simsignals.h"
 #include "inet/networklayer/common/ModuleIdAddress.h"
 #include "inet/networklayer/common/ModulePathAddress.h"
 #include "inet/networklayer/contract/IInterfaceTable.h"
@@ -30,6 +31,36 @@
 
 namespace inet {
 
+L3AddressResolver::Cache& L3AddressResolver::Cache::getInstance()
+{
+    static int handle = cSimulationOrSharedDataManager::registerSharedVariableName("inet::L3AddressResolver::cache");
+    auto& cache = getSimulationOrSharedDataManager()->getSharedVariable<Cache>(handle);
+    if (!cache.subscribed) {
+        cModule *systemModule = cSimulation::getActiveSimulation()->getSystemModule();
+        if (systemModule != nullptr) {
+            // any change of the module tree or of an interface address invalidates cached results
+            systemModule->subscribe(POST_MODEL_CHANGE, &cache);
+            systemModule->subscribe(interfaceConfigChangedSignal, &cache);
+            systemModule->subscribe(interfaceIpv4ConfigChangedSignal, &cache);
+            systemModule->subscribe(interfaceIpv6ConfigChangedSignal, &cache);
+            cache.subscribed = true;
+        }
+    }
+    return cache;
+}
+
+void L3AddressResolver::Cache::receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj, cObject *details)
+{
+    invalidate();
+}
+
+void L3AddressResolver::Cache::invalidate()
+{
+    resolvedAddresses.clear();
+    networkNodes.clear();
+    networkNodesValid = false;
+}
+
 L3Address L3AddressResolver::resolve(const char *s, int addrType)
 {
     L3Address addr;
@@ -80,6 +111,15 @@ bool L3AddressResolver::tryResolve(const char *s, L3Address& result, int addrTyp
     if (tryParse(result, s, addrType))
         return true;
 
+    // check the network-wide resolution cache
+    auto& cache = Cache::getInstance();
+    std::string cacheKey = std::string(s) + "|" + std::to_string(addrType);
+    auto cacheIt = cache.resolvedAddresses.find(cacheKey);
+    if (cacheIt != cache.resolvedAddresses.end()) {
+        result = cacheIt->second;
+        return true;
+    }
+
     // must be " modulename [ { '%' interfacename | '>' destnode } ] [ '(' protocol ')' ] [ '/' ] " syntax
     // interfacename: existing_interface_of_module | 'routerId'
     // protocol: 'ipv4' | 'ipv6' | 'mac' | 'modulepath' | 'moduleid'
@@ -183,7 +223,10 @@ bool L3AddressResolver::tryResolve(const char *s, L3Address& result, int addrTyp
         result = routerIdOf(mod); // addrType is meaningless here, routerId is protocol independent
     else
         result = addressOf(mod, ifname.c_str(), addrType);
-    return !result.isUnspecified();
+    if (result.isUnspecified())
+        return false; // not cached: the address may be assigned in a later init stage
+    cache.resolvedAddresses[cacheKey] = result;
+    return true;
 }
 
 L3Address L3AddressResolver::routerIdOf(cModule *host)
@@ -517,9 +560,13 @@ NextHopRoutingTable *L3AddressResolver::findNextHopRoutingTableOf(cModule *host)
 
 std::vector<cModule *> L3AddressResolver::collectNetworkNodes()
 {
-    std::vector<cModule *> result;
-    doCollectNetworkNodes(cSimulation::getActiveSimulation()->getSystemModule(), result);
-    return result;
+    auto& cache = Cache::getInstance();
+    if (!cache.networkNodesValid) {
+        cache.networkNodes.clear();
+        doCollectNetworkNodes(cSimulation::getActiveSimulation()->getSystemModule(), cache.networkNodes);
+        cache.networkNodesValid = true;
+    }
+    return cache.networkNodes;
 }
 
 void L3AddressResolver::doCollectNetworkNodes(cModule *parent, std::vector<cModule *>& result)
@@ -8,6 +8,7 @@
 #ifndef __INET_L3ADDRESSRESOLVER_H
 #define __INET_L3ADDRESSRESOLVER_H
 
+#include <map>
 #include <vector>
 
 #include "inet/networklayer/common/L3Address.h"
@@ -41,6 +42,32 @@ class NextHopRoutingTable;
  */
 class INET_API L3AddressResolver
 {
+  protected:
+    /**
+     * Network-wide resolution cache shared by all resolver instances, stored as
+     * a simulation-global variable so it is deallocated on network teardown.
+     * Successful resolutions are remembered keyed on the address spec string,
+     * and the collected network node list is reused across reverse lookups.
+     * The cache subscribes to model change and interface configuration change
+     * notifications at the network level and discards its contents whenever
+     * the module tree or an interface address changes, so cached results never
+     * go stale.
+     */
+    class INET_API Cache : public cListener
+    {
+      public:
+        std::map<std::string, L3Address> resolvedAddresses; // maps address spec and address type to resolved address
+        std::vector<cModule *> networkNodes; // result of collectNetworkNodes()
+        bool networkNodesValid = false;
+        bool subscribed = false;
+
+      public:
+        virtual void receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj, cObject *details) override;
+        void invalidate();
+
+        static Cache& getInstance();
+    };
+
   protected:
     // internal
     virtual bool getIpv4AddressFrom(L3Address& retAddr, IInterfaceTable *ift, bool netmask);
@@ -8,6 +8,7 @@
 #include "inet/networklayer/configurator/ipv4/Ipv4NetworkConfigurator.h"
 
 #include <set>
+#include <tuple>
 
 #include "inet/common/INETUtils.h"
 #include "inet/common/ModuleAccess.h"
@@ -1384,6 +1385,21 @@ void Ipv4NetworkConfigurator::addStaticRoutes(Topology& topology, cXMLElement *a
         destinationInterfaces = "**";
     Matcher sourceHostsMatcher(sourceHosts);
     Matcher destinationInterfacesMatcher(destinationInterfaces);
+    // the destination interface matcher is loop invariant, so match each interface
+    // once up front instead of once per source/destination node pair
+    std::set<InterfaceInfo *> matchedDestinationInterfaceInfos;
+    if (!destinationInterfacesMatcher.matchesAny()) {
+        for (int i = 0; i < topology.getNumNodes(); i++) {
+            Node *node = (Node *)topology.getNode(i);
+            for (auto& interfaceInfo : node->interfaceInfos) {
+                std::string destinationFullPath = interfaceInfo->networkInterface->getInterfaceFullPath();
+                std::string destinationShortenedFullPath = destinationFullPath.substr(destinationFullPath.find('.') + 1);
+                if (destinationInterfacesMatcher.matches(destinationFullPath.c_str()) ||
+                    destinationInterfacesMatcher.matches(destinationShortenedFullPath.c_str()))
+                    matchedDestinationInterfaceInfos.insert(static_cast<InterfaceInfo *>(interfaceInfo));
+            }
+        }
+    }
     for (int i = 0; i < topology.getNumNodes(); i++) {
         Node *sourceNode = (Node *)topology.getNode(i);
         std::string hostFullPath = sourceNode->module->getFullPath();
@@ -1429,6 +1445,14 @@ void Ipv4NetworkConfigurator::addStaticRoutes(Topology& topology, cXMLElement *a
             EV_DEBUG << "Adding default routes to " << sourceNode->getModule()->getFullPath() << ", node has only one (non-loopback) interface" << endl;
         }
         else {
+            // detect duplicate routes from a set of route keys instead of a linear
+            // scan of the routing table for every candidate route
+            auto makeRouteKey = [] (Ipv4Route *route) {
+                return std::make_tuple(route->getDestination(), route->getNetmask(), route->getGateway(), route->getInterface(), route->getSourceType(), route->getMetric());
+            };
+            std::set<std::tuple<Ipv4Address, Ipv4Address, Ipv4Address, NetworkInterface *, IRoute::SourceType, int>> routeKeys;
+            for (auto route : sourceNode->staticRoutes)
+                routeKeys.insert(makeRouteKey(route));
             // add a route to all destinations in the network
             for (int j = 0; j < topology.getNumNodes(); j++) {
                 // extract destination
@@ -1460,11 +1484,7 @@ void Ipv4NetworkConfigurator::addStaticRoutes(Topology& topology, cXMLElement *a
                     // add the same routes for all destination interfaces (IP packets are accepted from any interface at the destination)
                     for (size_t j = 0; j < destinationNode->interfaceInfos.size(); j++) {
                         InterfaceInfo *destinationInterfaceInfo = static_cast<InterfaceInfo *>(destinationNode->interfaceInfos[j]);
-                        std::string destinationFullPath = destinationInterfaceInfo->networkInterface->getInterfaceFullPath();
-                        std::string destinationShortenedFullPath = destinationFullPath.substr(destinationFullPath.find('.') + 1);
-                        if (!destinationInterfacesMatcher.matchesAny() &&
-                            !destinationInterfacesMatcher.matches(destinationFullPath.c_str()) &&
-                            !destinationInterfacesMatcher.matches(destinationShortenedFullPath.c_str()))
+                        if (!destinationInterfacesMatcher.matchesAny() && !contains(matchedDestinationInterfaceInfos, destinationInterfaceInfo))
                             continue;
                         NetworkInterface *destinationNetworkInterface = destinationInterfaceInfo->networkInterface;
                         Ipv4Address destinationAddress = destinationInterfaceInfo->getAddress();
@@ -1487,11 +1507,12 @@ void Ipv4NetworkConfigurator::addStaticRoutes(Topology& topology, cXMLElement *a
                             if (gatewayAddress != destinationAddress)
                                 route->setGateway(gatewayAddress);
                             route->setSourceType(Ipv4Route::MANUAL);
-                            if (containsRoute(sourceNode->staticRoutes, route))
+                            if (contains(routeKeys, makeRouteKey(route)))
                                 delete route;
                             else if (!addDirectRoutesParameter && route->getGateway().isUnspecified())
                                 delete route;
                             else {
+                                routeKeys.insert(makeRouteKey(route));
                                 sourceNode->staticRoutes.push_back(route);
                                 EV_DEBUG << "Adding route " << sourceNetworkInterface->getInterfaceFullPath() << " -> " << destinationNetworkInterface->getInterfaceFullPath() << " as " << route->str() << endl;
                             }
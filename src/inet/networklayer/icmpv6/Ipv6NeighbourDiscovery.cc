@@ -13,6 +13,7 @@
 #include "inet/linklayer/common/InterfaceTag_m.h"
 #include "inet/networklayer/common/HopLimitTag_m.h"
 #include "inet/networklayer/common/L3AddressTag_m.h"
+#include "inet/networklayer/common/L3Tools.h"
 #include "inet/networklayer/contract/IInterfaceTable.h"
 #include "inet/networklayer/icmpv6/Icmpv6.h"
 #include "inet/networklayer/ipv6/Ipv6Header.h"
@@ -214,7 +215,10 @@ void Ipv6NeighbourDiscovery::finish()
 
 void Ipv6NeighbourDiscovery::processIpv6Datagram(Packet *packet)
 {
-    const auto& msg = packet->peekAtFront<Ipv6Header>();
+    // use the header parsed at ingress and recorded in the NetworkProtocolInd tag when present
+    auto msg = dynamicPtrCast<const Ipv6Header>(findNetworkProtocolHeader(packet));
+    if (msg == nullptr)
+        msg = packet->peekAtFront<Ipv6Header>();
     EV_INFO << "Packet " << packet << " arrived from Ipv6 module.\n";
 
     Ipv6NdControlInfo *ctrl = check_and_cast<Ipv6NdControlInfo *>(packet->getControlInfo());
@@ -53,6 +53,8 @@ void Icmp::initialize(int stage)
         rt.reference(this, "routingTableModule", true);
         crcMode = parseCrcMode(par("crcMode"), false);
         parseQuoteLengthParameter();
+        errorRateLimit = par("errorRateLimit");
+        errorRateLimitBurst = par("errorRateLimitBurst");
     }
     if (stage == INITSTAGE_NETWORK_LAYER_PROTOCOLS) {
         registerService(Protocol::icmpv4, gate("transportIn"), gate("transportOut"));
@@ -110,6 +112,28 @@ bool Icmp::maySendErrorMessage(Packet *packet, int inputInterfaceId)
         }
     }
 
+    // rate limit error messages per destination, i.e. per offending source,
+    // before any of the error message gets assembled
+    if (errorRateLimit > 0 && !checkErrorRateLimit(origSrcAddr)) {
+        EV_DETAIL << "won't send ICMP error message, rate limit towards " << origSrcAddr << " exceeded" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool Icmp::checkErrorRateLimit(const Ipv4Address& destination)
+{
+    auto it = rateLimitBuckets.find(destination);
+    if (it == rateLimitBuckets.end())
+        it = rateLimitBuckets.insert({ destination, RateLimitBucket{ (double)errorRateLimitBurst, simTime() } }).first;
+    RateLimitBucket& bucket = it->second;
+    simtime_t now = simTime();
+    bucket.tokens = std::min((double)errorRateLimitBurst, bucket.tokens + errorRateLimit * (now - bucket.lastUpdate).dbl());
+    bucket.lastUpdate = now;
+    if (bucket.tokens < 1)
+        return false;
+    bucket.tokens -= 1;
     return true;
 }
 
@@ -30,6 +30,16 @@ class INET_API Icmp : public cSimpleModule, public DefaultProtocolRegistrationLi
     std::set<int> transportProtocols; // where to send up packets
     CrcMode crcMode = CRC_MODE_UNDEFINED;
     B quoteLength;
+    double errorRateLimit = 0; // max ICMP error messages per second towards one destination; 0 means no limit
+    int errorRateLimitBurst = 0;
+
+    struct RateLimitBucket {
+        double tokens = 0;
+        simtime_t lastUpdate;
+    };
+    // per-destination token buckets, keyed by the source of the offending
+    // datagram; only used when errorRateLimit is enabled
+    std::map<Ipv4Address, RateLimitBucket> rateLimitBuckets;
     ModuleRefByPar<IIpv4RoutingTable> rt;
     ModuleRefByPar<IInterfaceTable> ift;
     uint64_t& ctr = SIMULATION_SHARED_COUNTER(ctr);
@@ -64,6 +74,7 @@ class INET_API Icmp : public cSimpleModule, public DefaultProtocolRegistrationLi
     virtual void handleParameterChange(const char *name) override;
     virtual void parseQuoteLengthParameter();
     virtual bool maySendErrorMessage(Packet *packet, int inputInterfaceId);
+    virtual bool checkErrorRateLimit(const Ipv4Address& destination);
     virtual void sendOrProcessIcmpPacket(Packet *packet, Ipv4Address origSrcAddr);
 };
 
@@ -356,10 +356,13 @@ void Igmpv3::processRouterGroupTimer(cMessage *msg)
 
     if (groupData->filter == IGMPV3_FM_EXCLUDE) {
         bool timerRunning = false;
-        for (auto it = groupData->sources.begin(); it != groupData->sources.end(); ++it) {
-            if (!it->second->sourceTimer->isScheduled()) {
-                EV_DETAIL << "Deleting source record of '" << it->first << "'.\n";
-                groupData->deleteSourceRecord(it->first);
+        for (auto it = groupData->sources.begin(); it != groupData->sources.end();) {
+            auto source = it->first;
+            bool scheduled = it->second->sourceTimer->isScheduled();
+            ++it; // advance before a potential deleteSourceRecord() call invalidates the iterator
+            if (!scheduled) {
+                EV_DETAIL << "Deleting source record of '" << source << "'.\n";
+                groupData->deleteSourceRecord(source);
             }
             else {
                 timerRunning = true;
@@ -685,10 +688,12 @@ void Igmpv3::processReport(Packet *packet)
 
                 // INCLUDE(A)   -> IS_EX(B) -> EXCLUDE(A*B,B-A): Delete (A-B)
                 // EXCLUDE(X,Y) -> IS_EX(A) -> EXCLUDE(A-Y,Y*A): Delete (X-A) Delete (Y-A)
-                for (auto it = groupData->sources.begin(); it != groupData->sources.end(); ++it) {
-                    if (!contains(receivedSources, it->first)) {
-                        EV_DETAIL << "Deleting source record of '" << it->first << "'.\n";
-                        groupData->deleteSourceRecord(it->first);
+                for (auto it = groupData->sources.begin(); it != groupData->sources.end();) {
+                    auto source = it->first;
+                    ++it; // advance before a potential deleteSourceRecord() call invalidates the iterator
+                    if (!binary_search(receivedSources.begin(), receivedSources.end(), source)) {
+                        EV_DETAIL << "Deleting source record of '" << source << "'.\n";
+                        groupData->deleteSourceRecord(source);
                     }
                 }
 
@@ -835,7 +840,7 @@ void Igmpv3::processReport(Packet *packet)
 
                     // Delete A-B
                     for (auto& elem : sourcesA) {
-                        if (!contains(receivedSources, elem)) {
+                        if (!binary_search(receivedSources.begin(), receivedSources.end(), elem)) {
                             EV_DETAIL << "Deleting source record of '" << elem << "'.\n";
                             groupData->deleteSourceRecord(elem);
                         }
@@ -865,7 +870,7 @@ void Igmpv3::processReport(Packet *packet)
                     for (auto it = groupData->sources.begin(); it != groupData->sources.end();) {
                         auto rec = it->first;
                         ++it; // let's advance the iterator now because the deleteSourcerecord call will invalidate it and we wont be able to increment it after that
-                        if (!contains(receivedSources, it->first)) {
+                        if (!binary_search(receivedSources.begin(), receivedSources.end(), rec)) {
                             EV_DETAIL << "Deleting source record of '" << rec << "'.\n";
                             groupData->deleteSourceRecord(rec);
                         }
@@ -80,6 +80,7 @@ void Ipv4::initialize(int stage)
         fragmentTimeoutTime = par("fragmentTimeout");
         limitedBroadcast = par("limitedBroadcast");
         directBroadcastInterfaces = par("directBroadcastInterfaces").stdstringValue();
+        flowCacheSize = par("flowCacheSize");
 
         directBroadcastInterfaceMatcher.setPattern(directBroadcastInterfaces.c_str(), false, true, false);
 
@@ -107,6 +108,13 @@ void Ipv4::initialize(int stage)
         arpModule->subscribe(IArp::arpResolutionCompletedSignal, this);
         arpModule->subscribe(IArp::arpResolutionFailedSignal, this);
 
+        if (flowCacheSize > 0) {
+            cModule *rtModule = check_and_cast<cModule *>(rt.get());
+            rtModule->subscribe(routeAddedSignal, this);
+            rtModule->subscribe(routeChangedSignal, this);
+            rtModule->subscribe(routeDeletedSignal, this);
+        }
+
         registerService(Protocol::ipv4, gate("transportIn"), gate("transportOut"));
         registerProtocol(Protocol::ipv4, gate("queueOut"), gate("queueIn"));
     }
@@ -509,6 +517,31 @@ const NetworkInterface *Ipv4::determineOutgoingInterfaceForMulticastDatagram(con
     return ie;
 }
 
+const Ipv4Route *Ipv4::findRouteCached(const Ipv4Address& destAddr)
+{
+    if (flowCacheSize > 0) {
+        for (auto it = flowCache.begin(); it != flowCache.end(); ++it) {
+            if (it->first == destAddr) {
+                if (it->second != nullptr && !it->second->isValid()) {
+                    flowCache.erase(it);
+                    break;
+                }
+                if (it != flowCache.begin())
+                    flowCache.splice(flowCache.begin(), flowCache, it);
+                return it->second;
+            }
+        }
+    }
+    const Ipv4Route *route = rt->findBestMatchingRoute(destAddr);
+    if (flowCacheSize > 0) {
+        // unroutable destinations are cached as nullptr, a later route addition invalidates the cache
+        if ((int)flowCache.size() >= flowCacheSize)
+            flowCache.pop_back();
+        flowCache.emplace_front(destAddr, route);
+    }
+    return route;
+}
+
 void Ipv4::routeUnicastPacket(Packet *packet)
 {
     const NetworkInterface *fromIE = getSourceInterface(packet);
@@ -529,7 +562,7 @@ void Ipv4::routeUnicastPacket(Packet *packet)
         // special case ICMP reply
         else if (destIE->isBroadcast()) {
             // if the interface is broadcast we must search the next hop
-            const Ipv4Route *re = rt->findBestMatchingRoute(destAddr);
+            const Ipv4Route *re = findRouteCached(destAddr);
             if (re && re->getInterface() == destIE) {
                 packet->addTagIfAbsent<NextHopAddressReq>()->setNextHopAddress(re->getGateway());
             }
@@ -537,7 +570,7 @@ void Ipv4::routeUnicastPacket(Packet *packet)
     }
     else {
         // use Ipv4 routing (lookup in routing table)
-        const Ipv4Route *re = rt->findBestMatchingRoute(destAddr);
+        const Ipv4Route *re = findRouteCached(destAddr);
         if (re) {
             destIE = re->getInterface();
             packet->addTagIfAbsent<InterfaceReq>()->setInterfaceId(destIE->getInterfaceId());
@@ -1260,6 +1293,7 @@ void Ipv4::start()
 void Ipv4::stop()
 {
     flush();
+    flowCache.clear();
     for (auto it : socketIdToSocketDescriptor)
         delete it.second;
     socketIdToSocketDescriptor.clear();
@@ -1348,6 +1382,9 @@ void Ipv4::receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj,
     if (signalID == IArp::arpResolutionFailedSignal) {
         arpResolutionTimedOut(check_and_cast<IArp::Notification *>(obj));
     }
+    if (signalID == routeAddedSignal || signalID == routeChangedSignal || signalID == routeDeletedSignal) {
+        flowCache.clear();
+    }
 }
 
 void Ipv4::sendIcmpError(Packet *origPacket, int inputInterfaceId, IcmpType type, IcmpCode code)
@@ -30,6 +30,7 @@ class ArpPacket;
 class IcmpHeader;
 class IInterfaceTable;
 class IIpv4RoutingTable;
+class Ipv4Route;
 
 /**
  * Implements the Ipv4 protocol.
@@ -74,6 +75,7 @@ class INET_API Ipv4 : public OperationalBase, public NetfilterBase, public INetw
     simtime_t fragmentTimeoutTime;
     bool limitedBroadcast = false;
     std::string directBroadcastInterfaces = "";
+    int flowCacheSize = 0;
 
     cPatternMatcher directBroadcastInterfaceMatcher;
 
@@ -87,6 +89,12 @@ class INET_API Ipv4 : public OperationalBase, public NetfilterBase, public INetw
     // ARP related
     PendingPackets pendingPackets; // map indexed with IPv4Address for outbound packets waiting for ARP resolution
 
+    // flow cache: remembers the routing decision for the most recently routed
+    // destinations so steady-state flows skip the routing table lookup entirely;
+    // invalidated by the route change signals of the routing table
+    typedef std::list<std::pair<Ipv4Address, const Ipv4Route *>> FlowCache;
+    FlowCache flowCache; // most recently used entry first
+
     // statistics
     int numMulticast = 0;
     int numLocalDeliver = 0;
@@ -107,6 +115,9 @@ class INET_API Ipv4 : public OperationalBase, public NetfilterBase, public INetw
     // utility: look up route to the source of the datagram and return its interface
     virtual const NetworkInterface *getShortestPathInterfaceToSource(const Ptr<const Ipv4Header>& ipv4Header) const;
 
+    // utility: route lookup through the flow cache, falls back to the routing table on a miss
+    virtual const Ipv4Route *findRouteCached(const Ipv4Address& destAddr);
+
     // utility: show current statistics above the icon
     virtual void refreshDisplay() const override;
 
@@ -29,6 +29,7 @@ void Ipv4FragBuf::flush()
     for (auto i = bufs.begin(); i != bufs.end(); ++i)
         delete i->second.packet;
     bufs.clear();
+    expirations.clear();
 }
 
 Packet *Ipv4FragBuf::addFragment(Packet *packet, simtime_t now)
@@ -92,38 +93,34 @@ Packet *Ipv4FragBuf::addFragment(Packet *packet, simtime_t now)
     else {
         // there are still missing fragments
         curBuf->lastupdate = now;
+        expirations.push_back({now, key});
         return nullptr;
     }
 }
 
 void Ipv4FragBuf::purgeStaleFragments(Icmp *icmpModule, simtime_t lastupdate)
 {
-    // this method shouldn't be called too often because iteration on
-    // an std::map is *very* slow...
-
     ASSERT(icmpModule);
 
-    for (auto i = bufs.begin(); i != bufs.end();) {
-        // if too old, remove it
+    // the expiration entries are in arrival order, so only the stale prefix
+    // needs to be examined instead of iterating all reassembly buffers
+    while (!expirations.empty() && expirations.front().first < lastupdate) {
+        auto i = bufs.find(expirations.front().second);
+        expirations.pop_front();
+        // skip entries whose buffer was already refreshed, completed or removed
+        if (i == bufs.end() || i->second.lastupdate >= lastupdate)
+            continue;
         DatagramBuffer& buf = i->second;
-        if (buf.lastupdate < lastupdate) {
-            // send ICMP error.
-            // Note: receiver MUST NOT call decapsulate() on the datagram fragment,
-            // because its length (being a fragment) is smaller than the encapsulated
-            // packet, resulting in "length became negative" error. Use getEncapsulatedPacket().
-            EV_WARN << "datagram fragment timed out in reassembly buffer, sending ICMP_TIME_EXCEEDED\n";
-            if (buf.packet != nullptr) {
-                icmpModule->sendErrorMessage(buf.packet, -1 /*TODO*/, ICMP_TIME_EXCEEDED, 0);
-                delete buf.packet;
-            }
-
-            // delete
-            auto oldi = i++;
-            bufs.erase(oldi);
-        }
-        else {
-            ++i;
+        // send ICMP error.
+        // Note: receiver MUST NOT call decapsulate() on the datagram fragment,
+        // because its length (being a fragment) is smaller than the encapsulated
+        // packet, resulting in "length became negative" error. Use getEncapsulatedPacket().
+        EV_WARN << "datagram fragment timed out in reassembly buffer, sending ICMP_TIME_EXCEEDED\n";
+        if (buf.packet != nullptr) {
+            icmpModule->sendErrorMessage(buf.packet, -1 /*TODO*/, ICMP_TIME_EXCEEDED, 0);
+            delete buf.packet;
         }
+        bufs.erase(i);
     }
 }
 
@@ -8,6 +8,7 @@
 #ifndef __INET_IPV4FRAGBUF_H
 #define __INET_IPV4FRAGBUF_H
 
+#include <deque>
 #include <map>
 
 #include "inet/common/packet/Packet.h"
@@ -54,6 +55,11 @@ class INET_API Ipv4FragBuf
     // the reassembly buffers
     Buffers bufs;
 
+    // last update times in arrival order, used to purge stale datagrams
+    // without iterating all reassembly buffers; entries may be outdated and
+    // are lazily dropped when the buffer was refreshed, completed or removed
+    std::deque<std::pair<simtime_t, Key>> expirations;
+
   public:
     /**
      * Ctor.
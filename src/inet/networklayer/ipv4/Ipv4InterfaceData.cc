@@ -80,6 +80,13 @@ Ipv4InterfaceData::HostMulticastData::~HostMulticastData()
     joinedMulticastGroups.clear();
 }
 
+void Ipv4InterfaceData::HostMulticastData::recomputeGroupFilter()
+{
+    joinedMulticastGroupFilter = 0;
+    for (auto& elem : joinedMulticastGroups)
+        joinedMulticastGroupFilter |= computeGroupFilterBit(elem->multicastGroup);
+}
+
 std::string Ipv4InterfaceData::HostMulticastData::str()
 {
     std::stringstream out;
@@ -183,7 +190,10 @@ std::string Ipv4InterfaceData::detailedInfo() const
 
 bool Ipv4InterfaceData::isMemberOfMulticastGroup(const Ipv4Address& multicastAddress) const
 {
-    HostMulticastGroupVector groups = getHostData()->joinedMulticastGroups;
+    const HostMulticastData *data = getHostData();
+    if ((data->joinedMulticastGroupFilter & HostMulticastData::computeGroupFilterBit(multicastAddress)) == 0)
+        return false; // the group is definitely not joined
+    const HostMulticastGroupVector& groups = data->joinedMulticastGroups;
     for (HostMulticastGroupVector::const_iterator it = groups.begin(); it != groups.end(); ++it)
         if ((*it)->multicastGroup == multicastAddress)
             return true;
@@ -222,6 +232,7 @@ void Ipv4InterfaceData::changeMulticastGroupMembership(Ipv4Address multicastAddr
         ASSERT(oldFilterMode == MCAST_INCLUDE_SOURCES && oldSourceList.empty());
         HostMulticastData *data = getHostData();
         data->joinedMulticastGroups.push_back(new HostMulticastGroupData(multicastAddress));
+        data->joinedMulticastGroupFilter |= HostMulticastData::computeGroupFilterBit(multicastAddress);
         entry = data->joinedMulticastGroups.back();
     }
 
@@ -473,6 +484,7 @@ bool Ipv4InterfaceData::removeHostGroupData(Ipv4Address multicastAddress)
         if ((*it)->multicastGroup == multicastAddress) {
             delete *it;
             entries.erase(it);
+            getHostData()->recomputeGroupFilter();
             return true;
         }
     return false;
@@ -97,10 +97,21 @@ class INET_API Ipv4InterfaceData : public InterfaceProtocolData
 
     struct INET_API HostMulticastData {
         HostMulticastGroupVector joinedMulticastGroups; // multicast groups this interface joined
+        uint64_t joinedMulticastGroupFilter = 0; // bloom-style bitmap over the joined groups for a fast negative membership test
 
         virtual ~HostMulticastData();
         std::string str();
         std::string detailedInfo();
+
+        static uint64_t computeGroupFilterBit(Ipv4Address multicastGroup) {
+            uint32_t hash = multicastGroup.getInt();
+            hash ^= hash >> 16;
+            hash *= 0x45d9f3b;
+            hash ^= hash >> 16;
+            return (uint64_t)1 << (hash & 63);
+        }
+
+        void recomputeGroupFilter();
     };
 
     struct INET_API RouterMulticastGroupData {
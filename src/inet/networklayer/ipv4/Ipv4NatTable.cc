@@ -38,6 +38,7 @@ void Ipv4NatTable::initialize(int stage)
     cSimpleModule::initialize(stage);
     if (stage == INITSTAGE_LOCAL) {
         config = par("config");
+        connectionTracking = par("connectionTracking");
         networkProtocol.reference(this, "networkProtocolModule", true);
     }
     else if (stage == INITSTAGE_NETWORK_LAYER) {
@@ -99,52 +100,102 @@ void Ipv4NatTable::parseConfig()
 INetfilter::IHook::Result Ipv4NatTable::processPacket(Packet *packet, INetfilter::IHook::Type type)
 {
     Enter_Method("processPacket");
+    FlowKey flowKey;
+    bool flowKeyValid = connectionTracking && extractFlowKey(packet, type, flowKey);
+    if (flowKeyValid) {
+        auto it = trackedConnections.find(flowKey);
+        if (it != trackedConnections.end()) {
+            if (it->second != nullptr)
+                applyNatEntry(packet, it->second->second);
+            return ACCEPT;
+        }
+    }
     auto lt = natEntries.lower_bound(type);
     auto ut = natEntries.upper_bound(type);
+    const std::pair<PacketFilter *, Ipv4NatEntry> *matchingEntry = nullptr;
     for (; lt != ut; lt++) {
-        const auto& packetFilter = lt->second.first;
-        const auto& natEntry = lt->second.second;
         // TODO this might be slow for too many filters
-        if (packetFilter->matches(packet)) {
-            auto& ipv4Header = removeNetworkProtocolHeader<Ipv4Header>(packet);
-            if (!natEntry.getDestAddress().isUnspecified())
-                ipv4Header->setDestAddress(natEntry.getDestAddress());
-            if (!natEntry.getSrcAddress().isUnspecified())
-                ipv4Header->setSrcAddress(natEntry.getSrcAddress());
-            auto transportProtocol = ipv4Header->getProtocol();
+        if (lt->second.first->matches(packet)) {
+            matchingEntry = &lt->second;
+            break;
+        }
+    }
+    if (flowKeyValid)
+        // a nullptr entry caches the "no rule matches" result, later packets
+        // of the flow skip the filters either way
+        trackedConnections[flowKey] = matchingEntry;
+    if (matchingEntry != nullptr)
+        applyNatEntry(packet, matchingEntry->second);
+    return ACCEPT;
+}
+
+bool Ipv4NatTable::extractFlowKey(Packet *packet, INetfilter::IHook::Type type, FlowKey& flowKey)
+{
+    const auto& ipv4Header = packet->peekAtFront<Ipv4Header>();
+    if (ipv4Header->getFragmentOffset() != 0 || ipv4Header->getMoreFragments())
+        return false; // the ports of fragments cannot be read, leave them to the filters
+    auto transportProtocol = ipv4Header->getProtocol();
 #ifdef INET_WITH_UDP
-            if (transportProtocol == &Protocol::udp) {
-                auto& udpHeader = removeTransportProtocolHeader<UdpHeader>(packet);
-                // TODO if (!Udp::verifyCrc(Protocol::ipv4, udpHeader, packet))
-                auto udpData = packet->peekData();
-                if (natEntry.getDestPort() != -1)
-                    udpHeader->setDestPort(natEntry.getDestPort());
-                if (natEntry.getSrcPort() != -1)
-                    udpHeader->setSrcPort(natEntry.getSrcPort());
-                Udp::insertCrc(&Protocol::ipv4, ipv4Header->getSrcAddress(), ipv4Header->getDestAddress(), udpHeader, packet);
-                insertTransportProtocolHeader(packet, Protocol::udp, udpHeader);
-            }
-            else
+    if (transportProtocol == &Protocol::udp) {
+        const auto& udpHeader = packet->peekDataAt<UdpHeader>(ipv4Header->getChunkLength());
+        flowKey.srcPort = udpHeader->getSrcPort();
+        flowKey.destPort = udpHeader->getDestPort();
+    }
+    else
 #endif
 #ifdef INET_WITH_TCP_COMMON
-            if (transportProtocol == &Protocol::tcp) {
-                auto& tcpHeader = removeTransportProtocolHeader<tcp::TcpHeader>(packet);
-                // TODO if (!Tcp::verifyCrc(Protocol::ipv4, tcpHeader, packet))
-                if (natEntry.getDestPort() != -1)
-                    tcpHeader->setDestPort(natEntry.getDestPort());
-                if (natEntry.getSrcPort() != -1)
-                    tcpHeader->setSrcPort(natEntry.getSrcPort());
-                tcp::TcpCrcInsertionHook::insertCrc(&Protocol::ipv4, ipv4Header->getSrcAddress(), ipv4Header->getDestAddress(), tcpHeader, packet);
-                insertTransportProtocolHeader(packet, Protocol::tcp, tcpHeader);
-            }
-            else
+    if (transportProtocol == &Protocol::tcp) {
+        const auto& tcpHeader = packet->peekDataAt<tcp::TcpHeader>(ipv4Header->getChunkLength());
+        flowKey.srcPort = tcpHeader->getSrcPort();
+        flowKey.destPort = tcpHeader->getDestPort();
+    }
+    else
 #endif
-                throw cRuntimeError("Unknown protocol: '%s'", transportProtocol ? transportProtocol->getName() : std::to_string((int)ipv4Header->getProtocolId()).c_str());
-            insertNetworkProtocolHeader(packet, Protocol::ipv4, ipv4Header);
-            break;
-        }
+        return false; // only TCP and UDP flows are tracked
+    flowKey.type = type;
+    flowKey.srcAddress = ipv4Header->getSrcAddress();
+    flowKey.destAddress = ipv4Header->getDestAddress();
+    flowKey.protocolId = ipv4Header->getProtocolId();
+    return true;
+}
+
+void Ipv4NatTable::applyNatEntry(Packet *packet, const Ipv4NatEntry& natEntry)
+{
+    auto& ipv4Header = removeNetworkProtocolHeader<Ipv4Header>(packet);
+    if (!natEntry.getDestAddress().isUnspecified())
+        ipv4Header->setDestAddress(natEntry.getDestAddress());
+    if (!natEntry.getSrcAddress().isUnspecified())
+        ipv4Header->setSrcAddress(natEntry.getSrcAddress());
+    auto transportProtocol = ipv4Header->getProtocol();
+#ifdef INET_WITH_UDP
+    if (transportProtocol == &Protocol::udp) {
+        auto& udpHeader = removeTransportProtocolHeader<UdpHeader>(packet);
+        // TODO if (!Udp::verifyCrc(Protocol::ipv4, udpHeader, packet))
+        auto udpData = packet->peekData();
+        if (natEntry.getDestPort() != -1)
+            udpHeader->setDestPort(natEntry.getDestPort());
+        if (natEntry.getSrcPort() != -1)
+            udpHeader->setSrcPort(natEntry.getSrcPort());
+        Udp::insertCrc(&Protocol::ipv4, ipv4Header->getSrcAddress(), ipv4Header->getDestAddress(), udpHeader, packet);
+        insertTransportProtocolHeader(packet, Protocol::udp, udpHeader);
     }
-    return ACCEPT;
+    else
+#endif
+#ifdef INET_WITH_TCP_COMMON
+    if (transportProtocol == &Protocol::tcp) {
+        auto& tcpHeader = removeTransportProtocolHeader<tcp::TcpHeader>(packet);
+        // TODO if (!Tcp::verifyCrc(Protocol::ipv4, tcpHeader, packet))
+        if (natEntry.getDestPort() != -1)
+            tcpHeader->setDestPort(natEntry.getDestPort());
+        if (natEntry.getSrcPort() != -1)
+            tcpHeader->setSrcPort(natEntry.getSrcPort());
+        tcp::TcpCrcInsertionHook::insertCrc(&Protocol::ipv4, ipv4Header->getSrcAddress(), ipv4Header->getDestAddress(), tcpHeader, packet);
+        insertTransportProtocolHeader(packet, Protocol::tcp, tcpHeader);
+    }
+    else
+#endif
+        throw cRuntimeError("Unknown protocol: '%s'", transportProtocol ? transportProtocol->getName() : std::to_string((int)ipv4Header->getProtocolId()).c_str());
+    insertNetworkProtocolHeader(packet, Protocol::ipv4, ipv4Header);
 }
 
 } // namespace inet
@@ -8,6 +8,8 @@
 #ifndef __INET_IPV4NATTABLE_H
 #define __INET_IPV4NATTABLE_H
 
+#include <unordered_map>
+
 #include "inet/common/ModuleRefByPar.h"
 #include "inet/common/packet/PacketFilter.h"
 #include "inet/networklayer/contract/INetfilter.h"
@@ -23,11 +25,36 @@ class INET_API Ipv4NatTable : public cSimpleModule, public NetfilterBase::HookBa
 
     std::multimap<INetfilter::IHook::Type, std::pair<PacketFilter *, Ipv4NatEntry>> natEntries;
 
+    // connection tracking (optional): remembers per flow which NAT entry
+    // matched (nullptr if none), so the packet filters only run on the first
+    // packet of each flow; see the connectionTracking parameter
+    bool connectionTracking = false;
+    struct FlowKey {
+        INetfilter::IHook::Type type;
+        Ipv4Address srcAddress;
+        Ipv4Address destAddress;
+        int protocolId = -1;
+        int srcPort = -1;
+        int destPort = -1;
+
+        bool operator==(const FlowKey& other) const { return type == other.type && srcAddress == other.srcAddress && destAddress == other.destAddress && protocolId == other.protocolId && srcPort == other.srcPort && destPort == other.destPort; }
+    };
+    struct FlowKeyHash {
+        size_t operator()(const FlowKey& key) const {
+            uint64_t addresses = ((uint64_t)key.srcAddress.getInt() << 32) | key.destAddress.getInt();
+            uint64_t rest = ((uint64_t)key.type << 40) | ((uint64_t)(uint8_t)key.protocolId << 32) | ((uint64_t)(uint16_t)key.srcPort << 16) | (uint64_t)(uint16_t)key.destPort;
+            return std::hash<uint64_t>()(addresses) ^ (std::hash<uint64_t>()(rest) << 1);
+        }
+    };
+    std::unordered_map<FlowKey, const std::pair<PacketFilter *, Ipv4NatEntry> *, FlowKeyHash> trackedConnections;
+
   protected:
     virtual int numInitStages() const override { return NUM_INIT_STAGES; }
     virtual void initialize(int stage) override;
     virtual void handleMessage(cMessage *message) override;
     virtual void parseConfig();
+    virtual bool extractFlowKey(Packet *packet, INetfilter::IHook::Type type, FlowKey& flowKey);
+    virtual void applyNatEntry(Packet *packet, const Ipv4NatEntry& natEntry);
     virtual Result processPacket(Packet *packet, INetfilter::IHook::Type type);
 
   public:
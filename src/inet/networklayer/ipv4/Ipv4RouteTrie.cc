@@ -0,0 +1,149 @@
+//
+// Copyright (C) 2004-2006 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#include "inet/networklayer/ipv4/Ipv4RouteTrie.h"
+
+#include <algorithm>
+
+#include "inet/networklayer/ipv4/Ipv4Route.h"
+
+namespace inet {
+
+void Ipv4RouteTrie::add(Ipv4Route *route, const RouteComparator& comparator)
+{
+    int prefixLength = route->getNetmask().getNetmaskLength();
+    uint32_t prefix = makePrefix(route->getDestination().getInt(), prefixLength);
+    Node **link = &root;
+    while (true) {
+        Node *node = *link;
+        if (node == nullptr) {
+            node = new Node();
+            node->prefix = prefix;
+            node->prefixLength = prefixLength;
+            node->routes.push_back(route);
+            *link = node;
+            return;
+        }
+        int commonLength = std::min(node->prefixLength, prefixLength);
+        if (makePrefix(prefix, commonLength) != makePrefix(node->prefix, commonLength)) {
+            // prefixes diverge before either one ends: split with a branch node
+            // at the first differing bit (which is below commonLength, because
+            // bits beyond the prefix lengths are zero in both stored prefixes)
+            int diff = 0;
+            while (getBit(prefix, diff) == getBit(node->prefix, diff))
+                diff++;
+            Node *branch = new Node();
+            branch->prefix = makePrefix(prefix, diff);
+            branch->prefixLength = diff;
+            branch->children[getBit(node->prefix, diff)] = node;
+            Node *leaf = new Node();
+            leaf->prefix = prefix;
+            leaf->prefixLength = prefixLength;
+            leaf->routes.push_back(route);
+            branch->children[getBit(prefix, diff)] = leaf;
+            *link = branch;
+            return;
+        }
+        if (node->prefixLength == prefixLength) {
+            auto pos = std::upper_bound(node->routes.begin(), node->routes.end(), route, comparator);
+            node->routes.insert(pos, route);
+            return;
+        }
+        if (node->prefixLength < prefixLength)
+            link = &node->children[getBit(prefix, node->prefixLength)];
+        else {
+            // the new prefix is a proper prefix of the node: insert above it
+            Node *parent = new Node();
+            parent->prefix = prefix;
+            parent->prefixLength = prefixLength;
+            parent->routes.push_back(route);
+            parent->children[getBit(node->prefix, prefixLength)] = node;
+            *link = parent;
+            return;
+        }
+    }
+}
+
+void Ipv4RouteTrie::contract(Node *& node)
+{
+    // contract nodes left without routes and with at most one child
+    if (node->routes.empty() && (node->children[0] == nullptr || node->children[1] == nullptr)) {
+        Node *child = node->children[0] != nullptr ? node->children[0] : node->children[1];
+        node->children[0] = node->children[1] = nullptr;
+        delete node;
+        node = child;
+    }
+}
+
+bool Ipv4RouteTrie::removeRecursive(Node *& node, uint32_t prefix, int prefixLength, Ipv4Route *route)
+{
+    if (node == nullptr || node->prefixLength > prefixLength || makePrefix(prefix, node->prefixLength) != node->prefix)
+        return false;
+    bool removed;
+    if (node->prefixLength == prefixLength) {
+        auto it = std::find(node->routes.begin(), node->routes.end(), route);
+        if (it == node->routes.end())
+            return false;
+        node->routes.erase(it);
+        removed = true;
+    }
+    else
+        removed = removeRecursive(node->children[getBit(prefix, node->prefixLength)], prefix, prefixLength, route);
+    if (removed)
+        contract(node);
+    return removed;
+}
+
+bool Ipv4RouteTrie::removeScan(Node *& node, Ipv4Route *route)
+{
+    if (node == nullptr)
+        return false;
+    auto it = std::find(node->routes.begin(), node->routes.end(), route);
+    bool removed;
+    if (it != node->routes.end()) {
+        node->routes.erase(it);
+        removed = true;
+    }
+    else
+        removed = removeScan(node->children[0], route) || removeScan(node->children[1], route);
+    if (removed)
+        contract(node);
+    return removed;
+}
+
+bool Ipv4RouteTrie::remove(Ipv4Route *route)
+{
+    int prefixLength = route->getNetmask().getNetmaskLength();
+    uint32_t prefix = makePrefix(route->getDestination().getInt(), prefixLength);
+    if (removeRecursive(root, prefix, prefixLength, route))
+        return true;
+    // the route may be indexed under an older destination/netmask when its
+    // fields were modified before the routeChanged() notification arrived;
+    // fall back to an exhaustive scan so the index never holds a stale pointer
+    return removeScan(root, route);
+}
+
+Ipv4Route *Ipv4RouteTrie::findBestMatchingRoute(const Ipv4Address& dest) const
+{
+    uint32_t address = dest.getInt();
+    Ipv4Route *bestRoute = nullptr;
+    Node *node = root;
+    while (node != nullptr && makePrefix(address, node->prefixLength) == node->prefix) {
+        // a deeper node has a longer prefix, so its best valid route wins
+        for (auto route : node->routes) {
+            if (route->isValid()) {
+                bestRoute = route;
+                break;
+            }
+        }
+        if (node->prefixLength == 32)
+            break;
+        node = node->children[getBit(address, node->prefixLength)];
+    }
+    return bestRoute;
+}
+
+} // namespace inet
@@ -0,0 +1,84 @@
+//
+// Copyright (C) 2004-2006 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#ifndef __INET_IPV4ROUTETRIE_H
+#define __INET_IPV4ROUTETRIE_H
+
+#include <functional>
+#include <vector>
+
+#include "inet/common/INETDefs.h"
+#include "inet/networklayer/contract/ipv4/Ipv4Address.h"
+
+namespace inet {
+
+class Ipv4Route;
+
+/**
+ * Longest-prefix-match index over the unicast routes of an Ipv4RoutingTable.
+ *
+ * The routes are organized into a path-compressed binary trie keyed on the
+ * destination prefix, so lookup, insertion and removal all take O(prefix
+ * length) steps independently of the number of routes. Routes sharing the same
+ * destination/netmask are kept in a single trie node, ordered by the same
+ * comparator as the routing table's route vector, so the lookup result is
+ * identical to the linear best-match scan.
+ *
+ * The trie does not own the routes; it merely indexes the route vector of the
+ * routing table, which remains authoritative for enumeration and ownership.
+ */
+class INET_API Ipv4RouteTrie
+{
+  public:
+    typedef std::function<bool(const Ipv4Route *, const Ipv4Route *)> RouteComparator;
+
+  protected:
+    struct Node {
+        uint32_t prefix = 0; // the leading prefixLength bits are valid, the rest are zero
+        int prefixLength = 0;
+        std::vector<Ipv4Route *> routes; // routes with exactly this destination/netmask, best first
+        Node *children[2] = { nullptr, nullptr };
+
+        ~Node() { delete children[0]; delete children[1]; }
+    };
+
+    Node *root = nullptr;
+
+  protected:
+    static int getBit(uint32_t address, int index) { return (address >> (31 - index)) & 1; }
+    static uint32_t makePrefix(uint32_t address, int length) { return length == 0 ? 0 : address & (0xffffffffu << (32 - length)); }
+
+    bool removeRecursive(Node *& node, uint32_t prefix, int prefixLength, Ipv4Route *route);
+    bool removeScan(Node *& node, Ipv4Route *route);
+    void contract(Node *& node);
+
+  public:
+    ~Ipv4RouteTrie() { delete root; }
+
+    /**
+     * Inserts the route keyed on its current destination/netmask. Routes with
+     * the same prefix are ordered by the given comparator, best route first.
+     */
+    void add(Ipv4Route *route, const RouteComparator& comparator);
+
+    /**
+     * Removes the route. Looks it up keyed on its current destination/netmask
+     * first; falls back to an exhaustive scan when the fields were already
+     * modified (Ipv4Route::changed() notifies after the mutation). Returns
+     * false if the route was not found.
+     */
+    bool remove(Ipv4Route *route);
+
+    /**
+     * Returns the best (longest prefix, then lowest rank by the insertion
+     * comparator) valid route matching the destination, or nullptr.
+     */
+    Ipv4Route *findBestMatchingRoute(const Ipv4Address& dest) const;
+};
+
+} // namespace inet
+
+#endif
@@ -48,6 +48,7 @@ Ipv4RoutingTable::~Ipv4RoutingTable()
         delete elem;
     for (auto& elem : multicastRoutes)
         delete elem;
+    delete routeTrie;
 }
 
 void Ipv4RoutingTable::initialize(int stage)
@@ -69,6 +70,8 @@ void Ipv4RoutingTable::initialize(int stage)
         forwarding = par("forwarding");
         multicastForward = par("multicastForwarding");
         useAdminDist = par("useAdminDist");
+        if (par("useTrieIndex"))
+            routeTrie = new Ipv4RouteTrie();
 
         WATCH_PTRVECTOR(routes);
         WATCH_PTRVECTOR(multicastRoutes);
@@ -205,6 +208,7 @@ void Ipv4RoutingTable::deleteInterfaceRoutes(const NetworkInterface *entry)
         Ipv4Route *route = *it;
         if (route->getInterface() == entry) {
             it = routes.erase(it);
+            indexRemoveRoute(route);
             invalidateCache();
             ASSERT(route->getRoutingTable() == this); // still filled in, for the listeners' benefit
             emit(routeDeletedSignal, route);
@@ -239,6 +243,7 @@ void Ipv4RoutingTable::deleteInterfaceRoutes(const NetworkInterface *entry)
 void Ipv4RoutingTable::invalidateCache()
 {
     routingCache.clear();
+    multicastRoutingCache.clear();
     localBroadcastAddresses.clear();
 }
 
@@ -370,6 +375,7 @@ void Ipv4RoutingTable::purge()
             ++it;
         else {
             it = routes.erase(it);
+            indexRemoveRoute(route);
             invalidateCache();
             ASSERT(route->getRoutingTable() == this); // still filled in, for the listeners' benefit
             emit(routeDeletedSignal, route);
@@ -405,11 +411,15 @@ Ipv4Route *Ipv4RoutingTable::findBestMatchingRoute(const Ipv4Address& dest) cons
     // find best match (one with longest prefix)
     // default route has zero prefix length, so (if exists) it'll be selected as last resort
     Ipv4Route *bestRoute = nullptr;
-    for (auto e : routes) {
-        if (e->isValid()) {
-            if (Ipv4Address::maskedAddrAreEqual(dest, e->getDestination(), e->getNetmask())) { // match
-                bestRoute = const_cast<Ipv4Route *>(e);
-                break;
+    if (routeTrie != nullptr)
+        bestRoute = routeTrie->findBestMatchingRoute(dest);
+    else {
+        for (auto e : routes) {
+            if (e->isValid()) {
+                if (Ipv4Address::maskedAddrAreEqual(dest, e->getDestination(), e->getNetmask())) { // match
+                    bestRoute = const_cast<Ipv4Route *>(e);
+                    break;
+                }
             }
         }
     }
@@ -440,14 +450,23 @@ const Ipv4MulticastRoute *Ipv4RoutingTable::findBestMatchingMulticastRoute(const
             origin.getDByte(0), origin.getDByte(1), origin.getDByte(2), origin.getDByte(3),
             group.getDByte(0), group.getDByte(1), group.getDByte(2), group.getDByte(3)); // note: str().c_str() too slow here here
 
-    // TODO caching?
+    auto key = std::make_pair(origin, group);
+    auto it = multicastRoutingCache.find(key);
+    if (it != multicastRoutingCache.end()) {
+        if (it->second == nullptr || it->second->isValid())
+            return it->second;
+    }
 
+    const Ipv4MulticastRoute *bestRoute = nullptr;
     for (auto e : multicastRoutes) {
-        if (e->isValid() && e->matches(origin, group))
-            return e;
+        if (e->isValid() && e->matches(origin, group)) {
+            bestRoute = e;
+            break;
+        }
     }
 
-    return nullptr;
+    multicastRoutingCache[key] = bestRoute;
+    return bestRoute;
 }
 
 Ipv4Route *Ipv4RoutingTable::getRoute(int k) const
@@ -494,6 +513,18 @@ void Ipv4RoutingTable::setRouterId(Ipv4Address a)
     routerId = a;
 }
 
+void Ipv4RoutingTable::indexAddRoute(Ipv4Route *entry)
+{
+    if (routeTrie != nullptr)
+        routeTrie->add(entry, RouteLessThan(*this));
+}
+
+void Ipv4RoutingTable::indexRemoveRoute(Ipv4Route *entry)
+{
+    if (routeTrie != nullptr)
+        routeTrie->remove(entry);
+}
+
 void Ipv4RoutingTable::internalAddRoute(Ipv4Route *entry)
 {
     if (!entry->getNetmask().isValidNetmask())
@@ -529,6 +560,7 @@ void Ipv4RoutingTable::internalAddRoute(Ipv4Route *entry)
     // stop at the first match when doing the longest netmask matching
     auto pos = upper_bound(routes.begin(), routes.end(), entry, RouteLessThan(*this));
     routes.insert(pos, entry);
+    indexAddRoute(entry);
     invalidateCache();
     entry->setRoutingTable(this);
 }
@@ -547,6 +579,7 @@ Ipv4Route *Ipv4RoutingTable::internalRemoveRoute(Ipv4Route *entry)
     auto i = find(routes, entry);
     if (i != routes.end()) {
         routes.erase(i);
+        indexRemoveRoute(entry);
         invalidateCache();
         return entry;
     }
@@ -712,6 +745,7 @@ void Ipv4RoutingTable::updateNetmaskRoutes()
             auto it = routes.begin() + (k--); // '--' is necessary because indices shift down
             Ipv4Route *route = *it;
             routes.erase(it);
+            indexRemoveRoute(route);
             invalidateCache();
             ASSERT(route->getRoutingTable() == this); // still filled in, for the listeners' benefit
             emit(routeDeletedSignal, route);
@@ -740,6 +774,7 @@ void Ipv4RoutingTable::updateNetmaskRoutes()
                 route->setRoutingTable(this);
                 auto pos = upper_bound(routes.begin(), routes.end(), route, RouteLessThan(*this));
                 routes.insert(pos, route);
+                indexAddRoute(route);
                 invalidateCache();
                 emit(routeAddedSignal, route);
             }
@@ -23,6 +23,7 @@
 #include "inet/common/lifecycle/ILifecycle.h"
 #include "inet/networklayer/contract/ipv4/Ipv4Address.h"
 #include "inet/networklayer/ipv4/IIpv4RoutingTable.h"
+#include "inet/networklayer/ipv4/Ipv4RouteTrie.h"
 
 namespace inet {
 
@@ -80,6 +81,14 @@ class INET_API Ipv4RoutingTable : public cSimpleModule, public IIpv4RoutingTable
     typedef std::map<Ipv4Address, Ipv4Route *> RoutingCache;
     mutable RoutingCache routingCache;
 
+    // multicast routing cache: maps (source, group) to the best matching multicast route,
+    // so per-datagram replication decisions don't rescan the multicast route vector;
+    // the cached route pointer remains correct across the incremental out-interface
+    // updates made by the PIM/IGMP state machines, because those modify the route
+    // object in place; only route addition/removal/re-keying clears the cache
+    typedef std::map<std::pair<Ipv4Address, Ipv4Address>, const Ipv4MulticastRoute *> MulticastRoutingCache;
+    mutable MulticastRoutingCache multicastRoutingCache;
+
     // local addresses cache (to speed up isLocalAddress())
     typedef std::set<Ipv4Address> AddressSet;
     // JcM add: to handle the local broadcast address
@@ -96,6 +105,10 @@ class INET_API Ipv4RoutingTable : public cSimpleModule, public IIpv4RoutingTable
     typedef std::vector<Ipv4MulticastRoute *> MulticastRouteVector;
     MulticastRouteVector multicastRoutes; // Multicast route array, sorted by netmask desc, origin asc, metric asc
 
+    // optional longest-prefix-match index over 'routes' (see useTrieIndex parameter);
+    // kept in sync by the methods that modify the route vector
+    Ipv4RouteTrie *routeTrie = nullptr;
+
   protected:
     // set router Id
     virtual void configureRouterId();
@@ -128,6 +141,10 @@ class INET_API Ipv4RoutingTable : public cSimpleModule, public IIpv4RoutingTable
     // helper for sorting multicast routing table, used by addMulticastRoute()
     static bool multicastRouteLessThan(const Ipv4MulticastRoute *a, const Ipv4MulticastRoute *b);
 
+    // helpers keeping the optional trie index in sync with the 'routes' vector
+    void indexAddRoute(Ipv4Route *entry);
+    void indexRemoveRoute(Ipv4Route *entry);
+
     // helper functions:
     void internalAddRoute(Ipv4Route *entry);
     Ipv4Route *internalRemoveRoute(Ipv4Route *entry);
@@ -0,0 +1,161 @@
+//
+// Copyright (C) 2024 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#include "inet/networklayer/ipv4/NetworkStateSnapshotManager.h"
+
+#include "inet/common/ModuleAccess.h"
+#include "inet/common/XMLUtils.h"
+#include "inet/networklayer/common/L3AddressResolver.h"
+#include "inet/networklayer/contract/IInterfaceTable.h"
+#include "inet/networklayer/ipv4/Ipv4Route.h"
+
+namespace inet {
+
+using namespace xmlutils;
+
+Define_Module(NetworkStateSnapshotManager);
+
+NetworkStateSnapshotManager::~NetworkStateSnapshotManager()
+{
+    cancelAndDelete(snapshotTimer);
+}
+
+void NetworkStateSnapshotManager::initialize(int stage)
+{
+    cSimpleModule::initialize(stage);
+
+    if (stage == INITSTAGE_LOCAL) {
+        snapshotTime = par("snapshotTime");
+        snapshotFile = par("snapshotFile").stdstringValue();
+        if (snapshotTime >= SIMTIME_ZERO) {
+            snapshotTimer = new cMessage("takeSnapshot");
+            scheduleAt(snapshotTime, snapshotTimer);
+        }
+    }
+    else if (stage == INITSTAGE_LAST) {
+        // restore after the configurators have run, so their routes get replaced
+        const char *restoreFile = par("restoreFile");
+        if (*restoreFile != '\0')
+            restoreSnapshot(getEnvir()->getXMLDocument(restoreFile, nullptr));
+    }
+}
+
+void NetworkStateSnapshotManager::handleMessage(cMessage *message)
+{
+    if (message == snapshotTimer)
+        saveSnapshot();
+    else
+        throw cRuntimeError("Unknown message");
+}
+
+void NetworkStateSnapshotManager::saveSnapshot()
+{
+    EV_INFO << "Saving network state snapshot" << EV_FIELD(snapshotFile) << EV_ENDL;
+    std::ofstream out(snapshotFile.c_str());
+    if (!out.is_open())
+        throw cRuntimeError("Cannot open snapshot file '%s' for writing", snapshotFile.c_str());
+    out << "<snapshot network=\"" << getSimulation()->getNetworkType()->getName() << "\" time=\"" << simTime() << "\">\n";
+    for (int id = 0; id <= getSimulation()->getLastComponentId(); id++) {
+        cModule *module = getSimulation()->getModule(id);
+        if (auto routingTable = dynamic_cast<Ipv4RoutingTable *>(module))
+            saveRoutingTable(out, routingTable);
+        else if (auto arp = dynamic_cast<Arp *>(module))
+            saveArpCache(out, arp);
+    }
+    out << "</snapshot>\n";
+}
+
+void NetworkStateSnapshotManager::saveRoutingTable(std::ostream& out, Ipv4RoutingTable *routingTable)
+{
+    out << "  <routingTable module=\"" << routingTable->getFullPath() << "\">\n";
+    for (int i = 0; i < routingTable->getNumRoutes(); i++) {
+        Ipv4Route *route = routingTable->getRoute(i);
+        out << "    <route destination=\"" << route->getDestination() << "\""
+            << " netmask=\"" << route->getNetmask() << "\""
+            << " gateway=\"" << route->getGateway() << "\""
+            << " interface=\"" << (route->getInterface() != nullptr ? route->getInterface()->getInterfaceName() : "") << "\""
+            << " metric=\"" << route->getMetric() << "\""
+            << " sourceType=\"" << IRoute::sourceTypeName(route->getSourceType()) << "\"/>\n";
+    }
+    out << "  </routingTable>\n";
+}
+
+void NetworkStateSnapshotManager::saveArpCache(std::ostream& out, Arp *arp)
+{
+    out << "  <arpCache module=\"" << arp->getFullPath() << "\">\n";
+    for (const auto& elem : arp->getArpCache()) {
+        Arp::ArpCacheEntry *entry = elem.second;
+        if (entry->pending || entry->negative)
+            continue; // only completed resolutions are worth carrying over
+        out << "    <entry address=\"" << elem.first << "\""
+            << " macAddress=\"" << entry->macAddress << "\""
+            << " interface=\"" << (entry->ie != nullptr ? entry->ie->getInterfaceName() : "") << "\"/>\n";
+    }
+    out << "  </arpCache>\n";
+}
+
+void NetworkStateSnapshotManager::restoreSnapshot(const cXMLElement *snapshot)
+{
+    EV_INFO << "Restoring network state snapshot" << EV_FIELD(sourceLocation, snapshot->getSourceLocation()) << EV_ENDL;
+    for (const cXMLElement *element : snapshot->getChildren()) {
+        if (!strcmp(element->getTagName(), "routingTable"))
+            restoreRoutingTable(element);
+        else if (!strcmp(element->getTagName(), "arpCache"))
+            restoreArpCache(element);
+        else
+            throw cRuntimeError(element, "Unknown snapshot element <%s>", element->getTagName());
+    }
+}
+
+void NetworkStateSnapshotManager::restoreRoutingTable(const cXMLElement *element)
+{
+    const char *modulePath = getMandatoryFilledAttribute(*element, "module");
+    auto routingTable = check_and_cast<Ipv4RoutingTable *>(getModuleByPath(modulePath));
+    IInterfaceTable *interfaceTable = L3AddressResolver().interfaceTableOf(getContainingNode(routingTable));
+    // replace whatever the configurators installed with the recorded warm state
+    while (routingTable->getNumRoutes() > 0)
+        routingTable->deleteRoute(routingTable->getRoute(0));
+    for (const cXMLElement *routeElement : element->getChildrenByTagName("route")) {
+        Ipv4Route *route = new Ipv4Route();
+        route->setDestination(Ipv4Address(getMandatoryAttribute(*routeElement, "destination")));
+        route->setNetmask(Ipv4Address(getMandatoryAttribute(*routeElement, "netmask")));
+        route->setGateway(Ipv4Address(getMandatoryAttribute(*routeElement, "gateway")));
+        const char *interfaceName = getMandatoryFilledAttribute(*routeElement, "interface");
+        NetworkInterface *networkInterface = interfaceTable->findInterfaceByName(interfaceName);
+        if (networkInterface == nullptr)
+            throw cRuntimeError(routeElement, "No interface '%s' found for routing table '%s'", interfaceName, modulePath);
+        route->setInterface(networkInterface);
+        route->setMetric(atoi(getMandatoryAttribute(*routeElement, "metric")));
+        route->setSourceType(parseSourceType(getMandatoryAttribute(*routeElement, "sourceType")));
+        routingTable->addRoute(route);
+    }
+}
+
+void NetworkStateSnapshotManager::restoreArpCache(const cXMLElement *element)
+{
+    const char *modulePath = getMandatoryFilledAttribute(*element, "module");
+    auto arp = check_and_cast<Arp *>(getModuleByPath(modulePath));
+    IInterfaceTable *interfaceTable = L3AddressResolver().interfaceTableOf(getContainingNode(arp));
+    for (const cXMLElement *entryElement : element->getChildrenByTagName("entry")) {
+        Ipv4Address address(getMandatoryAttribute(*entryElement, "address"));
+        MacAddress macAddress(getMandatoryAttribute(*entryElement, "macAddress"));
+        const char *interfaceName = getMandatoryFilledAttribute(*entryElement, "interface");
+        NetworkInterface *networkInterface = interfaceTable->findInterfaceByName(interfaceName);
+        if (networkInterface == nullptr)
+            throw cRuntimeError(entryElement, "No interface '%s' found for ARP cache '%s'", interfaceName, modulePath);
+        arp->setArpCacheEntry(address, macAddress, networkInterface);
+    }
+}
+
+IRoute::SourceType NetworkStateSnapshotManager::parseSourceType(const char *name)
+{
+    for (int i = IRoute::MANUAL; i <= IRoute::ISIS; i++)
+        if (!strcmp(name, IRoute::sourceTypeName((IRoute::SourceType)i)))
+            return (IRoute::SourceType)i;
+    throw cRuntimeError("Unknown route source type '%s'", name);
+}
+
+} // namespace inet
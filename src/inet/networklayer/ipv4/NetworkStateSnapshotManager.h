@@ -0,0 +1,51 @@
+//
+// Copyright (C) 2024 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#ifndef __INET_NETWORKSTATESNAPSHOTMANAGER_H
+#define __INET_NETWORKSTATESNAPSHOTMANAGER_H
+
+#include <fstream>
+
+#include "inet/networklayer/arp/ipv4/Arp.h"
+#include "inet/networklayer/ipv4/Ipv4RoutingTable.h"
+
+namespace inet {
+
+/**
+ * Saves the IPv4 routing tables and ARP caches of all network nodes to an XML
+ * snapshot file at a configured time, and restores such a snapshot at startup,
+ * so measurement replications can skip a common warmup phase. See the NED file
+ * for details.
+ */
+class INET_API NetworkStateSnapshotManager : public cSimpleModule
+{
+  protected:
+    simtime_t snapshotTime;
+    std::string snapshotFile;
+    cMessage *snapshotTimer = nullptr;
+
+  protected:
+    virtual int numInitStages() const override { return NUM_INIT_STAGES; }
+    virtual void initialize(int stage) override;
+    virtual void handleMessage(cMessage *message) override;
+
+    virtual void saveSnapshot();
+    virtual void saveRoutingTable(std::ostream& out, Ipv4RoutingTable *routingTable);
+    virtual void saveArpCache(std::ostream& out, Arp *arp);
+
+    virtual void restoreSnapshot(const cXMLElement *snapshot);
+    virtual void restoreRoutingTable(const cXMLElement *element);
+    virtual void restoreArpCache(const cXMLElement *element);
+
+    static IRoute::SourceType parseSourceType(const char *name);
+
+  public:
+    virtual ~NetworkStateSnapshotManager();
+};
+
+} // namespace inet
+
+#endif
@@ -279,9 +279,17 @@ NetworkInterface *Ipv6::getSourceInterfaceFrom(Packet *packet)
     return interfaceInd != nullptr ? ift->getInterfaceById(interfaceInd->getInterfaceId()) : nullptr;
 }
 
+Ptr<const Ipv6Header> Ipv6::peekIpv6Header(Packet *packet) const
+{
+    auto ipv6Header = dynamicPtrCast<const Ipv6Header>(findNetworkProtocolHeader(packet));
+    if (ipv6Header == nullptr)
+        ipv6Header = packet->peekAtFront<Ipv6Header>();
+    return ipv6Header;
+}
+
 void Ipv6::preroutingFinish(Packet *packet, const NetworkInterface *fromIE, const NetworkInterface *destIE, Ipv6Address nextHopAddr)
 {
-    const auto& ipv6Header = packet->peekAtFront<Ipv6Header>();
+    const auto& ipv6Header = peekIpv6Header(packet);
     Ipv6Address destAddr = ipv6Header->getDestAddress();
     // remove control info
     delete packet->removeControlInfo();
@@ -364,7 +372,7 @@ void Ipv6::handleMessageFromHL(Packet *packet)
 
 void Ipv6::datagramLocalOut(Packet *packet, const NetworkInterface *destIE, Ipv6Address requestedNextHopAddress)
 {
-    const auto& ipv6Header = packet->peekAtFront<Ipv6Header>();
+    const auto& ipv6Header = peekIpv6Header(packet);
     // route packet
     if (destIE != nullptr)
         fragmentPostRouting(packet, destIE, MacAddress::BROADCAST_ADDRESS, true); // FIXME what MAC address to use?
@@ -376,7 +384,7 @@ void Ipv6::datagramLocalOut(Packet *packet, const NetworkInterface *destIE, Ipv6
 
 void Ipv6::routePacket(Packet *packet, const NetworkInterface *destIE, const NetworkInterface *fromIE, Ipv6Address requestedNextHopAddress, bool fromHL)
 {
-    auto ipv6Header = packet->peekAtFront<Ipv6Header>();
+    auto ipv6Header = peekIpv6Header(packet);
     // TODO add option handling code here
     Ipv6Address destAddress = ipv6Header->getDestAddress();
 
@@ -475,7 +483,7 @@ void Ipv6::routePacket(Packet *packet, const NetworkInterface *destIE, const Net
 
 void Ipv6::resolveMACAddressAndSendPacket(Packet *packet, int interfaceId, Ipv6Address nextHop, bool fromHL)
 {
-    const auto& ipv6Header = packet->peekAtFront<Ipv6Header>();
+    const auto& ipv6Header = peekIpv6Header(packet);
     NetworkInterface *ie = ift->getInterfaceById(interfaceId);
     ASSERT(ie != nullptr);
     ASSERT(!nextHop.isUnspecified());
@@ -520,7 +528,7 @@ void Ipv6::resolveMACAddressAndSendPacket(Packet *packet, int interfaceId, Ipv6A
 
 void Ipv6::routeMulticastPacket(Packet *packet, const NetworkInterface *destIE, const NetworkInterface *fromIE, bool fromHL)
 {
-    auto ipv6Header = packet->peekAtFront<Ipv6Header>();
+    auto ipv6Header = peekIpv6Header(packet);
     const Ipv6Address& destAddr = ipv6Header->getDestAddress();
 
     EV_INFO << "destination address " << destAddr << " is multicast, doing multicast routing\n";
@@ -646,7 +654,7 @@ void Ipv6::routeMulticastPacket(Packet *packet, const NetworkInterface *destIE,
 
 void Ipv6::localDeliver(Packet *packet, const NetworkInterface *fromIE)
 {
-    const auto& ipv6Header = packet->peekAtFront<Ipv6Header>();
+    const auto& ipv6Header = peekIpv6Header(packet);
 
     // Defragmentation. skip defragmentation if datagram is not fragmented
     const Ipv6FragmentHeader *fh = dynamic_cast<const Ipv6FragmentHeader *>(ipv6Header->findExtensionHeaderByType(IP_PROT_IPv6EXT_FRAGMENT));
@@ -835,7 +843,7 @@ void Ipv6::encapsulate(Packet *transportPacket)
 void Ipv6::fragmentPostRouting(Packet *packet, const NetworkInterface *ie, const MacAddress& nextHopAddr, bool fromHL)
 {
 //    const NetworkInterface *destIE = ift->getInterfaceById(packet->getTag<InterfaceReq>()->getInterfaceId());
-    auto ipv6Header = packet->peekAtFront<Ipv6Header>();
+    auto ipv6Header = peekIpv6Header(packet);
     // ensure source address is filled
     if (fromHL && ipv6Header->getSrcAddress().isUnspecified() &&
         !ipv6Header->getDestAddress().isSolicitedNodeMulticastAddress())
@@ -113,6 +113,14 @@ class INET_API Ipv6 : public cSimpleModule, public NetfilterBase, public Lifecyc
     // utility: look up interface from getArrivalGate()
     virtual NetworkInterface *getSourceInterfaceFrom(Packet *msg);
 
+    /**
+     * Returns the IPv6 header of the packet. Uses the header recorded in the
+     * NetworkProtocolInd tag at ingress (and kept up to date by
+     * insertNetworkProtocolHeader()) when present, so the header chain is not
+     * re-parsed at every processing step; falls back to peeking the packet.
+     */
+    virtual Ptr<const Ipv6Header> peekIpv6Header(Packet *packet) const;
+
     // utility: show current statistics above the icon
     virtual void refreshDisplay() const override;
 
@@ -0,0 +1,161 @@
+//
+// Copyright (C) 2005 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#include "inet/networklayer/ipv6/Ipv6RouteTrie.h"
+
+#include <algorithm>
+
+#include "inet/networklayer/ipv6/Ipv6Route.h"
+
+namespace inet {
+
+void Ipv6RouteTrie::add(Ipv6Route *route, const RouteComparator& comparator)
+{
+    int prefixLength = route->getPrefixLength();
+    Ipv6Address prefix = route->getDestPrefix().getPrefix(prefixLength);
+    Node **link = &root;
+    while (true) {
+        Node *node = *link;
+        if (node == nullptr) {
+            node = new Node();
+            node->prefix = prefix;
+            node->prefixLength = prefixLength;
+            node->routes.push_back(route);
+            *link = node;
+            return;
+        }
+        int commonLength = std::min(node->prefixLength, prefixLength);
+        if (prefix.getPrefix(commonLength) != node->prefix.getPrefix(commonLength)) {
+            // prefixes diverge before either one ends: split with a branch node
+            // at the first differing bit (which is below commonLength, because
+            // bits beyond the prefix lengths are zero in both stored prefixes)
+            int diff = 0;
+            while (getBit(prefix, diff) == getBit(node->prefix, diff))
+                diff++;
+            Node *branch = new Node();
+            branch->prefix = prefix.getPrefix(diff);
+            branch->prefixLength = diff;
+            branch->children[getBit(node->prefix, diff)] = node;
+            Node *leaf = new Node();
+            leaf->prefix = prefix;
+            leaf->prefixLength = prefixLength;
+            leaf->routes.push_back(route);
+            branch->children[getBit(prefix, diff)] = leaf;
+            *link = branch;
+            return;
+        }
+        if (node->prefixLength == prefixLength) {
+            auto pos = std::upper_bound(node->routes.begin(), node->routes.end(), route, comparator);
+            node->routes.insert(pos, route);
+            return;
+        }
+        if (node->prefixLength < prefixLength)
+            link = &node->children[getBit(prefix, node->prefixLength)];
+        else {
+            // the new prefix is a proper prefix of the node: insert above it
+            Node *parent = new Node();
+            parent->prefix = prefix;
+            parent->prefixLength = prefixLength;
+            parent->routes.push_back(route);
+            parent->children[getBit(node->prefix, prefixLength)] = node;
+            *link = parent;
+            return;
+        }
+    }
+}
+
+void Ipv6RouteTrie::contract(Node *& node)
+{
+    // contract nodes left without routes and with at most one child
+    if (node->routes.empty() && (node->children[0] == nullptr || node->children[1] == nullptr)) {
+        Node *child = node->children[0] != nullptr ? node->children[0] : node->children[1];
+        node->children[0] = node->children[1] = nullptr;
+        delete node;
+        node = child;
+    }
+}
+
+bool Ipv6RouteTrie::removeRecursive(Node *& node, const Ipv6Address& prefix, int prefixLength, Ipv6Route *route)
+{
+    if (node == nullptr || node->prefixLength > prefixLength || prefix.getPrefix(node->prefixLength) != node->prefix)
+        return false;
+    bool removed;
+    if (node->prefixLength == prefixLength) {
+        auto it = std::find(node->routes.begin(), node->routes.end(), route);
+        if (it == node->routes.end())
+            return false;
+        node->routes.erase(it);
+        removed = true;
+    }
+    else
+        removed = removeRecursive(node->children[getBit(prefix, node->prefixLength)], prefix, prefixLength, route);
+    if (removed)
+        contract(node);
+    return removed;
+}
+
+bool Ipv6RouteTrie::removeScan(Node *& node, Ipv6Route *route)
+{
+    if (node == nullptr)
+        return false;
+    auto it = std::find(node->routes.begin(), node->routes.end(), route);
+    bool removed;
+    if (it != node->routes.end()) {
+        node->routes.erase(it);
+        removed = true;
+    }
+    else
+        removed = removeScan(node->children[0], route) || removeScan(node->children[1], route);
+    if (removed)
+        contract(node);
+    return removed;
+}
+
+bool Ipv6RouteTrie::remove(Ipv6Route *route)
+{
+    int prefixLength = route->getPrefixLength();
+    Ipv6Address prefix = route->getDestPrefix().getPrefix(prefixLength);
+    if (removeRecursive(root, prefix, prefixLength, route))
+        return true;
+    // the route may be indexed under an older prefix when its fields were
+    // modified before the routeChanged() notification arrived; fall back to
+    // an exhaustive scan so the index never holds a stale pointer
+    return removeScan(root, route);
+}
+
+Ipv6Route *Ipv6RouteTrie::findBestMatchingRoute(const Ipv6Address& dest, simtime_t now, std::vector<Ipv6Route *>& expiredRoutes) const
+{
+    // collect the nodes along the matching path first, because the best
+    // route may be in an upper node when the deeper ones are all expired
+    Node *matchingNodes[129];
+    int numMatchingNodes = 0;
+    Node *node = root;
+    while (node != nullptr && dest.getPrefix(node->prefixLength) == node->prefix) {
+        matchingNodes[numMatchingNodes++] = node;
+        if (node->prefixLength == 128)
+            break;
+        node = node->children[getBit(dest, node->prefixLength)];
+    }
+    // a deeper node has a longer prefix, so its first unexpired route wins;
+    // expired router advertisement routes shadowing it are collected for
+    // deletion, just like the linear scan of doLongestPrefixMatch() does
+    Ipv6Route *bestRoute = nullptr;
+    for (int i = numMatchingNodes - 1; i >= 0 && bestRoute == nullptr; i--) {
+        for (auto route : matchingNodes[i]->routes) {
+            if (now > route->getExpiryTime() && route->getExpiryTime() != 0) { // since 0 represents infinity.
+                if (route->getSourceType() == IRoute::ROUTER_ADVERTISEMENT)
+                    expiredRoutes.push_back(route);
+            }
+            else {
+                bestRoute = route;
+                break;
+            }
+        }
+    }
+    return bestRoute;
+}
+
+} // namespace inet
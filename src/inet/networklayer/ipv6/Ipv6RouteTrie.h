@@ -0,0 +1,86 @@
+//
+// Copyright (C) 2005 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#ifndef __INET_IPV6ROUTETRIE_H
+#define __INET_IPV6ROUTETRIE_H
+
+#include <functional>
+#include <vector>
+
+#include "inet/common/INETDefs.h"
+#include "inet/networklayer/contract/ipv6/Ipv6Address.h"
+
+namespace inet {
+
+class Ipv6Route;
+
+/**
+ * Longest-prefix-match index over the routes of an Ipv6RoutingTable.
+ *
+ * The routes are organized into a path-compressed binary trie keyed on the
+ * destination prefix, so lookup, insertion and removal all take O(prefix
+ * length) steps independently of the number of routes. Routes sharing the same
+ * prefix are kept in a single trie node, ordered by the same comparator as the
+ * routing table's route list, so the lookup result is identical to the linear
+ * best-match scan.
+ *
+ * The trie does not own the routes; it merely indexes the route list of the
+ * routing table, which remains authoritative for enumeration and ownership.
+ */
+class INET_API Ipv6RouteTrie
+{
+  public:
+    typedef std::function<bool(const Ipv6Route *, const Ipv6Route *)> RouteComparator;
+
+  protected:
+    struct Node {
+        Ipv6Address prefix; // the leading prefixLength bits are valid, the rest are zero
+        int prefixLength = 0;
+        std::vector<Ipv6Route *> routes; // routes with exactly this prefix, best first
+        Node *children[2] = { nullptr, nullptr };
+
+        ~Node() { delete children[0]; delete children[1]; }
+    };
+
+    Node *root = nullptr;
+
+  protected:
+    static int getBit(const Ipv6Address& address, int index) { return (address.words()[index / 32] >> (31 - index % 32)) & 1; }
+
+    bool removeRecursive(Node *& node, const Ipv6Address& prefix, int prefixLength, Ipv6Route *route);
+    bool removeScan(Node *& node, Ipv6Route *route);
+    void contract(Node *& node);
+
+  public:
+    ~Ipv6RouteTrie() { delete root; }
+
+    /**
+     * Inserts the route keyed on its current prefix. Routes with the same
+     * prefix are ordered by the given comparator, best route first.
+     */
+    void add(Ipv6Route *route, const RouteComparator& comparator);
+
+    /**
+     * Removes the route. Looks it up keyed on its current prefix first; falls
+     * back to an exhaustive scan when the fields were already modified
+     * (routeChanged() notifies after the mutation). Returns false if the route
+     * was not found.
+     */
+    bool remove(Ipv6Route *route);
+
+    /**
+     * Returns the best (longest prefix, then lowest rank by the insertion
+     * comparator) unexpired route matching the destination, or nullptr.
+     * Expired router advertisement routes that the equivalent linear scan
+     * would have deleted before reaching the result are collected into
+     * expiredRoutes, in the same order.
+     */
+    Ipv6Route *findBestMatchingRoute(const Ipv6Address& dest, simtime_t now, std::vector<Ipv6Route *>& expiredRoutes) const;
+};
+
+} // namespace inet
+
+#endif
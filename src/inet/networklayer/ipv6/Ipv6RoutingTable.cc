@@ -41,6 +41,7 @@ Ipv6RoutingTable::~Ipv6RoutingTable()
 {
     for (auto& elem : routeList)
         delete elem;
+    delete routeTrie;
 }
 
 Ipv6Route *Ipv6RoutingTable::createNewRoute(Ipv6Address destPrefix, int prefixLength, IRoute::SourceType src)
@@ -58,6 +59,8 @@ void Ipv6RoutingTable::initialize(int stage)
         isrouter = par("isRouter");
         multicastForward = par("multicastForwarding");
         useAdminDist = par("useAdminDist");
+        if (par("useTrieIndex"))
+            routeTrie = new Ipv6RouteTrie();
         WATCH(isrouter);
 
         ift.reference(this, "interfaceTableModule", true);
@@ -449,7 +452,7 @@ const Ipv6Address& Ipv6RoutingTable::lookupDestCache(const Ipv6Address& dest, in
         return Ipv6Address::UNSPECIFIED_ADDRESS;
     }
     DestCacheEntry& entry = it->second;
-    if (entry.expiryTime > 0 && simTime() > entry.expiryTime) {
+    if (entry.generation != destCacheGeneration || (entry.expiryTime > 0 && simTime() > entry.expiryTime)) {
         destCache.erase(it);
         outInterfaceId = -1;
         return Ipv6Address::UNSPECIFIED_ADDRESS;
@@ -463,6 +466,18 @@ const Ipv6Route *Ipv6RoutingTable::doLongestPrefixMatch(const Ipv6Address& dest)
 {
     Enter_Method("doLongestPrefixMatch(%s)", dest.str().c_str());
 
+    if (routeTrie != nullptr) {
+        std::vector<Ipv6Route *> expiredRoutes;
+        Ipv6Route *bestRoute = routeTrie->findBestMatchingRoute(dest, simTime(), expiredRoutes);
+        // the trie reports the expired router advertisement routes the linear
+        // scan below would have deleted on its way to the same result
+        for (auto expiredRoute : expiredRoutes) {
+            EV_INFO << "Expired prefix detected!!" << endl;
+            internalDeleteRoute(find(routeList, expiredRoute)); // TODO update display string
+        }
+        return bestRoute;
+    }
+
     // we'll just stop at the first match, because the table is sorted
     // by prefix lengths and metric (see addRoute())
 
@@ -500,17 +515,23 @@ void Ipv6RoutingTable::updateDestCache(const Ipv6Address& dest, const Ipv6Addres
     entry.nextHopAddr = nextHopAddr;
     entry.interfaceId = interfaceId;
     entry.expiryTime = expiryTime;
+    entry.generation = destCacheGeneration;
 }
 
 void Ipv6RoutingTable::purgeDestCache()
 {
-    destCache.clear();
+    // invalidating the generation counter is equivalent to clearing the map
+    // (lookupDestCache() discards entries of older generations), but it takes
+    // constant time no matter how many destinations are cached
+    destCacheGeneration++;
 }
 
 void Ipv6RoutingTable::purgeDestCacheEntriesToNeighbour(const Ipv6Address& nextHopAddr, int interfaceId)
 {
     for (auto it = destCache.begin(); it != destCache.end();) {
-        if (it->second.interfaceId == interfaceId && it->second.nextHopAddr == nextHopAddr) {
+        if (it->second.generation != destCacheGeneration ||
+            (it->second.interfaceId == interfaceId && it->second.nextHopAddr == nextHopAddr))
+        {
             // move the iterator past this element before removing it
             destCache.erase(it++);
         }
@@ -523,7 +544,7 @@ void Ipv6RoutingTable::purgeDestCacheEntriesToNeighbour(const Ipv6Address& nextH
 void Ipv6RoutingTable::purgeDestCacheForInterfaceId(int interfaceId)
 {
     for (auto it = destCache.begin(); it != destCache.end();) {
-        if (it->second.interfaceId == interfaceId) {
+        if (it->second.generation != destCacheGeneration || it->second.interfaceId == interfaceId) {
             // move the iterator past this element before removing it
             destCache.erase(it++);
         }
@@ -689,12 +710,25 @@ Ipv6Route *Ipv6RoutingTable::removeRoute(Ipv6Route *route)
     return route;
 }
 
+void Ipv6RoutingTable::indexAddRoute(Ipv6Route *route)
+{
+    if (routeTrie != nullptr)
+        routeTrie->add(route, RouteLessThan(*this));
+}
+
+void Ipv6RoutingTable::indexRemoveRoute(Ipv6Route *route)
+{
+    if (routeTrie != nullptr)
+        routeTrie->remove(route);
+}
+
 void Ipv6RoutingTable::internalAddRoute(Ipv6Route *route)
 {
     ASSERT(route->getRoutingTable() == nullptr);
 
     routeList.push_back(route);
     route->setRoutingTable(this);
+    indexAddRoute(route);
 
     // we keep entries sorted by prefix length in routeList, so that we can
     // stop at the first match when doing the longest prefix matching
@@ -707,6 +741,7 @@ Ipv6Route *Ipv6RoutingTable::internalRemoveRoute(Ipv6Route *route)
     if (i != routeList.end()) {
         ASSERT(route->getRoutingTable() == this);
         routeList.erase(i);
+        indexRemoveRoute(route);
         route->setRoutingTable(nullptr);
         return route;
     }
@@ -718,6 +753,7 @@ Ipv6RoutingTable::RouteList::iterator Ipv6RoutingTable::internalDeleteRoute(Rout
     ASSERT(it != routeList.end());
     Ipv6Route *route = *it;
     it = routeList.erase(it);
+    indexRemoveRoute(route);
     emit(routeDeletedSignal, route);
     // TODO purge cache?
     delete route;
@@ -796,6 +832,7 @@ void Ipv6RoutingTable::deleteAllRoutes()
     EV_INFO << "/// Removing all routes from rt6 " << endl;
 
     for (auto& elem : routeList) {
+        indexRemoveRoute(elem);
         emit(routeDeletedSignal, elem);
         delete elem;
     }
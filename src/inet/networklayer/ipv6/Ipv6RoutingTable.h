@@ -15,6 +15,7 @@
 #include "inet/networklayer/contract/IRoutingTable.h"
 #include "inet/networklayer/contract/ipv6/Ipv6Address.h"
 #include "inet/networklayer/ipv6/Ipv6Route.h"
+#include "inet/networklayer/ipv6/Ipv6RouteTrie.h"
 
 namespace inet {
 
@@ -58,17 +59,24 @@ class INET_API Ipv6RoutingTable : public cSimpleModule, public IRoutingTable, pr
         int interfaceId = -1;
         Ipv6Address nextHopAddr;
         simtime_t expiryTime;
+        uint64_t generation = 0; // entries stamped with an older generation than the cache are treated as purged
         // more destination specific data may be added here, e.g. path MTU
     };
     friend std::ostream& operator<<(std::ostream& os, const DestCacheEntry& e);
     typedef std::map<Ipv6Address, DestCacheEntry> DestCache;
     DestCache destCache;
+    // purgeDestCache() just bumps the generation counter instead of clearing the
+    // map; stale entries are discarded lazily when they are next looked up
+    uint64_t destCacheGeneration = 0;
 
     // RouteList contains local prefixes, and (for routers)
     // static, OSPF, RIP etc routes as well
     typedef std::vector<Ipv6Route *> RouteList;
     RouteList routeList;
 
+    // optional longest-prefix-match index over routeList, see the useTrieIndex parameter
+    Ipv6RouteTrie *routeTrie = nullptr;
+
   protected:
     // creates a new empty route, factory method overriden in subclasses that use custom routes
     virtual Ipv6Route *createNewRoute(Ipv6Address destPrefix, int prefixLength, IRoute::SourceType src);
@@ -102,6 +110,10 @@ class INET_API Ipv6RoutingTable : public cSimpleModule, public IRoutingTable, pr
     // internal
     virtual void configureTunnelFromXml(cXMLElement *cfg);
 
+    // maintain the trie index (if enabled) when the route list changes
+    void indexAddRoute(Ipv6Route *route);
+    void indexRemoveRoute(Ipv6Route *route);
+
     void internalAddRoute(Ipv6Route *route);
     Ipv6Route *internalRemoveRoute(Ipv6Route *route);
     RouteList::iterator internalDeleteRoute(RouteList::iterator it);
@@ -39,13 +39,12 @@ bool LibTable::resolveLabel(std::string inInterface, int inLabel,
 {
     bool any = (inInterface.length() == 0);
 
-    for (auto& elem : lib) {
+    auto range = labelIndex.equal_range(inLabel);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto& elem = lib[it->second];
         if (!any && elem.inInterface != inInterface)
             continue;
 
-        if (elem.inLabel != inLabel)
-            continue;
-
         outLabel = elem.outLabel;
         outInterface = elem.outInterface;
         color = elem.color;
@@ -66,12 +65,13 @@ int LibTable::installLibEntry(int inLabel, std::string inInterface, const LabelO
         newItem.outInterface = outInterface;
         newItem.color = color;
         lib.push_back(newItem);
+        labelIndex.emplace(newItem.inLabel, lib.size() - 1);
         return newItem.inLabel;
     }
     else {
-        for (auto& elem : lib) {
-            if (elem.inLabel != inLabel)
-                continue;
+        auto range = labelIndex.equal_range(inLabel);
+        for (auto it = range.first; it != range.second; ++it) {
+            auto& elem = lib[it->second];
 
             elem.inInterface = inInterface;
             elem.outLabel = outLabel;
@@ -91,11 +91,19 @@ void LibTable::removeLibEntry(int inLabel)
             continue;
 
         lib.erase(lib.begin() + i);
+        rebuildLabelIndex();
         return;
     }
     ASSERT(false);
 }
 
+void LibTable::rebuildLabelIndex()
+{
+    labelIndex.clear();
+    for (size_t i = 0; i < lib.size(); i++)
+        labelIndex.emplace(lib[i].inLabel, i);
+}
+
 void LibTable::readTableFromXML(const cXMLElement *libtable)
 {
     using namespace xmlutils;
@@ -146,6 +154,7 @@ void LibTable::readTableFromXML(const cXMLElement *libtable)
         }
 
         lib.push_back(newItem);
+        labelIndex.emplace(newItem.inLabel, lib.size() - 1);
 
         ASSERT(newItem.inLabel > 0);
 
@@ -9,6 +9,7 @@
 #define __INET_LIBTABLE_H
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "inet/networklayer/contract/ipv4/Ipv4Address.h"
@@ -52,6 +53,11 @@ class INET_API LibTable : public cSimpleModule
     int maxLabel;
     std::vector<LibEntry> lib;
 
+    // label-indexed lookup over 'lib', so per-packet label resolution doesn't
+    // scan the whole table; entries with the same inLabel on different input
+    // interfaces are chained; kept in sync by the methods that modify 'lib'
+    std::unordered_multimap<int, size_t> labelIndex;
+
   protected:
     virtual void initialize(int stage) override;
     virtual int numInitStages() const override { return NUM_INIT_STAGES; }
@@ -60,6 +66,9 @@ class INET_API LibTable : public cSimpleModule
     // static configuration
     virtual void readTableFromXML(const cXMLElement *libtable);
 
+    // rebuilds labelIndex from 'lib'; needed after removals shift vector indexes
+    virtual void rebuildLabelIndex();
+
   public:
     // label management
     virtual bool resolveLabel(std::string inInterface, int inLabel,
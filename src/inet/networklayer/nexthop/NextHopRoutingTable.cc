@@ -122,14 +122,17 @@ void NextHopRoutingTable::receiveSignal(cComponent *source, simsignal_t signalID
     // TODO
 }
 
+void NextHopRoutingTable::invalidateCache()
+{
+    routingCache.clear();
+}
+
 void NextHopRoutingTable::routeChanged(NextHopRoute *entry, int fieldCode)
 {
     if (fieldCode == IRoute::F_DESTINATION || fieldCode == IRoute::F_PREFIX_LENGTH || fieldCode == IRoute::F_METRIC) { // our data structures depend on these fields
         entry = internalRemoveRoute(entry);
         ASSERT(entry != nullptr); // failure means inconsistency: route was not found in this routing table
         internalAddRoute(entry);
-
-//        invalidateCache();
     }
     emit(routeChangedSignal, entry); // TODO include fieldCode in the notification
 }
@@ -250,6 +253,10 @@ NextHopRoute *NextHopRoutingTable::findBestMatchingRoute(const L3Address& dest)
 
     // find best match (one with longest prefix)
     // default route has zero prefix length, so (if exists) it'll be selected as last resort
+    auto it = routingCache.find(dest);
+    if (it != routingCache.end())
+        return it->second;
+
     NextHopRoute *bestRoute = nullptr;
     for (auto e : routes) {
 
@@ -258,6 +265,7 @@ NextHopRoute *NextHopRoutingTable::findBestMatchingRoute(const L3Address& dest)
             break;
         }
     }
+    routingCache[dest] = bestRoute;
     return bestRoute;
 }
 
@@ -363,6 +371,8 @@ void NextHopRoutingTable::internalAddRoute(NextHopRoute *route)
     routes.insert(pos, route);
 
     route->setRoutingTable(this);
+
+    invalidateCache();
 }
 
 NextHopRoute *NextHopRoutingTable::internalRemoveRoute(NextHopRoute *route)
@@ -371,6 +381,7 @@ NextHopRoute *NextHopRoutingTable::internalRemoveRoute(NextHopRoute *route)
     if (i != routes.end()) {
         ASSERT(route->getRoutingTableAsGeneric() == this);
         routes.erase(i);
+        invalidateCache();
         return route;
     }
     return nullptr;
@@ -37,6 +37,11 @@ class INET_API NextHopRoutingTable : public cSimpleModule, public IRoutingTable,
     typedef std::vector<NextHopMulticastRoute *> MulticastRouteVector;
     MulticastRouteVector multicastRoutes; // multicast route table, sorted by prefix match order
 
+    // destination -> route cache for findBestMatchingRoute(); a nullptr value
+    // means the last lookup found no matching route
+    typedef std::map<L3Address, NextHopRoute *> RoutingCache;
+    mutable RoutingCache routingCache;
+
   protected:
     virtual int numInitStages() const override { return NUM_INIT_STAGES; }
     virtual void initialize(int stage) override;
@@ -62,6 +67,8 @@ class INET_API NextHopRoutingTable : public cSimpleModule, public IRoutingTable,
 
     static bool routeLessThan(const NextHopRoute *a, const NextHopRoute *b);
 
+    virtual void invalidateCache();
+
     void internalAddRoute(NextHopRoute *route);
     NextHopRoute *internalRemoveRoute(NextHopRoute *route);
 
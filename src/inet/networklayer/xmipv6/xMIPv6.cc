@@ -11,6 +11,8 @@
 
 #include "inet/networklayer/xmipv6/xMIPv6.h"
 
+#include <climits>
+
 #include <algorithm>
 
 #include "inet/common/ModuleAccess.h"
@@ -609,14 +611,9 @@ void xMIPv6::updateBUL(BindingUpdate *bu, const Ipv6Address& dest, const Ipv6Add
 
 xMIPv6::BuTransmitIfEntry *xMIPv6::fetchBUTransmitIfEntry(NetworkInterface *ie, const Ipv6Address& dest)
 {
-    // TODO use STL search algorithm
-    for (auto& elem : transmitIfList) {
-        if (BuTransmitIfEntry *buIfEntry = dynamic_cast<BuTransmitIfEntry *>(elem.second)) {
-            if (buIfEntry->ifEntry->getInterfaceId() == ie->getInterfaceId() && buIfEntry->dest == dest)
-                return buIfEntry;
-        }
-    }
-    return nullptr;
+    // BU timers are keyed on (dest, interface, KEY_BU), so the entry can be looked up directly
+    auto pos = transmitIfList.find(Key(dest, ie->getInterfaceId(), KEY_BU));
+    return pos != transmitIfList.end() ? dynamic_cast<BuTransmitIfEntry *>(pos->second) : nullptr;
 }
 
 void xMIPv6::sendMobilityMessageToIPv6Module(Packet *msg, const Ipv6Address& destAddr,
@@ -2016,7 +2013,10 @@ void xMIPv6::sendBUtoCN(BindingUpdateList::BindingUpdateListEntry& bulEntry, Net
 
 void xMIPv6::processType2RH(Packet *packet, Ipv6RoutingHeader *rh)
 {
-    auto ipv6Header = packet->peekAtFront<Ipv6Header>();
+    // use the header parsed at ingress and recorded in the NetworkProtocolInd tag when present
+    auto ipv6Header = dynamicPtrCast<const Ipv6Header>(findNetworkProtocolHeader(packet));
+    if (ipv6Header == nullptr)
+        ipv6Header = packet->peekAtFront<Ipv6Header>();
 //    EV << "Processing RH2..." << endl;
 
     if (!validateType2RH(*ipv6Header.get(), *rh)) {
@@ -2121,7 +2121,10 @@ bool xMIPv6::validateType2RH(const Ipv6Header& ipv6Header, const Ipv6RoutingHead
 
 void xMIPv6::processHoAOpt(Packet *packet, HomeAddressOption *hoaOpt)
 {
-    auto ipv6Header = packet->peekAtFront<Ipv6Header>();
+    // use the header parsed at ingress and recorded in the NetworkProtocolInd tag when present
+    auto ipv6Header = dynamicPtrCast<const Ipv6Header>(findNetworkProtocolHeader(packet));
+    if (ipv6Header == nullptr)
+        ipv6Header = packet->peekAtFront<Ipv6Header>();
 
     // datagram from MN to CN
     bool validHoAOpt = false;
@@ -2300,9 +2303,12 @@ xMIPv6::TimerIfEntry *xMIPv6::getTimerIfEntry(Key& key, int timerType)
 
 xMIPv6::TimerIfEntry *xMIPv6::searchTimerIfEntry(Ipv6Address& dest, int timerType)
 {
-    for (auto& elem : transmitIfList) {
-        if (elem.first.type == timerType && elem.first.dest == dest)
-            return elem.second;
+    // keys are ordered by type first, so only the entries of this timer type need to be scanned
+    for (auto it = transmitIfList.lower_bound(Key(Ipv6Address::UNSPECIFIED_ADDRESS, INT_MIN, timerType));
+         it != transmitIfList.end() && it->first.type == timerType; ++it)
+    {
+        if (it->first.dest == dest)
+            return it->second;
     }
 
     return nullptr;
@@ -24,8 +24,11 @@ Define_Module(DimensionalMediumAnalogModel);
 void DimensionalMediumAnalogModel::initialize(int stage)
 {
     AnalogModelBase::initialize(stage);
-    if (stage == INITSTAGE_LOCAL)
+    if (stage == INITSTAGE_LOCAL) {
         attenuateWithCenterFrequency = par("attenuateWithCenterFrequency"); // TODO rename center
+        noiseTimeDivision = par("noiseTimeDivision");
+        noiseFrequencyDivision = par("noiseFrequencyDivision");
+    }
 }
 
 std::ostream& DimensionalMediumAnalogModel::printToStream(std::ostream& stream, int level, int evFlags) const
@@ -89,7 +92,12 @@ const INoise *DimensionalMediumAnalogModel::computeNoise(const IListening *liste
         EV_TRACE << *receptionPower << endl;
         EV_TRACE << "Interference power end" << endl;
     }
-    const Ptr<const IFunction<WpHz, Domain<simsec, Hz>>>& noisePower = makeShared<SummedFunction<WpHz, Domain<simsec, Hz>>>(receptionPowers);
+    Ptr<const IFunction<WpHz, Domain<simsec, Hz>>> noisePower = makeShared<SummedFunction<WpHz, Domain<simsec, Hz>>>(receptionPowers);
+    // flatten the sum of the interfering signals into a contiguous array of
+    // constant valued cells, so that subsequent SNIR queries iterate over the
+    // grid instead of recursing into all interfering power functions
+    if (noiseTimeDivision > 0 && noiseFrequencyDivision > 0)
+        noisePower = makeShared<Sampled2DFunction<WpHz, simsec, Hz>>(simsec(listening->getStartTime()), simsec(listening->getEndTime()), noiseTimeDivision, centerFrequency - bandwidth / 2, centerFrequency + bandwidth / 2, noiseFrequencyDivision, noisePower);
     EV_TRACE << "Noise power begin " << endl;
     EV_TRACE << *noisePower << endl;
     EV_TRACE << "Noise power end" << endl;
@@ -22,6 +22,8 @@ class INET_API DimensionalMediumAnalogModel : public AnalogModelBase
 {
   protected:
     bool attenuateWithCenterFrequency = false;
+    int noiseTimeDivision = 0;
+    int noiseFrequencyDivision = 0;
 
   protected:
     virtual void initialize(int stage) override;
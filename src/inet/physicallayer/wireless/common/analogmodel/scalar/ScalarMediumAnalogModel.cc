@@ -26,8 +26,10 @@ Define_Module(ScalarMediumAnalogModel);
 void ScalarMediumAnalogModel::initialize(int stage)
 {
     AnalogModelBase::initialize(stage);
-    if (stage == INITSTAGE_LOCAL)
+    if (stage == INITSTAGE_LOCAL) {
         ignorePartialInterference = par("ignorePartialInterference");
+        cachePathLoss = par("cachePathLoss");
+    }
 }
 
 std::ostream& ScalarMediumAnalogModel::printToStream(std::ostream& stream, int level, int evFlags) const
@@ -44,6 +46,31 @@ bool ScalarMediumAnalogModel::areOverlappingBands(Hz centerFrequency1, Hz bandwi
            centerFrequency1 - bandwidth1 / 2 <= centerFrequency2 + bandwidth2 / 2;
 }
 
+double ScalarMediumAnalogModel::computePathLoss(const IRadioMedium *radioMedium, const IRadio *receiverRadio, const ITransmission *transmission, const IArrival *arrival, Hz centerFrequency) const
+{
+    if (!cachePathLoss)
+        return radioMedium->getPathLoss()->computePathLoss(transmission, arrival);
+    auto communicationCache = const_cast<ICommunicationCache *>(radioMedium->getCommunicationCache());
+    // the cache is shared between all receiver radios, so the accesses must be
+    // serialized when the receptions are computed concurrently (e.g.
+    // RadioMedium.parallelReceptionComputation); racing workers may compute
+    // the same deterministic path loss twice, but never corrupt the cache
+    double pathLoss;
+    bool found;
+#ifdef _OPENMP
+#pragma omp critical(inetPathLossCache)
+#endif
+    found = communicationCache->getCachedPathLoss(receiverRadio, transmission, arrival, centerFrequency, pathLoss);
+    if (!found) {
+        pathLoss = radioMedium->getPathLoss()->computePathLoss(transmission, arrival);
+#ifdef _OPENMP
+#pragma omp critical(inetPathLossCache)
+#endif
+        communicationCache->setCachedPathLoss(receiverRadio, transmission, arrival, centerFrequency, pathLoss);
+    }
+    return pathLoss;
+}
+
 W ScalarMediumAnalogModel::computeReceptionPower(const IRadio *receiverRadio, const ITransmission *transmission, const IArrival *arrival) const
 {
     const IRadioMedium *radioMedium = receiverRadio->getMedium();
@@ -52,7 +79,7 @@ W ScalarMediumAnalogModel::computeReceptionPower(const IRadio *receiverRadio, co
     // TODO could be used for doppler shift? const Coord& receptionEndPosition = arrival->getEndPosition();
     double transmitterAntennaGain = computeAntennaGain(transmission->getTransmitterAntennaGain(), transmission->getStartPosition(), arrival->getStartPosition(), transmission->getStartOrientation());
     double receiverAntennaGain = computeAntennaGain(receiverRadio->getAntenna()->getGain().get(), arrival->getStartPosition(), transmission->getStartPosition(), arrival->getStartOrientation());
-    double pathLoss = radioMedium->getPathLoss()->computePathLoss(transmission, arrival);
+    double pathLoss = computePathLoss(radioMedium, receiverRadio, transmission, arrival, analogModel->getCenterFrequency());
     double obstacleLoss = radioMedium->getObstacleLoss() ? radioMedium->getObstacleLoss()->computeObstacleLoss(analogModel->getCenterFrequency(), transmission->getStartPosition(), receptionStartPosition) : 1;
     W transmissionPower = analogModel->getPower();
     ASSERT(!std::isnan(transmissionPower.get()));
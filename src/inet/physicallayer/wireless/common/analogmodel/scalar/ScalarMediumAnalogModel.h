@@ -19,12 +19,14 @@ class INET_API ScalarMediumAnalogModel : public AnalogModelBase
 {
   protected:
     bool ignorePartialInterference = false;
+    bool cachePathLoss = false;
 
   protected:
     virtual int numInitStages() const override { return NUM_INIT_STAGES; }
     virtual void initialize(int stage) override;
 
     virtual bool areOverlappingBands(Hz centerFrequency1, Hz bandwidth1, Hz centerFrequency2, Hz bandwidth2) const;
+    virtual double computePathLoss(const IRadioMedium *radioMedium, const IRadio *receiverRadio, const ITransmission *transmission, const IArrival *arrival, Hz centerFrequency) const;
     virtual void addReception(const IReception *reception, simtime_t& noiseStartTime, simtime_t& noiseEndTime, std::map<simtime_t, W>& powerChanges) const;
     virtual void addNoise(const ScalarNoise *noise, simtime_t& noiseStartTime, simtime_t& noiseEndTime, std::map<simtime_t, W>& powerChanges) const;
 
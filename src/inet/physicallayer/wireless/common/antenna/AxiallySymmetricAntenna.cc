@@ -40,6 +40,7 @@ AxiallySymmetricAntenna::AntennaGain::AntennaGain(const char *axis, double baseG
     maxGain(NaN)
 {
     axisOfSymmetryDirection = Coord::parse(axis);
+    std::map<rad, double> gainMap;
     cStringTokenizer tokenizer(gains);
     while (tokenizer.hasMoreTokens()) {
         const char *angleString = tokenizer.nextToken();
@@ -58,18 +59,20 @@ AxiallySymmetricAntenna::AntennaGain::AntennaGain(const char *axis, double baseG
         throw cRuntimeError("The first angle must be 0");
     if (!containsKey(gainMap, deg(180)))
         throw cRuntimeError("The last angle must be 180");
+    gainTable.assign(gainMap.begin(), gainMap.end());
 }
 
 double AxiallySymmetricAntenna::AntennaGain::computeGain(const Quaternion& direction) const
 {
     double product = math::minnan(1.0, math::maxnan(-1.0, direction.rotate(Coord::X_AXIS) * Coord::X_AXIS));
     rad angle = rad(std::acos(product));
-    // NOTE: 0 and M_PI are always in the map
-    std::map<rad, double>::const_iterator lowerBound = gainMap.lower_bound(angle);
-    std::map<rad, double>::const_iterator upperBound = gainMap.upper_bound(angle);
-    if (lowerBound->first != angle)
+    // NOTE: 0 and M_PI are always in the table
+    auto lowerBound = std::lower_bound(gainTable.begin(), gainTable.end(), angle,
+            [] (const std::pair<rad, double>& entry, rad angle) { return entry.first < angle; });
+    auto upperBound = (lowerBound != gainTable.end() && lowerBound->first == angle) ? lowerBound + 1 : lowerBound;
+    if (lowerBound == gainTable.end() || lowerBound->first != angle)
         lowerBound--;
-    if (upperBound == gainMap.end())
+    if (upperBound == gainTable.end())
         upperBound--;
     if (upperBound == lowerBound)
         return lowerBound->second;
@@ -22,7 +22,7 @@ class INET_API AxiallySymmetricAntenna : public AntennaBase
         double minGain = NaN;
         double maxGain = NaN;
         Coord axisOfSymmetryDirection = Coord::NIL;
-        std::map<rad, double> gainMap;
+        std::vector<std::pair<rad, double>> gainTable; // gain by angle, sorted by angle for binary search
 
       public:
         AntennaGain(const char *axis, double baseGain, const char *gains);
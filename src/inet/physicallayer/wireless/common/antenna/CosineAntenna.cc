@@ -38,13 +38,13 @@ std::ostream& CosineAntenna::printToStream(std::ostream& stream, int level, int
 }
 
 CosineAntenna::AntennaGain::AntennaGain(double maxGain, deg beamWidth) :
-    maxGain(maxGain), beamWidth(beamWidth)
+    maxGain(maxGain), beamWidth(beamWidth),
+    exponent(-3.0 / (20 * std::log10(std::cos(math::deg2rad(beamWidth.get()) / 4.0))))
 {
 }
 
 double CosineAntenna::AntennaGain::computeGain(const Quaternion& direction) const
 {
-    double exponent = -3.0 / (20 * std::log10(std::cos(math::deg2rad(beamWidth.get()) / 4.0)));
     double product = math::minnan(1.0, math::maxnan(-1.0, direction.rotate(Coord::X_AXIS) * Coord::X_AXIS));
     double angle = std::acos(product);
     return maxGain * std::pow(std::abs(std::cos(angle / 2.0)), exponent);
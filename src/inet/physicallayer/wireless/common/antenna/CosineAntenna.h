@@ -30,6 +30,7 @@ class INET_API CosineAntenna : public AntennaBase
       protected:
         double maxGain;
         deg beamWidth;
+        double exponent; // derived from the beam width once, it's needed for every gain computation
     };
 
     Ptr<AntennaGain> gain;
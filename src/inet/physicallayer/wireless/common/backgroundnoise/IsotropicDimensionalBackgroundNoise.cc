@@ -50,21 +50,21 @@ const INoise *IsotropicDimensionalBackgroundNoise::computeNoise(const IListening
     const BandListening *bandListening = check_and_cast<const BandListening *>(listening);
     Hz centerFrequency = bandListening->getCenterFrequency();
     Hz listeningBandwidth = bandListening->getBandwidth();
-    WpHz noisePowerSpectralDensity;
-    if (!std::isnan(powerSpectralDensity.get()))
-        noisePowerSpectralDensity = powerSpectralDensity;
-    else {
+    if (std::isnan(powerSpectralDensity.get())) {
         if (std::isnan(bandwidth.get()))
             bandwidth = listeningBandwidth;
         else if (bandwidth != listeningBandwidth)
             throw cRuntimeError("The powerSpectralDensity parameter is not specified and the power parameter cannot be used, because background noise bandwidth doesn't match listening bandwidth");
+    }
+    if (powerFunction == nullptr) {
         // NOTE: dividing by the bandwidth here makes sure the total background noise power in the listening band is the given power
-        noisePowerSpectralDensity = power / bandwidth;
+        WpHz noisePowerSpectralDensity = !std::isnan(powerSpectralDensity.get()) ? powerSpectralDensity : power / bandwidth;
+        // the power spectral density function is immutable and independent of the listening, build it only once
+        powerFunction = makeFirstQuadrantLimitedFunction<WpHz, Domain<simsec, Hz>>(makeShared<ConstantFunction<WpHz, Domain<simsec, Hz>>>(noisePowerSpectralDensity));
     }
-    const Ptr<const IFunction<WpHz, Domain<simsec, Hz>>>& powerFunction = makeShared<ConstantFunction<WpHz, Domain<simsec, Hz>>>(noisePowerSpectralDensity);
     const simtime_t startTime = listening->getStartTime();
     const simtime_t endTime = listening->getEndTime();
-    return new DimensionalNoise(startTime, endTime, centerFrequency, bandwidth, makeFirstQuadrantLimitedFunction(powerFunction));
+    return new DimensionalNoise(startTime, endTime, centerFrequency, bandwidth, powerFunction);
 }
 
 } // namespace physicallayer
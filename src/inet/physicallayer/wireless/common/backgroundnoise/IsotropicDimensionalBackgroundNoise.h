@@ -8,6 +8,7 @@
 #ifndef __INET_ISOTROPICDIMENSIONALBACKGROUNDNOISE_H
 #define __INET_ISOTROPICDIMENSIONALBACKGROUNDNOISE_H
 
+#include "inet/common/math/IFunction.h"
 #include "inet/physicallayer/wireless/common/contract/packetlevel/IBackgroundNoise.h"
 
 namespace inet {
@@ -20,6 +21,7 @@ class INET_API IsotropicDimensionalBackgroundNoise : public cModule, public IBac
     WpHz powerSpectralDensity = WpHz(NaN);
     W power = W(NaN);
     mutable Hz bandwidth = Hz(NaN);
+    mutable Ptr<const math::IFunction<WpHz, math::Domain<simsec, Hz>>> powerFunction; // interned, the power spectral density is the same for all listenings
 
   protected:
     virtual void initialize(int stage) override;
@@ -69,6 +69,11 @@ const ApskSymbol *ApskModulationBase::mapToConstellationDiagram(const ShortBitVe
 
 ShortBitVector ApskModulationBase::demapToBitRepresentation(const ApskSymbol *symbol) const
 {
+    // fast path: both the modulator and the layered error models produce symbols
+    // pointing into the constellation diagram, for those the index is immediate
+    const ApskSymbol *constellationBegin = constellation->data();
+    if (symbol >= constellationBegin && symbol < constellationBegin + constellationSize)
+        return ShortBitVector(symbol - constellationBegin, codeWordSize);
     // TODO Complete implementation: http://eprints.soton.ac.uk/354719/1/tvt-hanzo-2272640-proof.pdf
     double symbolQ = symbol->real();
     double symbolI = symbol->imag();
@@ -282,15 +282,24 @@ std::vector<const ITransmission *> *CommunicationCacheBase::computeInterferingTr
     RadioCacheEntry *radioCacheEntry = getRadioCacheEntry(radio);
     std::vector<const ITransmission *> *interferingTransmissions = new std::vector<const ITransmission *>();
     if (radioCacheEntry->receptionIntervals != nullptr) {
-        std::deque<const IntervalTree::Interval *> interferingIntervals = radioCacheEntry->receptionIntervals->query(startTime, endTime);
-        for (auto interferingInterval : interferingIntervals) {
+        radioCacheEntry->receptionIntervals->query(startTime, endTime, [&] (const IntervalTree::Interval *interferingInterval) {
             const ITransmission *interferingTransmission = (ITransmission *)interferingInterval->value;
             interferingTransmissions->push_back(interferingTransmission);
-        }
+        });
     }
     return interferingTransmissions;
 }
 
+void CommunicationCacheBase::mapInterferingTransmissions(const IRadio *radio, const simtime_t startTime, const simtime_t endTime, std::function<void(const ITransmission *)> f)
+{
+    RadioCacheEntry *radioCacheEntry = getRadioCacheEntry(radio);
+    if (radioCacheEntry->receptionIntervals != nullptr) {
+        radioCacheEntry->receptionIntervals->query(startTime, endTime, [&] (const IntervalTree::Interval *interferingInterval) {
+            f((ITransmission *)interferingInterval->value);
+        });
+    }
+}
+
 const simtime_t CommunicationCacheBase::getCachedInterferenceEndTime(const ITransmission *transmission)
 {
     return getTransmissionCacheEntry(transmission)->interferenceEndTime;
@@ -552,6 +561,40 @@ void CommunicationCacheBase::removeCachedSignal(const IRadio *receiver, const IT
         cacheEntry->signal = nullptr;
 }
 
+bool CommunicationCacheBase::getCachedPathLoss(const IRadio *receiver, const ITransmission *transmission, const IArrival *arrival, Hz centerFrequency, double& pathLoss)
+{
+    auto it = pathLossCache.find(std::make_pair(transmission->getTransmitterRadioId(), receiver->getId()));
+    if (it == pathLossCache.end())
+        return false;
+    // the cached value is only valid while neither radio moved and the center frequency is unchanged
+    const PathLossCacheEntry& cacheEntry = it->second;
+    if (cacheEntry.transmissionPosition != transmission->getStartPosition() ||
+        cacheEntry.receptionPosition != arrival->getStartPosition() ||
+        cacheEntry.centerFrequency != centerFrequency)
+        return false;
+    pathLoss = cacheEntry.pathLoss;
+    return true;
+}
+
+void CommunicationCacheBase::setCachedPathLoss(const IRadio *receiver, const ITransmission *transmission, const IArrival *arrival, Hz centerFrequency, double pathLoss)
+{
+    PathLossCacheEntry& cacheEntry = pathLossCache[std::make_pair(transmission->getTransmitterRadioId(), receiver->getId())];
+    cacheEntry.transmissionPosition = transmission->getStartPosition();
+    cacheEntry.receptionPosition = arrival->getStartPosition();
+    cacheEntry.centerFrequency = centerFrequency;
+    cacheEntry.pathLoss = pathLoss;
+}
+
+void CommunicationCacheBase::removeCachedPathLoss(const IRadio *radio)
+{
+    int radioId = radio->getId();
+    for (auto it = pathLossCache.begin(); it != pathLossCache.end(); )
+        if (it->first.first == radioId || it->first.second == radioId)
+            it = pathLossCache.erase(it);
+        else
+            ++it;
+}
+
 } // namespace physicallayer
 
 } // namespace inet
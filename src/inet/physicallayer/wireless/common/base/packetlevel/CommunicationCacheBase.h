@@ -107,6 +107,24 @@ class INET_API CommunicationCacheBase : public cModule, public ICommunicationCac
         virtual void deleteSignal();
     };
 
+    /**
+     * Caches the path loss computed for a pair of radios along with the
+     * positions and the center frequency it was computed for.
+     */
+    class INET_API PathLossCacheEntry {
+      public:
+        Coord transmissionPosition = Coord::NIL;
+        Coord receptionPosition = Coord::NIL;
+        Hz centerFrequency = Hz(NaN);
+        double pathLoss = NaN;
+    };
+
+  protected:
+    /**
+     * Maps transmitter and receiver radio id pairs to cached path loss values.
+     */
+    std::map<std::pair<int, int>, PathLossCacheEntry> pathLossCache;
+
   protected:
     /** @name Cache data structures */
     //@{
@@ -129,6 +147,7 @@ class INET_API CommunicationCacheBase : public cModule, public ICommunicationCac
     /** @name Interference cache */
     //@{
     virtual std::vector<const ITransmission *> *computeInterferingTransmissions(const IRadio *radio, const simtime_t startTime, const simtime_t endTime) override;
+    virtual void mapInterferingTransmissions(const IRadio *radio, const simtime_t startTime, const simtime_t endTime, std::function<void(const ITransmission *)> f) override;
 
     virtual const simtime_t getCachedInterferenceEndTime(const ITransmission *transmission) override;
     virtual void setCachedInterferenceEndTime(const ITransmission *transmission, const simtime_t interferenceEndTime) override;
@@ -181,6 +200,13 @@ class INET_API CommunicationCacheBase : public cModule, public ICommunicationCac
     virtual void setCachedSignal(const IRadio *receiver, const ITransmission *transmission, const IWirelessSignal *signal) override;
     virtual void removeCachedSignal(const IRadio *receiver, const ITransmission *transmission) override;
     //@}
+
+    /** @name Path loss cache */
+    //@{
+    virtual bool getCachedPathLoss(const IRadio *receiver, const ITransmission *transmission, const IArrival *arrival, Hz centerFrequency, double& pathLoss) override;
+    virtual void setCachedPathLoss(const IRadio *receiver, const ITransmission *transmission, const IArrival *arrival, Hz centerFrequency, double pathLoss) override;
+    virtual void removeCachedPathLoss(const IRadio *radio) override;
+    //@}
 };
 
 } // namespace physicallayer
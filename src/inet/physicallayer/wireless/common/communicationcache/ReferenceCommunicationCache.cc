@@ -136,6 +136,18 @@ std::vector<const ITransmission *> *ReferenceCommunicationCache::computeInterfer
     return interferingTransmissions;
 }
 
+void ReferenceCommunicationCache::mapInterferingTransmissions(const IRadio *radio, const simtime_t startTime, const simtime_t endTime, std::function<void(const ITransmission *)> f)
+{
+    // NOTE: ignore receptionIntervals to test that it doesn't affect simulation results
+    for (const auto& transmissionCacheEntry : transmissionCache) {
+        auto receptionCacheEntries = transmissionCacheEntry.receptionCacheEntries;
+        auto& receptionCacheEntry = receptionCacheEntries->at(radio->getId());
+        const IArrival *arrival = receptionCacheEntry.arrival;
+        if (arrival != nullptr && !(arrival->getEndTime() < startTime || endTime < arrival->getStartTime()))
+            f(transmissionCacheEntry.transmission);
+    }
+}
+
 } // namespace physicallayer
 } // namespace inet
 
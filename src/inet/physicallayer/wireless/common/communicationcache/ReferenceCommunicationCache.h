@@ -67,6 +67,7 @@ class INET_API ReferenceCommunicationCache : public CommunicationCacheBase
     //@{
     virtual void removeNonInterferingTransmissions(std::function<void(const ITransmission *transmission)> f) override;
     virtual std::vector<const ITransmission *> *computeInterferingTransmissions(const IRadio *radio, const simtime_t startTime, const simtime_t endTime) override;
+    virtual void mapInterferingTransmissions(const IRadio *radio, const simtime_t startTime, const simtime_t endTime, std::function<void(const ITransmission *)> f) override;
     //@}
 
     /** @name Reception cache */
@@ -51,6 +51,12 @@ class INET_API ICommunicationCache : public virtual IPrintableObject
     /** @name Interference cache */
     //@{
     virtual std::vector<const ITransmission *> *computeInterferingTransmissions(const IRadio *radio, const simtime_t startTime, const simtime_t endTime) = 0;
+    /**
+     * Calls f for all transmissions whose reception interval at the given radio
+     * overlaps the [startTime, endTime] interval, without building an
+     * intermediate result vector.
+     */
+    virtual void mapInterferingTransmissions(const IRadio *radio, const simtime_t startTime, const simtime_t endTime, std::function<void(const ITransmission *)> f) = 0;
     virtual void removeNonInterferingTransmissions(std::function<void(const ITransmission *transmission)> f) = 0;
 
     virtual const simtime_t getCachedInterferenceEndTime(const ITransmission *transmission) = 0;
@@ -104,6 +110,18 @@ class INET_API ICommunicationCache : public virtual IPrintableObject
     virtual void setCachedSignal(const IRadio *receiver, const ITransmission *transmission, const IWirelessSignal *signal) = 0;
     virtual void removeCachedSignal(const IRadio *receiver, const ITransmission *transmission) = 0;
     //@}
+
+    /** @name Path loss cache */
+    //@{
+    /**
+     * Returns true and fills in pathLoss if a path loss value computed for the
+     * same transmitter/receiver radio pair at the same positions and center
+     * frequency is cached, false otherwise.
+     */
+    virtual bool getCachedPathLoss(const IRadio *receiver, const ITransmission *transmission, const IArrival *arrival, Hz centerFrequency, double& pathLoss) = 0;
+    virtual void setCachedPathLoss(const IRadio *receiver, const ITransmission *transmission, const IArrival *arrival, Hz centerFrequency, double pathLoss) = 0;
+    virtual void removeCachedPathLoss(const IRadio *radio) = 0;
+    //@}
 };
 
 } // namespace physicallayer
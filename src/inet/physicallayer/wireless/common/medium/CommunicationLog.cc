@@ -14,6 +14,8 @@ namespace physicallayer {
 
 void CommunicationLog::open()
 {
+    buffer.resize(1 << 16);
+    output.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
     output.open(getActiveSimulationOrEnvir()->getConfig()->substituteVariables("${resultdir}/${configname}-${runnumber}.tlog"));
 }
 
@@ -29,7 +31,7 @@ void CommunicationLog::writeTransmission(const IRadio *transmitter, const IWirel
     output << "T " << transmitterRadio->getFullPath() << " " << transmitterRadio->getId() << " "
            << "M " << check_and_cast<const WirelessSignal *>(signal)->getName() << " " << transmission->getId() << " "
            << "S " << transmission->getStartTime() << " " << transmission->getStartPosition() << " -> "
-           << "E " << transmission->getEndTime() << " " << transmission->getEndPosition() << endl;
+           << "E " << transmission->getEndTime() << " " << transmission->getEndPosition() << "\n"; // no endl: flushing after every record is costly
 }
 
 void CommunicationLog::writeReception(const IRadio *receiver, const IWirelessSignal *signal)
@@ -40,7 +42,7 @@ void CommunicationLog::writeReception(const IRadio *receiver, const IWirelessSig
     output << "R " << receiverRadio->getFullPath() << " " << reception->getReceiverRadio()->getId() << " "
            << "M " << check_and_cast<const WirelessSignal *>(signal)->getName() << " " << transmission->getId() << " "
            << "S " << reception->getStartTime() << " " << reception->getStartPosition() << " -> "
-           << "E " << reception->getEndTime() << " " << reception->getEndPosition() << endl;
+           << "E " << reception->getEndTime() << " " << reception->getEndPosition() << "\n";
 }
 
 } // namespace physicallayer
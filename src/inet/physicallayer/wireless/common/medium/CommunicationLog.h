@@ -9,6 +9,7 @@
 #define __INET_COMMUNICATIONLOG_H
 
 #include <fstream>
+#include <vector>
 
 #include "inet/physicallayer/wireless/common/contract/packetlevel/IReceptionDecision.h"
 #include "inet/physicallayer/wireless/common/contract/packetlevel/ITransmission.h"
@@ -20,6 +21,7 @@ namespace physicallayer {
 class INET_API CommunicationLog
 {
   protected:
+    std::vector<char> buffer; // stream buffer large enough that record writes don't hit the OS one line at a time
     std::ofstream output;
 
   public:
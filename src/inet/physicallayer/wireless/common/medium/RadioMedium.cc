@@ -15,6 +15,8 @@
 #include "inet/linklayer/common/MacAddressTag_m.h"
 #include "inet/networklayer/common/NetworkInterface.h"
 #include "inet/networklayer/contract/IInterfaceTable.h"
+#include "inet/physicallayer/wireless/common/analogmodel/unitdisk/UnitDiskTransmissionAnalogModel.h"
+#include "inet/physicallayer/wireless/common/radio/packetlevel/BandListening.h"
 #include "inet/physicallayer/wireless/common/radio/packetlevel/Radio.h"
 #include "inet/physicallayer/wireless/common/signal/Interference.h"
 
@@ -35,14 +37,17 @@ RadioMedium::RadioMedium() :
     radioModeFilter(false),
     listeningFilter(false),
     macAddressFilter(false),
+    pruneOutOfRangeReceivers(false),
     recordTransmissionLog(false),
     recordReceptionLog(false),
+    parallelReceptionComputation(false),
     removeNonInterferingTransmissionsTimer(nullptr),
     mediumLimitCache(nullptr),
     neighborCache(nullptr),
     communicationCache(nullptr),
     transmissionCount(0),
     signalSendCount(0),
+    prunedReceiverCount(0),
     receptionComputationCount(0),
     interferenceComputationCount(0),
     receptionDecisionComputationCount(0),
@@ -91,11 +96,15 @@ void RadioMedium::initialize(int stage)
             rangeFilter = RANGE_FILTER_INTERFERENCE_RANGE;
         else if (!strcmp(rangeFilterString, "communicationRange"))
             rangeFilter = RANGE_FILTER_COMMUNICATION_RANGE;
+        else if (!strcmp(rangeFilterString, "detectionRange"))
+            rangeFilter = RANGE_FILTER_DETECTION_RANGE;
         else
             throw cRuntimeError("Unknown range filter: '%d'", rangeFilter);
         radioModeFilter = par("radioModeFilter");
         listeningFilter = par("listeningFilter");
         macAddressFilter = par("macAddressFilter");
+        pruneOutOfRangeReceivers = par("pruneOutOfRangeReceivers");
+        parallelReceptionComputation = par("parallelReceptionComputation");
         // initialize timers
         removeNonInterferingTransmissionsTimer = new cMessage("removeNonInterferingTransmissions");
         // initialize logging
@@ -118,6 +127,7 @@ void RadioMedium::finish()
     double resultCacheHitPercentage = 100 * (double)cacheResultHitCount / (double)cacheResultGetCount;
     EV_INFO << "Transmission count = " << transmissionCount << endl;
     EV_INFO << "Signal send count = " << signalSendCount << endl;
+    EV_INFO << "Pruned receiver count = " << prunedReceiverCount << endl;
     EV_INFO << "Reception computation count = " << receptionComputationCount << endl;
     EV_INFO << "Interference computation count = " << interferenceComputationCount << endl;
     EV_INFO << "Reception decision computation count = " << receptionDecisionComputationCount << endl;
@@ -130,6 +140,7 @@ void RadioMedium::finish()
     EV_INFO << "Reception result cache hit = " << resultCacheHitPercentage << " %" << endl;
     recordScalar("transmission count", transmissionCount);
     recordScalar("signal send count", signalSendCount);
+    recordScalar("pruned receiver count", prunedReceiverCount);
     recordScalar("reception computation count", receptionComputationCount);
     recordScalar("interference computation count", interferenceComputationCount);
     recordScalar("reception decision computation count", receptionDecisionComputationCount);
@@ -200,6 +211,27 @@ bool RadioMedium::isInInterferenceRange(const ITransmission *transmission, const
             transmission->getEndPosition().distance(endPosition) < maxInterferenceRange.get());
 }
 
+bool RadioMedium::isInDetectionRange(const ITransmission *transmission, const Coord& startPosition, const Coord& endPosition) const
+{
+    auto unitDiskAnalogModel = dynamic_cast<const UnitDiskTransmissionAnalogModel *>(transmission->getAnalogModel());
+    if (unitDiskAnalogModel == nullptr)
+        return true;
+    m detectionRange = unitDiskAnalogModel->getDetectionRange();
+    return std::isnan(detectionRange.get()) ||
+           (transmission->getStartPosition().distance(startPosition) < detectionRange.get() &&
+            transmission->getEndPosition().distance(endPosition) < detectionRange.get());
+}
+
+bool RadioMedium::isOutOfInterferenceRange(const IRadio *transmitter, const ITransmission *transmission, const IRadio *receiver) const
+{
+    m maxInterferenceRange = mediumLimitCache->getMaxInterferenceRange(transmitter);
+    if (std::isnan(maxInterferenceRange.get()))
+        return false;
+    Coord receiverPosition = receiver->getAntenna()->getMobility()->getCurrentPosition();
+    return transmission->getStartPosition().distance(receiverPosition) > maxInterferenceRange.get() &&
+           transmission->getEndPosition().distance(receiverPosition) > maxInterferenceRange.get();
+}
+
 bool RadioMedium::isInterferingTransmission(const ITransmission *transmission, const IListening *listening) const
 {
     const IRadio *receiver = listening->getReceiverRadio();
@@ -237,12 +269,11 @@ void RadioMedium::removeNonInterferingTransmissions()
 const std::vector<const IReception *> *RadioMedium::computeInterferingReceptions(const IListening *listening) const
 {
     const IRadio *radio = listening->getReceiverRadio();
-    std::vector<const ITransmission *> *interferingTransmissions = communicationCache->computeInterferingTransmissions(radio, listening->getStartTime(), listening->getEndTime());
     std::vector<const IReception *> *interferingReceptions = new std::vector<const IReception *>();
-    for (const auto interferingTransmission : *interferingTransmissions)
+    communicationCache->mapInterferingTransmissions(radio, listening->getStartTime(), listening->getEndTime(), [&] (const ITransmission *interferingTransmission) {
         if (isInterferingTransmission(interferingTransmission, listening))
             interferingReceptions->push_back(getReception(radio, interferingTransmission));
-    delete interferingTransmissions;
+    });
     return interferingReceptions;
 }
 
@@ -250,12 +281,11 @@ const std::vector<const IReception *> *RadioMedium::computeInterferingReceptions
 {
     const IRadio *radio = reception->getReceiverRadio();
     const ITransmission *transmission = reception->getTransmission();
-    std::vector<const ITransmission *> *interferingTransmissions = communicationCache->computeInterferingTransmissions(radio, reception->getStartTime(), reception->getEndTime());
     std::vector<const IReception *> *interferingReceptions = new std::vector<const IReception *>();
-    for (const auto interferingTransmission : *interferingTransmissions)
+    communicationCache->mapInterferingTransmissions(radio, reception->getStartTime(), reception->getEndTime(), [&] (const ITransmission *interferingTransmission) {
         if (transmission != interferingTransmission && isInterferingTransmission(interferingTransmission, reception))
             interferingReceptions->push_back(getReception(radio, interferingTransmission));
-    delete interferingTransmissions;
+    });
     return interferingReceptions;
 }
 
@@ -437,6 +467,7 @@ void RadioMedium::addRadio(const IRadio *radio)
 void RadioMedium::removeRadio(const IRadio *radio)
 {
     Enter_Method("removeRadio");
+    communicationCache->removeCachedPathLoss(radio);
     communicationCache->removeRadio(radio);
     if (neighborCache)
         neighborCache->removeRadio(radio);
@@ -464,6 +495,10 @@ void RadioMedium::addTransmission(const IRadio *transmitterRadio, const ITransmi
     simtime_t maxArrivalEndTime = transmission->getEndTime();
     communicationCache->mapRadios([&] (const IRadio *receiverRadio) {
         if (receiverRadio != nullptr && receiverRadio != transmitterRadio && receiverRadio->getReceiver() != nullptr) {
+            if (pruneOutOfRangeReceivers && isOutOfInterferenceRange(transmitterRadio, transmission, receiverRadio)) {
+                prunedReceiverCount++;
+                return;
+            }
             const IArrival *arrival = propagation->computeArrival(transmission, receiverRadio->getAntenna()->getMobility());
             const IntervalTree::Interval *interval = new IntervalTree::Interval(arrival->getStartTime(), arrival->getEndTime(), (void *)transmission);
             const IListening *listening = receiverRadio->getReceiver()->createListening(receiverRadio, arrival->getStartTime(), arrival->getEndTime(), arrival->getStartPosition(), arrival->getEndPosition());
@@ -476,6 +511,31 @@ void RadioMedium::addTransmission(const IRadio *transmitterRadio, const ITransmi
         }
     });
     communicationCache->setCachedInterferenceEndTime(transmission, maxArrivalEndTime + mediumLimitCache->getMaxTransmissionDuration());
+    if (parallelReceptionComputation) {
+        // the transmission and the cached arrivals are immutable at this
+        // point, the chunk reference counting is atomic in OpenMP builds and
+        // the shared path loss cache serializes its accesses, so the
+        // receptions of the affected radios can be computed concurrently; the
+        // results are stored on the simulation thread after the loop to keep
+        // the communication cache single threaded
+        std::vector<const IRadio *> receiverRadios;
+        communicationCache->mapRadios([&] (const IRadio *receiverRadio) {
+            if (receiverRadio != nullptr && receiverRadio != transmitterRadio && receiverRadio->getReceiver() != nullptr &&
+                communicationCache->getCachedArrival(receiverRadio, transmission) != nullptr)
+            {
+                receiverRadios.push_back(receiverRadio);
+            }
+        });
+        std::vector<const IReception *> receptions(receiverRadios.size());
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int i = 0; i < (int)receiverRadios.size(); i++)
+            receptions[i] = analogModel->computeReception(receiverRadios[i], transmission, getArrival(receiverRadios[i], transmission));
+        for (int i = 0; i < (int)receiverRadios.size(); i++)
+            communicationCache->setCachedReception(receiverRadios[i], transmission, receptions[i]);
+        receptionComputationCount += receiverRadios.size();
+    }
     if (!removeNonInterferingTransmissionsTimer->isScheduled())
         scheduleAt(communicationCache->getCachedInterferenceEndTime(transmission), removeNonInterferingTransmissionsTimer);
     emit(signalAddedSignal, check_and_cast<const cObject *>(transmission));
@@ -529,7 +589,9 @@ void RadioMedium::sendToAffectedRadios(IRadio *radio, const IWirelessSignal *tra
     const WirelessSignal *signal = check_and_cast<const WirelessSignal *>(transmittedSignal);
     EV_DEBUG << "Sending " << transmittedSignal << " with " << signal->getBitLength() << " bits in " << signal->getDuration() * 1E+6 << " us transmission duration"
              << " from " << radio << " on " << (IRadioMedium *)this << "." << endl;
-    if (neighborCache && rangeFilter != RANGE_FILTER_ANYWHERE) {
+    // the detection range is per transmission, so it has no aggregated maximum for the
+    // neighbor cache; those signals are filtered per radio in isPotentialReceiver()
+    if (neighborCache && rangeFilter != RANGE_FILTER_ANYWHERE && rangeFilter != RANGE_FILTER_DETECTION_RANGE) {
         double range;
         if (rangeFilter == RANGE_FILTER_COMMUNICATION_RANGE)
             range = mediumLimitCache->getMaxCommunicationRange(radio).get();
@@ -612,6 +674,9 @@ const IListeningDecision *RadioMedium::listenOnMedium(const IRadio *radio, const
 
 bool RadioMedium::isPotentialReceiver(const IRadio *radio, const ITransmission *transmission) const
 {
+    // pruned receivers have no cached arrival, interval or listening for the transmission
+    if (pruneOutOfRangeReceivers && communicationCache->getCachedArrival(radio, transmission) == nullptr)
+        return false;
     const Radio *receiverRadio = dynamic_cast<const Radio *>(radio);
     if (radioModeFilter && receiverRadio != nullptr && receiverRadio->getRadioMode() != IRadio::RADIO_MODE_RECEIVER && receiverRadio->getRadioMode() != IRadio::RADIO_MODE_TRANSCEIVER)
         return false;
@@ -628,6 +693,10 @@ bool RadioMedium::isPotentialReceiver(const IRadio *radio, const ITransmission *
         const IArrival *arrival = getArrival(radio, transmission);
         return isInCommunicationRange(transmission, arrival->getStartPosition(), arrival->getEndPosition());
     }
+    else if (rangeFilter == RANGE_FILTER_DETECTION_RANGE) {
+        const IArrival *arrival = getArrival(radio, transmission);
+        return isInDetectionRange(transmission, arrival->getStartPosition(), arrival->getEndPosition());
+    }
     else
         return true;
 }
@@ -715,9 +784,31 @@ void RadioMedium::receiveSignal(cComponent *source, simsignal_t signal, intval_t
     else if (signal == IRadio::listeningChangedSignal) {
         Enter_Method("listeningChanged");
         auto radio = check_and_cast<Radio *>(source);
+        // The listening often doesn't actually change with the notification (e.g. only
+        // the transmitter was reconfigured). The cached listenings of the radio were all
+        // created with the current receiver parameters, and the listening times and
+        // positions come from the cached arrivals, which are unaffected. Therefore it's
+        // enough to compare the listened band once, and the recreation of all cached
+        // listenings can be skipped when it is unchanged.
+        bool compared = false;
+        bool changed = false;
         communicationCache->mapTransmissions([&] (const ITransmission *transmission) {
+            if (compared && !changed)
+                return;
             const IArrival *arrival = getArrival(radio, transmission);
             const IListening *listening = radio->getReceiver()->createListening(radio, arrival->getStartTime(), arrival->getEndTime(), arrival->getStartPosition(), arrival->getEndPosition());
+            if (!compared) {
+                compared = true;
+                auto cachedBandListening = dynamic_cast<const BandListening *>(communicationCache->getCachedListening(radio, transmission));
+                auto newBandListening = dynamic_cast<const BandListening *>(listening);
+                changed = cachedBandListening == nullptr || newBandListening == nullptr ||
+                    cachedBandListening->getCenterFrequency() != newBandListening->getCenterFrequency() ||
+                    cachedBandListening->getBandwidth() != newBandListening->getBandwidth();
+                if (!changed) {
+                    delete listening;
+                    return;
+                }
+            }
             delete communicationCache->getCachedListening(radio, transmission);
             communicationCache->setCachedListening(radio, transmission, listening);
         });
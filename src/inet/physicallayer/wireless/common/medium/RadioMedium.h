@@ -37,6 +37,7 @@ class INET_API RadioMedium : public cSimpleModule, public cListener, public IRad
         RANGE_FILTER_ANYWHERE,
         RANGE_FILTER_INTERFERENCE_RANGE,
         RANGE_FILTER_COMMUNICATION_RANGE,
+        RANGE_FILTER_DETECTION_RANGE,
     };
 
   protected:
@@ -91,6 +92,12 @@ class INET_API RadioMedium : public cSimpleModule, public cListener, public IRad
      * the mac address of the destination is different.
      */
     bool macAddressFilter;
+    /**
+     * True means radios outside the maximum interference range of the
+     * transmitter are pruned when a transmission is added to the medium,
+     * so no arrival, listening or reception objects are created for them.
+     */
+    bool pruneOutOfRangeReceivers;
     /**
      * Records all transmissions (if recordTransmissionLog is enabled) and receptions (if recordReceptionLog is enabled) into a separate trace file.
      * The communication log file can be found at:
@@ -98,6 +105,11 @@ class INET_API RadioMedium : public cSimpleModule, public cListener, public IRad
      */
     bool recordTransmissionLog;
     bool recordReceptionLog;
+    /**
+     * True means the receptions of all affected radios are computed eagerly
+     * and concurrently when a transmission is added to the medium.
+     */
+    bool parallelReceptionComputation;
     //@}
 
     /** @name Timer */
@@ -142,6 +154,10 @@ class INET_API RadioMedium : public cSimpleModule, public cListener, public IRad
      * Total number of signal sends.
      */
     mutable long signalSendCount;
+    /**
+     * Total number of receivers pruned by the interference range precheck.
+     */
+    mutable long prunedReceiverCount;
     /**
      * Total number of reception computations.
      */
@@ -274,6 +290,22 @@ class INET_API RadioMedium : public cSimpleModule, public cListener, public IRad
     virtual bool isInCommunicationRange(const ITransmission *transmission, const Coord& startPosition, const Coord& endPosition) const;
     virtual bool isInInterferenceRange(const ITransmission *transmission, const Coord& startPosition, const Coord& endPosition) const;
 
+    /**
+     * Returns true unless the transmission carries a unit disk analog model
+     * and the receiver is beyond its detection range, where the signal has
+     * no effect at all. Exact for the unit disk analog model, always true
+     * for other analog models.
+     */
+    virtual bool isInDetectionRange(const ITransmission *transmission, const Coord& startPosition, const Coord& endPosition) const;
+
+    /**
+     * Returns true if the receiver is farther from the transmission than the
+     * maximum interference range of the transmitter (derived by the medium
+     * limit cache from the maximum transmission power, the minimum interference
+     * power and the path loss model), so no medium state needs to be kept for it.
+     */
+    virtual bool isOutOfInterferenceRange(const IRadio *transmitter, const ITransmission *transmission, const IRadio *receiver) const;
+
     virtual bool isInterferingTransmission(const ITransmission *transmission, const IListening *listening) const;
     virtual bool isInterferingTransmission(const ITransmission *transmission, const IReception *reception) const;
 
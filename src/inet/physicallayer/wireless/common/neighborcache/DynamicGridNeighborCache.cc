@@ -0,0 +1,172 @@
+//
+// Copyright (C) 2026 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#include "inet/physicallayer/wireless/common/neighborcache/DynamicGridNeighborCache.h"
+
+#include "inet/common/ModuleAccess.h"
+#include "inet/common/stlutils.h"
+
+namespace inet {
+namespace physicallayer {
+
+Define_Module(DynamicGridNeighborCache);
+
+DynamicGridNeighborCache::DynamicGridNeighborCache() :
+    grid(nullptr),
+    constraintAreaMin(Coord::NIL),
+    constraintAreaMax(Coord::NIL),
+    rangeMargin(NaN),
+    cellSize(Coord::NIL),
+    lazyGridUpdates(false)
+{
+}
+
+void DynamicGridNeighborCache::initialize(int stage)
+{
+    if (stage == INITSTAGE_LOCAL) {
+        radioMedium.reference(this, "radioMediumModule", true);
+        cellSize.x = par("cellSizeX");
+        cellSize.y = par("cellSizeY");
+        cellSize.z = par("cellSizeZ");
+        rangeMargin = par("rangeMargin");
+        lazyGridUpdates = par("lazyGridUpdates");
+        getSimulation()->getSystemModule()->subscribe(IMobility::mobilityStateChangedSignal, this);
+    }
+    else if (stage == INITSTAGE_PHYSICAL_LAYER_NEIGHBOR_CACHE) {
+        constraintAreaMin = radioMedium->getMediumLimitCache()->getMinConstraintArea();
+        constraintAreaMax = radioMedium->getMediumLimitCache()->getMaxConstraintArea();
+        const Coord constraintAreaSize = constraintAreaMax - constraintAreaMin;
+        if (std::isnan(cellSize.x))
+            cellSize.x = constraintAreaSize.x / par("cellCountX").doubleValue();
+        if (std::isnan(cellSize.y))
+            cellSize.y = constraintAreaSize.y / par("cellCountY").doubleValue();
+        if (std::isnan(cellSize.z))
+            cellSize.z = constraintAreaSize.z / par("cellCountZ").doubleValue();
+        fillGrid();
+    }
+}
+
+void DynamicGridNeighborCache::handleMessage(cMessage *msg)
+{
+    throw cRuntimeError("This module doesn't handle messages");
+}
+
+std::ostream& DynamicGridNeighborCache::printToStream(std::ostream& stream, int level, int evFlags) const
+{
+    stream << "DynamicGridNeighborCache";
+    if (level <= PRINT_LEVEL_TRACE)
+        stream << EV_FIELD(cellSize)
+               << EV_FIELD(rangeMargin);
+    return stream;
+}
+
+void DynamicGridNeighborCache::fillGrid()
+{
+    delete grid;
+    dirtyMobilities.clear();
+    grid = new SpatialGrid(cellSize, constraintAreaMin, constraintAreaMax);
+    for (auto& elem : radios) {
+        const IRadio *radio = elem;
+        Coord radioPos = radio->getAntenna()->getMobility()->getCurrentPosition();
+        grid->insertPoint(check_and_cast<const cObject *>(radio), radioPos);
+    }
+}
+
+void DynamicGridNeighborCache::addRadio(const IRadio *radio)
+{
+    radios.push_back(radio);
+    radiosByMobility.insert(std::make_pair(radio->getAntenna()->getMobility(), radio));
+    Coord newConstraintAreaMin = radioMedium->getMediumLimitCache()->getMinConstraintArea();
+    Coord newConstraintAreaMax = radioMedium->getMediumLimitCache()->getMaxConstraintArea();
+    // If the constraintArea changed we must rebuild the grid
+    if (newConstraintAreaMin != constraintAreaMin || newConstraintAreaMax != constraintAreaMax) {
+        constraintAreaMin = newConstraintAreaMin;
+        constraintAreaMax = newConstraintAreaMax;
+        if (initialized())
+            fillGrid();
+    }
+    else if (initialized())
+        grid->insertPoint(check_and_cast<const cObject *>(radio), radio->getAntenna()->getMobility()->getCurrentPosition());
+}
+
+void DynamicGridNeighborCache::removeRadio(const IRadio *radio)
+{
+    auto it = find(radios, radio);
+    if (it != radios.end()) {
+        radios.erase(it);
+        for (auto jt = radiosByMobility.begin(); jt != radiosByMobility.end(); )
+            if (jt->second == radio)
+                jt = radiosByMobility.erase(jt);
+            else
+                ++jt;
+        Coord newConstraintAreaMin = radioMedium->getMediumLimitCache()->getMinConstraintArea();
+        Coord newConstraintAreaMax = radioMedium->getMediumLimitCache()->getMaxConstraintArea();
+        if (newConstraintAreaMin != constraintAreaMin || newConstraintAreaMax != constraintAreaMax) {
+            constraintAreaMin = newConstraintAreaMin;
+            constraintAreaMax = newConstraintAreaMax;
+            fillGrid();
+        }
+        else if (grid != nullptr)
+            grid->removePoint(check_and_cast<const cObject *>(radio));
+    }
+    else {
+        throw cRuntimeError("You can't remove radio: %d because it is not in our radio vector", radio->getId());
+    }
+}
+
+void DynamicGridNeighborCache::updateDirtyPoints() const
+{
+    for (auto mobility : dirtyMobilities) {
+        auto range = radiosByMobility.equal_range(mobility);
+        for (auto it = range.first; it != range.second; ++it)
+            grid->movePoint(check_and_cast<const cObject *>(it->second), mobility->getCurrentPosition());
+    }
+    dirtyMobilities.clear();
+}
+
+void DynamicGridNeighborCache::sendToNeighbors(IRadio *transmitter, const IWirelessSignal *signal, double range) const
+{
+    updateDirtyPoints();
+    double radius = range + rangeMargin;
+    Coord transmitterPos = transmitter->getAntenna()->getMobility()->getCurrentPosition();
+    DynamicGridNeighborCacheVisitor visitor(radioMedium, transmitter, signal);
+    grid->rangeQuery(transmitterPos, radius, &visitor);
+}
+
+void DynamicGridNeighborCache::receiveSignal(cComponent *source, simsignal_t signal, cObject *object, cObject *details)
+{
+    Enter_Method("%s", cComponent::getSignalName(signal));
+    if (signal == IMobility::mobilityStateChangedSignal) {
+        auto mobility = check_and_cast<IMobility *>(object);
+        if (grid == nullptr)
+            return;
+        if (lazyGridUpdates)
+            // coalesce the position updates into a single cell move per radio
+            // right before the next neighbor query
+            dirtyMobilities.insert(mobility);
+        else {
+            auto range = radiosByMobility.equal_range(mobility);
+            for (auto it = range.first; it != range.second; ++it)
+                grid->movePoint(check_and_cast<const cObject *>(it->second), mobility->getCurrentPosition());
+        }
+    }
+}
+
+void DynamicGridNeighborCache::DynamicGridNeighborCacheVisitor::visit(const cObject *radio) const
+{
+    const IRadio *neighbor = check_and_cast<const IRadio *>(radio);
+    if (transmitter->getId() != neighbor->getId())
+        radioMedium->sendToRadio(transmitter, neighbor, signal);
+}
+
+DynamicGridNeighborCache::~DynamicGridNeighborCache()
+{
+    delete grid;
+}
+
+} // namespace physicallayer
+} // namespace inet
@@ -0,0 +1,75 @@
+//
+// Copyright (C) 2026 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#ifndef __INET_DYNAMICGRIDNEIGHBORCACHE_H
+#define __INET_DYNAMICGRIDNEIGHBORCACHE_H
+
+#include <set>
+
+#include "inet/common/ModuleRefByPar.h"
+#include "inet/common/geometry/container/SpatialGrid.h"
+#include "inet/mobility/contract/IMobility.h"
+#include "inet/physicallayer/wireless/common/medium/RadioMedium.h"
+
+namespace inet {
+namespace physicallayer {
+
+class INET_API DynamicGridNeighborCache : public cSimpleModule, public cListener, public INeighborCache
+{
+  public:
+    typedef std::vector<const IRadio *> Radios;
+
+  protected:
+    class INET_API DynamicGridNeighborCacheVisitor : public IVisitor {
+      protected:
+        RadioMedium *radioMedium;
+        IRadio *transmitter;
+        const IWirelessSignal *signal;
+
+      public:
+        void visit(const cObject *radio) const override;
+        DynamicGridNeighborCacheVisitor(RadioMedium *radioMedium, IRadio *transmitter, const IWirelessSignal *signal) :
+            radioMedium(radioMedium), transmitter(transmitter), signal(signal) {}
+    };
+
+  protected:
+    SpatialGrid *grid;
+    Radios radios;
+    std::multimap<const IMobility *, const IRadio *> radiosByMobility;
+    ModuleRefByPar<RadioMedium> radioMedium;
+    Coord constraintAreaMin, constraintAreaMax;
+    double rangeMargin;
+    Coord cellSize;
+    bool lazyGridUpdates;
+    // mobilities that moved since the grid was last brought up to date; only
+    // used when lazyGridUpdates is enabled
+    mutable std::set<const IMobility *> dirtyMobilities;
+
+  protected:
+    virtual int numInitStages() const override { return NUM_INIT_STAGES; }
+    virtual void initialize(int stage) override;
+    virtual void handleMessage(cMessage *msg) override;
+    void fillGrid();
+    void updateDirtyPoints() const;
+
+  public:
+    DynamicGridNeighborCache();
+    virtual ~DynamicGridNeighborCache();
+
+    virtual std::ostream& printToStream(std::ostream& stream, int level, int evFlags = 0) const override;
+
+    virtual void addRadio(const IRadio *radio) override;
+    virtual void removeRadio(const IRadio *radio) override;
+    virtual void sendToNeighbors(IRadio *transmitter, const IWirelessSignal *signal, double range) const override;
+
+    virtual void receiveSignal(cComponent *source, simsignal_t signal, cObject *object, cObject *details) override;
+};
+
+} // namespace physicallayer
+} // namespace inet
+
+#endif
@@ -22,7 +22,10 @@ Define_Module(FreeSpacePathLoss);
 
 FreeSpacePathLoss::FreeSpacePathLoss() :
     alpha(2.0),
-    systemLoss(1.0)
+    systemLoss(1.0),
+    tabulatePathLoss(false),
+    pathLossTableSize(0),
+    tabulatedMaxDistance(m(NaN))
 {
 }
 
@@ -31,6 +34,9 @@ void FreeSpacePathLoss::initialize(int stage)
     if (stage == INITSTAGE_LOCAL) {
         alpha = par("alpha");
         systemLoss = math::dB2fraction(par("systemLoss"));
+        tabulatePathLoss = par("tabulatePathLoss");
+        pathLossTableSize = par("pathLossTableSize");
+        tabulatedMaxDistance = m(par("tabulatedMaxDistance"));
     }
 }
 
@@ -45,10 +51,37 @@ std::ostream& FreeSpacePathLoss::printToStream(std::ostream& stream, int level,
 
 double FreeSpacePathLoss::computeFreeSpacePathLoss(m waveLength, m distance, double alpha, double systemLoss) const
 {
+    if (tabulatePathLoss) {
+        double d = distance.get();
+        double step = tabulatedMaxDistance.get() / pathLossTableSize;
+        // distances below one table step or beyond the sampled range are computed exactly,
+        // because the path loss changes too steeply near the transmitter to interpolate
+        if (d >= step && d < tabulatedMaxDistance.get()) {
+            const std::vector<double>& table = getPathLossTable(waveLength, alpha, systemLoss);
+            double position = d / step;
+            int index = (int)position;
+            double fraction = position - index;
+            return table[index] * (1 - fraction) + table[index + 1] * fraction;
+        }
+    }
     // factor = waveLength ^ 2 / (16 * PI ^ 2 * systemLoss * distance ^ alpha)
     return distance.get() == 0.0 ? 1.0 : (waveLength * waveLength).get() / (16 * M_PI * M_PI * systemLoss * pow(distance.get(), alpha));
 }
 
+const std::vector<double>& FreeSpacePathLoss::getPathLossTable(m waveLength, double alpha, double systemLoss) const
+{
+    std::vector<double>& table = pathLossTables[waveLength.get()];
+    if (table.empty()) {
+        table.resize(pathLossTableSize + 1);
+        double step = tabulatedMaxDistance.get() / pathLossTableSize;
+        for (int i = 0; i <= pathLossTableSize; i++) {
+            double distance = i * step;
+            table[i] = distance == 0.0 ? 1.0 : (waveLength * waveLength).get() / (16 * M_PI * M_PI * systemLoss * pow(distance, alpha));
+        }
+    }
+    return table;
+}
+
 double FreeSpacePathLoss::computePathLoss(mps propagationSpeed, Hz frequency, m distance) const
 {
     m waveLength = propagationSpeed / frequency;
@@ -15,6 +15,9 @@
 #ifndef __INET_FREESPACEPATHLOSS_H
 #define __INET_FREESPACEPATHLOSS_H
 
+#include <map>
+#include <vector>
+
 #include "inet/physicallayer/wireless/common/base/packetlevel/PathLossBase.h"
 
 namespace inet {
@@ -31,10 +34,15 @@ class INET_API FreeSpacePathLoss : public PathLossBase
   protected:
     double alpha;
     double systemLoss;
+    bool tabulatePathLoss;
+    int pathLossTableSize;
+    m tabulatedMaxDistance;
+    mutable std::map<double, std::vector<double>> pathLossTables; // distance sampled path loss tables indexed by wave length
 
   protected:
     virtual void initialize(int stage) override;
     virtual double computeFreeSpacePathLoss(m waveLength, m distance, double alpha, double systemLoss) const;
+    virtual const std::vector<double>& getPathLossTable(m waveLength, double alpha, double systemLoss) const;
 
   public:
     FreeSpacePathLoss();
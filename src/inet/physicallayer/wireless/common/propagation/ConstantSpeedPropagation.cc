@@ -57,6 +57,28 @@ const IArrival *ConstantSpeedPropagation::computeArrival(const ITransmission *tr
     arrivalComputationCount++;
     const simtime_t startTime = transmission->getStartTime();
     const simtime_t endTime = transmission->getEndTime();
+    if (ignoreMovementDuringPropagation && ignoreMovementDuringReception && mobility->getMaxSpeed() == 0) {
+        // the arrival position, orientation and propagation time are the same for
+        // all transmissions between a fixed transmitter position and a stationary
+        // receiver, so the mobility queries and the distance computation can be
+        // done once per (transmitter, receiver) pair
+        auto key = std::make_pair(transmission->getTransmitterRadioId(), (const IMobility *)mobility);
+        auto it = arrivalCache.find(key);
+        if (it == arrivalCache.end() || it->second.transmissionStartPosition != transmission->getStartPosition()) {
+            CachedArrival cachedArrival;
+            cachedArrival.transmissionStartPosition = transmission->getStartPosition();
+            cachedArrival.arrivalPosition = mobility->getCurrentPosition();
+            cachedArrival.arrivalOrientation = mobility->getCurrentAngularPosition();
+            cachedArrival.propagationTime = cachedArrival.transmissionStartPosition.distance(cachedArrival.arrivalPosition) / propagationSpeed.get();
+            it = arrivalCache.insert(std::make_pair(key, cachedArrival)).first;
+        }
+        const auto& cachedArrival = it->second;
+        return new Arrival(cachedArrival.propagationTime, cachedArrival.propagationTime,
+                startTime + cachedArrival.propagationTime, endTime + cachedArrival.propagationTime,
+                transmission->getPreambleDuration(), transmission->getHeaderDuration(), transmission->getDataDuration(),
+                cachedArrival.arrivalPosition, cachedArrival.arrivalPosition,
+                cachedArrival.arrivalOrientation, cachedArrival.arrivalOrientation);
+    }
     const Coord& startPosition = transmission->getStartPosition();
     const Coord& endPosition = transmission->getEndPosition();
     const Coord& startArrivalPosition = ignoreMovementDuringPropagation ? mobility->getCurrentPosition() : computeArrivalPosition(startTime, startPosition, mobility);
@@ -8,6 +8,8 @@
 #ifndef __INET_CONSTANTSPEEDPROPAGATION_H
 #define __INET_CONSTANTSPEEDPROPAGATION_H
 
+#include <map>
+
 #include "inet/physicallayer/wireless/common/base/packetlevel/PropagationBase.h"
 
 namespace inet {
@@ -17,10 +19,23 @@ namespace physicallayer {
 class INET_API ConstantSpeedPropagation : public PropagationBase
 {
   protected:
+    struct CachedArrival {
+        Coord transmissionStartPosition; // the entry is valid for this transmitter position only
+        Coord arrivalPosition;
+        Quaternion arrivalOrientation;
+        simtime_t propagationTime;
+    };
+
     bool ignoreMovementDuringTransmission;
     bool ignoreMovementDuringPropagation;
     bool ignoreMovementDuringReception;
 
+    // cached arrival data for stationary receivers (zero maximum speed), keyed
+    // by transmitter radio id and receiver mobility; entries are validated
+    // against the transmission start position, so a moving transmitter
+    // invalidates them automatically
+    mutable std::map<std::pair<int, const IMobility *>, CachedArrival> arrivalCache;
+
   protected:
     virtual void initialize(int stage) override;
     virtual const Coord computeArrivalPosition(const simtime_t startTime, const Coord& startPosition, IMobility *mobility) const;
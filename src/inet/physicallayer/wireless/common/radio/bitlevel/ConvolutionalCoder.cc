@@ -191,6 +191,7 @@ void ConvolutionalCoder::initParameters()
     computeOutputAndInputSymbols();
     computeStateTransitions();
     computeDecimalToOutputSymbolVector();
+    computeStateTransitionLists();
     computeHammingDistanceLookupTable();
 }
 
@@ -356,6 +357,22 @@ void ConvolutionalCoder::printTransferFunctionMatrix() const
     }
 }
 
+void ConvolutionalCoder::computeStateTransitionLists()
+{
+    // flatten the sparse inputSymbols table into per-state transition lists, preserving
+    // the scan order (and thus the tie breaking RNG sequence) of updateTrellisGraph()
+    stateTransitionLists.resize(numberOfStates);
+    for (int state = 0; state < numberOfStates; state++) {
+        for (int j = 0; j < numberOfOutputSymbols; j++) {
+            int inputSymbol = inputSymbols[state][j];
+            if (inputSymbol != -1) {
+                int outputSymbolDec = decimalToOutputSymbol[j].toDecimal();
+                stateTransitionLists[state].push_back(StateTransition{outputSymbolDec, inputSymbol, stateTransitions[state][inputSymbol]});
+            }
+        }
+    }
+}
+
 void ConvolutionalCoder::computeDecimalToOutputSymbolVector()
 {
     for (int i = 0; i != numberOfOutputSymbols; i++) {
@@ -367,39 +384,40 @@ void ConvolutionalCoder::computeDecimalToOutputSymbolVector()
 void ConvolutionalCoder::updateTrellisGraph(TrellisGraphNode **trellisGraph, unsigned int time, const ShortBitVector& outputSymbol, const ShortBitVector& excludedFromHammingDistance) const
 {
     int tieBreakingCounter = 0;
+    // hoist the loop invariant Hamming distance lookup table indices, they involve bit loops
+    const unsigned char *const *hammingDistances = hammingDistanceLookupTable[outputSymbol.toDecimal()];
+    int excludedBitsDec = excludedFromHammingDistance.toDecimal();
     for (int prevState = 0; prevState != numberOfStates; prevState++) {
         const TrellisGraphNode& node = trellisGraph[prevState][time];
-        for (int j = 0; j != numberOfOutputSymbols && node.state != -1; j++) {
-            int feasibleDecodedSymbol = inputSymbols[prevState][j];
-            if (feasibleDecodedSymbol != -1) {
-                const ShortBitVector& otherOutputSymbol = decimalToOutputSymbol[j];
-                int hammingDistance = computeHammingDistance(outputSymbol, excludedFromHammingDistance, otherOutputSymbol);
-                int newState = stateTransitions[prevState][feasibleDecodedSymbol];
-                int cumulativeHammingDistance = hammingDistance;
-                if (node.comulativeHammingDistance != INT32_MAX)
-                    cumulativeHammingDistance += node.comulativeHammingDistance;
-                TrellisGraphNode& best = trellisGraph[newState][time + 1];
-                bool replace = false;
-                if (cumulativeHammingDistance == best.comulativeHammingDistance) {
-                    tieBreakingCounter++;
-                    if (RNGCONTEXT dblrand() < 1.0 / tieBreakingCounter)
-                        replace = true;
-                }
-                else if (cumulativeHammingDistance < best.comulativeHammingDistance) {
-                    tieBreakingCounter = 0;
+        if (node.state == -1)
+            continue;
+        for (const auto& transition : stateTransitionLists[prevState]) {
+            int hammingDistance = hammingDistances[transition.outputSymbolDec][excludedBitsDec];
+            int newState = transition.nextState;
+            int cumulativeHammingDistance = hammingDistance;
+            if (node.comulativeHammingDistance != INT32_MAX)
+                cumulativeHammingDistance += node.comulativeHammingDistance;
+            TrellisGraphNode& best = trellisGraph[newState][time + 1];
+            bool replace = false;
+            if (cumulativeHammingDistance == best.comulativeHammingDistance) {
+                tieBreakingCounter++;
+                if (RNGCONTEXT dblrand() < 1.0 / tieBreakingCounter)
                     replace = true;
-                }
-                if (replace) {
-                    best.state = newState;
-                    best.prevState = prevState;
-                    best.depth = node.depth + 1;
-                    best.comulativeHammingDistance = cumulativeHammingDistance;
-                    if (hammingDistance > 0)
-                        best.numberOfErrors = node.numberOfErrors + 1;
-                    else
-                        best.numberOfErrors = node.numberOfErrors;
-                    best.symbol = feasibleDecodedSymbol;
-                }
+            }
+            else if (cumulativeHammingDistance < best.comulativeHammingDistance) {
+                tieBreakingCounter = 0;
+                replace = true;
+            }
+            if (replace) {
+                best.state = newState;
+                best.prevState = prevState;
+                best.depth = node.depth + 1;
+                best.comulativeHammingDistance = cumulativeHammingDistance;
+                if (hammingDistance > 0)
+                    best.numberOfErrors = node.numberOfErrors + 1;
+                else
+                    best.numberOfErrors = node.numberOfErrors;
+                best.symbol = transition.inputSymbol;
             }
         }
     }
@@ -70,6 +70,13 @@ class INET_API ConvolutionalCoder : public IFecCoder
     ShortBitVector *decimalToOutputSymbol; // maps an outputSymbol (in decimal) to its ShortBitVector representation
     int **stateTransitions; // maps a (state, inputSymbol) pair to the corresponding next state
     unsigned char ***hammingDistanceLookupTable; // lookup table for Hamming distances, the three dimensions are: [outputSymbol, outputSymbol, excludedBits]
+
+    struct StateTransition {
+        int outputSymbolDec; // the output symbol of this transition, as a Hamming distance lookup table index
+        int inputSymbol; // the input symbol of this transition (in decimal)
+        int nextState; // the state this transition leads to
+    };
+    std::vector<std::vector<StateTransition>> stateTransitionLists; // per-state compact list of the feasible transitions, in the same order as the inputSymbols scan
     std::vector<std::vector<TrellisGraphNode>> trellisGraph; // the decoder's trellis graph
     const ConvolutionalCode *convolutionalCode; // this info class holds information related to this encoder
 
@@ -103,6 +110,7 @@ class INET_API ConvolutionalCoder : public IFecCoder
     void computeNumberOfStates();
     void computeNumberOfInputAndOutputSymbols();
     void computeStateTransitions();
+    void computeStateTransitionLists();
     void computeOutputAndInputSymbols();
     void computeDecimalToOutputSymbolVector();
     void printStateTransitions() const;
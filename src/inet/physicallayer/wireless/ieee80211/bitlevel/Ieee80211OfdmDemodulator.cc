@@ -30,21 +30,17 @@ std::ostream& Ieee80211OfdmDemodulator::printToStream(std::ostream& stream, int
     return stream;
 }
 
-BitVector Ieee80211OfdmDemodulator::demodulateSymbol(const Ieee80211OfdmSymbol *signalSymbol) const
+void Ieee80211OfdmDemodulator::demodulateSymbol(const Ieee80211OfdmSymbol *signalSymbol, const ApskModulationBase *demodulationScheme, BitVector& bitRepresentation) const
 {
-    std::vector<const ApskSymbol *> apskSymbols = signalSymbol->getSubCarrierSymbols();
-    const ApskModulationBase *demodulationScheme = subcarrierModulation->getSubcarrierModulation();
-    BitVector field;
+    const std::vector<const ApskSymbol *>& apskSymbols = signalSymbol->getSubCarrierSymbols();
     for (unsigned int i = 0; i < apskSymbols.size(); i++) {
         if (!isPilotOrDcSubcarrier(i)) {
             const ApskSymbol *apskSymbol = apskSymbols.at(i);
             ShortBitVector bits = demodulationScheme->demapToBitRepresentation(apskSymbol);
             for (unsigned int j = 0; j < bits.getSize(); j++)
-                field.appendBit(bits.getBit(j));
+                bitRepresentation.appendBit(bits.getBit(j));
         }
     }
-    EV_DEBUG << "The field symbols has been demodulated into the following bit stream: " << field << endl;
-    return field;
 }
 
 const IReceptionBitModel *Ieee80211OfdmDemodulator::createBitModel(const BitVector *bitRepresentation, int signalFieldLength, bps signalFieldBitrate, int dataFieldLength, bps dataFieldBitrate) const
@@ -60,13 +56,16 @@ bool Ieee80211OfdmDemodulator::isPilotOrDcSubcarrier(int i) const
 const IReceptionBitModel *Ieee80211OfdmDemodulator::demodulate(const IReceptionSymbolModel *symbolModel) const
 {
     const std::vector<const ISymbol *> *symbols = symbolModel->getAllSymbols();
+    const ApskModulationBase *demodulationScheme = subcarrierModulation->getSubcarrierModulation();
+    // demodulate the whole frame in one pass, appending the bits of each symbol
+    // directly into the frame level bit representation
     BitVector *bitRepresentation = new BitVector();
     for (auto& symbols_i : *symbols) {
         const Ieee80211OfdmSymbol *symbol = dynamic_cast<const Ieee80211OfdmSymbol *>(symbols_i);
-        BitVector bits = demodulateSymbol(symbol);
-        for (unsigned int j = 0; j < bits.getSize(); j++)
-            bitRepresentation->appendBit(bits.getBit(j));
+        demodulateSymbol(symbol, demodulationScheme, *bitRepresentation);
     }
+    if (bitRepresentation->getSize() > 0)
+        EV_DEBUG << "The symbols have been demodulated into the following bit stream: " << *bitRepresentation << endl;
     return createBitModel(bitRepresentation, -1, bps(NaN), -1, bps(NaN)); // TODO
 }
 
@@ -26,7 +26,7 @@ class INET_API Ieee80211OfdmDemodulator : public IDemodulator
     const Ieee80211OfdmModulation *subcarrierModulation = nullptr;
 
   protected:
-    BitVector demodulateSymbol(const Ieee80211OfdmSymbol *signalSymbol) const;
+    void demodulateSymbol(const Ieee80211OfdmSymbol *signalSymbol, const ApskModulationBase *demodulationScheme, BitVector& bitRepresentation) const;
     const IReceptionBitModel *createBitModel(const BitVector *bitRepresentation, int signalFieldBitLength, bps signalFieldBitrate, int dataFieldBitLength, bps dataFieldBitrate) const;
     bool isPilotOrDcSubcarrier(int i) const;
 
@@ -24,8 +24,8 @@ namespace physicallayer {
 
 Register_Abstract_Class(Ieee80211ModeSet);
 
-const DelayedInitializer<std::vector<Ieee80211ModeSet>> Ieee80211ModeSet::modeSets([]() { return new std::vector<Ieee80211ModeSet> {
-    Ieee80211ModeSet("a", {
+const std::vector<Ieee80211ModeSet::Factory> Ieee80211ModeSet::modeSetFactories = {
+    { "a", [] () { return new Ieee80211ModeSet("a", {
         { true, &Ieee80211OfdmCompliantModes::ofdmMode6MbpsCS20MHz },
         { false, &Ieee80211OfdmCompliantModes::ofdmMode9MbpsCS20MHz },
         { true, &Ieee80211OfdmCompliantModes::ofdmMode12MbpsCS20MHz },
@@ -34,15 +34,15 @@ const DelayedInitializer<std::vector<Ieee80211ModeSet>> Ieee80211ModeSet::modeSe
         { false, &Ieee80211OfdmCompliantModes::ofdmMode36Mbps },
         { false, &Ieee80211OfdmCompliantModes::ofdmMode48Mbps },
         { false, &Ieee80211OfdmCompliantModes::ofdmMode54Mbps },
-    }),
-    Ieee80211ModeSet("b", {
+    }); } },
+    { "b", [] () { return new Ieee80211ModeSet("b", {
         { true, &Ieee80211DsssCompliantModes::dsssMode1Mbps },
         { true, &Ieee80211DsssCompliantModes::dsssMode2Mbps },
         { true, &Ieee80211HrDsssCompliantModes::hrDsssMode5_5MbpsCckLongPreamble },
         { true, &Ieee80211HrDsssCompliantModes::hrDsssMode11MbpsCckLongPreamble },
-    }),
+    }); } },
     // TODO slotTime, cwMin, cwMax must be identical in all modes
-    Ieee80211ModeSet("g(mixed)", {
+    { "g(mixed)", [] () { return new Ieee80211ModeSet("g(mixed)", {
         { true, &Ieee80211DsssCompliantModes::dsssMode1Mbps },
         { true, &Ieee80211DsssCompliantModes::dsssMode2Mbps },
         { true, &Ieee80211HrDsssCompliantModes::hrDsssMode5_5MbpsCckLongPreamble },
@@ -55,8 +55,8 @@ const DelayedInitializer<std::vector<Ieee80211ModeSet>> Ieee80211ModeSet::modeSe
         { false, &Ieee80211ErpOfdmCompliantModes::erpOfdmMode36Mbps },
         { false, &Ieee80211ErpOfdmCompliantModes::erpOfdmMode48Mbps },
         { false, &Ieee80211ErpOfdmCompliantModes::erpOfdmMode54Mbps }, // TODO ERP-CCK, ERP-PBCC, DSSS-OFDM
-    }),
-    Ieee80211ModeSet("g(erp)", {
+    }); } },
+    { "g(erp)", [] () { return new Ieee80211ModeSet("g(erp)", {
         { true, &Ieee80211ErpOfdmCompliantModes::erpOnlyOfdmMode6Mbps },
         { false, &Ieee80211ErpOfdmCompliantModes::erpOnlyOfdmMode9Mbps },
         { true, &Ieee80211ErpOfdmCompliantModes::erpOnlyOfdmMode12Mbps },
@@ -65,8 +65,8 @@ const DelayedInitializer<std::vector<Ieee80211ModeSet>> Ieee80211ModeSet::modeSe
         { false, &Ieee80211ErpOfdmCompliantModes::erpOnlyOfdmMode36Mbps },
         { false, &Ieee80211ErpOfdmCompliantModes::erpOnlyOfdmMode48Mbps },
         { false, &Ieee80211ErpOfdmCompliantModes::erpOnlyOfdmMode54Mbps },
-    }),
-    Ieee80211ModeSet("p", {
+    }); } },
+    { "p", [] () { return new Ieee80211ModeSet("p", {
         { true, &Ieee80211OfdmCompliantModes::ofdmMode3MbpsCS10MHz },
         { false, &Ieee80211OfdmCompliantModes::ofdmMode4_5MbpsCS10MHz },
         { true, &Ieee80211OfdmCompliantModes::ofdmMode6MbpsCS10MHz },
@@ -75,8 +75,8 @@ const DelayedInitializer<std::vector<Ieee80211ModeSet>> Ieee80211ModeSet::modeSe
         { false, &Ieee80211OfdmCompliantModes::ofdmMode18MbpsCS10MHz },
         { false, &Ieee80211OfdmCompliantModes::ofdmMode24MbpsCS10MHz },
         { false, &Ieee80211OfdmCompliantModes::ofdmMode27Mbps },
-        }),
-    Ieee80211ModeSet("n(mixed-2.4Ghz)", { // This table is not complete; it only contains 2.4GHz homogeneous spatial streams, all mandatory and optional modes
+    }); } },
+    { "n(mixed-2.4Ghz)", [] () { return new Ieee80211ModeSet("n(mixed-2.4Ghz)", { // This table is not complete; it only contains 2.4GHz homogeneous spatial streams, all mandatory and optional modes
         { true, Ieee80211HtCompliantModes::getCompliantMode(&Ieee80211HtmcsTable::htMcs0BW20MHz, Ieee80211HtMode::BAND_2_4GHZ, Ieee80211HtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211HtModeBase::HT_GUARD_INTERVAL_LONG) },
         { true, Ieee80211HtCompliantModes::getCompliantMode(&Ieee80211HtmcsTable::htMcs1BW20MHz, Ieee80211HtMode::BAND_2_4GHZ, Ieee80211HtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211HtModeBase::HT_GUARD_INTERVAL_LONG) },
         { true, Ieee80211HtCompliantModes::getCompliantMode(&Ieee80211HtmcsTable::htMcs2BW20MHz, Ieee80211HtMode::BAND_2_4GHZ, Ieee80211HtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211HtModeBase::HT_GUARD_INTERVAL_LONG) },
@@ -141,8 +141,8 @@ const DelayedInitializer<std::vector<Ieee80211ModeSet>> Ieee80211ModeSet::modeSe
         { false, Ieee80211HtCompliantModes::getCompliantMode(&Ieee80211HtmcsTable::htMcs29BW40MHz, Ieee80211HtMode::BAND_2_4GHZ, Ieee80211HtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211HtModeBase::HT_GUARD_INTERVAL_SHORT) },
         { false, Ieee80211HtCompliantModes::getCompliantMode(&Ieee80211HtmcsTable::htMcs30BW40MHz, Ieee80211HtMode::BAND_2_4GHZ, Ieee80211HtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211HtModeBase::HT_GUARD_INTERVAL_SHORT) },
         { false, Ieee80211HtCompliantModes::getCompliantMode(&Ieee80211HtmcsTable::htMcs31BW40MHz, Ieee80211HtMode::BAND_2_4GHZ, Ieee80211HtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211HtModeBase::HT_GUARD_INTERVAL_SHORT) }
-    }),
-    Ieee80211ModeSet("ac", {
+    }); } },
+    { "ac", [] () { return new Ieee80211ModeSet("ac", {
         { true, Ieee80211VhtCompliantModes::getCompliantMode(&Ieee80211VhtmcsTable::vhtMcs0BW20MHzNss1, Ieee80211VhtMode::BAND_5GHZ, Ieee80211VhtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211VhtModeBase::HT_GUARD_INTERVAL_LONG) },
         { true, Ieee80211VhtCompliantModes::getCompliantMode(&Ieee80211VhtmcsTable::vhtMcs1BW20MHzNss1, Ieee80211VhtMode::BAND_5GHZ, Ieee80211VhtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211VhtModeBase::HT_GUARD_INTERVAL_LONG) },
         { true, Ieee80211VhtCompliantModes::getCompliantMode(&Ieee80211VhtmcsTable::vhtMcs2BW20MHzNss1, Ieee80211VhtMode::BAND_5GHZ, Ieee80211VhtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211VhtModeBase::HT_GUARD_INTERVAL_LONG) },
@@ -453,7 +453,10 @@ const DelayedInitializer<std::vector<Ieee80211ModeSet>> Ieee80211ModeSet::modeSe
         { false, Ieee80211VhtCompliantModes::getCompliantMode(&Ieee80211VhtmcsTable::vhtMcs7BW160MHzNss8, Ieee80211VhtMode::BAND_5GHZ, Ieee80211VhtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211VhtModeBase::HT_GUARD_INTERVAL_SHORT) },
         { false, Ieee80211VhtCompliantModes::getCompliantMode(&Ieee80211VhtmcsTable::vhtMcs8BW160MHzNss8, Ieee80211VhtMode::BAND_5GHZ, Ieee80211VhtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211VhtModeBase::HT_GUARD_INTERVAL_SHORT) },
         { false, Ieee80211VhtCompliantModes::getCompliantMode(&Ieee80211VhtmcsTable::vhtMcs9BW160MHzNss8, Ieee80211VhtMode::BAND_5GHZ, Ieee80211VhtPreambleMode::HT_PREAMBLE_MIXED, Ieee80211VhtModeBase::HT_GUARD_INTERVAL_SHORT) },
-}),}; });
+    }); } },
+};
+
+std::vector<std::unique_ptr<const Ieee80211ModeSet>> Ieee80211ModeSet::modeSets;
 
 Ieee80211ModeSet::Ieee80211ModeSet(const char *name, const std::vector<Entry> entries) :
     name(name),
@@ -461,6 +464,25 @@ Ieee80211ModeSet::Ieee80211ModeSet(const char *name, const std::vector<Entry> en
 {
     std::vector<Entry> *nonConstEntries = const_cast<std::vector<Entry> *>(&this->entries);
     std::stable_sort(nonConstEntries->begin(), nonConstEntries->end(), EntryNetBitrateComparator());
+    // the mode set is immutable, so the mode index and the mandatory mode
+    // neighbors can be precomputed once; the HT/VHT mode sets contain
+    // thousands of modes, a linear scan per lookup is measurable
+    for (size_t index = 0; index < this->entries.size(); index++)
+        modeIndexes[this->entries[index].mode] = index;
+    slowerMandatoryModes.resize(this->entries.size());
+    fasterMandatoryModes.resize(this->entries.size());
+    const IIeee80211Mode *slowerMandatoryMode = nullptr;
+    for (size_t index = 0; index < this->entries.size(); index++) {
+        slowerMandatoryModes[index] = slowerMandatoryMode;
+        if (this->entries[index].isMandatory)
+            slowerMandatoryMode = this->entries[index].mode;
+    }
+    const IIeee80211Mode *fasterMandatoryMode = nullptr;
+    for (int index = (int)this->entries.size() - 1; index >= 0; index--) {
+        fasterMandatoryModes[index] = fasterMandatoryMode;
+        if (this->entries[index].isMandatory)
+            fasterMandatoryMode = this->entries[index].mode;
+    }
     auto referenceMode = entries[0].mode;
     for (auto entry : entries) {
         auto mode = entry.mode;
@@ -475,10 +497,8 @@ Ieee80211ModeSet::Ieee80211ModeSet(const char *name, const std::vector<Entry> en
 
 int Ieee80211ModeSet::findModeIndex(const IIeee80211Mode *mode) const
 {
-    for (size_t index = 0; index < entries.size(); index++)
-        if (entries[index].mode == mode)
-            return index;
-    return -1;
+    auto it = modeIndexes.find(mode);
+    return it != modeIndexes.end() ? it->second : -1;
 }
 
 int Ieee80211ModeSet::getModeIndex(const IIeee80211Mode *mode) const
@@ -581,29 +601,28 @@ const IIeee80211Mode *Ieee80211ModeSet::getFastestMandatoryMode() const
 const IIeee80211Mode *Ieee80211ModeSet::getSlowerMandatoryMode(const IIeee80211Mode *mode) const
 {
     int index = findModeIndex(mode);
-    if (index > 0)
-        for (int i = index - 1; i >= 0; i--)
-            if (entries[i].isMandatory)
-                return entries[i].mode;
-    return nullptr;
+    return index >= 0 ? slowerMandatoryModes[index] : nullptr;
 }
 
 const IIeee80211Mode *Ieee80211ModeSet::getFasterMandatoryMode(const IIeee80211Mode *mode) const
 {
     int index = findModeIndex(mode);
-    if (index >= 0)
-        for (size_t i = index + 1; i < entries.size(); i++)
-            if (entries[i].isMandatory)
-                return entries[i].mode;
-    return nullptr;
+    return index >= 0 ? fasterMandatoryModes[index] : nullptr;
 }
 
 const Ieee80211ModeSet *Ieee80211ModeSet::findModeSet(const char *mode)
 {
-    for (size_t index = 0; index < (&modeSets)->size(); index++) {
-        const Ieee80211ModeSet *modeSet = &(&modeSets)->at(index);
+    for (auto& modeSet : modeSets)
         if (strcmp(modeSet->getName(), mode) == 0)
-            return modeSet;
+            return modeSet.get();
+    // materialize the requested mode set on first use; constructing e.g. the
+    // HT/VHT tables allocates thousands of mode objects, so the mode sets
+    // that the simulation doesn't reference are never built
+    for (auto& factory : modeSetFactories) {
+        if (strcmp(factory.name, mode) == 0) {
+            modeSets.push_back(std::unique_ptr<const Ieee80211ModeSet>(factory.create()));
+            return modeSets.back().get();
+        }
     }
     return nullptr;
 }
@@ -613,10 +632,8 @@ const Ieee80211ModeSet *Ieee80211ModeSet::getModeSet(const char *mode)
     const Ieee80211ModeSet *modeSet = findModeSet(mode);
     if (modeSet == nullptr) {
         std::string validModeSets;
-        for (size_t index = 0; index < (&modeSets)->size(); index++) {
-            const Ieee80211ModeSet *modeSet = &(&modeSets)->at(index);
-            validModeSets += std::string("'") + modeSet->getName() + "' ";
-        }
+        for (auto& factory : modeSetFactories)
+            validModeSets += std::string("'") + factory.name + "' ";
         throw cRuntimeError("Unknown 802.11 operational mode: '%s', valid modes are: %s", mode, validModeSets.c_str());
     }
     else
@@ -8,7 +8,10 @@
 #ifndef __INET_IEEE80211MODESET_H
 #define __INET_IEEE80211MODESET_H
 
-#include "inet/common/DelayedInitializer.h"
+#include <functional>
+#include <map>
+#include <memory>
+
 #include "inet/physicallayer/wireless/ieee80211/mode/IIeee80211Mode.h"
 
 namespace inet {
@@ -27,12 +30,25 @@ class INET_API Ieee80211ModeSet : public IPrintableObject, public cObject
         bool operator()(const Entry& left, const Entry& right) { return left.mode->getDataMode()->getNetBitrate() < right.mode->getDataMode()->getNetBitrate(); }
     };
 
+    /**
+     * Creates a mode set on demand, so that only the mode sets actually
+     * referenced by the simulation are materialized.
+     */
+    class INET_API Factory {
+      public:
+        const char *name;
+        std::function<Ieee80211ModeSet *()> create;
+    };
+
   protected:
     std::string name;
     const std::vector<Entry> entries;
+    std::map<const IIeee80211Mode *, int> modeIndexes; // index of entries by mode, so per-frame lookups don't scan the mode list
+    std::vector<const IIeee80211Mode *> slowerMandatoryModes; // for each entry, the next slower mandatory mode or nullptr
+    std::vector<const IIeee80211Mode *> fasterMandatoryModes; // for each entry, the next faster mandatory mode or nullptr
 
-  public:
-    static const DelayedInitializer<std::vector<Ieee80211ModeSet>> modeSets;
+    static const std::vector<Factory> modeSetFactories;
+    static std::vector<std::unique_ptr<const Ieee80211ModeSet>> modeSets; // the process-wide immutable mode sets materialized so far
 
   protected:
     int findModeIndex(const IIeee80211Mode *mode) const;
@@ -29,6 +29,67 @@ namespace physicallayer {
 
 Define_Module(Ieee80211NistErrorModel);
 
+void Ieee80211NistErrorModel::initialize(int stage)
+{
+    Ieee80211ErrorModelBase::initialize(stage);
+    if (stage == INITSTAGE_LOCAL) {
+        berTableSize = par("berTableSize");
+        berTableMinSnir = par("berTableMinSnir");
+        berTableMaxSnir = par("berTableMaxSnir");
+        if (berTableSize > 0) {
+            if (berTableSize < 2 || berTableMinSnir <= 0 || berTableMaxSnir <= berTableMinSnir)
+                throw cRuntimeError("Invalid packet error probability table parameters");
+            // all (constellation size, puncturing b value) combinations used by getOFDMAndERPOFDMChunkSuccessRate
+            static const std::pair<unsigned int, uint32_t> combinations[] = {
+                { 2, 1 }, { 2, 3 }, { 4, 1 }, { 4, 3 }, { 16, 1 }, { 16, 3 },
+                { 64, 2 }, { 64, 3 }, { 256, 3 }, { 256, 5 }, { 1024, 3 }, { 1024, 5 }
+            };
+            double logMinSnir = std::log(berTableMinSnir);
+            double logStep = (std::log(berTableMaxSnir) - logMinSnir) / (berTableSize - 1);
+            for (auto& combination : combinations) {
+                std::vector<double>& peTable = peTables[combination];
+                peTable.resize(berTableSize);
+                for (int i = 0; i < berTableSize; i++)
+                    peTable[i] = computePe(std::exp(logMinSnir + i * logStep), combination.first, combination.second);
+            }
+        }
+    }
+}
+
+double Ieee80211NistErrorModel::computePe(double snr, unsigned int constellationSize, uint32_t bValue) const
+{
+    double ber;
+    switch (constellationSize) {
+        case 2: ber = getBpskBer(snr); break;
+        case 4: ber = getQpskBer(snr); break;
+        case 16: ber = get16QamBer(snr); break;
+        case 64: ber = get64QamBer(snr); break;
+        case 256: ber = get256QamBer(snr); break;
+        case 1024: ber = get1024QamBer(snr); break;
+        default: throw cRuntimeError("Unknown constellation size: %u", constellationSize);
+    }
+    if (ber == 0.0)
+        return 0.0;
+    return math::minnan(calculatePe(ber, bValue), 1.0);
+}
+
+double Ieee80211NistErrorModel::lookupPe(double snr, unsigned int constellationSize, uint32_t bValue) const
+{
+    if (berTableSize > 0 && berTableMinSnir <= snr && snr <= berTableMaxSnir) {
+        auto it = peTables.find(std::make_pair(constellationSize, bValue));
+        if (it != peTables.end()) {
+            const std::vector<double>& peTable = it->second;
+            double logMinSnir = std::log(berTableMinSnir);
+            double logStep = (std::log(berTableMaxSnir) - logMinSnir) / (berTableSize - 1);
+            double position = (std::log(snr) - logMinSnir) / logStep;
+            int index = std::min((int)position, berTableSize - 2);
+            double alpha = position - index;
+            return (1 - alpha) * peTable[index] + alpha * peTable[index + 1];
+        }
+    }
+    return computePe(snr, constellationSize, bValue);
+}
+
 double Ieee80211NistErrorModel::getBpskBer(double snr) const
 {
     double z = sqrt(snr);
@@ -79,24 +140,14 @@ double Ieee80211NistErrorModel::get1024QamBer(double snr) const
 
 double Ieee80211NistErrorModel::getFecBpskBer(double snr, double nbits, uint32_t bValue) const
 {
-    double ber = getBpskBer(snr);
-    if (ber == 0.0) {
-        return 1.0;
-    }
-    double pe = calculatePe(ber, bValue);
-    pe = math::minnan(pe, 1.0);
+    double pe = lookupPe(snr, 2, bValue);
     double pms = pow(1 - pe, nbits);
     return pms;
 }
 
 double Ieee80211NistErrorModel::getFecQpskBer(double snr, double nbits, uint32_t bValue) const
 {
-    double ber = getQpskBer(snr);
-    if (ber == 0.0) {
-        return 1.0;
-    }
-    double pe = calculatePe(ber, bValue);
-    pe = math::minnan(pe, 1.0);
+    double pe = lookupPe(snr, 4, bValue);
     double pms = pow(1 - pe, nbits);
     return pms;
 }
@@ -142,48 +193,28 @@ double Ieee80211NistErrorModel::calculatePe(double p, uint32_t bValue) const
 
 double Ieee80211NistErrorModel::getFec16QamBer(double snr, uint32_t nbits, uint32_t bValue) const
 {
-    double ber = get16QamBer(snr);
-    if (ber == 0.0) {
-        return 1.0;
-    }
-    double pe = calculatePe(ber, bValue);
-    pe = math::minnan(pe, 1.0);
+    double pe = lookupPe(snr, 16, bValue);
     double pms = pow(1 - pe, (double)nbits);
     return pms;
 }
 
 double Ieee80211NistErrorModel::getFec64QamBer(double snr, uint32_t nbits, uint32_t bValue) const
 {
-    double ber = get64QamBer(snr);
-    if (ber == 0.0) {
-        return 1.0;
-    }
-    double pe = calculatePe(ber, bValue);
-    pe = math::minnan(pe, 1.0);
+    double pe = lookupPe(snr, 64, bValue);
     double pms = pow(1 - pe, (double)nbits);
     return pms;
 }
 
 double Ieee80211NistErrorModel::getFec256QamBer(double snr, uint64_t nbits, uint32_t bValue) const
 {
-    double ber = get256QamBer(snr);
-    if (ber == 0.0) {
-        return 1.0;
-    }
-    double pe = calculatePe(ber, bValue);
-    pe = math::minnan(pe, 1.0);
+    double pe = lookupPe(snr, 256, bValue);
     double pms = std::pow(1 - pe, nbits);
     return pms;
 }
 
 double Ieee80211NistErrorModel::getFec1024QamBer(double snr, uint64_t nbits, uint32_t bValue) const
 {
-    double ber = get1024QamBer(snr);
-    if (ber == 0.0) {
-        return 1.0;
-    }
-    double pe = calculatePe(ber, bValue);
-    pe = math::minnan(pe, 1.0);
+    double pe = lookupPe(snr, 1024, bValue);
     double pms = std::pow(1 - pe, nbits);
     return pms;
 }
@@ -27,6 +27,20 @@ namespace physicallayer {
 class INET_API Ieee80211NistErrorModel : public Ieee80211ErrorModelBase
 {
   protected:
+    int berTableSize = 0;
+    double berTableMinSnir = NaN;
+    double berTableMaxSnir = NaN;
+    /**
+     * Precomputed packet error probability samples on a logarithmic SNIR grid,
+     * one table per (constellation size, puncturing b value) combination.
+     */
+    std::map<std::pair<unsigned int, uint32_t>, std::vector<double>> peTables;
+
+  protected:
+    virtual void initialize(int stage) override;
+
+    double computePe(double snr, unsigned int constellationSize, uint32_t bValue) const;
+    double lookupPe(double snr, unsigned int constellationSize, uint32_t bValue) const;
     double calculatePe(double p, uint32_t bValue) const;
     double getBpskBer(double snr) const;
     double getQpskBer(double snr) const;
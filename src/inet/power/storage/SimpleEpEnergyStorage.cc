@@ -137,16 +137,17 @@ void SimpleEpEnergyStorage::updateResidualCapacity()
 void SimpleEpEnergyStorage::scheduleTimer()
 {
     W totalPower = totalPowerGeneration - totalPowerConsumption;
+    bool hasCapacityStep = !std::isnan(printCapacityStep.get()) && printCapacityStep > J(0);
     targetCapacity = residualCapacity;
     if (totalPower > W(0)) {
-        targetCapacity = std::isnan(printCapacityStep.get()) ? nominalCapacity : ceil(unit(residualCapacity / printCapacityStep).get()) * printCapacityStep;
+        targetCapacity = !hasCapacityStep ? nominalCapacity : ceil(unit(residualCapacity / printCapacityStep).get()) * printCapacityStep;
         // NOTE: make sure capacity will change over time despite double arithmetic
         simtime_t remainingTime = unit((targetCapacity - residualCapacity) / totalPower / s(1)).get();
         if (remainingTime == 0)
             targetCapacity += printCapacityStep;
     }
     else if (totalPower < W(0)) {
-        targetCapacity = std::isnan(printCapacityStep.get()) ? J(0) : floor(unit(residualCapacity / printCapacityStep).get()) * printCapacityStep;
+        targetCapacity = !hasCapacityStep ? J(0) : floor(unit(residualCapacity / printCapacityStep).get()) * printCapacityStep;
         // make sure capacity will change over time despite double arithmetic
         simtime_t remainingTime = unit((targetCapacity - residualCapacity) / totalPower / s(1)).get();
         if (remainingTime == 0)
@@ -43,7 +43,10 @@ class INET_API SimpleEpEnergyStorage : public EpEnergyStorageBase, public String
     J residualCapacity = J(NaN);
 
     /**
-     * Specifies the amount of capacity change which will be reported.
+     * Specifies the amount of capacity change which will be reported. A zero
+     * or NaN value disables the periodic reporting timer events, the timer is
+     * then only scheduled to the analytically computed complete depletion or
+     * complete charge time.
      */
     J printCapacityStep = J(NaN);
 
@@ -8,9 +8,17 @@
 #include "inet/protocolelement/checksum/base/FcsCheckerBase.h"
 
 #include "inet/common/checksum/EthernetCRC.h"
+#include "inet/protocolelement/checksum/FcsVerifiedTag_m.h"
 
 namespace inet {
 
+void FcsCheckerBase::initialize(int stage)
+{
+    PacketFilterBase::initialize(stage);
+    if (stage == INITSTAGE_LOCAL)
+        useFcsVerifiedTags = par("useFcsVerifiedTags");
+}
+
 bool FcsCheckerBase::checkDisabledFcs(const Packet *packet, uint32_t fcs) const
 {
     if (fcs != 0x00000000L)
@@ -36,8 +44,17 @@ bool FcsCheckerBase::checkDeclaredIncorrectFcs(const Packet *packet, uint32_t fc
 bool FcsCheckerBase::checkComputedFcs(const Packet *packet, uint32_t receivedFcs) const
 {
     // TODO if (receivedFcs == 0x00000000L) -> disabled
+    if (useFcsVerifiedTags) {
+        b offset = packet->getFrontOffset();
+        b length = packet->getDataLength() - B(4);
+        const auto& regionTags = packet->getAllRegionTags<FcsVerifiedTag>(offset, length);
+        // a tag covering the entire region proves that the covered bytes are
+        // unchanged since the recorded FCS was computed over them
+        if (regionTags.size() == 1 && regionTags[0].getOffset() == offset && regionTags[0].getLength() == length && regionTags[0].getTag()->getFcs() == receivedFcs)
+            return packet->peekData()->isCorrect() && !packet->hasBitError();
+    }
     auto data = packet->peekDataAsBytes();
-    auto bytes = data->getBytes();
+    const auto& bytes = data->getBytes();
     uint32_t computedFcs = ethernetCRC(bytes.data(), packet->getByteLength() - 4);
     // NOTE: the correct bit must be checked, because the data may not be corrupted precisely depending on the corruption mode
     return receivedFcs == computedFcs && data->isCorrect() && !packet->hasBitError();
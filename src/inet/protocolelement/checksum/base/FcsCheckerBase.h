@@ -18,6 +18,11 @@ using namespace inet::queueing;
 class INET_API FcsCheckerBase : public PacketFilterBase
 {
   protected:
+    bool useFcsVerifiedTags = false;
+
+  protected:
+    virtual void initialize(int stage) override;
+
     virtual bool checkDisabledFcs(const Packet *packet, uint32_t fcs) const;
     virtual bool checkDeclaredCorrectFcs(const Packet *packet, uint32_t fcs) const;
     virtual bool checkDeclaredIncorrectFcs(const Packet *packet, uint32_t fcs) const;
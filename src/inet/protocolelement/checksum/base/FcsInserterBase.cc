@@ -8,14 +8,17 @@
 #include "inet/protocolelement/checksum/base/FcsInserterBase.h"
 
 #include "inet/common/checksum/EthernetCRC.h"
+#include "inet/protocolelement/checksum/FcsVerifiedTag_m.h"
 
 namespace inet {
 
 void FcsInserterBase::initialize(int stage)
 {
     PacketFlowBase::initialize(stage);
-    if (stage == INITSTAGE_LOCAL)
+    if (stage == INITSTAGE_LOCAL) {
         fcsMode = parseFcsMode(par("fcsMode"));
+        useFcsVerifiedTags = par("useFcsVerifiedTags");
+    }
 }
 
 uint32_t FcsInserterBase::computeDisabledFcs(const Packet *packet) const
@@ -35,9 +38,25 @@ uint32_t FcsInserterBase::computeDeclaredIncorrectFcs(const Packet *packet) cons
 
 uint32_t FcsInserterBase::computeComputedFcs(const Packet *packet) const
 {
+    b offset = packet->getFrontOffset();
+    b length = packet->getDataLength();
+    if (useFcsVerifiedTags) {
+        const auto& regionTags = packet->getAllRegionTags<FcsVerifiedTag>(offset, length);
+        // a tag covering the entire region proves that the covered bytes are
+        // unchanged since the recorded FCS was computed over them
+        if (regionTags.size() == 1 && regionTags[0].getOffset() == offset && regionTags[0].getLength() == length)
+            return regionTags[0].getTag()->getFcs();
+    }
     auto data = packet->peekDataAsBytes();
-    auto bytes = data->getBytes();
-    return ethernetCRC(bytes.data(), packet->getByteLength());
+    const auto& bytes = data->getBytes();
+    uint32_t fcs = ethernetCRC(bytes.data(), packet->getByteLength());
+    if (useFcsVerifiedTags) {
+        // the tag is packet metadata, attaching it doesn't modify the content
+        auto mutablePacket = const_cast<Packet *>(packet);
+        mutablePacket->removeRegionTagsWherePresent<FcsVerifiedTag>(offset, length);
+        mutablePacket->addRegionTag<FcsVerifiedTag>(offset, length)->setFcs(fcs);
+    }
+    return fcs;
 }
 
 uint32_t FcsInserterBase::computeFcs(const Packet *packet, FcsMode fcsMode) const
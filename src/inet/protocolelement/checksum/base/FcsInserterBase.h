@@ -19,6 +19,7 @@ class INET_API FcsInserterBase : public PacketFlowBase
 {
   protected:
     FcsMode fcsMode = FCS_MODE_UNDEFINED;
+    bool useFcsVerifiedTags = false;
 
   protected:
     virtual void initialize(int stage) override;
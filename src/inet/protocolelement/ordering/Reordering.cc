@@ -17,37 +17,88 @@ Define_Module(Reordering);
 
 Reordering::~Reordering()
 {
-    for (auto it : packets)
-        delete it.second;
+    cancelAndDelete(gapTimer);
+    for (auto packet : packets)
+        delete packet;
 }
 
 void Reordering::initialize(int stage)
 {
     PacketPusherBase::initialize(stage);
     if (stage == INITSTAGE_LOCAL) {
+        windowSize = par("windowSize");
+        if (windowSize < 1)
+            throw cRuntimeError("Invalid windowSize: %d", windowSize);
+        gapTimeout = par("gapTimeout");
+        packets.resize(windowSize);
+        gapTimer = new cMessage("GapTimer");
         registerService(AccessoryProtocol::sequenceNumber, inputGate, nullptr);
         registerProtocol(AccessoryProtocol::sequenceNumber, outputGate, nullptr);
     }
 }
 
+void Reordering::handleMessage(cMessage *message)
+{
+    if (message == gapTimer)
+        skipSequenceNumberGap();
+    else
+        PacketPusherBase::handleMessage(message);
+}
+
 void Reordering::pushPacket(Packet *packet, const cGate *gate)
 {
     Enter_Method("pushPacket");
     take(packet);
     auto header = packet->popAtFront<SequenceNumberHeader>();
     auto sequenceNumber = header->getSequenceNumber();
-    packets[sequenceNumber] = packet;
-    if (sequenceNumber == expectedSequenceNumber) {
-        while (true) {
-            auto it = packets.find(expectedSequenceNumber);
-            if (it == packets.end())
-                break;
-            pushOrSendPacket(it->second, outputGate, consumer);
-            packets.erase(it);
-            expectedSequenceNumber++;
-        }
+    if (sequenceNumber < expectedSequenceNumber) {
+        EV_WARN << "Dropping already delivered or skipped packet" << EV_FIELD(sequenceNumber) << EV_FIELD(packet) << EV_ENDL;
+        delete packet;
+        return;
+    }
+    if (sequenceNumber >= expectedSequenceNumber + windowSize)
+        throw cRuntimeError("Sequence number %d is outside of the reordering window [%d, %d), increase windowSize", sequenceNumber, expectedSequenceNumber, expectedSequenceNumber + windowSize);
+    auto& slot = packets[sequenceNumber % windowSize];
+    if (slot != nullptr)
+        delete slot;
+    else
+        numBufferedPackets++;
+    slot = packet;
+    if (sequenceNumber == expectedSequenceNumber)
+        deliverPackets();
+    if (gapTimeout > 0) {
+        if (numBufferedPackets == 0)
+            cancelEvent(gapTimer);
+        else if (!gapTimer->isScheduled())
+            scheduleAfter(gapTimeout, gapTimer);
     }
 }
 
-} // namespace inet
+void Reordering::deliverPackets()
+{
+    while (true) {
+        auto& slot = packets[expectedSequenceNumber % windowSize];
+        if (slot == nullptr)
+            break;
+        auto packet = slot;
+        slot = nullptr;
+        numBufferedPackets--;
+        expectedSequenceNumber++;
+        pushOrSendPacket(packet, outputGate, consumer);
+    }
+}
+
+void Reordering::skipSequenceNumberGap()
+{
+    // give up waiting for the missing packets in front of the oldest buffered
+    // one, all consecutive gaps up to it are skipped in a single pass
+    ASSERT(numBufferedPackets > 0);
+    while (packets[expectedSequenceNumber % windowSize] == nullptr)
+        expectedSequenceNumber++;
+    EV_WARN << "Timeout waiting for missing packets, skipping forward" << EV_FIELD(expectedSequenceNumber) << EV_ENDL;
+    deliverPackets();
+    if (numBufferedPackets != 0)
+        scheduleAfter(gapTimeout, gapTimer);
+}
 
+} // namespace inet
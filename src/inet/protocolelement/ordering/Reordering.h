@@ -17,11 +17,23 @@ using namespace inet::queueing;
 class INET_API Reordering : public PacketPusherBase
 {
   protected:
-    int expectedSequenceNumber;
-    std::map<int, Packet *> packets;
+    int windowSize = -1;
+    simtime_t gapTimeout;
+
+    int expectedSequenceNumber = 0;
+    // ring buffer of the packets buffered in [expectedSequenceNumber,
+    // expectedSequenceNumber + windowSize), indexed modulo windowSize
+    std::vector<Packet *> packets;
+    int numBufferedPackets = 0;
+
+    cMessage *gapTimer = nullptr;
 
   protected:
     virtual void initialize(int stage) override;
+    virtual void handleMessage(cMessage *message) override;
+
+    virtual void deliverPackets();
+    virtual void skipSequenceNumberGap();
 
   public:
     virtual ~Reordering();
@@ -32,4 +44,3 @@ class INET_API Reordering : public PacketPusherBase
 } // namespace inet
 
 #endif
-
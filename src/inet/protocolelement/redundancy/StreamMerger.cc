@@ -7,7 +7,8 @@
 
 #include "inet/protocolelement/redundancy/StreamMerger.h"
 
-#include "inet/common/stlutils.h"
+#include <algorithm>
+
 #include "inet/common/SequenceNumberTag_m.h"
 #include "inet/protocolelement/redundancy/StreamTag_m.h"
 
@@ -15,6 +16,43 @@ namespace inet {
 
 Define_Module(StreamMerger);
 
+void StreamMerger::SequenceNumberWindow::initialize(int windowSize)
+{
+    this->windowSize = windowSize;
+    nextSequenceNumber = -1;
+    seen.assign(windowSize, false);
+}
+
+bool StreamMerger::SequenceNumberWindow::contains(int sequenceNumber) const
+{
+    if (nextSequenceNumber == -1)
+        return false;
+    // sequence numbers ahead of or far behind the window count as not seen,
+    // the latter to recover from a sequence number reset of the talker
+    if (sequenceNumber >= nextSequenceNumber || sequenceNumber < nextSequenceNumber - windowSize)
+        return false;
+    return seen[sequenceNumber % windowSize];
+}
+
+void StreamMerger::SequenceNumberWindow::insert(int sequenceNumber)
+{
+    if (nextSequenceNumber == -1 || sequenceNumber < nextSequenceNumber - windowSize) {
+        // first packet or sequence number reset, restart the window
+        std::fill(seen.begin(), seen.end(), false);
+        nextSequenceNumber = sequenceNumber + 1;
+    }
+    else if (sequenceNumber >= nextSequenceNumber) {
+        // bulk advance, clearing the seen flags of the sequence numbers that fall out of the window
+        if (sequenceNumber - nextSequenceNumber >= windowSize)
+            std::fill(seen.begin(), seen.end(), false);
+        else
+            for (int i = std::max(nextSequenceNumber, sequenceNumber + 1 - windowSize); i < sequenceNumber; i++)
+                seen[i % windowSize] = false;
+        nextSequenceNumber = sequenceNumber + 1;
+    }
+    seen[sequenceNumber % windowSize] = true;
+}
+
 void StreamMerger::initialize(int stage)
 {
     PacketFilterBase::initialize(stage);
@@ -47,10 +85,12 @@ void StreamMerger::processPacket(Packet *packet)
         auto inputStreamName = streamInd->getStreamName();
         if (mapping->containsKey(inputStreamName)) {
             auto outputStreamName = mapping->get(inputStreamName).stringValue();
-            auto& it = sequenceNumbers[outputStreamName];
-            it.push_back(packet->getTag<SequenceNumberInd>()->getSequenceNumber());
-            if ((int)it.size() > bufferSize)
-                it.erase(it.begin(), it.begin() + it.size() - bufferSize);
+            auto it = sequenceNumbers.find(outputStreamName);
+            if (it == sequenceNumbers.end()) {
+                it = sequenceNumbers.emplace(outputStreamName, SequenceNumberWindow()).first;
+                it->second.initialize(bufferSize);
+            }
+            it->second.insert(packet->getTag<SequenceNumberInd>()->getSequenceNumber());
             if (*outputStreamName != '\0')
                 packet->getTagForUpdate<StreamInd>()->setStreamName(outputStreamName);
             else {
@@ -91,8 +131,7 @@ bool StreamMerger::matchesSequenceNumber(const char *streamName, int sequenceNum
     if (it == sequenceNumbers.end())
         return true;
     else
-        return !contains(it->second, sequenceNumber);
+        return !it->second.contains(sequenceNumber);
 }
 
 } // namespace inet
-
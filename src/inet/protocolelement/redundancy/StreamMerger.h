@@ -18,10 +18,24 @@ using namespace inet::queueing;
 class INET_API StreamMerger : public PacketFilterBase, public TransparentProtocolRegistrationListener
 {
   protected:
+    // fixed-size sequence recovery window with O(1) duplicate test and insert;
+    // the ring buffer bitmap stores the seen flags of the sequence numbers in
+    // [nextSequenceNumber - windowSize, nextSequenceNumber) at positions
+    // indexed modulo windowSize
+    struct SequenceNumberWindow {
+        int windowSize = -1;
+        int nextSequenceNumber = -1; // one past the highest sequence number seen, -1 until the first packet
+        std::vector<bool> seen; // preallocated ring buffer of windowSize bits
+
+        void initialize(int windowSize);
+        bool contains(int sequenceNumber) const;
+        void insert(int sequenceNumber);
+    };
+
     cValueMap *mapping = nullptr;
     int bufferSize = -1;
 
-    std::map<std::string, std::vector<int>> sequenceNumbers;
+    std::map<std::string, SequenceNumberWindow, std::less<>> sequenceNumbers;
 
   protected:
     virtual void initialize(int stage) override;
@@ -38,4 +52,3 @@ class INET_API StreamMerger : public PacketFilterBase, public TransparentProtoco
 } // namespace inet
 
 #endif
-
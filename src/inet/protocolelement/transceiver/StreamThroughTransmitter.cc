@@ -108,9 +108,8 @@ void StreamThroughTransmitter::endTx(Packet *packet)
     handlePacketProcessed(packet);
     auto signal = encodePacket(packet);
     delete txSignal;
-    txSignal = signal->dup();
-    emit(transmissionEndedSignal, txSignal);
-    sendSignalEnd(txSignal, packet->getTransmissionId());
+    emit(transmissionEndedSignal, signal);
+    sendSignalEnd(signal, packet->getTransmissionId());
     // 3. clear internal state
     txSignal = nullptr;
     txDatarate = bps(NaN);
@@ -126,7 +125,6 @@ void StreamThroughTransmitter::endTx(Packet *packet)
         producer.handlePushPacketProcessed(packet, true);
         producer.handleCanPushPacketChanged();
     }
-    delete signal;
 }
 
 void StreamThroughTransmitter::abortTx()
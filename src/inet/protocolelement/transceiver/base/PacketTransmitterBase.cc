@@ -64,9 +64,11 @@ Signal *PacketTransmitterBase::encodePacket(Packet *packet)
     // TODO: this is just a weak approximation which ignores the past and future drift and drift rate changes of the clock
     simtime_t packetTransmissionTime = CLOCKTIME_AS_SIMTIME(txDurationClockTime);
     simtime_t bitTransmissionTime = packet->getBitLength() != 0 ? CLOCKTIME_AS_SIMTIME(txDurationClockTime / packet->getBitLength()) : 0;
-    auto packetEvent = new PacketTransmittedEvent();
-    packetEvent->setDatarate(packet->getDataLength() / s(txDurationClockTime.dbl()));
-    insertPacketEvent(this, packet, PEK_TRANSMITTED, bitTransmissionTime, packetEvent);
+    if (hasPacketEvents(packet)) {
+        auto packetEvent = new PacketTransmittedEvent();
+        packetEvent->setDatarate(packet->getDataLength() / s(txDurationClockTime.dbl()));
+        insertPacketEvent(this, packet, PEK_TRANSMITTED, bitTransmissionTime, packetEvent);
+    }
     increaseTimeTag<TransmissionTimeTag>(packet, bitTransmissionTime, packetTransmissionTime);
     if (auto channel = dynamic_cast<cDatarateChannel *>(outputGate->findTransmissionChannel())) {
         insertPacketEvent(this, packet, PEK_PROPAGATED, channel->getDelay());
@@ -45,6 +45,10 @@ void StreamingTransmitterBase::scheduleTxEndTimer(Signal *signal)
 {
     ASSERT(txStartClockTime != -1);
     clocktime_t txEndClockTime = txStartClockTime + txDurationClockTime;
+    // progress updates that don't change the transmission duration would
+    // reschedule the timer to the very same moment, so leave it in place
+    if (txEndTimer->isScheduled() && getArrivalClockTime(txEndTimer) == txEndClockTime)
+        return;
     EV_INFO << "Scheduling transmission end timer" << EV_FIELD(at, txEndClockTime.ustr()) << EV_ENDL;
     rescheduleClockEventAt(txEndClockTime, txEndTimer);
 }
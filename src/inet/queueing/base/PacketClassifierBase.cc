@@ -7,6 +7,7 @@
 
 #include "inet/queueing/base/PacketClassifierBase.h"
 
+#include "inet/common/HotPathProfiler.h"
 #include "inet/common/ModuleAccess.h"
 
 namespace inet {
@@ -40,6 +41,7 @@ void PacketClassifierBase::initialize(int stage)
 
 void PacketClassifierBase::handleMessage(cMessage *message)
 {
+    HotPathProfiler::Measurement measurement(this);
     auto packet = check_and_cast<Packet *>(message);
     pushPacket(packet, packet->getArrivalGate());
 }
@@ -7,6 +7,7 @@
 
 #include "inet/queueing/base/PacketFilterBase.h"
 
+#include "inet/common/HotPathProfiler.h"
 #include "inet/common/ModuleAccess.h"
 #include "inet/common/Simsignals.h"
 
@@ -35,6 +36,7 @@ void PacketFilterBase::initialize(int stage)
 
 void PacketFilterBase::handleMessage(cMessage *message)
 {
+    HotPathProfiler::Measurement measurement(this);
     auto packet = check_and_cast<Packet *>(message);
     pushPacket(packet, packet->getArrivalGate());
 }
@@ -7,6 +7,7 @@
 
 #include "inet/queueing/base/PacketFlowBase.h"
 
+#include "inet/common/HotPathProfiler.h"
 #include "inet/common/ModuleAccess.h"
 
 namespace inet {
@@ -33,6 +34,7 @@ void PacketFlowBase::initialize(int stage)
 
 void PacketFlowBase::handleMessage(cMessage *message)
 {
+    HotPathProfiler::Measurement measurement(this);
     auto packet = check_and_cast<Packet *>(message);
     pushPacket(packet, packet->getArrivalGate());
 }
@@ -69,10 +71,10 @@ void PacketFlowBase::pushPacket(Packet *packet, const cGate *gate)
     Enter_Method("pushPacket");
     take(packet);
     checkPacketStreaming(nullptr);
-    emit(packetPushedInSignal, packet);
+    signalEmissionCache.emit(this, packetPushedInSignal, packet);
     processPacket(packet);
     handlePacketProcessed(packet);
-    emit(packetPushedOutSignal, packet);
+    signalEmissionCache.emit(this, packetPushedOutSignal, packet);
     pushOrSendPacket(packet, outputGate, consumer);
     updateDisplayString();
 }
@@ -83,7 +85,7 @@ void PacketFlowBase::pushPacketStart(Packet *packet, const cGate *gate, bps data
     EV_INFO << "Starting packet streaming" << EV_FIELD(packet) << EV_ENDL;
     take(packet);
     checkPacketStreaming(packet);
-    emit(packetPushedInSignal, packet);
+    signalEmissionCache.emit(this, packetPushedInSignal, packet);
     startPacketStreaming(packet);
     processPacket(packet);
     pushOrSendPacketStart(packet, outputGate, consumer, datarate, packet->getTransmissionId());
@@ -100,7 +102,7 @@ void PacketFlowBase::pushPacketEnd(Packet *packet, const cGate *gate)
     else
         checkPacketStreaming(packet);
     processPacket(packet);
-    emit(packetPushedOutSignal, packet);
+    signalEmissionCache.emit(this, packetPushedOutSignal, packet);
     endPacketStreaming(packet);
     pushOrSendPacketEnd(packet, outputGate, consumer, packet->getTransmissionId());
     updateDisplayString();
@@ -118,7 +120,7 @@ void PacketFlowBase::pushPacketProgress(Packet *packet, const cGate *gate, bps d
     bool isPacketEnd = packet->getDataLength() == position + extraProcessableLength;
     processPacket(packet);
     if (isPacketEnd) {
-        emit(packetPushedOutSignal, packet);
+        signalEmissionCache.emit(this, packetPushedOutSignal, packet);
         endPacketStreaming(packet);
         pushOrSendPacketEnd(packet, outputGate, consumer, packet->getTransmissionId());
     }
@@ -158,10 +160,10 @@ Packet *PacketFlowBase::pullPacket(const cGate *gate)
     checkPacketStreaming(nullptr);
     auto packet = provider.pullPacket();
     take(packet);
-    emit(packetPulledInSignal, packet);
+    signalEmissionCache.emit(this, packetPulledInSignal, packet);
     processPacket(packet);
     handlePacketProcessed(packet);
-    emit(packetPulledOutSignal, packet);
+    signalEmissionCache.emit(this, packetPulledOutSignal, packet);
     if (collector != nullptr)
         animatePullPacket(packet, outputGate, collector.getReferencedGate());
     updateDisplayString();
@@ -174,10 +176,10 @@ Packet *PacketFlowBase::pullPacketStart(const cGate *gate, bps datarate)
     checkPacketStreaming(nullptr);
     auto packet = provider.pullPacketStart(datarate);
     take(packet);
-    emit(packetPulledInSignal, packet);
+    signalEmissionCache.emit(this, packetPulledInSignal, packet);
     inProgressStreamId = packet->getTreeId();
     processPacket(packet);
-    emit(packetPulledOutSignal, packet);
+    signalEmissionCache.emit(this, packetPulledOutSignal, packet);
     if (collector != nullptr)
         animatePullPacketStart(packet, outputGate, collector.getReferencedGate(), datarate, packet->getTransmissionId());
     updateDisplayString();
@@ -190,10 +192,10 @@ Packet *PacketFlowBase::pullPacketEnd(const cGate *gate)
     auto packet = provider.pullPacketEnd();
     take(packet);
     checkPacketStreaming(packet);
-    emit(packetPulledInSignal, packet);
+    signalEmissionCache.emit(this, packetPulledInSignal, packet);
     processPacket(packet);
     inProgressStreamId = packet->getTreeId();
-    emit(packetPulledOutSignal, packet);
+    signalEmissionCache.emit(this, packetPulledOutSignal, packet);
     endPacketStreaming(packet);
     if (collector != nullptr)
         animatePullPacketEnd(packet, outputGate, collector.getReferencedGate(), packet->getTransmissionId());
@@ -211,7 +213,7 @@ Packet *PacketFlowBase::pullPacketProgress(const cGate *gate, bps datarate, b po
     bool isPacketEnd = packet->getDataLength() == position + extraProcessableLength;
     processPacket(packet);
     if (isPacketEnd) {
-        emit(packetPulledOutSignal, packet);
+        signalEmissionCache.emit(this, packetPulledOutSignal, packet);
         endPacketStreaming(packet);
     }
     if (collector != nullptr)
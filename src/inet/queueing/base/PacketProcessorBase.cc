@@ -17,13 +17,17 @@ void PacketProcessorBase::initialize(int stage)
 {
     if (stage == INITSTAGE_LOCAL) {
         displayStringTextFormat = par("displayStringTextFormat");
+        cacheListenedSignals = par("cacheListenedSignals");
         numProcessedPackets = 0;
         processedTotalLength = b(0);
         WATCH(numProcessedPackets);
         WATCH(processedTotalLength);
     }
-    else if (stage == INITSTAGE_LAST)
+    else if (stage == INITSTAGE_LAST) {
+        if (cacheListenedSignals)
+            signalEmissionCache.build(this, { packetPushedInSignal, packetPushedOutSignal, packetPulledInSignal, packetPulledOutSignal });
         updateDisplayString();
+    }
 }
 
 void PacketProcessorBase::refreshDisplay() const
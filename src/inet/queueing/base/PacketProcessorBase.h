@@ -9,6 +9,7 @@
 #define __INET_PACKETPROCESSORBASE_H
 
 #include "inet/common/packet/Packet.h"
+#include "inet/common/SignalEmissionCache.h"
 #include "inet/common/Simsignals.h"
 #include "inet/common/StringFormat.h"
 #include "inet/queueing/common/PassivePacketSinkRef.h"
@@ -29,6 +30,8 @@ class INET_API PacketProcessorBase : public cSimpleModule, public virtual IPacke
     const char *displayStringTextFormat = nullptr;
     int numProcessedPackets = -1;
     b processedTotalLength = b(-1);
+    bool cacheListenedSignals = false;
+    SignalEmissionCache signalEmissionCache;
 
   protected:
     virtual int numInitStages() const override { return NUM_INIT_STAGES; }
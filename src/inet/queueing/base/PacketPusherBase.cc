@@ -7,6 +7,7 @@
 
 #include "inet/queueing/base/PacketPusherBase.h"
 
+#include "inet/common/HotPathProfiler.h"
 #include "inet/common/ModuleAccess.h"
 #include "inet/common/Simsignals.h"
 
@@ -30,6 +31,7 @@ void PacketPusherBase::initialize(int stage)
 
 void PacketPusherBase::handleMessage(cMessage *message)
 {
+    HotPathProfiler::Measurement measurement(this);
     auto packet = check_and_cast<Packet *>(message);
     pushPacket(packet, packet->getArrivalGate());
 }
@@ -7,6 +7,7 @@
 
 #include "inet/queueing/base/PacketQueueBase.h"
 
+#include "inet/common/HotPathProfiler.h"
 #include "inet/common/Simsignals.h"
 #include "inet/common/StringFormat.h"
 
@@ -34,6 +35,7 @@ void PacketQueueBase::initialize(int stage)
 
 void PacketQueueBase::handleMessage(cMessage *message)
 {
+    HotPathProfiler::Measurement measurement(this);
     auto packet = check_and_cast<Packet *>(message);
     pushPacket(packet, packet->getArrivalGate());
 }
@@ -7,6 +7,7 @@
 
 #include "inet/queueing/base/PassivePacketSinkBase.h"
 
+#include "inet/common/HotPathProfiler.h"
 #include "inet/common/ModuleAccess.h"
 
 namespace inet {
@@ -25,6 +26,7 @@ void PassivePacketSinkBase::initialize(int stage)
 
 void PassivePacketSinkBase::handleMessage(cMessage *message)
 {
+    HotPathProfiler::Measurement measurement(this);
     auto packet = check_and_cast<Packet *>(message);
     pushPacket(packet, packet->getArrivalGate());
 }
@@ -45,12 +45,23 @@ bool PacketBuffer::isOverloaded() const
            (dataCapacity != b(-1) && getTotalLength() > dataCapacity);
 }
 
-b PacketBuffer::getTotalLength() const
+void PacketBuffer::accountAddedPacket(Packet *packet)
 {
-    b totalLength = b(0);
-    for (auto packet : packets)
-        totalLength += packet->getDataLength();
-    return totalLength;
+    totalLength += packet->getDataLength();
+    if (auto queue = dynamic_cast<cPacketQueue *>(packet->getOwner()))
+        queueTotalLengths[queue] += packet->getDataLength();
+}
+
+void PacketBuffer::accountRemovedPacket(Packet *packet)
+{
+    totalLength -= packet->getDataLength();
+    if (auto queue = dynamic_cast<cPacketQueue *>(packet->getOwner())) {
+        auto it = queueTotalLengths.find(queue);
+        ASSERT(it != queueTotalLengths.end());
+        it->second -= packet->getDataLength();
+        if (it->second == b(0))
+            queueTotalLengths.erase(it);
+    }
 }
 
 void PacketBuffer::addPacket(Packet *packet)
@@ -59,12 +70,14 @@ void PacketBuffer::addPacket(Packet *packet)
     EV_INFO << "Adding packet" << EV_FIELD(packet) << EV_ENDL;
     emit(packetAddedSignal, packet);
     packets.push_back(packet);
+    accountAddedPacket(packet);
     if (isOverloaded()) {
         if (packetDropperFunction != nullptr) {
             while (!isEmpty() && isOverloaded()) {
                 auto packet = packetDropperFunction->selectPacket(this);
                 EV_INFO << "Dropping packet" << EV_FIELD(packet) << EV_ENDL;
                 packets.erase(find(packets, packet));
+                accountRemovedPacket(packet);
                 auto queue = dynamic_cast<cPacketQueue *>(packet->getOwner());
                 if (queue != nullptr) {
                     ICallback *callback = dynamic_cast<ICallback *>(queue->getOwner());
@@ -88,6 +101,7 @@ void PacketBuffer::removePacket(Packet *packet)
     EV_INFO << "Removing packet" << EV_FIELD(packet) << EV_ENDL;
     emit(packetRemovedSignal, packet);
     packets.erase(find(packets, packet));
+    accountRemovedPacket(packet);
     updateDisplayString();
     auto queue = dynamic_cast<cPacketQueue *>(packet->getOwner());
     if (queue != nullptr) {
@@ -105,6 +119,7 @@ void PacketBuffer::removeAllPackets()
         auto packet = getPacket(0);
         emit(packetRemovedSignal, packet);
         packets.erase(packets.begin());
+        accountRemovedPacket(packet);
         auto queue = dynamic_cast<cPacketQueue *>(packet->getOwner());
         if (queue != nullptr) {
             ICallback *callback = dynamic_cast<ICallback *>(queue->getOwner());
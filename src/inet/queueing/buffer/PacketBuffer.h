@@ -23,6 +23,8 @@ class INET_API PacketBuffer : public PacketBufferBase, public virtual IPacketBuf
     b dataCapacity = b(-1);
 
     std::vector<Packet *> packets;
+    b totalLength = b(0); // maintained incrementally, the packet list is not scanned per operation
+    std::map<cPacketQueue *, b> queueTotalLengths; // buffered data per connected packet queue, maintained incrementally
 
     IPacketDropperFunction *packetDropperFunction = nullptr;
 
@@ -31,6 +33,9 @@ class INET_API PacketBuffer : public PacketBufferBase, public virtual IPacketBuf
     virtual IPacketDropperFunction *createDropperFunction(const char *dropperClass) const;
     virtual bool isOverloaded() const;
 
+    virtual void accountAddedPacket(Packet *packet);
+    virtual void accountRemovedPacket(Packet *packet);
+
   public:
     virtual ~PacketBuffer() { delete packetDropperFunction; }
 
@@ -38,7 +43,8 @@ class INET_API PacketBuffer : public PacketBufferBase, public virtual IPacketBuf
     virtual int getNumPackets() const override { return packets.size(); }
 
     virtual b getMaxTotalLength() const override { return dataCapacity; }
-    virtual b getTotalLength() const override;
+    virtual b getTotalLength() const override { return totalLength; }
+    virtual const std::map<cPacketQueue *, b>& getQueueTotalLengths() const { return queueTotalLengths; }
 
     virtual Packet *getPacket(int index) const override;
     virtual bool isEmpty() const override { return packets.size() == 0; }
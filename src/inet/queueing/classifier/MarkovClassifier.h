@@ -26,6 +26,7 @@ class INET_API MarkovClassifier : public ClockUserModuleMixin<PacketClassifierBa
     std::vector<ActivePacketSinkRef> collectors;
 
     std::vector<std::vector<double>> transitionProbabilities;
+    std::vector<std::vector<double>> transitionCdfs; // per-state partial sums of transitionProbabilities, precomputed for sampling
     std::vector<cDynamicExpression> waitIntervals;
 
     int state;
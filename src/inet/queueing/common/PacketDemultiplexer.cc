@@ -36,6 +36,13 @@ void PacketDemultiplexer::initialize(int stage)
     }
 }
 
+cGate *PacketDemultiplexer::getPassThroughInputGate(const cGate *g)
+{
+    // a demultiplexer with a single output merely forwards pulled packets, so it
+    // can be compiled out of the pull path when its statistics are not needed
+    return gateSize("out") == 1 && par("fusePacketPulling") ? gate("in") : nullptr;
+}
+
 Packet *PacketDemultiplexer::pullPacket(const cGate *gate)
 {
     Enter_Method("pullPacket");
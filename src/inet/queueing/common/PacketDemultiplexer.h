@@ -32,6 +32,8 @@ class INET_API PacketDemultiplexer : public PacketProcessorBase, public virtual
   public:
     virtual IPassivePacketSource *getProvider(const cGate *gate) override { return provider; }
 
+    virtual cGate *getPassThroughInputGate(const cGate *gate) override;
+
     virtual bool supportsPacketPushing(const cGate *gate) const override { return false; }
     virtual bool supportsPacketPulling(const cGate *gate) const override { return true; }
 
@@ -37,6 +37,13 @@ void PacketMultiplexer::initialize(int stage)
     }
 }
 
+cGate *PacketMultiplexer::getPassThroughOutputGate(const cGate *g)
+{
+    // a multiplexer with a single input merely forwards pushed packets, so it
+    // can be compiled out of the push path when its statistics are not needed
+    return gateSize("in") == 1 && par("fusePacketPushing") ? gate("out") : nullptr;
+}
+
 void PacketMultiplexer::handleMessage(cMessage *message)
 {
     auto packet = check_and_cast<Packet *>(message);
@@ -45,6 +45,8 @@ class INET_API PacketMultiplexer : public PacketProcessorBase, public virtual IP
   public:
     virtual IPassivePacketSink *getConsumer(const cGate *gate) override { return consumer; }
 
+    virtual cGate *getPassThroughOutputGate(const cGate *gate) override;
+
     virtual bool supportsPacketPulling(const cGate *gate) const override { return false; }
     virtual bool supportsPacketPushing(const cGate *gate) const override { return true; }
     virtual bool supportsPacketStreaming(const cGate *gate) const override { return true; }
@@ -19,6 +19,25 @@ class INET_API PassivePacketSinkRef : public ModuleRefByGate<IPassivePacketSink>
   public:
     virtual ~PassivePacketSinkRef() {}
 
+    /**
+     * Resolves the reference, then follows any chain of pass-through elements
+     * to its end, so packets are pushed with a single call directly into the
+     * first element that actually processes them.
+     */
+    void reference(cGate *referencingGate, bool mandatory, int direction = 0) {
+        ModuleRefByGate<IPassivePacketSink>::reference(referencingGate, mandatory, direction);
+        while (referencedModule != nullptr) {
+            auto passThroughOutputGate = referencedModule->getPassThroughOutputGate(referencedGate);
+            if (passThroughOutputGate == nullptr)
+                break;
+            auto pair = findConnectedModuleAndGate<IPassivePacketSink>(passThroughOutputGate);
+            if (pair.first == nullptr)
+                break;
+            referencedModule = pair.first;
+            referencedGate = pair.second;
+        }
+    }
+
     virtual bool canPushSomePacket() const {
         return referencedModule->canPushSomePacket(referencedGate);
     }
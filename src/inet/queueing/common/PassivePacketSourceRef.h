@@ -19,6 +19,25 @@ class INET_API PassivePacketSourceRef : public ModuleRefByGate<IPassivePacketSou
   public:
     virtual ~PassivePacketSourceRef() {}
 
+    /**
+     * Resolves the reference, then follows any chain of pass-through elements
+     * to its beginning, so packets are pulled with a single call directly from
+     * the first element that actually provides them.
+     */
+    void reference(cGate *referencingGate, bool mandatory, int direction = 0) {
+        ModuleRefByGate<IPassivePacketSource>::reference(referencingGate, mandatory, direction);
+        while (referencedModule != nullptr) {
+            auto passThroughInputGate = referencedModule->getPassThroughInputGate(referencedGate);
+            if (passThroughInputGate == nullptr)
+                break;
+            auto pair = findConnectedModuleAndGate<IPassivePacketSource>(passThroughInputGate);
+            if (pair.first == nullptr)
+                break;
+            referencedModule = pair.first;
+            referencedGate = pair.second;
+        }
+    }
+
     virtual bool canPullSomePacket() const {
         return referencedModule->canPullSomePacket(referencedGate);
     }
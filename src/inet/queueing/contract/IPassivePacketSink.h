@@ -22,6 +22,18 @@ class INET_API IPassivePacketSink
   public:
     virtual ~IPassivePacketSink() {}
 
+    /**
+     * Returns the output gate this module would immediately forward packets
+     * pushed at the given gate to, or nullptr if the module actually processes
+     * pushed packets. Returning a non-nullptr gate allows chains of such
+     * pass-through elements to be compiled into a single direct reference when
+     * the pipeline is resolved at initialization time, eliminating per-element
+     * call and signal emission overhead. The result must only depend on the
+     * network topology and module parameters, because it may be queried before
+     * this module is initialized.
+     */
+    virtual cGate *getPassThroughOutputGate(const cGate *gate) { return nullptr; }
+
     /**
      * Returns true if packets can be pushed at the given gate into the packet
      * sink.
@@ -22,6 +22,18 @@ class INET_API IPassivePacketSource
   public:
     virtual ~IPassivePacketSource() {}
 
+    /**
+     * Returns the input gate this module would immediately pull packets from
+     * when pulled at the given gate, or nullptr if the module actually
+     * processes pulled packets. Returning a non-nullptr gate allows chains of
+     * such pass-through elements to be compiled into a single direct reference
+     * when the pipeline is resolved at initialization time, eliminating
+     * per-element call and signal emission overhead. The result must only
+     * depend on the network topology and module parameters, because it may be
+     * queried before this module is initialized.
+     */
+    virtual cGate *getPassThroughInputGate(const cGate *gate) { return nullptr; }
+
     /**
      * Returns true if packets can be pulled at the given gate from the packet
      * source.
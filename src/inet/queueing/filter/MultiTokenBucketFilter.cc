@@ -0,0 +1,76 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#include "inet/queueing/filter/MultiTokenBucketFilter.h"
+
+#include "inet/queueing/common/LabelsTag_m.h"
+
+namespace inet {
+namespace queueing {
+
+Define_Module(MultiTokenBucketFilter);
+
+template class TokenBucketClassifierMixin<MultiTokenBucketMixin<PacketFilterBase>>;
+
+void MultiTokenBucketFilter::initialize(int stage)
+{
+    TokenBucketClassifierMixin<MultiTokenBucketMixin<PacketFilterBase>>::initialize(stage);
+    if (stage == INITSTAGE_LOCAL) {
+        cValueArray *bucketConfigurations = check_and_cast<cValueArray *>(par("buckets").objectValue());
+        for (int i = 0; i < bucketConfigurations->size(); i++) {
+            cValueMap *bucketConfiguration = check_and_cast<cValueMap *>(bucketConfigurations->get(i).objectValue());
+            labels.push_back(bucketConfiguration->containsKey("label") ? bucketConfiguration->get("label").stringValue() : "");
+        }
+        WATCH_VECTOR(tokenBuckets);
+    }
+}
+
+cGate *MultiTokenBucketFilter::getRegistrationForwardingGate(cGate *gate)
+{
+    if (gate == outputGate)
+        return inputGate;
+    else if (gate == inputGate)
+        return outputGate;
+    else
+        throw cRuntimeError("Unknown gate");
+}
+
+bool MultiTokenBucketFilter::canPushPacket(Packet *packet, const cGate *gate) const
+{
+    return consumer == nullptr || consumer.canPushPacket(packet);
+}
+
+bool MultiTokenBucketFilter::matchesPacket(const Packet *packet) const
+{
+    auto self = const_cast<MultiTokenBucketFilter *>(this);
+    self->emitTokensChangedSignals();
+    auto numTokens = getNumPacketTokens(const_cast<Packet *>(packet));
+    for (size_t i = 0; i < tokenBuckets.size(); i++) {
+        auto& tokenBucket = self->tokenBuckets[i];
+        EV_DEBUG << "Checking tokens for packet" << EV_FIELD(numTokens) << EV_FIELD(tokenBucket) << EV_FIELD(packet) << EV_ENDL;
+        if (tokenBucket.getNumTokens() >= numTokens) {
+            tokenBucket.removeTokens(numTokens);
+            EV_INFO << "Removed tokens from ith bucket for packet" << EV_FIELD(numTokens) << EV_FIELD(i) << EV_FIELD(tokenBucket) << EV_FIELD(packet) << EV_ENDL;
+            self->emitTokensChangedSignals();
+            lastMatchedBucket = i;
+            return true;
+        }
+    }
+    EV_INFO << "Insufficient number of tokens for packet" << EV_FIELD(numTokens) << EV_FIELD(packet) << EV_ENDL;
+    lastMatchedBucket = -1;
+    return false;
+}
+
+void MultiTokenBucketFilter::processPacket(Packet *packet)
+{
+    auto& label = labels[lastMatchedBucket];
+    if (!label.empty())
+        packet->addTagIfAbsent<LabelsTag>()->appendLabels(label.c_str());
+}
+
+} // namespace queueing
+} // namespace inet
@@ -0,0 +1,45 @@
+//
+// Copyright (C) 2020 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#ifndef __INET_MULTITOKENBUCKETFILTER_H
+#define __INET_MULTITOKENBUCKETFILTER_H
+
+#include "inet/common/IProtocolRegistrationListener.h"
+#include "inet/queueing/base/MultiTokenBucketMixin.h"
+#include "inet/queueing/base/PacketFilterBase.h"
+#include "inet/queueing/base/TokenBucketClassifierMixin.h"
+
+namespace inet {
+namespace queueing {
+
+extern template class TokenBucketClassifierMixin<MultiTokenBucketMixin<PacketFilterBase>>;
+
+class INET_API MultiTokenBucketFilter : public TokenBucketClassifierMixin<MultiTokenBucketMixin<PacketFilterBase>>, public TransparentProtocolRegistrationListener
+{
+  protected:
+    std::vector<std::string> labels;
+
+    mutable int lastMatchedBucket = -1; // set by matchesPacket, used by processPacket to label the passed packet
+
+  protected:
+    virtual void initialize(int stage) override;
+
+    virtual cGate *getRegistrationForwardingGate(cGate *gate) override;
+
+    // NOTE: cannot answer because matchesPacket consumes tokens
+    virtual bool canPushPacket(Packet *packet, const cGate *gate) const override;
+
+    virtual bool matchesPacket(const Packet *packet) const override;
+    virtual void processPacket(Packet *packet) override;
+
+    virtual std::string getTokenBucketName(int i) override { return labels[i].empty() ? std::to_string(i) : labels[i]; }
+};
+
+} // namespace queueing
+} // namespace inet
+
+#endif
@@ -23,6 +23,7 @@ void RedDropper::initialize(int stage)
         wq = par("wq");
         if (wq < 0.0 || wq > 1.0)
             throw cRuntimeError("Invalid value for wq parameter: %g", wq);
+        oneMinusWq = 1 - wq;
         minth = par("minth");
         maxth = par("maxth");
         maxp = par("maxp");
@@ -60,12 +61,13 @@ RedDropper::RedResult RedDropper::doRandomEarlyDetection(const Packet *packet)
 
     if (queueLength > 0) {
         // TD: This following calculation is only useful when the queue is not empty!
-        avg = (1 - wq) * avg + wq * queueLength;
+        avg = oneMinusWq * avg + wq * queueLength;
     }
     else {
         // TD: Added behaviour for empty queue.
         const double m = SIMTIME_DBL(simTime() - q_time) * pkrate;
-        avg = pow(1 - wq, m) * avg;
+        if (m != 0 && avg != 0) // pow(x, 0) == 1 and anything times 0 is 0, so the result is the same without the expensive pow() call
+            avg = pow(oneMinusWq, m) * avg;
         q_time = simTime();
     }
 
@@ -148,7 +150,7 @@ void RedDropper::processPacket(Packet *packet)
 
 void RedDropper::receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj, cObject *details)
 {
-    Enter_Method("%s", cComponent::getSignalName(signalID));
+    Enter_Method_Silent("%s", cComponent::getSignalName(signalID)); // this runs for every queue operation, don't animate it
 
     if (signalID == packetPushedSignal || signalID == packetPulledSignal || signalID == packetRemovedSignal || signalID == packetDroppedSignal)
         q_time = simTime();
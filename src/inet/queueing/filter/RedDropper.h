@@ -26,6 +26,7 @@ class INET_API RedDropper : public PacketFilterBase, public cListener
 
   protected:
     double wq = 0.0;
+    double oneMinusWq = 1.0; // precomputed for the per-packet averaging
     double minth = NaN;
     double maxth = NaN;
     double maxp = NaN;
@@ -8,6 +8,7 @@
 #include "inet/queueing/flow/FlowMeasurementRecorder.h"
 
 #include "inet/common/FlowTag.h"
+#include "inet/common/stlutils.h"
 
 namespace inet {
 namespace queueing {
@@ -68,9 +69,20 @@ void FlowMeasurementRecorder::makeMeasurements(Packet *packet)
     emit(packetFlowMeasuredSignal, packet);
 }
 
+bool FlowMeasurementRecorder::matchesFlowName(const char *flowName)
+{
+    auto it = flowNameMatchCache.find(flowName);
+    if (it != flowNameMatchCache.end())
+        return it->second;
+    cMatchableString matchableFlowName(flowName);
+    bool matches = flowNameMatcher.matches(&matchableFlowName);
+    flowNameMatchCache[flowName] = matches;
+    return matches;
+}
+
 void FlowMeasurementRecorder::endMeasurements(Packet *packet)
 {
-    std::set<std::string> endedFlowNames;
+    std::vector<std::string> endedFlowNames;
     b length = this->length == b(-1) ? packet->getDataLength() - offset : this->length;
     if (measureElapsedTime)
         endMeasurement<ElapsedTimeTag>(packet, offset, length);
@@ -87,9 +99,9 @@ void FlowMeasurementRecorder::endMeasurements(Packet *packet)
     packet->mapAllRegionTagsForUpdate<FlowTag>(offset, length, [&] (b o, b l, const Ptr<FlowTag>& flowTag) {
         for (size_t i = 0; i < flowTag->getNamesArraySize(); i++) {
             auto flowName = flowTag->getNames(i);
-            cMatchableString matchableFlowName(flowName);
-            if (flowNameMatcher.matches(&matchableFlowName)) {
-                endedFlowNames.insert(flowName);
+            if (matchesFlowName(flowName)) {
+                if (!contains(endedFlowNames, flowName))
+                    endedFlowNames.push_back(flowName);
                 flowTag->eraseNames(i);
                 i--;
             }
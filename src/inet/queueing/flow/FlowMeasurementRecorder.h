@@ -8,6 +8,8 @@
 #ifndef __INET_FLOWMEASUREMENTRECORDER_H
 #define __INET_FLOWMEASUREMENTRECORDER_H
 
+#include <map>
+
 #include "inet/common/IProtocolRegistrationListener.h"
 #include "inet/common/TimeTag_m.h"
 #include "inet/common/packet/PacketFilter.h"
@@ -28,6 +30,7 @@ class INET_API FlowMeasurementRecorder : public PacketFlowBase, public Transpare
     bool endMeasurement_ = false;
     const char *flowName = nullptr;
     cMatchExpression flowNameMatcher;
+    std::map<std::string, bool, std::less<>> flowNameMatchCache; // match results by flow name, so each flow is pattern matched only once
     bool measureLifeTime = false;
     bool measureElapsedTime = false;
     bool measureDelayingTime = false;
@@ -41,6 +44,8 @@ class INET_API FlowMeasurementRecorder : public PacketFlowBase, public Transpare
     virtual void makeMeasurements(Packet *packet);
     virtual void endMeasurements(Packet *packet);
 
+    virtual bool matchesFlowName(const char *flowName);
+
     virtual cGate *getRegistrationForwardingGate(cGate *gate) override;
 
     template<typename T>
@@ -48,8 +53,7 @@ class INET_API FlowMeasurementRecorder : public PacketFlowBase, public Transpare
         packet->mapAllRegionTagsForUpdate<T>(offset, length, [&] (b o, b l, const Ptr<T>& timeTag) {
             for (size_t i = 0; i < timeTag->getBitTotalTimesArraySize(); i++) {
                 auto flowName = timeTag->getFlowNames(i);
-                cMatchableString matchableFlowName(flowName);
-                if (flowNameMatcher.matches(&matchableFlowName)) {
+                if (matchesFlowName(flowName)) {
                     EV_INFO << "Stopping measurement on packet" << EV_FIELD(offset) << EV_FIELD(length);
                     if (flowName != nullptr && *flowName != '\0')
                         EV_INFO << EV_FIELD(flowName);
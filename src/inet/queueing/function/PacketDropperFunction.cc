@@ -8,6 +8,7 @@
 #include "inet/queueing/function/PacketDropperFunction.h"
 
 #include "inet/common/Simsignals.h"
+#include "inet/queueing/buffer/PacketBuffer.h"
 
 namespace inet {
 namespace queueing {
@@ -67,6 +68,53 @@ static Packet *selectPacketWithHighestOwnerModuleId(IPacketCollection *collectio
 
 Register_Packet_Dropper_Function(PacketWithHighestOwnerModuleIdDropper, selectPacketWithHighestOwnerModuleId);
 
+static Packet *selectPacketFromLongestQueue(IPacketCollection *collection)
+{
+    // shared buffers maintain the per-queue data amounts incrementally, the
+    // victim is found without scanning the packets; the maps are keyed by
+    // pointers, so ties are broken by owner module id to keep the drop
+    // pattern independent of heap addresses
+    if (auto buffer = dynamic_cast<PacketBuffer *>(collection)) {
+        cPacketQueue *longestQueue = nullptr;
+        b longestLength = b(-1);
+        int longestQueueModuleId = -1;
+        for (const auto& elem : buffer->getQueueTotalLengths()) {
+            int moduleId = check_and_cast<cModule *>(elem.first->getOwner())->getId();
+            if (elem.second > longestLength || (elem.second == longestLength && moduleId < longestQueueModuleId)) {
+                longestLength = elem.second;
+                longestQueue = elem.first;
+                longestQueueModuleId = moduleId;
+            }
+        }
+        if (longestQueue != nullptr)
+            return check_and_cast<Packet *>(longestQueue->front());
+    }
+    std::map<cObject *, b> queueTotalLengths;
+    for (int index = 0; index < collection->getNumPackets(); index++) {
+        auto packet = collection->getPacket(index);
+        queueTotalLengths[packet->getOwner()] += packet->getDataLength();
+    }
+    cObject *longestQueue = nullptr;
+    b longestLength = b(-1);
+    int longestQueueModuleId = -1;
+    for (const auto& elem : queueTotalLengths) {
+        int moduleId = check_and_cast<cModule *>(elem.first->getOwner())->getId();
+        if (elem.second > longestLength || (elem.second == longestLength && moduleId < longestQueueModuleId)) {
+            longestLength = elem.second;
+            longestQueue = elem.first;
+            longestQueueModuleId = moduleId;
+        }
+    }
+    for (int index = 0; index < collection->getNumPackets(); index++) {
+        auto packet = collection->getPacket(index);
+        if (packet->getOwner() == longestQueue)
+            return packet;
+    }
+    return nullptr;
+}
+
+Register_Packet_Dropper_Function(PacketFromLongestQueueDropper, selectPacketFromLongestQueue);
+
 } // namespace queueing
 } // namespace inet
 
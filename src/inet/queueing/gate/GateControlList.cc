@@ -7,6 +7,8 @@
 
 #include "inet/queueing/gate/GateControlList.h"
 
+#include <algorithm>
+
 namespace inet {
 namespace queueing {
 
@@ -20,16 +22,10 @@ void GateControlList::initialize(int stage)
         durations = check_and_cast<cValueArray *>(par("durations").objectValue());
         gateStates = check_and_cast<cValueArray *>(par("gateStates").objectValue());
 
-        parseGcl();
-
-        for (int index = 0; index < numGates; ++index) {
-            std::string modulePath = "^.transmissionGate[" + std::to_string(index) + "]";
-            PeriodicGate *mod = check_and_cast<PeriodicGate *>(getModuleByPath(modulePath.c_str()));
-            cPar& offsetPar = mod->par("offset");
-            offsetPar.setDoubleValue(offset.dbl());
-            cPar& durationsPar = mod->par("durations");
-            durationsPar.copyIfShared();
-            durationsPar.setObjectValue(durations);
+        if (durations->size() > 0) {
+            compileGcl();
+            for (int index = 0; index < numGates; ++index)
+                configureGate(index);
         }
     }
 }
@@ -39,46 +35,79 @@ void GateControlList::handleMessage(cMessage *msg)
     throw cRuntimeError("Do not handle cMessage");
 }
 
-void GateControlList::parseGcl() {
+void GateControlList::compileGcl() {
     if (durations->size() != gateStates->size()) {
         throw cRuntimeError("The length of durations is not equal to gateStates.");
     }
 
-    for (int i = 0; i < numGates; ++i) {
-        gateDurations.emplace_back(new cValueArray());
-    }
-
     int numEntries = durations->size();
-    std::vector<bool> currentGateStates(numGates, true);
-    std::vector<double> currentDuration(numGates, 0);
-
+    compiledSchedule.clear();
+    cycleDuration = 0;
     for (int indexEntry = 0; indexEntry < numEntries; ++indexEntry) {
-        const char *curGateStates = gateStates->get(indexEntry).stringValue();
+        std::vector<bool> entry = retrieveGateStates(gateStates->get(indexEntry).stringValue(), numGates);
         double duration = durations->get(indexEntry).doubleValueInUnit("s");
-
-        std::vector<bool> entry = retrieveGateStates(curGateStates, numGates);
-
-        for (int i = 0; i < numGates; ++i) {
-            if (entry.at(i) != currentGateStates.at(i)) {
-                gateDurations.at(i)->add(cValue(currentDuration[i], "s"));
-
-                currentGateStates[i] = !currentGateStates[i];
-                currentDuration[i] = 0;
-            }
-
-            currentDuration[i] += duration;
+        if (duration <= 0)
+            throw cRuntimeError("Unaccepted duration value (%s) at position %d", durations->get(indexEntry).str().c_str(), indexEntry);
+
+        // consecutive entries with identical gate states are merged into one segment
+        if (compiledSchedule.empty() || compiledSchedule.back().gateStates != entry) {
+            ScheduleEntry scheduleEntry;
+            scheduleEntry.offset = cycleDuration;
+            scheduleEntry.gateStates = entry;
+            compiledSchedule.push_back(scheduleEntry);
         }
-
+        cycleDuration += duration;
     }
+}
 
-    for (int i = 0; i < numGates; ++i) {
-        gateDurations.at(i)->add(cValue(currentDuration[i], "s"));
+void GateControlList::configureGate(int index) {
+    std::string modulePath = "^.transmissionGate[" + std::to_string(index) + "]";
+    PeriodicGate *mod = check_and_cast<PeriodicGate *>(getModuleByPath(modulePath.c_str()));
+
+    // collect the offsets within the cycle where the state of this gate changes
+    std::vector<double> changeOffsets;
+    int numEntries = compiledSchedule.size();
+    for (int i = 0; i < numEntries; ++i) {
+        bool previousState = compiledSchedule[(i + numEntries - 1) % numEntries].gateStates[index];
+        if (compiledSchedule[i].gateStates[index] != previousState)
+            changeOffsets.push_back(compiledSchedule[i].offset);
+    }
 
-        if (gateDurations.at(i)->size() % 2 != 0) {
-            gateDurations.at(i)->add(cValue(0.0, "s"));
+    bool initiallyOpen;
+    double gateOffset;
+    cValueArray *gateDurations = new cValueArray();
+    if (changeOffsets.empty()) {
+        // the gate state is constant over the whole cycle, no durations are needed
+        initiallyOpen = compiledSchedule.at(0).gateStates[index];
+        gateOffset = 0;
+    }
+    else {
+        // rotate the schedule of the gate to start at its first state change, so
+        // that no zero length durations are needed, and compensate in the offset;
+        // the number of state changes over a cycle is always even
+        double rotation = changeOffsets[0];
+        for (size_t i = 0; i < changeOffsets.size(); ++i) {
+            double nextOffset = i + 1 < changeOffsets.size() ? changeOffsets[i + 1] : cycleDuration + changeOffsets[0];
+            gateDurations->add(cValue(nextOffset - changeOffsets[i], "s"));
         }
+        initiallyOpen = getGateStates(rotation)[index];
+        gateOffset = offset.dbl() + cycleDuration - rotation;
     }
 
+    mod->par("initiallyOpen").setBoolValue(initiallyOpen);
+    mod->par("offset").setDoubleValue(gateOffset);
+    cPar& durationsPar = mod->par("durations");
+    durationsPar.copyIfShared();
+    durationsPar.setObjectValue(gateDurations);
+}
+
+const std::vector<bool>& GateControlList::getGateStates(double timeInCycle) const
+{
+    ASSERT(!compiledSchedule.empty());
+    // find the last segment starting at or before the given time
+    auto it = std::upper_bound(compiledSchedule.begin(), compiledSchedule.end(), timeInCycle,
+            [] (double time, const ScheduleEntry& entry) { return time < entry.offset; });
+    return (it - 1)->gateStates;
 }
 
 std::vector<bool> GateControlList::retrieveGateStates(const char *gateStates, uint numGates) {
@@ -101,11 +130,5 @@ std::vector<bool> GateControlList::retrieveGateStates(const char *gateStates, ui
     return res;
 }
 
-GateControlList::~GateControlList() {
-    for (int i = 0; i < numGates; ++i) {
-        delete gateDurations.at(i);
-    }
-}
-
 } // namespace queueing
 } // namespace inet
@@ -16,25 +16,38 @@ namespace queueing {
 class INET_API GateControlList : public cSimpleModule
 {
   protected:
+    /**
+     * One segment of the compiled gate control list: the gate states are
+     * constant from the segment offset until the offset of the next entry
+     * (or until the end of the cycle for the last entry).
+     */
+    struct ScheduleEntry {
+        double offset = 0; // segment start within the cycle, in seconds
+        std::vector<bool> gateStates; // per-gate open state during the segment
+    };
+
     int numGates;
     clocktime_t offset;
     cValueArray *durations = nullptr;
     cValueArray *gateStates = nullptr;
 
+    double cycleDuration = 0;
+    std::vector<ScheduleEntry> compiledSchedule; // sorted by offset, consecutive entries with identical gate states merged
+
   protected:
     virtual void initialize(int stage) override;
     virtual void handleMessage(cMessage *msg) override;
 
   private:
-    // ownership
-    std::vector<cValueArray *> gateDurations;
-
-    void parseGcl();
+    void compileGcl();
+    void configureGate(int index);
     static std::vector<bool> retrieveGateStates(const char *gateStates, uint numGates);
 
   public:
-    ~GateControlList();
-
+    /**
+     * Returns the open states of all gates at the given time within the cycle.
+     */
+    const std::vector<bool>& getGateStates(double timeInCycle) const;
 };
 
 } // namespace queueing
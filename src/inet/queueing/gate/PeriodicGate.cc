@@ -24,6 +24,7 @@ void PeriodicGate::initialize(int stage)
         initialOffset = par("offset");
         readDurationsPar();
         scheduleForAbsoluteTime = par("scheduleForAbsoluteTime");
+        lazyGating = par("lazyGating");
         changeTimer = new ClockEvent("ChangeTimer");
         enableImplicitGuardBand = par("enableImplicitGuardBand");
         openSchedulingPriority = par("openSchedulingPriority");
@@ -56,8 +57,18 @@ void PeriodicGate::handleParameterChange(const char *name)
 void PeriodicGate::handleMessage(cMessage *message)
 {
     if (message == changeTimer) {
-        scheduleChangeTimer();
-        processChangeTimer();
+        if (lazyGating) {
+            index = (index + 1) % durations.size();
+            segmentEndClockTime += durations[index];
+            changeTimer->setSchedulingPriority(isOpen_ ? closeSchedulingPriority : openSchedulingPriority);
+            scheduleClockEventAt(segmentEndClockTime, changeTimer);
+            processChangeTimer();
+            updateChangeTimer();
+        }
+        else {
+            scheduleChangeTimer();
+            processChangeTimer();
+        }
     }
     else
         throw cRuntimeError("Unknown message");
@@ -109,8 +120,57 @@ void PeriodicGate::initializeGating()
     }
     if (changeTimer->isScheduled())
         cancelClockEvent(changeTimer);
-    if (durations.size() > 0)
-        scheduleChangeTimer();
+    if (durations.size() > 0) {
+        if (lazyGating) {
+            segmentEndClockTime = getClockTime() + durations[index] - offset;
+            offset = 0;
+            updateChangeTimer();
+        }
+        else
+            scheduleChangeTimer();
+    }
+}
+
+bool PeriodicGate::isGatingRelevant() const
+{
+    // a pushing producer may be waiting for the gate to open, which cannot be queried
+    if (producer != nullptr)
+        return true;
+    return provider == nullptr || provider.canPullPacket() != nullptr;
+}
+
+void PeriodicGate::updateChangeTimer()
+{
+    if (isGatingRelevant()) {
+        if (!changeTimer->isScheduled()) {
+            changeTimer->setSchedulingPriority(isOpen_ ? closeSchedulingPriority : openSchedulingPriority);
+            scheduleClockEventAt(segmentEndClockTime, changeTimer);
+        }
+    }
+    else if (changeTimer->isScheduled())
+        cancelClockEvent(changeTimer);
+}
+
+void PeriodicGate::resyncGating()
+{
+    if (changeTimer->isScheduled())
+        return; // the schedule position is up to date while the change timer is running
+    clocktime_t now = getClockTime();
+    int numChanges = 0;
+    while (segmentEndClockTime <= now) {
+        index = (index + 1) % durations.size();
+        segmentEndClockTime += durations[index];
+        numChanges++;
+    }
+    // skipped segments come in open/close pairs, only an odd number of state
+    // changes leaves the gate in the other state
+    if (numChanges % 2 != 0) {
+        if (isOpen_)
+            close();
+        else
+            open();
+    }
+    updateChangeTimer();
 }
 
 void PeriodicGate::scheduleChangeTimer()
@@ -169,12 +229,16 @@ void PeriodicGate::updateIsInGuardBand()
 
 void PeriodicGate::handleCanPushPacketChanged(const cGate *gate)
 {
+    if (lazyGating)
+        resyncGating();
     PacketGateBase::handleCanPushPacketChanged(gate);
     updateIsInGuardBand();
 }
 
 void PeriodicGate::handleCanPullPacketChanged(const cGate *gate)
 {
+    if (lazyGating)
+        resyncGating();
     PacketGateBase::handleCanPullPacketChanged(gate);
     updateIsInGuardBand();
 }
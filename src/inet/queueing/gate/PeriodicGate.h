@@ -31,9 +31,11 @@ class INET_API PeriodicGate : public ClockUserModuleMixin<PacketGateBase>
     std::vector<clocktime_t> durations;
     bool scheduleForAbsoluteTime = false;
     bool enableImplicitGuardBand = true;
+    bool lazyGating = false;
     int openSchedulingPriority = 0;
     int closeSchedulingPriority = 0;
     bool isInGuardBand_ = false;
+    clocktime_t segmentEndClockTime; // clock time when the current schedule segment ends (lazy gating)
 
     ClockEvent *changeTimer = nullptr;
 
@@ -49,6 +51,25 @@ class INET_API PeriodicGate : public ClockUserModuleMixin<PacketGateBase>
     virtual void processChangeTimer();
     virtual void readDurationsPar();
 
+    /**
+     * Returns true if a gate state change has an observable effect, that is
+     * if a packet may be waiting on either side of the gate.
+     */
+    virtual bool isGatingRelevant() const;
+
+    /**
+     * Schedules the change timer for the end of the current schedule segment
+     * or cancels it while gating is irrelevant (lazy gating).
+     */
+    virtual void updateChangeTimer();
+
+    /**
+     * Advances the schedule position to the current clock time, opening or
+     * closing the gate if the skipped segments left it in the other state
+     * (lazy gating).
+     */
+    virtual void resyncGating();
+
     virtual void updateIsInGuardBand();
 
   public:
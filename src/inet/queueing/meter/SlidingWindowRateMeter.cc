@@ -30,15 +30,11 @@ void SlidingWindowRateMeter::meterPacket(Packet *packet)
     auto now = simTime();
     currentNumPackets++;
     currentTotalPacketLength += packet->getDataLength();
-    packetLengths[now] += packet->getDataLength();
-    for (auto it = packetLengths.begin(); it != packetLengths.end();) {
-        if (it->first < now - timeWindow) {
-            currentNumPackets--;
-            currentTotalPacketLength -= it->second;
-            it = packetLengths.erase(it);
-        }
-        else
-            break;
+    packetWindow.push_back({now, packet->getDataLength()});
+    while (packetWindow.front().time < now - timeWindow) {
+        currentNumPackets--;
+        currentTotalPacketLength -= packetWindow.front().length;
+        packetWindow.pop_front();
     }
     datarate = currentTotalPacketLength / s(timeWindow.dbl());
     packetrate = currentNumPackets /timeWindow.dbl();
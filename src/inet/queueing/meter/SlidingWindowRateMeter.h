@@ -8,6 +8,8 @@
 #ifndef __INET_SLIDINGWINDOWRATEMETER_H
 #define __INET_SLIDINGWINDOWRATEMETER_H
 
+#include <deque>
+
 #include "inet/queueing/base/PacketMeterBase.h"
 
 namespace inet {
@@ -22,7 +24,12 @@ class INET_API SlidingWindowRateMeter : public PacketMeterBase
     bps datarate = bps(0);
     double packetrate = 0;
 
-    std::map<simtime_t, b> packetLengths;
+    struct PacketWindowEntry {
+        simtime_t time;
+        b length;
+    };
+
+    std::deque<PacketWindowEntry> packetWindow; // one entry per metered packet, pruned from the front as the window slides
 
   protected:
     virtual void initialize(int stage) override;
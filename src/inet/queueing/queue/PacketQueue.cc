@@ -33,6 +33,13 @@ void PacketQueue::initialize(int stage)
         if (packetComparatorFunction != nullptr)
             queue.setup(packetComparatorFunction);
         packetDropperFunction = createDropperFunction(par("dropperClass"));
+        recordQuantileSketches = par("recordQuantileSketches");
+        if (recordQuantileSketches) {
+            double sketchRelativeAccuracy = par("sketchRelativeAccuracy");
+            queueingTimeSketch.setRelativeAccuracy(sketchRelativeAccuracy);
+            queueLengthSketch.setRelativeAccuracy(sketchRelativeAccuracy);
+            lastOccupancyChangeTime = simTime();
+        }
     }
     else if (stage == INITSTAGE_QUEUEING) {
         checkPacketOperationSupport(inputGate);
@@ -44,6 +51,39 @@ void PacketQueue::initialize(int stage)
         updateDisplayString();
 }
 
+void PacketQueue::finish()
+{
+    if (recordQuantileSketches) {
+        updateOccupancySketch();
+        recordQuantileSketch("queueLength", queueLengthSketch);
+        recordQuantileSketch("queueingTime", queueingTimeSketch);
+    }
+}
+
+void PacketQueue::updateOccupancySketch()
+{
+    simtime_t now = simTime();
+    if (now > lastOccupancyChangeTime)
+        queueLengthSketch.collect(lastNumPackets, (now - lastOccupancyChangeTime).dbl());
+    lastOccupancyChangeTime = now;
+    lastNumPackets = getNumPackets();
+}
+
+void PacketQueue::recordQuantileSketch(const char *name, const QuantileSketch& sketch)
+{
+    static const double quantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+    for (double q : quantiles) {
+        char scalarName[64];
+        snprintf(scalarName, sizeof(scalarName), "%s p%g", name, 100 * q);
+        recordScalar(scalarName, sketch.computeQuantile(q));
+    }
+    char scalarName[64];
+    snprintf(scalarName, sizeof(scalarName), "%s sketchMin", name);
+    recordScalar(scalarName, sketch.getMin());
+    snprintf(scalarName, sizeof(scalarName), "%s sketchMax", name);
+    recordScalar(scalarName, sketch.getMax());
+}
+
 IPacketDropperFunction *PacketQueue::createDropperFunction(const char *dropperClass) const
 {
     if (strlen(dropperClass) == 0)
@@ -101,6 +141,8 @@ void PacketQueue::pushPacket(Packet *packet, const cGate *gate)
         collector.handleCanPullPacketChanged();
     cNamedObject packetPushEndedDetails("atomicOperationEnded");
     emit(packetPushEndedSignal, nullptr, &packetPushEndedDetails);
+    if (recordQuantileSketches)
+        updateOccupancySketch();
     updateDisplayString();
 }
 
@@ -116,12 +158,18 @@ Packet *PacketQueue::pullPacket(const cGate *gate)
     else
         queue.pop();
     auto queueingTime = simTime() - packet->getArrivalTime();
-    auto packetEvent = new PacketQueuedEvent();
-    packetEvent->setQueuePacketLength(getNumPackets());
-    packetEvent->setQueueDataLength(getTotalLength());
-    insertPacketEvent(this, packet, PEK_QUEUED, queueingTime, packetEvent);
+    if (hasPacketEvents(packet)) {
+        auto packetEvent = new PacketQueuedEvent();
+        packetEvent->setQueuePacketLength(getNumPackets());
+        packetEvent->setQueueDataLength(getTotalLength());
+        insertPacketEvent(this, packet, PEK_QUEUED, queueingTime, packetEvent);
+    }
     increaseTimeTag<QueueingTimeTag>(packet, queueingTime, queueingTime);
     emit(packetPulledSignal, packet);
+    if (recordQuantileSketches) {
+        queueingTimeSketch.collect(queueingTime.dbl());
+        updateOccupancySketch();
+    }
     if (collector != nullptr)
         animatePullPacket(packet, outputGate, collector.getReferencedGate());
     updateDisplayString();
@@ -136,6 +184,8 @@ void PacketQueue::removePacket(Packet *packet)
     if (buffer != nullptr)
         buffer->removePacket(packet);
     emit(packetRemovedSignal, packet);
+    if (recordQuantileSketches)
+        updateOccupancySketch();
     updateDisplayString();
 }
 
@@ -152,6 +202,8 @@ void PacketQueue::removeAllPackets()
         emit(packetRemovedSignal, packet);
         delete packet;
     }
+    if (recordQuantileSketches)
+        updateOccupancySketch();
     updateDisplayString();
 }
 
@@ -184,6 +236,8 @@ void PacketQueue::handlePacketRemoved(Packet *packet)
         EV_INFO << "Removing packet" << EV_FIELD(packet) << EV_ENDL;
         queue.remove(packet);
         emit(packetRemovedSignal, packet);
+        if (recordQuantileSketches)
+            updateOccupancySketch();
         updateDisplayString();
     }
 }
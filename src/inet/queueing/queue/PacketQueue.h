@@ -8,6 +8,7 @@
 #ifndef __INET_PACKETQUEUE_H
 #define __INET_PACKETQUEUE_H
 
+#include "inet/common/QuantileSketch.h"
 #include "inet/queueing/base/PacketQueueBase.h"
 #include "inet/queueing/common/ActivePacketSinkRef.h"
 #include "inet/queueing/common/ActivePacketSourceRef.h"
@@ -35,8 +36,21 @@ class INET_API PacketQueue : public PacketQueueBase, public IPacketBuffer::ICall
     IPacketDropperFunction *packetDropperFunction = nullptr;
     IPacketComparatorFunction *packetComparatorFunction = nullptr;
 
+    // constant memory quantile sketches recorded once at the end of the
+    // simulation, a lightweight alternative to vector recording of the queue
+    // length and queueing time signals
+    bool recordQuantileSketches = false;
+    QuantileSketch queueingTimeSketch;
+    QuantileSketch queueLengthSketch; // time weighted
+    simtime_t lastOccupancyChangeTime;
+    int lastNumPackets = 0;
+
   protected:
     virtual void initialize(int stage) override;
+    virtual void finish() override;
+
+    virtual void updateOccupancySketch();
+    virtual void recordQuantileSketch(const char *name, const QuantileSketch& sketch);
 
     virtual IPacketDropperFunction *createDropperFunction(const char *dropperClass) const;
     virtual IPacketComparatorFunction *createComparatorFunction(const char *comparatorClass) const;
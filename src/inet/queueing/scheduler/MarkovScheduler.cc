@@ -7,6 +7,8 @@
 
 #include "inet/queueing/scheduler/MarkovScheduler.h"
 
+#include <algorithm>
+
 #include "inet/common/ModuleAccess.h"
 
 namespace inet {
@@ -38,6 +40,14 @@ void MarkovScheduler::initialize(int stage)
             for (int j = 0; j < numStates; j++)
                 transitionProbabilities[i].push_back(atof(transitionProbabilitiesTokenizer.nextToken()));
         }
+        transitionCdfs.resize(numStates);
+        for (int i = 0; i < numStates; i++) {
+            double sum = 0;
+            for (int j = 0; j < numStates; j++) {
+                sum += transitionProbabilities[i][j];
+                transitionCdfs[i].push_back(sum);
+            }
+        }
         cStringTokenizer waitIntervalsTokenizer(par("waitIntervals"));
         for (int i = 0; i < numStates; i++) {
             cDynamicExpression expression;
@@ -61,15 +71,10 @@ void MarkovScheduler::handleMessage(cMessage *message)
 {
     if (message == waitTimer) {
         double v = uniform(0, 1);
-        double sum = 0;
-        int numStates = (int)transitionProbabilities.size();
-        for (int i = 0; i < numStates; i++) {
-            sum += transitionProbabilities[state][i];
-            if (sum >= v || i == numStates - 1) {
-                state = i;
-                break;
-            }
-        }
+        // the first state whose partial sum reaches v, found with a binary search
+        // on the precomputed partial sums instead of scanning the probabilities
+        const auto& cdf = transitionCdfs[state];
+        state = std::min((int)(std::lower_bound(cdf.begin(), cdf.end(), v) - cdf.begin()), (int)cdf.size() - 1);
         if (producers[state] != nullptr)
             producers[state].handleCanPushPacketChanged();
         scheduleWaitTimer();
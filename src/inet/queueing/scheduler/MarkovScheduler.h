@@ -25,6 +25,7 @@ class INET_API MarkovScheduler : public ClockUserModuleMixin<PacketSchedulerBase
     PassivePacketSinkRef consumer;
 
     std::vector<std::vector<double>> transitionProbabilities;
+    std::vector<std::vector<double>> transitionCdfs; // per-state partial sums of transitionProbabilities, precomputed for sampling
     std::vector<cDynamicExpression> waitIntervals;
 
     int state;
@@ -20,13 +20,19 @@ PacketServer::~PacketServer()
 {
     cancelAndDelete(serveTimer);
     cancelAndDeleteClockEvent(processingTimer);
-    delete packet;
+    for (auto packet : packets)
+        delete packet;
 }
 
 void PacketServer::initialize(int stage)
 {
     ClockUserModuleMixin::initialize(stage);
     if (stage == INITSTAGE_LOCAL) {
+        processingTimeParameter = &par("processingTime");
+        processingBitrateParameter = &par("processingBitrate");
+        batchSize = par("batchSize");
+        if (batchSize < 1)
+            throw cRuntimeError("Invalid batchSize: %d", batchSize);
         int serveSchedulingPriority = par("serveSchedulingPriority");
         if (serveSchedulingPriority != -1) {
             serveTimer = new cMessage("ServeTimer");
@@ -56,10 +62,18 @@ void PacketServer::handleMessage(cMessage *message)
 
 void PacketServer::scheduleProcessingTimer()
 {
-    clocktime_t processingTime = par("processingTime");
-    auto processingBitrate = bps(par("processingBitrate"));
-    processingTime += s(packet->getDataLength() / processingBitrate).get();
-    scheduleClockEventAfter(processingTime, processingTimer);
+    // the service times of all packets of the batch are summed up and covered by
+    // a single timer; each packet still gets its own share in its time tags
+    clocktime_t totalProcessingTime = 0;
+    processingTimes.clear();
+    for (auto packet : packets) {
+        clocktime_t processingTime = *processingTimeParameter;
+        auto processingBitrate = bps(*processingBitrateParameter);
+        processingTime += s(packet->getDataLength() / processingBitrate).get();
+        processingTimes.push_back(processingTime);
+        totalProcessingTime += processingTime;
+    }
+    scheduleClockEventAfter(totalProcessingTime, processingTimer);
 }
 
 bool PacketServer::canStartProcessingPacket()
@@ -70,24 +84,36 @@ bool PacketServer::canStartProcessingPacket()
 
 void PacketServer::startProcessingPacket()
 {
-    packet = provider.pullPacket();
-    take(packet);
-    emit(packetPulledSignal, packet);
-    EV_INFO << "Processing packet started" << EV_FIELD(packet) << EV_ENDL;
+    do {
+        auto packet = provider.pullPacket();
+        take(packet);
+        emit(packetPulledSignal, packet);
+        EV_INFO << "Processing packet started" << EV_FIELD(packet) << EV_ENDL;
+        packets.push_back(packet);
+    } while ((int)packets.size() < batchSize && provider.canPullSomePacket());
 }
 
 void PacketServer::endProcessingPacket()
 {
-    EV_INFO << "Processing packet ended" << EV_FIELD(packet) << EV_ENDL;
-    simtime_t packetProcessingTime = simTime() - processingTimer->getSendingTime();
-    simtime_t bitProcessingTime = packetProcessingTime / packet->getBitLength();
-    insertPacketEvent(this, packet, PEK_PROCESSED, bitProcessingTime);
-    increaseTimeTag<ProcessingTimeTag>(packet, bitProcessingTime, packetProcessingTime);
-    processedTotalLength += packet->getDataLength();
-    emit(packetPushedSignal, packet);
-    pushOrSendPacket(packet, outputGate, consumer);
-    numProcessedPackets++;
-    packet = nullptr;
+    simtime_t elapsedTime = simTime() - processingTimer->getSendingTime();
+    clocktime_t totalProcessingTime = 0;
+    for (auto& processingTime : processingTimes)
+        totalProcessingTime += processingTime;
+    for (size_t i = 0; i < packets.size(); i++) {
+        auto packet = packets[i];
+        EV_INFO << "Processing packet ended" << EV_FIELD(packet) << EV_ENDL;
+        // divide the elapsed time between the packets of the batch in proportion to their service times
+        simtime_t packetProcessingTime = packets.size() == 1 ? elapsedTime : elapsedTime * (processingTimes[i].dbl() / totalProcessingTime.dbl());
+        simtime_t bitProcessingTime = packetProcessingTime / packet->getBitLength();
+        insertPacketEvent(this, packet, PEK_PROCESSED, bitProcessingTime);
+        increaseTimeTag<ProcessingTimeTag>(packet, bitProcessingTime, packetProcessingTime);
+        processedTotalLength += packet->getDataLength();
+        emit(packetPushedSignal, packet);
+        pushOrSendPacket(packet, outputGate, consumer);
+        numProcessedPackets++;
+    }
+    packets.clear();
+    processingTimes.clear();
 }
 
 void PacketServer::handleCanPushPacketChanged(const cGate *gate)
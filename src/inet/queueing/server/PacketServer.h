@@ -20,9 +20,14 @@ namespace queueing {
 class INET_API PacketServer : public ClockUserModuleMixin<PacketServerBase>
 {
   protected:
+    cPar *processingTimeParameter = nullptr;
+    cPar *processingBitrateParameter = nullptr;
+    int batchSize = 1;
+
     cMessage *serveTimer = nullptr;
     ClockEvent *processingTimer = nullptr;
-    Packet *packet = nullptr;
+    std::vector<Packet *> packets; // the packets being processed, at most batchSize
+    std::vector<clocktime_t> processingTimes; // the processing time share of each packet in packets
 
   protected:
     virtual void initialize(int stage) override;
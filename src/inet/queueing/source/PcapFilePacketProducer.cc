@@ -18,8 +18,11 @@ Define_Module(PcapFilePacketProducer);
 void PcapFilePacketProducer::initialize(int stage)
 {
     ActivePacketSourceBase::initialize(stage);
-    if (stage == INITSTAGE_LOCAL)
+    if (stage == INITSTAGE_LOCAL) {
+        timeShift = par("timeShift");
+        timeScale = par("timeScale");
         pcapReader.openPcap(par("filename"), par("packetNameFormat"));
+    }
     else if (stage == INITSTAGE_QUEUEING)
         schedulePacket();
 }
@@ -51,7 +54,7 @@ void PcapFilePacketProducer::schedulePacket()
     emit(packetCreatedSignal, packet);
     if (packet != nullptr) {
         EV << "Scheduling packet from PCAP file" << EV_FIELD(packet) << EV_ENDL;
-        scheduleAt(pair.first, packet);
+        scheduleAt(timeShift + pair.first * timeScale, packet);
     }
     else
         EV << "End of PCAP file reached" << EV_ENDL;
@@ -18,6 +18,8 @@ class INET_API PcapFilePacketProducer : public ActivePacketSourceBase
 {
   protected:
     PcapReader pcapReader;
+    simtime_t timeShift;
+    double timeScale = 1;
 
   protected:
     virtual void initialize(int stage) override;
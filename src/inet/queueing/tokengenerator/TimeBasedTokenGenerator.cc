@@ -18,10 +18,17 @@ void TimeBasedTokenGenerator::initialize(int stage)
     if (stage == INITSTAGE_LOCAL) {
         generationIntervalParameter = &par("generationInterval");
         numTokensParameter = &par("numTokens");
+        continuousTokenGeneration = par("continuousTokenGeneration");
         generationTimer = new ClockEvent("GenerationTimer");
     }
-    else if (stage == INITSTAGE_QUEUEING)
-        scheduleGenerationTimer();
+    else if (stage == INITSTAGE_QUEUEING) {
+        if (continuousTokenGeneration)
+            // the storage accrues tokens analytically from the elapsed time, no
+            // periodic event is needed; both parameters are evaluated only once
+            storage->addTokenProductionRate(numTokensParameter->doubleValue() / generationIntervalParameter->doubleValue());
+        else
+            scheduleGenerationTimer();
+    }
 }
 
 void TimeBasedTokenGenerator::scheduleGenerationTimer()
@@ -22,6 +22,7 @@ class INET_API TimeBasedTokenGenerator : public ClockUserModuleMixin<TokenGenera
   protected:
     cPar *generationIntervalParameter = nullptr;
     cPar *numTokensParameter = nullptr;
+    bool continuousTokenGeneration = false;
 
     ClockEvent *generationTimer = nullptr;
 
@@ -723,7 +723,7 @@ void Aodv::updateRoutingTable(IRoute *route, const L3Address& nextHop, unsigned
 
     EV_DETAIL << "Route updated: " << route << endl;
 
-    scheduleExpungeRoutes();
+    scheduleExpungeRoutes(lifeTime);
 }
 
 void Aodv::sendAODVPacket(const Ptr<AodvControlPacket>& aodvPacket, const L3Address& destAddr, unsigned int timeToLive, double delay)
@@ -1005,7 +1005,7 @@ IRoute *Aodv::createRoute(const L3Address& destAddr, const L3Address& nextHop,
     EV_DETAIL << "Adding new route " << newRoute << endl;
     routingTable->addRoute(newRoute);
 
-    scheduleExpungeRoutes();
+    scheduleExpungeRoutes(lifeTime);
     return newRoute;
 }
 
@@ -1090,7 +1090,7 @@ void Aodv::handleLinkBreakSendRERR(const L3Address& unreachableAddr)
 
             routeData->setIsActive(false);
             routeData->setLifeTime(simTime() + deletePeriod);
-            scheduleExpungeRoutes();
+            scheduleExpungeRoutes(routeData->getLifeTime());
 
             UnreachableNode node;
             node.addr = route->getDestinationAsGeneric();
@@ -1186,7 +1186,7 @@ void Aodv::handleRERR(const Ptr<const Rerr>& rerr, const L3Address& sourceAddr)
                         node.seqNum = routeData->getDestSeqNum();
                         unreachableNeighbors.push_back(node);
                     }
-                    scheduleExpungeRoutes();
+                    scheduleExpungeRoutes(routeData->getLifeTime());
                 }
             }
         }
@@ -1469,6 +1469,18 @@ void Aodv::expungeRoutes()
     scheduleExpungeRoutes();
 }
 
+void Aodv::scheduleExpungeRoutes(simtime_t lifeTime)
+{
+    // when only a single route changed the expunge timer needs to be moved
+    // earlier at most, so the routing table doesn't have to be scanned;
+    // firing early is harmless because expungeRoutes() rechecks the lifetimes
+    // and computes the accurate next expunge time
+    if (!expungeTimer->isScheduled())
+        scheduleAt(lifeTime, expungeTimer);
+    else if (expungeTimer->getArrivalTime() > lifeTime)
+        rescheduleAt(lifeTime, expungeTimer);
+}
+
 void Aodv::scheduleExpungeRoutes()
 {
     simtime_t nextExpungeTime = SimTime::getMaxTime();
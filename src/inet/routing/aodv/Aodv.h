@@ -143,6 +143,7 @@ class INET_API Aodv : public RoutingProtocolBase, public NetfilterBase::HookBase
     IRoute *createRoute(const L3Address& destAddr, const L3Address& nextHop, unsigned int hopCount, bool hasValidDestNum, unsigned int destSeqNum, bool isActive, simtime_t lifeTime);
     bool updateValidRouteLifeTime(const L3Address& destAddr, simtime_t lifetime);
     void scheduleExpungeRoutes();
+    void scheduleExpungeRoutes(simtime_t lifeTime);
     void expungeRoutes();
 
     /* Control packet creators */
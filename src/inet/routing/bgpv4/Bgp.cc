@@ -23,7 +23,8 @@ Bgp::Bgp()
 Bgp::~Bgp()
 {
     cancelAndDelete(startupTimer);
-    delete bgpRouter;
+    delete bgpRouter; // deletes the sessions, whose timers may still be in the timer queue
+    delete timerQueue;
 }
 
 void Bgp::initialize(int stage)
@@ -35,6 +36,8 @@ void Bgp::initialize(int stage)
         rt.reference(this, "routingTableModule", true);
 
         startupTimer = new cMessage("BGP-startup");
+        if (par("useTimerQueue"))
+            timerQueue = new TimerQueue(this, this, "BGP-timers");
     }
     else if (stage == INITSTAGE_ROUTING_PROTOCOLS) { // interfaces and static routes are already initialized
         cModule *node = findContainingNode(this);
@@ -72,6 +75,8 @@ void Bgp::handleMessage(cMessage *msg)
 
     if (msg == startupTimer)
         createBgpRouter();
+    else if (timerQueue != nullptr && timerQueue->handleMessage(msg))
+        ; // the expired session timers have been dispatched to handleTimer()
     else if (msg->isSelfMessage()) // BGP level
         handleTimer(msg);
     else if (!strcmp(msg->getArrivalGate()->getName(), "socketIn")) // TCP level
@@ -83,6 +88,8 @@ void Bgp::handleMessage(cMessage *msg)
 void Bgp::createBgpRouter()
 {
     bgpRouter = new BgpRouter(this, ift, rt);
+    if (timerQueue != nullptr)
+        bgpRouter->setTimerQueue(timerQueue);
 
     // read BGP configuration
     cXMLElement *bgpConfig = par("bgpConfig");
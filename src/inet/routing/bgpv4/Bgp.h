@@ -7,6 +7,7 @@
 #ifndef __INET_BGP_H
 #define __INET_BGP_H
 
+#include "inet/common/TimerQueue.h"
 #include "inet/common/lifecycle/LifecycleUnsupported.h"
 #include "inet/networklayer/contract/ipv4/Ipv4Address.h"
 #include "inet/networklayer/ipv4/Ipv4InterfaceData.h"
@@ -18,7 +19,7 @@ namespace inet {
 
 namespace bgp {
 
-class INET_API Bgp : public cSimpleModule, protected cListener, public LifecycleUnsupported
+class INET_API Bgp : public cSimpleModule, protected cListener, public LifecycleUnsupported, public TimerQueue::ICallback
 {
   private:
     ModuleRefByPar<IIpv4RoutingTable> rt;
@@ -26,6 +27,7 @@ class INET_API Bgp : public cSimpleModule, protected cListener, public Lifecycle
     bool isUp = false;
     BgpRouter *bgpRouter = nullptr; // data structure to fill in
     cMessage *startupTimer = nullptr; // timer for delayed startup
+    TimerQueue *timerQueue = nullptr; // multiplexes the session timers behind a single scheduled event, see the useTimerQueue parameter
 
   public:
     Bgp();
@@ -36,7 +38,7 @@ class INET_API Bgp : public cSimpleModule, protected cListener, public Lifecycle
     virtual void initialize(int stage) override;
     virtual void handleMessage(cMessage *msg) override;
     void createBgpRouter();
-    void handleTimer(cMessage *timer);
+    virtual void handleTimer(cMessage *timer) override;
     virtual void finish() override;
 };
 
@@ -65,7 +65,7 @@ void Connect::HoldTimer_Expires()
     BgpSession& session = TopState::box().getModule();
     // In response to any other events (Events 8, 10-11, 13, 19, 23, 25-28), the local system:
     // - if the ConnectRetryTimer is running, stops and resets the ConnectRetryTimer (sets to zero),
-    if (session._ptrConnectRetryTimer->isScheduled()) {
+    if (session.isTimerScheduled(session._ptrConnectRetryTimer)) {
         session.restartsConnectRetryTimer(false);
     }
     // - if the DelayOpenTimer is running, stops and resets the DelayOpenTimer (sets to zero),
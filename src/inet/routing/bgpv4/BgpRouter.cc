@@ -189,7 +189,7 @@ void BgpRouter::addToAdvertiseList(Ipv4Address address)
     BGPEntry->addAS(myAsId);
     BGPEntry->setPathType(IGP);
     BGPEntry->setLocalPreference(bgpModule->par("localPreference").intValue());
-    bgpRoutingTable.push_back(BGPEntry);
+    addEntryToRib(BGPEntry);
 }
 
 void BgpRouter::addToPrefixList(std::string nodeName, BgpRoutingTableEntry *entry)
@@ -576,15 +576,15 @@ BgpProcessResult BgpRouter::decisionProcess(const BgpUpdateMessage& msg, BgpRout
 
     // if the route already exists in BGP routing table, tieBreakingProcess();
     // (RFC 4271: 9.1.2.2 Breaking Ties)
-    unsigned long BGPindex = isInTable(bgpRoutingTable, entry);
-    if (BGPindex != (unsigned long)-1) {
-        if (tieBreakingProcess(bgpRoutingTable[BGPindex], entry)) {
+    BgpRoutingTableEntry *existingEntry = findRibEntry(entry);
+    if (existingEntry != nullptr) {
+        if (tieBreakingProcess(existingEntry, entry)) {
             delete entry;
             return RESULT0;
         }
         else {
             entry->setInterface(_BGPSessions[sessionIndex]->getLinkIntf());
-            bgpRoutingTable.push_back(entry);
+            addEntryToRib(entry);
             rt->addRoute(entry);
             return ROUTE_DESTINATION_CHANGED;
         }
@@ -626,7 +626,7 @@ BgpProcessResult BgpRouter::decisionProcess(const BgpUpdateMessage& msg, BgpRout
     }
 
     entry->setInterface(_BGPSessions[sessionIndex]->getLinkIntf());
-    bgpRoutingTable.push_back(entry);
+    addEntryToRib(entry);
 
     if (_BGPSessions[sessionIndex]->getType() == EGP) {
         if (isReachable(entry->getGateway()))
@@ -778,18 +778,17 @@ void BgpRouter::updateSendProcess(BgpProcessResult type, SessionId sessionIndex,
  */
 bool BgpRouter::deleteBGPRoutingEntry(BgpRoutingTableEntry *entry)
 {
-    for (auto it = bgpRoutingTable.begin();
-         it != bgpRoutingTable.end(); it++)
-    {
-        if (((*it)->getDestination().getInt() & (*it)->getNetmask().getInt()) ==
-            (entry->getDestination().getInt() & entry->getNetmask().getInt()))
-        {
-            bgpRoutingTable.erase(it);
-            rt->deleteRoute(entry);
-            return true;
-        }
-    }
-    return false;
+    uint32_t maskedDestination = entry->getDestination().getInt() & entry->getNetmask().getInt();
+    auto indexIt = bgpRoutingTableByPrefix.find(maskedDestination);
+    if (indexIt == bgpRoutingTableByPrefix.end())
+        return false;
+    BgpRoutingTableEntry *storedEntry = indexIt->second.front();
+    indexIt->second.erase(indexIt->second.begin());
+    if (indexIt->second.empty())
+        bgpRoutingTableByPrefix.erase(indexIt);
+    bgpRoutingTable.erase(std::find(bgpRoutingTable.begin(), bgpRoutingTable.end(), storedEntry));
+    rt->deleteRoute(entry);
+    return true;
 }
 
 /*return index of the Ipv4 table if the route is found, -1 else*/
@@ -818,8 +817,23 @@ SessionId BgpRouter::findIdFromSocketConnId(std::map<SessionId, BgpSession *> se
     return -1;
 }
 
+void BgpRouter::addEntryToRib(BgpRoutingTableEntry *entry)
+{
+    bgpRoutingTable.push_back(entry);
+    bgpRoutingTableByPrefix[entry->getDestination().getInt() & entry->getNetmask().getInt()].push_back(entry);
+}
+
+/*return the first entry of bgpRoutingTable with the same masked destination, nullptr else*/
+BgpRoutingTableEntry *BgpRouter::findRibEntry(BgpRoutingTableEntry *entry)
+{
+    auto indexIt = bgpRoutingTableByPrefix.find(entry->getDestination().getInt() & entry->getNetmask().getInt());
+    if (indexIt == bgpRoutingTableByPrefix.end())
+        return nullptr;
+    return indexIt->second.front();
+}
+
 /*return index of the table if the route is found, -1 else*/
-unsigned long BgpRouter::isInTable(std::vector<BgpRoutingTableEntry *> rtTable, BgpRoutingTableEntry *entry)
+unsigned long BgpRouter::isInTable(const std::vector<BgpRoutingTableEntry *>& rtTable, BgpRoutingTableEntry *entry)
 {
     for (unsigned long i = 0; i < rtTable.size(); i++) {
         BgpRoutingTableEntry *entryCur = rtTable[i];
@@ -833,7 +847,7 @@ unsigned long BgpRouter::isInTable(std::vector<BgpRoutingTableEntry *> rtTable,
 }
 
 /*return true if the AS is found, false else*/
-bool BgpRouter::isInASList(std::vector<AsId> ASList, BgpRoutingTableEntry *entry)
+bool BgpRouter::isInASList(const std::vector<AsId>& ASList, BgpRoutingTableEntry *entry)
 {
     for (auto& elem : ASList) {
         for (unsigned int i = 0; i < entry->getASCount(); i++) {
@@ -7,6 +7,7 @@
 #ifndef __INET_BGPROUTER_H
 #define __INET_BGPROUTER_H
 
+#include "inet/common/TimerQueue.h"
 #include "inet/common/socket/SocketMap.h"
 #include "inet/networklayer/contract/ipv4/Ipv4Address.h"
 #include "inet/networklayer/ipv4/Ipv4InterfaceData.h"
@@ -29,6 +30,7 @@ class INET_API BgpRouter : public TcpSocket::ReceiveQueueBasedCallback
     IInterfaceTable *ift = nullptr;
     IIpv4RoutingTable *rt = nullptr;
     cSimpleModule *bgpModule = nullptr;
+    TimerQueue *timerQueue = nullptr; // when set, the session timers are multiplexed behind a single scheduled event
     ospfv2::Ospfv2 *ospfModule = nullptr;
     AsId myAsId = 0;
     bool redistributeInternal = false;
@@ -50,6 +52,7 @@ class INET_API BgpRouter : public TcpSocket::ReceiveQueueBasedCallback
 
     typedef std::vector<BgpRoutingTableEntry *> RoutingTableEntryVector;
     RoutingTableEntryVector bgpRoutingTable; // The BGP routing table
+    std::map<uint32_t, RoutingTableEntryVector> bgpRoutingTableByPrefix; // bgpRoutingTable entries indexed by masked destination, per prefix in insertion order
     std::vector<Ipv4Address> advertiseList;
     RoutingTableEntryVector _prefixListIN;
     RoutingTableEntryVector _prefixListOUT;
@@ -114,9 +117,11 @@ class INET_API BgpRouter : public TcpSocket::ReceiveQueueBasedCallback
 
     friend class BgpSession;
     // functions used by the BgpSession class
-    void getScheduleAt(simtime_t t, cMessage *msg) { bgpModule->scheduleAt(t, msg); }
-    void getCancelAndDelete(cMessage *msg) { bgpModule->cancelAndDelete(msg); }
-    cMessage *getCancelEvent(cMessage *msg) { return bgpModule->cancelEvent(msg); }
+    void setTimerQueue(TimerQueue *timerQueue) { this->timerQueue = timerQueue; }
+    void getScheduleAt(simtime_t t, cMessage *msg) { if (timerQueue) timerQueue->scheduleAt(t, msg); else bgpModule->scheduleAt(t, msg); }
+    bool isTimerScheduled(cMessage *msg) const { return timerQueue ? timerQueue->isScheduled(msg) : msg->isScheduled(); }
+    void getCancelAndDelete(cMessage *msg) { if (timerQueue) timerQueue->cancelAndDelete(msg); else bgpModule->cancelAndDelete(msg); }
+    cMessage *getCancelEvent(cMessage *msg) { return timerQueue ? timerQueue->cancelEvent(msg) : bgpModule->cancelEvent(msg); }
     IIpv4RoutingTable *getIPRoutingTable() { return rt; }
     std::vector<BgpRoutingTableEntry *> getBGPRoutingTable() { return bgpRoutingTable; }
 
@@ -161,8 +166,11 @@ class INET_API BgpRouter : public TcpSocket::ReceiveQueueBasedCallback
      */
     bool tieBreakingProcess(BgpRoutingTableEntry *oldEntry, BgpRoutingTableEntry *entry);
 
-    bool isInASList(std::vector<AsId> ASList, BgpRoutingTableEntry *entry);
-    unsigned long isInTable(std::vector<BgpRoutingTableEntry *> rtTable, BgpRoutingTableEntry *entry);
+    bool isInASList(const std::vector<AsId>& ASList, BgpRoutingTableEntry *entry);
+    unsigned long isInTable(const std::vector<BgpRoutingTableEntry *>& rtTable, BgpRoutingTableEntry *entry);
+    // maintain and query the masked destination index of bgpRoutingTable
+    void addEntryToRib(BgpRoutingTableEntry *entry);
+    BgpRoutingTableEntry *findRibEntry(BgpRoutingTableEntry *entry);
 
     bool ospfExist(IIpv4RoutingTable *rtTable);
     // check if the route is in OSPF external Ipv4RoutingTable
@@ -80,7 +80,7 @@ void BgpSession::startConnection()
     if (_info.sessionType == IGP) {
         if (simTime() > _StartEventTime)
             _StartEventTime = simTime();
-        if (!_ptrStartEvent->isScheduled())
+        if (!bgpRouter.isTimerScheduled(_ptrStartEvent))
             bgpRouter.getScheduleAt(_StartEventTime, _ptrStartEvent);
         _ptrStartEvent->setContextPointer(this);
     }
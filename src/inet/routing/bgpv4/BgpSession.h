@@ -79,6 +79,7 @@ public:
     void listenConnectionFromPeer() { bgpRouter.listenConnectionFromPeer(_info.sessionID); }
     void openTCPConnectionToPeer() { bgpRouter.openTCPConnectionToPeer(_info.sessionID); }
     SessionId findAndStartNextSession(BgpSessionType type) { return bgpRouter.findNextSession(type, true); }
+    bool isTimerScheduled(cMessage *timer) const { return bgpRouter.isTimerScheduled(timer); }
 
     // setters for creating and editing the information in the Bgp session:
     void setInfo(SessionInfo info);
@@ -1171,7 +1171,7 @@ void Dymo::updateRoute(Packet *packet, const Ptr<const RteMsg>& rteMsg, const Ad
         routeData->setExpirationTime(simTime() + addressBlock.getValidityTime());
     else
         routeData->setExpirationTime(SimTime::getMaxTime());
-    scheduleExpungeTimer();
+    scheduleExpungeTimer(std::min(routeData->getExpirationTime(), routeData->getLastUsed() + maxSequenceNumberLifetime));
 }
 
 // TODO use
@@ -1203,6 +1203,21 @@ void Dymo::processExpungeTimer()
     scheduleExpungeTimer();
 }
 
+void Dymo::scheduleExpungeTimer(simtime_t expungeTime)
+{
+    // when only a single route changed the expunge timer needs to be moved
+    // earlier at most, so the routing table doesn't have to be scanned;
+    // firing early is harmless because expungeRoutes() rechecks the routes
+    // and processExpungeTimer() computes the accurate next expunge time
+    EV_DETAIL << "Scheduling expunge timer" << endl;
+    if (expungeTime == SimTime::getMaxTime())
+        return;
+    if (!expungeTimer->isScheduled())
+        scheduleAt(expungeTime, expungeTimer);
+    else if (expungeTimer->getArrivalTime() > expungeTime)
+        rescheduleAt(expungeTime, expungeTimer);
+}
+
 void Dymo::scheduleExpungeTimer()
 {
     EV_DETAIL << "Scheduling expunge timer" << endl;
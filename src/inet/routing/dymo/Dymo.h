@@ -180,6 +180,7 @@ class INET_API Dymo : public RoutingProtocolBase, public cListener, public Netfi
     // handling expunge timer
     void processExpungeTimer();
     void scheduleExpungeTimer();
+    void scheduleExpungeTimer(simtime_t expungeTime);
     void expungeRoutes();
     simtime_t getNextExpungeTime();
     DymoRouteState getRouteState(DymoRouteData *routeData);
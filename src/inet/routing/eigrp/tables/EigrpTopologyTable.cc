@@ -153,12 +153,14 @@ uint64_t EigrpTopologyTable<IPAddress>::findRouteDMin(EigrpRoute<IPAddress> *rou
 {
     uint64_t dmin = eigrp::EigrpMetricHelper::METRIC_INF;
     uint64_t tempD;
-    typename RouteVector::iterator it;
-    int routeId = route->getRouteId();
+    typename std::map<int, RouteVector>::iterator indexIt = sourcesByRouteId.find(route->getRouteId());
 
-    for (it = routeVec.begin(); it != routeVec.end(); it++) {
-        if ((*it)->getRouteId() == routeId /* do not check FC here */ && (*it)->isValid()) {
-            tempD = (*it)->getMetric();
+    if (indexIt == sourcesByRouteId.end())
+        return dmin;
+
+    for (auto& source : indexIt->second) {
+        if (source->isValid() /* do not check FC here */) {
+            tempD = source->getMetric();
             if (tempD < dmin) {
                 dmin = tempD;
             }
@@ -174,20 +176,22 @@ uint64_t EigrpTopologyTable<IPAddress>::findRouteDMin(EigrpRoute<IPAddress> *rou
 template<typename IPAddress>
 EigrpRouteSource<IPAddress> *EigrpTopologyTable<IPAddress>::getBestSuccessor(EigrpRoute<IPAddress> *route)
 {
-    typename RouteVector::iterator it;
-    int routeId = route->getRouteId();
     EigrpRouteSource<IPAddress> *tempSrc = nullptr;
+    typename std::map<int, RouteVector>::iterator indexIt = sourcesByRouteId.find(route->getRouteId());
 
-    for (it = routeVec.begin(); it != routeVec.end(); it++) {
-        if ((*it)->getRouteId() == routeId && (*it)->isSuccessor() && (*it)->isValid()) {
+    if (indexIt == sourcesByRouteId.end())
+        return nullptr;
+
+    for (auto& source : indexIt->second) {
+        if (source->isSuccessor() && source->isValid()) {
             if (tempSrc != nullptr) {
-                if ((*it)->getMetric() < tempSrc->getMetric())
-                    tempSrc = *it;
-                else if ((*it)->getMetric() == tempSrc->getMetric() && (*it)->getNextHop() < tempSrc->getNextHop())
-                    tempSrc = *it;
+                if (source->getMetric() < tempSrc->getMetric())
+                    tempSrc = source;
+                else if (source->getMetric() == tempSrc->getMetric() && source->getNextHop() < tempSrc->getNextHop())
+                    tempSrc = source;
             }
             else
-                tempSrc = *it;
+                tempSrc = source;
         }
     }
 
@@ -215,15 +219,17 @@ EigrpRouteSource<IPAddress> *EigrpTopologyTable<IPAddress>::getBestSuccessor(Eig
 template<typename IPAddress>
 EigrpRouteSource<IPAddress> *EigrpTopologyTable<IPAddress>::getBestSuccessorByIf(EigrpRoute<IPAddress> *route, int ifaceId)
 {
-    typename RouteVector::iterator it;
-    int routeId = route->getRouteId();
     uint64_t dij = route->getDij();
+    typename std::map<int, RouteVector>::iterator indexIt = sourcesByRouteId.find(route->getRouteId());
 
-    for (it = routeVec.begin(); it != routeVec.end(); it++) {
-        if ((*it)->getRouteId() == routeId && (*it)->isSuccessor() && (*it)->getMetric() == dij &&
-            (*it)->getIfaceId() == ifaceId && (*it)->isValid())
+    if (indexIt == sourcesByRouteId.end())
+        return nullptr;
+
+    for (auto& source : indexIt->second) {
+        if (source->isSuccessor() && source->getMetric() == dij &&
+            source->getIfaceId() == ifaceId && source->isValid())
         {
-            return *it;
+            return source;
         }
     }
     return nullptr;
@@ -237,32 +243,33 @@ EigrpRouteSource<IPAddress> *EigrpTopologyTable<IPAddress>::getBestSuccessorByIf
 template<typename IPAddress>
 bool EigrpTopologyTable<IPAddress>::hasFeasibleSuccessor(EigrpRoute<IPAddress> *route, uint64_t& resultDmin)
 {
-    typename RouteVector::iterator it;
-    int routeId = route->getRouteId();
     bool hasFs = false;
     uint64_t tempD;
+    typename std::map<int, RouteVector>::iterator indexIt = sourcesByRouteId.find(route->getRouteId());
 
     resultDmin = eigrp::EigrpMetricHelper::METRIC_INF;
     EV_DEBUG << "EIGRP: Search feasible successor for route " << route->getRouteAddress();
     EV_DEBUG << ", FD is " << route->getFd() << endl;
 
-    for (it = routeVec.begin(); it != routeVec.end(); it++) {
-        if ((*it)->getRouteId() == routeId && (*it)->isValid()) {
-            EV_DEBUG << "    Next hop " << (*it)->getNextHop();
-            EV_DEBUG << " (" << (*it)->getMetric() << "/" << (*it)->getRd() << ") ";
-
-            tempD = (*it)->getMetric();
-            if (tempD < resultDmin) {
-                hasFs = false; // FS must have minimal distance
-                resultDmin = tempD;
+    if (indexIt != sourcesByRouteId.end()) {
+        for (auto& source : indexIt->second) {
+            if (source->isValid()) {
+                EV_DEBUG << "    Next hop " << source->getNextHop();
+                EV_DEBUG << " (" << source->getMetric() << "/" << source->getRd() << ") ";
+
+                tempD = source->getMetric();
+                if (tempD < resultDmin) {
+                    hasFs = false; // FS must have minimal distance
+                    resultDmin = tempD;
+                }
+
+                if (source->getRd() < route->getFd() && tempD == resultDmin) {
+                    EV_DEBUG << "satisfies FC" << endl;
+                    hasFs = true;
+                }
+                else
+                    EV_DEBUG << "not satisfies FC" << endl;
             }
-
-            if ((*it)->getRd() < route->getFd() && tempD == resultDmin) {
-                EV_DEBUG << "satisfies FC" << endl;
-                hasFs = true;
-            }
-            else
-                EV_DEBUG << "not satisfies FC" << endl;
         }
     }
     if (hasFs)
@@ -296,6 +303,34 @@ void EigrpTopologyTable<IPAddress>::addRoute(EigrpRouteSource<IPAddress> *source
         routeVec.push_back(source);
     else
         routeVec.insert(it + 1, source);
+
+    indexAddSource(source);
+}
+
+/**
+ * Records the source in the per route ID index. Appending preserves the routeVec
+ * order of sources of the route, because new sources are inserted behind the
+ * last source of the route in routeVec as well.
+ */
+template<typename IPAddress>
+void EigrpTopologyTable<IPAddress>::indexAddSource(EigrpRouteSource<IPAddress> *source)
+{
+    sourcesByRouteId[source->getRouteId()].push_back(source);
+}
+
+template<typename IPAddress>
+void EigrpTopologyTable<IPAddress>::indexRemoveSource(EigrpRouteSource<IPAddress> *source)
+{
+    typename std::map<int, RouteVector>::iterator indexIt = sourcesByRouteId.find(source->getRouteId());
+
+    if (indexIt == sourcesByRouteId.end())
+        return;
+
+    typename RouteVector::iterator it = find(indexIt->second, source);
+    if (it != indexIt->second.end())
+        indexIt->second.erase(it);
+    if (indexIt->second.empty())
+        sourcesByRouteId.erase(indexIt);
 }
 
 /*
@@ -428,6 +463,7 @@ typename std::vector<EigrpRouteSource<IPAddress> *>::iterator EigrpTopologyTable
         route->decrementRefCnt();
     }
 
+    indexRemoveSource(source);
     delete source;
     return routeVec.erase(routeIt);
 }
@@ -446,10 +482,14 @@ EigrpRouteSource<IPAddress> *EigrpTopologyTable<IPAddress>::findRouteById(int so
 template<typename IPAddress>
 EigrpRouteSource<IPAddress> *EigrpTopologyTable<IPAddress>::findRouteByNextHop(int routeId, int nextHopId)
 {
-    typename RouteVector::iterator it;
-    for (it = routeVec.begin(); it != routeVec.end(); it++) {
-        if ((*it)->getRouteId() == routeId && (*it)->getNexthopId() == nextHopId && (*it)->isValid())
-            return *it;
+    typename std::map<int, RouteVector>::iterator indexIt = sourcesByRouteId.find(routeId);
+
+    if (indexIt == sourcesByRouteId.end())
+        return nullptr;
+
+    for (auto& source : indexIt->second) {
+        if (source->getNexthopId() == nextHopId && source->isValid())
+            return source;
     }
     return nullptr;
 }
@@ -37,6 +37,8 @@ class INET_API EigrpTopologyTable : public cSimpleModule
     RouteVector routeVec; /**< Table with routes. */
     RouteInfoVector routeInfoVec; /**< Table with info about routes. */
 
+    std::map<int, RouteVector> sourcesByRouteId; /**< Sources of each route keyed by route ID (in routeVec order), so DUAL computations do not scan the whole table. */
+
     Ipv4Address routerID; /**< Router ID of this router, number represented as IPv4 address. INDEPENDENT on routed protocol (Ipv4/IPv6)! */
 
     int routeIdCounter; /**< Counter for route ID */
@@ -44,6 +46,9 @@ class INET_API EigrpTopologyTable : public cSimpleModule
 
     typename RouteVector::iterator removeRoute(typename RouteVector::iterator routeIt);
 
+    void indexAddSource(EigrpRouteSource<IPAddress> *source);
+    void indexRemoveSource(EigrpRouteSource<IPAddress> *source);
+
   protected:
     virtual void initialize(int stage) override;
     virtual void handleMessage(cMessage *msg) override;
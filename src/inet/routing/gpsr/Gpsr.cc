@@ -80,6 +80,7 @@ void Gpsr::initialize(int stage)
         beaconInterval = par("beaconInterval");
         maxJitter = par("maxJitter");
         neighborValidityInterval = par("neighborValidityInterval");
+        beaconSuppressionPositionDelta = par("beaconSuppressionPositionDelta");
         displayBubbles = par("displayBubbles");
         // context
         host = getContainingNode(this);
@@ -149,12 +150,18 @@ void Gpsr::processBeaconTimer()
     EV_DEBUG << "Processing beacon timer" << endl;
     const L3Address selfAddress = getSelfAddress();
     if (!selfAddress.isUnspecified()) {
-        auto beacon = createBeacon();
-        cPatternMatcher interfaceMatcher(interfaces, false, true, false);
-        for (int i = 0; i < interfaceTable->getNumInterfaces(); i++) {
-            NetworkInterface *networkInterface = interfaceTable->getInterface(i);
-            if (networkInterface->isMulticast() && interfaceMatcher.matches(networkInterface->getInterfaceName()))
-                sendBeacon(beacon, networkInterface);
+        if (suppressBeacon())
+            EV_DEBUG << "Suppressing beacon, position is unchanged since the last sent beacon" << endl;
+        else {
+            auto beacon = createBeacon();
+            cPatternMatcher interfaceMatcher(interfaces, false, true, false);
+            for (int i = 0; i < interfaceTable->getNumInterfaces(); i++) {
+                NetworkInterface *networkInterface = interfaceTable->getInterface(i);
+                if (networkInterface->isMulticast() && interfaceMatcher.matches(networkInterface->getInterfaceName()))
+                    sendBeacon(beacon, networkInterface);
+            }
+            lastBeaconPosition = mobility->getCurrentPosition();
+            lastBeaconTime = simTime();
         }
         storeSelfPositionInGlobalRegistry();
     }
@@ -212,13 +219,30 @@ void Gpsr::processUdpPacket(Packet *packet)
 // handling beacons
 //
 
+bool Gpsr::suppressBeacon() const
+{
+    if (beaconSuppressionPositionDelta == 0 || lastBeaconTime < 0)
+        return false;
+    // a suppressed beacon may be followed by further suppressed ones, so only
+    // suppress if the next beacon opportunity still comes before the neighbors
+    // would purge this node from their neighbor tables
+    return mobility->getCurrentPosition().distance(lastBeaconPosition) < beaconSuppressionPositionDelta &&
+           simTime() - lastBeaconTime + beaconInterval + maxJitter < neighborValidityInterval;
+}
+
 const Ptr<GpsrBeacon> Gpsr::createBeacon()
 {
-    const auto& beacon = makeShared<GpsrBeacon>();
-    beacon->setAddress(getSelfAddress());
-    beacon->setPosition(mobility->getCurrentPosition());
-    beacon->setChunkLength(B(getSelfAddress().getAddressType()->getAddressByteLength() + positionByteLength));
-    return beacon;
+    const auto& selfAddress = getSelfAddress();
+    const auto& position = mobility->getCurrentPosition();
+    // the beacon chunk is immutable once sent, so it can be shared among all
+    // sent packets and reused as long as the advertised state is unchanged
+    if (lastBeacon == nullptr || lastBeacon->getAddress() != selfAddress || lastBeacon->getPosition() != position) {
+        lastBeacon = makeShared<GpsrBeacon>();
+        lastBeacon->setAddress(selfAddress);
+        lastBeacon->setPosition(position);
+        lastBeacon->setChunkLength(B(selfAddress.getAddressType()->getAddressByteLength() + positionByteLength));
+    }
+    return lastBeacon;
 }
 
 void Gpsr::sendBeacon(const Ptr<GpsrBeacon>& beacon, NetworkInterface *networkInterface)
@@ -783,6 +807,7 @@ INetfilter::IHook::Result Gpsr::datagramLocalOutHook(Packet *packet)
 
 void Gpsr::handleStartOperation(LifecycleOperation *operation)
 {
+    lastBeaconTime = -1; // peers may have purged this node while it was down, so don't suppress the first beacon
     configureInterfaces();
     storeSelfPositionInGlobalRegistry();
     scheduleBeaconTimer();
@@ -43,6 +43,7 @@ class INET_API Gpsr : public RoutingProtocolBase, public cListener, public Netfi
     simtime_t beaconInterval;
     simtime_t maxJitter;
     simtime_t neighborValidityInterval;
+    double beaconSuppressionPositionDelta = 0;
     bool displayBubbles;
 
     // context
@@ -61,6 +62,9 @@ class INET_API Gpsr : public RoutingProtocolBase, public cListener, public Netfi
     cMessage *beaconTimer = nullptr;
     cMessage *purgeNeighborsTimer = nullptr;
     GpsrNeighborTable neighborTable;
+    Ptr<GpsrBeacon> lastBeacon; // immutable beacon chunk shared among sent packets, reused while the advertised state is unchanged
+    Coord lastBeaconPosition = Coord::NIL;
+    simtime_t lastBeaconTime = -1;
 
   public:
     Gpsr();
@@ -90,6 +94,7 @@ class INET_API Gpsr : public RoutingProtocolBase, public cListener, public Netfi
     void processUdpPacket(Packet *packet);
 
     // handling beacons
+    bool suppressBeacon() const;
     const Ptr<GpsrBeacon> createBeacon();
     void sendBeacon(const Ptr<GpsrBeacon>& beacon, NetworkInterface *networkInterface);
     void processBeacon(Packet *packet);
@@ -32,7 +32,8 @@ Ospfv2::Ospfv2()
 Ospfv2::~Ospfv2()
 {
     cancelAndDelete(startupTimer);
-    delete ospfRouter;
+    delete ospfRouter; // clears its timers, which may still be in the timer queue
+    delete timerQueue;
 }
 
 void Ospfv2::initialize(int stage)
@@ -56,6 +57,8 @@ void Ospfv2::handleMessageWhenUp(cMessage *msg)
         createOspfRouter();
         subscribe();
     }
+    else if (timerQueue != nullptr && timerQueue->handleMessage(msg))
+        ; // the expired timers have been dispatched to the message handler
     else
         ospfRouter->getMessageHandler()->messageReceived(msg);
 
@@ -64,6 +67,10 @@ void Ospfv2::handleMessageWhenUp(cMessage *msg)
 void Ospfv2::createOspfRouter()
 {
     ospfRouter = new Router(this, ift, rt);
+    if (par("useTimerQueue")) {
+        timerQueue = new TimerQueue(this, ospfRouter->getMessageHandler(), "OSPF-timers");
+        ospfRouter->getMessageHandler()->setTimerQueue(timerQueue);
+    }
 
     // read the OSPF AS configuration
     cXMLElement *ospfConfig = par("ospfConfig");
@@ -142,8 +149,10 @@ void Ospfv2::handleStopOperation(LifecycleOperation *operation)
 {
     ASSERT(ospfRouter);
     delete ospfRouter;
+    delete timerQueue;
     cancelEvent(startupTimer);
     ospfRouter = nullptr;
+    timerQueue = nullptr;
     unsubscribe();
 }
 
@@ -151,8 +160,10 @@ void Ospfv2::handleCrashOperation(LifecycleOperation *operation)
 {
     ASSERT(ospfRouter);
     delete ospfRouter;
+    delete timerQueue;
     cancelEvent(startupTimer);
     ospfRouter = nullptr;
+    timerQueue = nullptr;
     unsubscribe();
 }
 
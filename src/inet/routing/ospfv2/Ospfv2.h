@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "inet/common/ModuleRefByPar.h"
+#include "inet/common/TimerQueue.h"
 #include "inet/networklayer/contract/IInterfaceTable.h"
 #include "inet/networklayer/ipv4/IIpv4RoutingTable.h"
 #include "inet/routing/base/RoutingProtocolBase.h"
@@ -31,6 +32,7 @@ class INET_API Ospfv2 : public RoutingProtocolBase, protected cListener
     ModuleRefByPar<IInterfaceTable> ift;
     Router *ospfRouter = nullptr; // root object of the OSPF data structure
     cMessage *startupTimer = nullptr; // timer for delayed startup
+    TimerQueue *timerQueue = nullptr; // multiplexes the protocol timers behind a single scheduled event, see the useTimerQueue parameter
 
   public:
     Ospfv2();
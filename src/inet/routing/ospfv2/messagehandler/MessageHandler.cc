@@ -369,12 +369,18 @@ void MessageHandler::sendPacket(Packet *packet, Ipv4Address destination, Ospfv2I
 
 void MessageHandler::clearTimer(cMessage *timer)
 {
-    ospfModule->cancelEvent(timer);
+    if (timerQueue != nullptr)
+        timerQueue->cancelEvent(timer);
+    else
+        ospfModule->cancelEvent(timer);
 }
 
 void MessageHandler::startTimer(cMessage *timer, simtime_t delay)
 {
-    ospfModule->scheduleAfter(delay, timer);
+    if (timerQueue != nullptr)
+        timerQueue->scheduleAfter(delay, timer);
+    else
+        ospfModule->scheduleAfter(delay, timer);
 }
 
 void MessageHandler::printEvent(const char *eventString, const Ospfv2Interface *onInterface, const Neighbor *forNeighbor /*= nullptr*/) const
@@ -7,6 +7,7 @@
 #ifndef __INET_MESSAGEHANDLER_H
 #define __INET_MESSAGEHANDLER_H
 
+#include "inet/common/TimerQueue.h"
 #include "inet/routing/ospfv2/interface/Ospfv2Interface.h"
 #include "inet/routing/ospfv2/messagehandler/DatabaseDescriptionHandler.h"
 #include "inet/routing/ospfv2/messagehandler/HelloHandler.h"
@@ -18,10 +19,11 @@
 namespace inet {
 namespace ospfv2 {
 
-class INET_API MessageHandler : public IMessageHandler
+class INET_API MessageHandler : public IMessageHandler, public TimerQueue::ICallback
 {
   private:
     cSimpleModule *ospfModule;
+    TimerQueue *timerQueue = nullptr; // when set, the timers are multiplexed behind a single scheduled event
 
     HelloHandler helloHandler;
     DatabaseDescriptionHandler ddHandler;
@@ -32,8 +34,10 @@ class INET_API MessageHandler : public IMessageHandler
   public:
     MessageHandler(Router *containingRouter, cSimpleModule *containingModule);
 
+    void setTimerQueue(TimerQueue *timerQueue) { this->timerQueue = timerQueue; }
+
     void messageReceived(cMessage *message);
-    void handleTimer(cMessage *timer);
+    virtual void handleTimer(cMessage *timer) override;
 
     void processPacket(Packet *packet, Ospfv2Interface *unused1 = nullptr, Neighbor *unused2 = nullptr) override;
 
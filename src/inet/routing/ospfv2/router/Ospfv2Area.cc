@@ -9,6 +9,10 @@
 
 #include <memory.h>
 
+#include <set>
+#include <tuple>
+
+#include "inet/common/stlutils.h"
 #include "inet/routing/ospfv2/Ospfv2Crc.h"
 #include "inet/routing/ospfv2/router/Ospfv2Router.h"
 
@@ -369,7 +373,6 @@ void Ospfv2Area::ageDatabase()
         RouterLsa *lsa = routerLSAs[i];
         unsigned short lsAge = lsa->getHeader().getLsAge();
         bool selfOriginated = (lsa->getHeader().getAdvertisingRouter() == parentRouter->getRouterID());
-        bool unreachable = parentRouter->isDestinationUnreachable(lsa);
 
         if ((selfOriginated && (lsAge < (LS_REFRESH_TIME - 1))) || (!selfOriginated && (lsAge < (MAX_AGE - 1)))) {
             lsa->getHeaderForUpdate().setLsAge(lsAge + 1);
@@ -381,7 +384,7 @@ void Ospfv2Area::ageDatabase()
             lsa->incrementInstallTime();
         }
         if (selfOriginated && (lsAge == (LS_REFRESH_TIME - 1))) {
-            if (unreachable) {
+            if (parentRouter->isDestinationUnreachable(lsa)) {
                 lsa->getHeaderForUpdate().setLsAge(MAX_AGE);
                 floodLSA(lsa);
                 lsa->incrementInstallTime();
@@ -418,7 +421,7 @@ void Ospfv2Area::ageDatabase()
             if (!isOnAnyRetransmissionList(lsaKey) &&
                 !hasAnyNeighborInStates(Neighbor::EXCHANGE_STATE | Neighbor::LOADING_STATE))
             {
-                if (!selfOriginated || unreachable) {
+                if (!selfOriginated || parentRouter->isDestinationUnreachable(lsa)) {
                     routerLSAsByID.erase(lsa->getHeader().getLinkStateID());
                     delete lsa;
                     routerLSAs[i] = nullptr;
@@ -450,7 +453,6 @@ void Ospfv2Area::ageDatabase()
 
     for (uint32_t i = 0; i < networkLSAs.size(); i++) {
         unsigned short lsAge = networkLSAs[i]->getHeader().getLsAge();
-        bool unreachable = parentRouter->isDestinationUnreachable(networkLSAs[i]);
         NetworkLsa *lsa = networkLSAs[i];
         Ospfv2Interface *localIntf = getInterface(lsa->getHeader().getLinkStateID());
         bool selfOriginated = false;
@@ -473,7 +475,7 @@ void Ospfv2Area::ageDatabase()
             lsa->incrementInstallTime();
         }
         if (selfOriginated && (lsAge == (LS_REFRESH_TIME - 1))) {
-            if (unreachable) {
+            if (parentRouter->isDestinationUnreachable(lsa)) {
                 lsa->getHeaderForUpdate().setLsAge(MAX_AGE);
                 floodLSA(lsa);
                 lsa->incrementInstallTime();
@@ -516,7 +518,7 @@ void Ospfv2Area::ageDatabase()
             if (!isOnAnyRetransmissionList(lsaKey) &&
                 !hasAnyNeighborInStates(Neighbor::EXCHANGE_STATE | Neighbor::LOADING_STATE))
             {
-                if (!selfOriginated || unreachable) {
+                if (!selfOriginated || parentRouter->isDestinationUnreachable(lsa)) {
                     networkLSAsByID.erase(lsa->getHeader().getLinkStateID());
                     delete lsa;
                     networkLSAs[i] = nullptr;
@@ -554,7 +556,6 @@ void Ospfv2Area::ageDatabase()
     for (uint32_t i = 0; i < summaryLSAs.size(); i++) {
         unsigned short lsAge = summaryLSAs[i]->getHeader().getLsAge();
         bool selfOriginated = (summaryLSAs[i]->getHeader().getAdvertisingRouter() == parentRouter->getRouterID());
-        bool unreachable = parentRouter->isDestinationUnreachable(summaryLSAs[i]);
         SummaryLsa *lsa = summaryLSAs[i];
 
         if ((selfOriginated && (lsAge < (LS_REFRESH_TIME - 1))) || (!selfOriginated && (lsAge < (MAX_AGE - 1)))) {
@@ -567,7 +568,7 @@ void Ospfv2Area::ageDatabase()
             lsa->incrementInstallTime();
         }
         if (selfOriginated && (lsAge == (LS_REFRESH_TIME - 1))) {
-            if (unreachable) {
+            if (parentRouter->isDestinationUnreachable(lsa)) {
                 lsa->getHeaderForUpdate().setLsAge(MAX_AGE);
                 floodLSA(lsa);
                 lsa->incrementInstallTime();
@@ -611,7 +612,7 @@ void Ospfv2Area::ageDatabase()
             if (!isOnAnyRetransmissionList(lsaKey) &&
                 !hasAnyNeighborInStates(Neighbor::EXCHANGE_STATE | Neighbor::LOADING_STATE))
             {
-                if (!selfOriginated || unreachable) {
+                if (!selfOriginated || parentRouter->isDestinationUnreachable(lsa)) {
                     summaryLSAsByID.erase(lsaKey);
                     delete lsa;
                     summaryLSAs[i] = nullptr;
@@ -1400,8 +1401,31 @@ void Ospfv2Area::calculateShortestPathTree(std::vector<Ospfv2RoutingTableEntry *
 {
     bool finished = false;
     std::vector<Ospfv2Lsa *> treeVertices;
+    std::set<Ospfv2Lsa *> treeVertexSet; // for membership tests without scanning treeVertices
     Ospfv2Lsa *justAddedVertex;
-    std::vector<Ospfv2Lsa *> candidateVertices;
+
+    // The candidate list is queried by vertex, updated with decreased distances
+    // and drained in distance order, so it is kept in a vertex-indexed map plus
+    // an ordered key set instead of a vector that would have to be scanned
+    // linearly for each of these operations. The key preserves the original
+    // selection rule: smallest distance first, network vertices preferred over
+    // router vertices, insertion order as the final tie breaker.
+    typedef std::tuple<unsigned long, int, unsigned long> CandidateKey; // (distance, vertex type rank, insertion index)
+    std::map<Ospfv2Lsa *, CandidateKey> candidateKeys;
+    std::set<std::pair<CandidateKey, Ospfv2Lsa *>> candidateQueue;
+    unsigned long nextCandidateIndex = 0;
+    auto vertexTypeRank = [] (Ospfv2Lsa *vertex) { return vertex->getHeader().getLsType() == NETWORKLSA_TYPE ? 0 : 1; };
+    auto enqueueCandidate = [&] (Ospfv2Lsa *vertex, unsigned long distance) {
+        CandidateKey key(distance, vertexTypeRank(vertex), nextCandidateIndex++);
+        candidateKeys[vertex] = key;
+        candidateQueue.insert({ key, vertex });
+    };
+    auto decreaseCandidateDistance = [&] (Ospfv2Lsa *vertex, unsigned long distance) {
+        CandidateKey& key = candidateKeys[vertex];
+        candidateQueue.erase({ key, vertex });
+        std::get<0>(key) = distance;
+        candidateQueue.insert({ key, vertex });
+    };
 
     printLSDB();
 
@@ -1428,6 +1452,7 @@ void Ospfv2Area::calculateShortestPathTree(std::vector<Ospfv2RoutingTableEntry *
 
     spfTreeRoot->setDistance(0);
     treeVertices.push_back(spfTreeRoot);
+    treeVertexSet.insert(spfTreeRoot);
     justAddedVertex = spfTreeRoot; // (1)
 
     do {
@@ -1466,28 +1491,13 @@ void Ospfv2Area::calculateShortestPathTree(std::vector<Ospfv2RoutingTableEntry *
                     continue;
                 }
 
-                unsigned int treeSize = treeVertices.size();
-                bool alreadyOnTree = false;
-
-                for (uint32_t j = 0; j < treeSize; j++) {
-                    if (treeVertices[j] == joiningVertex) {
-                        alreadyOnTree = true;
-                        break;
-                    }
-                }
-                if (alreadyOnTree) { // (2) (c)
+                if (contains(treeVertexSet, joiningVertex)) { // (2) (c)
                     continue;
                 }
 
                 unsigned long linkStateCost = routerVertex->getDistance() + link.getLinkCost();
-                unsigned int candidateCount = candidateVertices.size();
-                Ospfv2Lsa *candidate = nullptr;
+                Ospfv2Lsa *candidate = containsKey(candidateKeys, joiningVertex) ? joiningVertex : nullptr;
 
-                for (uint32_t j = 0; j < candidateCount; j++) {
-                    if (candidateVertices[j] == joiningVertex) {
-                        candidate = candidateVertices[j];
-                    }
-                }
                 if (candidate != nullptr) { // (2) (d)
                     RoutingInfo *routingInfo = check_and_cast<RoutingInfo *>(candidate);
                     unsigned long candidateDistance = routingInfo->getDistance();
@@ -1498,6 +1508,7 @@ void Ospfv2Area::calculateShortestPathTree(std::vector<Ospfv2RoutingTableEntry *
                     if (linkStateCost < candidateDistance) {
                         routingInfo->setDistance(linkStateCost);
                         routingInfo->clearNextHops();
+                        decreaseCandidateDistance(candidate, linkStateCost);
                     }
                     std::vector<NextHop> *newNextHops = calculateNextHops(joiningVertex, justAddedVertex); // (destination, parent)
                     for (auto it = newNextHops->begin(); it != newNextHops->end(); ++it)
@@ -1515,7 +1526,7 @@ void Ospfv2Area::calculateShortestPathTree(std::vector<Ospfv2RoutingTableEntry *
                         RoutingInfo *vertexRoutingInfo = check_and_cast<RoutingInfo *>(joiningRouterVertex);
                         vertexRoutingInfo->setParent(justAddedVertex);
 
-                        candidateVertices.push_back(joiningRouterVertex);
+                        enqueueCandidate(joiningRouterVertex, linkStateCost);
                     }
                     else {
                         NetworkLsa *joiningNetworkVertex = check_and_cast<NetworkLsa *>(joiningVertex);
@@ -1527,7 +1538,7 @@ void Ospfv2Area::calculateShortestPathTree(std::vector<Ospfv2RoutingTableEntry *
                         RoutingInfo *vertexRoutingInfo = check_and_cast<RoutingInfo *>(joiningNetworkVertex);
                         vertexRoutingInfo->setParent(justAddedVertex);
 
-                        candidateVertices.push_back(joiningNetworkVertex);
+                        enqueueCandidate(joiningNetworkVertex, linkStateCost);
                     }
                 }
             }
@@ -1546,28 +1557,13 @@ void Ospfv2Area::calculateShortestPathTree(std::vector<Ospfv2RoutingTableEntry *
                     continue;
                 }
 
-                unsigned int treeSize = treeVertices.size();
-                bool alreadyOnTree = false;
-
-                for (uint32_t j = 0; j < treeSize; j++) {
-                    if (treeVertices[j] == joiningVertex) {
-                        alreadyOnTree = true;
-                        break;
-                    }
-                }
-                if (alreadyOnTree) { // (2) (c)
+                if (contains(treeVertexSet, joiningVertex)) { // (2) (c)
                     continue;
                 }
 
                 unsigned long linkStateCost = networkVertex->getDistance(); // link cost from network to router is always 0
-                unsigned int candidateCount = candidateVertices.size();
-                Ospfv2Lsa *candidate = nullptr;
+                Ospfv2Lsa *candidate = containsKey(candidateKeys, joiningVertex) ? joiningVertex : nullptr;
 
-                for (uint32_t j = 0; j < candidateCount; j++) {
-                    if (candidateVertices[j] == joiningVertex) {
-                        candidate = candidateVertices[j];
-                    }
-                }
                 if (candidate != nullptr) { // (2) (d)
                     RoutingInfo *routingInfo = check_and_cast<RoutingInfo *>(candidate);
                     unsigned long candidateDistance = routingInfo->getDistance();
@@ -1578,6 +1574,7 @@ void Ospfv2Area::calculateShortestPathTree(std::vector<Ospfv2RoutingTableEntry *
                     if (linkStateCost < candidateDistance) {
                         routingInfo->setDistance(linkStateCost);
                         routingInfo->clearNextHops();
+                        decreaseCandidateDistance(candidate, linkStateCost);
                     }
                     std::vector<NextHop> *newNextHops = calculateNextHops(joiningVertex, justAddedVertex); // (destination, parent)
                     for (auto it = newNextHops->begin(); it != newNextHops->end(); ++it)
@@ -1593,46 +1590,22 @@ void Ospfv2Area::calculateShortestPathTree(std::vector<Ospfv2RoutingTableEntry *
                     RoutingInfo *vertexRoutingInfo = check_and_cast<RoutingInfo *>(joiningVertex);
                     vertexRoutingInfo->setParent(justAddedVertex);
 
-                    candidateVertices.push_back(joiningVertex);
+                    enqueueCandidate(joiningVertex, linkStateCost);
                 }
             }
         }
 
-        if (candidateVertices.empty()) { // (3)
+        if (candidateQueue.empty()) { // (3)
             finished = true;
         }
         else {
-            unsigned int candidateCount = candidateVertices.size();
-            unsigned long minDistance = LS_INFINITY;
-            Ospfv2Lsa *closestVertex = candidateVertices[0];
-
-            for (uint32_t i = 0; i < candidateCount; i++) {
-                RoutingInfo *routingInfo = check_and_cast<RoutingInfo *>(candidateVertices[i]);
-                unsigned long currentDistance = routingInfo->getDistance();
-
-                if (currentDistance < minDistance) {
-                    closestVertex = candidateVertices[i];
-                    minDistance = currentDistance;
-                }
-                else {
-                    if (currentDistance == minDistance) {
-                        if ((closestVertex->getHeader().getLsType() == ROUTERLSA_TYPE) &&
-                            (candidateVertices[i]->getHeader().getLsType() == NETWORKLSA_TYPE))
-                        {
-                            closestVertex = candidateVertices[i];
-                        }
-                    }
-                }
-            }
+            auto closestIt = candidateQueue.begin();
+            Ospfv2Lsa *closestVertex = closestIt->second;
+            candidateQueue.erase(closestIt);
+            candidateKeys.erase(closestVertex);
 
             treeVertices.push_back(closestVertex);
-
-            for (auto it = candidateVertices.begin(); it != candidateVertices.end(); it++) {
-                if ((*it) == closestVertex) {
-                    candidateVertices.erase(it);
-                    break;
-                }
-            }
+            treeVertexSet.insert(closestVertex);
 
             if (closestVertex->getHeader().getLsType() == ROUTERLSA_TYPE) {
                 RouterLsa *routerLSA = check_and_cast<RouterLsa *>(closestVertex);
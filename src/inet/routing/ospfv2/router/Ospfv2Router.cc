@@ -283,7 +283,6 @@ void Router::ageDatabase()
     for (long i = 0; i < lsaCount; i++) {
         unsigned short lsAge = asExternalLSAs[i]->getHeader().getLsAge();
         bool selfOriginated = (asExternalLSAs[i]->getHeader().getAdvertisingRouter() == routerID);
-        bool unreachable = isDestinationUnreachable(asExternalLSAs[i]);
         AsExternalLsa *lsa = asExternalLSAs[i];
 
         if ((selfOriginated && (lsAge < (LS_REFRESH_TIME - 1))) || (!selfOriginated && (lsAge < (MAX_AGE - 1)))) {
@@ -296,7 +295,7 @@ void Router::ageDatabase()
             lsa->incrementInstallTime();
         }
         if (selfOriginated && (lsAge == (LS_REFRESH_TIME - 1))) {
-            if (unreachable) {
+            if (isDestinationUnreachable(lsa)) {
                 lsa->getHeaderForUpdate().setLsAge(MAX_AGE);
                 floodLSA(lsa, BACKBONE_AREAID);
                 lsa->incrementInstallTime();
@@ -333,7 +332,7 @@ void Router::ageDatabase()
             if (!isOnAnyRetransmissionList(lsaKey) &&
                 !hasAnyNeighborInStates(Neighbor::EXCHANGE_STATE | Neighbor::LOADING_STATE))
             {
-                if (!selfOriginated || unreachable) {
+                if (!selfOriginated || isDestinationUnreachable(lsa)) {
                     asExternalLSAsByID.erase(lsaKey);
                     delete lsa;
                     asExternalLSAs[i] = nullptr;
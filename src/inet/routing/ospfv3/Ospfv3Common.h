@@ -232,6 +232,19 @@ struct LSAKeyType
     Ipv4Address advertisingRouter;
 };
 
+// orders LSA keys for the per-type LSA maps; the LS type is ignored
+// because each map holds LSAs of a single type only
+class INET_API LSAKeyType_Less
+{
+  public:
+    bool operator()(const LSAKeyType& leftKey, const LSAKeyType& rightKey) const
+    {
+        return (leftKey.linkStateID < rightKey.linkStateID) ||
+               ((leftKey.linkStateID == rightKey.linkStateID) &&
+                (leftKey.advertisingRouter < rightKey.advertisingRouter));
+    }
+};
+
 // Things needed for SPF Tree Vertices
 struct NextHop
 {
@@ -66,6 +66,7 @@ Ospfv3Interface::~Ospfv3Interface()
         delete neighbors[i];
     }
     long lsaCount = linkLSAList.size();
+    linkLSAsByKey.clear();
     for (long j = 0; j < lsaCount; j++) {
         delete linkLSAList[j];
     }
@@ -187,7 +188,7 @@ bool Ospfv3Interface::ageDatabase()
                     !hasAnyNeighborInState(Ospfv3Neighbor::LOADING_STATE)))
             {
                 if (!selfOriginated /*|| unreachable*/) {
-                    linkLSAsByID.erase(lsa->getHeader().getLinkStateID());
+                    linkLSAsByKey.erase(lsaKey);
                     delete lsa;
                     linkLSAList[i] = nullptr;
                     shouldRebuildRoutingTable = true;
@@ -1813,13 +1814,8 @@ LinkLSA *Ospfv3Interface::originateLinkLSA()
 
 LinkLSA *Ospfv3Interface::getLinkLSAbyKey(LSAKeyType lsaKey)
 {
-    for (auto it = this->linkLSAList.begin(); it != this->linkLSAList.end(); it++) {
-        if (((*it)->getHeader().getAdvertisingRouter() == lsaKey.advertisingRouter) && (*it)->getHeader().getLinkStateID() == lsaKey.linkStateID) {
-            return *it;
-        }
-    }
-
-    return nullptr;
+    auto it = this->linkLSAsByKey.find(lsaKey);
+    return (it != this->linkLSAsByKey.end()) ? it->second : nullptr;
 }
 
 bool Ospfv3Interface::installLinkLSA(const Ospfv3LinkLsa *lsa)
@@ -1840,6 +1836,7 @@ bool Ospfv3Interface::installLinkLSA(const Ospfv3LinkLsa *lsa)
     else {
         LinkLSA *lsaCopy = new LinkLSA(*lsa);
         this->linkLSAList.push_back(lsaCopy);
+        this->linkLSAsByKey[lsaKey] = lsaCopy;
         return true;
     }
 } // installLinkLSA
@@ -1847,7 +1844,10 @@ bool Ospfv3Interface::installLinkLSA(const Ospfv3LinkLsa *lsa)
 bool Ospfv3Interface::updateLinkLSA(LinkLSA *currentLsa, const Ospfv3LinkLsa *newLsa)
 {
     bool different = linkLSADiffersFrom(currentLsa, newLsa);
+    // the assignment may change the identifying header fields, re-key the LSA in the index
+    this->linkLSAsByKey.erase(Ospfv3Area::lsaKey(currentLsa));
     (*currentLsa) = (*newLsa);
+    this->linkLSAsByKey[Ospfv3Area::lsaKey(currentLsa)] = currentLsa;
 //    currentLsa->getHeaderForUpdate().setLsaAge(0); //reset the age
     if (different) {
         return true;
@@ -173,7 +173,7 @@ class INET_API Ospfv3Interface : public cObject
     // LINK LSA
     LinkLSA *originateLinkLSA();
     bool installLinkLSA(const Ospfv3LinkLsa *lsa);
-    void addLinkLSA(LinkLSA *newLSA) { this->linkLSAList.push_back(newLSA); }
+    void addLinkLSA(LinkLSA *newLSA) { this->linkLSAList.push_back(newLSA); this->linkLSAsByKey[Ospfv3Area::lsaKey(newLSA)] = newLSA; }
     int getLinkLSACount() { return this->linkLSAList.size(); }
     LinkLSA *getLinkLSA(int i) { return this->linkLSAList.at(i); }
     LinkLSA *getLinkLSAbyKey(LSAKeyType lsaKey);
@@ -223,7 +223,8 @@ class INET_API Ospfv3Interface : public cObject
     std::vector<Ospfv3Neighbor *> neighbors;
     std::map<Ipv4Address, Ospfv3Neighbor *> neighborsById;
     std::map<Ipv6Address, std::list<Ospfv3LsaHeader>> delayedAcknowledgements;
-    std::map<Ipv4Address, LinkLSA *> linkLSAsByID;
+    // index of linkLSAList, keyed by (Link State ID, Advertising Router)
+    std::map<LSAKeyType, LinkLSA *, LSAKeyType_Less> linkLSAsByKey;
 
     // for Intra-Area-Prefix LSA
     bool transitNetworkInterface;
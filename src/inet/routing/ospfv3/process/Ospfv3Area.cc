@@ -4,6 +4,8 @@
 #include <string.h>
 
 #include <iostream>
+#include <set>
+#include <tuple>
 
 #include "inet/common/stlutils.h"
 
@@ -35,21 +37,25 @@ Ospfv3Area::~Ospfv3Area()
         delete routerLSAList[j];
     }
     routerLSAList.clear();
+    routerLSAsByKey.clear();
     lsaCount = networkLSAList.size();
     for (long k = 0; k < lsaCount; k++) {
         delete networkLSAList[k];
     }
     networkLSAList.clear();
+    networkLSAsByKey.clear();
     lsaCount = interAreaPrefixLSAList.size();
     for (long m = 0; m < lsaCount; m++) {
         delete interAreaPrefixLSAList[m];
     }
     interAreaPrefixLSAList.clear();
+    interAreaPrefixLSAsByKey.clear();
     lsaCount = intraAreaPrefixLSAList.size();
     for (long m = 0; m < lsaCount; m++) {
         delete intraAreaPrefixLSAList[m];
     }
     intraAreaPrefixLSAList.clear();
+    intraAreaPrefixLSAsByKey.clear();
 }
 
 void Ospfv3Area::init()
@@ -243,7 +249,7 @@ void Ospfv3Area::ageDatabase()
                 !hasAnyNeighborInStates(Ospfv3Neighbor::EXCHANGE_STATE | Ospfv3Neighbor::LOADING_STATE))
             {
                 if (!selfOriginated /*|| unreachable*/) {
-                    routerLSAsByID.erase(lsa->getHeader().getLinkStateID());
+                    routerLSAsByKey.erase(lsaKey);
                     delete lsa;
                     routerLSAList[i] = nullptr;
                     shouldRebuildRoutingTable = true;
@@ -345,7 +351,7 @@ void Ospfv3Area::ageDatabase()
                 !hasAnyNeighborInStates(Ospfv3Neighbor::EXCHANGE_STATE | Ospfv3Neighbor::LOADING_STATE)) // Final state for Neighbor is FULL_STATE
             {
                 if (!selfOriginated /*|| unreachable*/) {
-                    networkLSAsByID.erase(lsa->getHeader().getLinkStateID());
+                    networkLSAsByKey.erase(lsaKey);
                     delete lsa;
                     networkLSAList[i] = nullptr;
                     shouldRebuildRoutingTable = true;
@@ -480,7 +486,7 @@ void Ospfv3Area::ageDatabase()
                         }
                     }
 
-                    intraAreaPrefixLSAByID.erase(lsa->getHeader().getLinkStateID());
+                    intraAreaPrefixLSAsByKey.erase(lsaKey);
                     delete lsa;
                     intraAreaPrefixLSAList[i] = nullptr;
                     shouldRebuildRoutingTable = true;
@@ -598,7 +604,7 @@ void Ospfv3Area::ageDatabase()
             if (!isOnAnyRetransmissionList(lsaKey)) {
                 if (!hasAnyNeighborInStates(Ospfv3Neighbor::EXCHANGE_STATE | Ospfv3Neighbor::LOADING_STATE)) {
                     if (!selfOriginated /*|| unreachable*/) {
-                        interAreaPrefixLSAByID.erase(lsa->getHeader().getLinkStateID());
+                        interAreaPrefixLSAsByKey.erase(lsaKey);
                         delete lsa;
                         interAreaPrefixLSAList[i] = nullptr;
                         shouldRebuildRoutingTable = true;
@@ -616,7 +622,7 @@ void Ospfv3Area::ageDatabase()
                                     area->originateInterAreaPrefixLSA(iapLSA, area, false);
                                 }
                                 else {
-                                    interAreaPrefixLSAByID.erase(lsa->getHeader().getLinkStateID());
+                                    interAreaPrefixLSAsByKey.erase(lsaKey);
                                     delete lsa;
                                     interAreaPrefixLSAList[i] = nullptr;
                                     shouldRebuildRoutingTable = true;
@@ -629,7 +635,7 @@ void Ospfv3Area::ageDatabase()
                                     area->originateInterAreaPrefixLSA(interLSA, area);
                                 }
                                 else {
-                                    interAreaPrefixLSAByID.erase(lsa->getHeader().getLinkStateID());
+                                    interAreaPrefixLSAsByKey.erase(lsaKey);
                                     delete lsa;
                                     interAreaPrefixLSAList[i] = nullptr;
                                     shouldRebuildRoutingTable = true;
@@ -798,12 +804,8 @@ RouterLSA *Ospfv3Area::routerLSAAlreadyExists(RouterLSA *newLsa)
 
 RouterLSA *Ospfv3Area::getRouterLSAbyKey(LSAKeyType LSAKey)
 {
-    for (auto it = this->routerLSAList.begin(); it != this->routerLSAList.end(); it++) {
-        if (((*it)->getHeader().getAdvertisingRouter() == LSAKey.advertisingRouter) && (*it)->getHeader().getLinkStateID() == LSAKey.linkStateID)
-            return *it;
-    }
-
-    return nullptr;
+    auto it = this->routerLSAsByKey.find(LSAKey);
+    return (it != this->routerLSAsByKey.end()) ? it->second : nullptr;
 }
 
 // add LSA message into list of all router-LSA for this area
@@ -823,6 +825,7 @@ bool Ospfv3Area::installRouterLSA(const Ospfv3RouterLsa *lsa)
         RouterLSA *lsaCopy = new RouterLSA(*lsa);
         EV_DEBUG << "RouterLSA was added to routerLSAList\n";
         this->routerLSAList.push_back(lsaCopy);
+        this->routerLSAsByKey[lsaKey] = lsaCopy;
         return true;
     }
 } // installRouterLSA
@@ -830,7 +833,10 @@ bool Ospfv3Area::installRouterLSA(const Ospfv3RouterLsa *lsa)
 bool Ospfv3Area::updateRouterLSA(RouterLSA *currentLsa, const Ospfv3RouterLsa *newLsa)
 {
     bool different = routerLSADiffersFrom(currentLsa, newLsa);
+    // the assignment may change the identifying header fields, re-key the LSA in the index
+    this->routerLSAsByKey.erase(lsaKey(currentLsa));
     (*currentLsa) = (*newLsa);
+    this->routerLSAsByKey[lsaKey(currentLsa)] = currentLsa;
 //    currentLsa = new RouterLSA(* newLsa);
 //    currentLsa->resetInstallTime();
 //    currentLsa->getHeaderForUpdate().setLsaAge(0); //reset the age
@@ -901,6 +907,7 @@ void Ospfv3Area::deleteRouterLSA(int index) {
             break;
         }
     }
+    this->routerLSAsByKey.erase(lsaKey(delRouter));
     delete delRouter;
     this->routerLSAList.erase(this->routerLSAList.begin() + index);
 }
@@ -1022,12 +1029,8 @@ NetworkLSA *Ospfv3Area::originateNetworkLSA(Ospfv3Interface *interface)
 
 NetworkLSA *Ospfv3Area::getNetworkLSAbyKey(LSAKeyType LSAKey)
 {
-    for (auto it = this->networkLSAList.begin(); it != this->networkLSAList.end(); it++) {
-        if (((*it)->getHeader().getAdvertisingRouter() == LSAKey.advertisingRouter) && (*it)->getHeader().getLinkStateID() == LSAKey.linkStateID) {
-            return *it;
-        }
-    }
-    return nullptr;
+    auto it = this->networkLSAsByKey.find(LSAKey);
+    return (it != this->networkLSAsByKey.end()) ? it->second : nullptr;
 } // getRouterLSAByKey
 
 bool Ospfv3Area::installNetworkLSA(const Ospfv3NetworkLsa *lsa)
@@ -1045,6 +1048,7 @@ bool Ospfv3Area::installNetworkLSA(const Ospfv3NetworkLsa *lsa)
     else {
         NetworkLSA *lsaCopy = new NetworkLSA(*lsa);
         this->networkLSAList.push_back(lsaCopy);
+        this->networkLSAsByKey[lsaKey] = lsaCopy;
         return true;
     }
 } // installNetworkLSA
@@ -1052,7 +1056,10 @@ bool Ospfv3Area::installNetworkLSA(const Ospfv3NetworkLsa *lsa)
 bool Ospfv3Area::updateNetworkLSA(NetworkLSA *currentLsa, const Ospfv3NetworkLsa *newLsa)
 {
     bool different = networkLSADiffersFrom(currentLsa, newLsa);
+    // the assignment may change the identifying header fields, re-key the LSA in the index
+    this->networkLSAsByKey.erase(lsaKey(currentLsa));
     (*currentLsa) = (*newLsa);
+    this->networkLSAsByKey[lsaKey(currentLsa)] = currentLsa;
 //    currentLsa->resetInstallTime();
 //    delete currentLsa;
     return different;
@@ -1321,6 +1328,7 @@ bool Ospfv3Area::installInterAreaPrefixLSA(const Ospfv3InterAreaPrefixLsa *lsa)
     else {
         InterAreaPrefixLSA *lsaCopy = new InterAreaPrefixLSA(*lsa);
         this->interAreaPrefixLSAList.push_back(lsaCopy);
+        this->interAreaPrefixLSAsByKey[lsaKey] = lsaCopy;
         EV_DEBUG << "creating new one\n";
         return true;
     }
@@ -1329,7 +1337,10 @@ bool Ospfv3Area::installInterAreaPrefixLSA(const Ospfv3InterAreaPrefixLsa *lsa)
 bool Ospfv3Area::updateInterAreaPrefixLSA(InterAreaPrefixLSA *currentLsa, const Ospfv3InterAreaPrefixLsa *newLsa)
 {
     bool different = interAreaPrefixLSADiffersFrom(currentLsa, newLsa);
+    // the assignment may change the identifying header fields, re-key the LSA in the index
+    this->interAreaPrefixLSAsByKey.erase(lsaKey(currentLsa));
     (*currentLsa) = (*newLsa);
+    this->interAreaPrefixLSAsByKey[lsaKey(currentLsa)] = currentLsa;
 //    currentLsa->getHeaderForUpdate().setLsaAge(0); //reset the age
     currentLsa->resetInstallTime();
     return different;
@@ -1659,6 +1670,7 @@ bool Ospfv3Area::installIntraAreaPrefixLSA(const Ospfv3IntraAreaPrefixLsa *lsa)
                         // if router recieve LSA type 9 from DR with IPv6 which roter have stored aj LSType 1, delete this old LSA and install new one
                         if (routerPref.getPrefix(routerPrefixLen) == netPref.getPrefix(netPrefixLen)) {
                             EV_DEBUG << "Deleting old IntraAreaPrefixLSA, install new one IntraAreaPrefixLSA\n";
+                            this->intraAreaPrefixLSAsByKey.erase(lsaKey(prefLSA));
                             delete intraAreaPrefixLSAList.at(in);
                             this->intraAreaPrefixLSAList.erase(this->intraAreaPrefixLSAList.begin() + in);
                             erase = true;
@@ -1726,6 +1738,7 @@ bool Ospfv3Area::installIntraAreaPrefixLSA(const Ospfv3IntraAreaPrefixLsa *lsa)
     else if (lsa->getReferencedLSType() == NETWORK_LSA || lsa->getReferencedLSType() == ROUTER_LSA) {
         IntraAreaPrefixLSA *lsaCopy = new IntraAreaPrefixLSA(*lsa);
         this->intraAreaPrefixLSAList.push_back(lsaCopy);
+        this->intraAreaPrefixLSAsByKey[lsaKey] = lsaCopy;
 
         if (this->getInstance()->getAreaCount() > 1)
             originateInterAreaPrefixLSA(lsaCopy, this, false);
@@ -1738,7 +1751,10 @@ bool Ospfv3Area::installIntraAreaPrefixLSA(const Ospfv3IntraAreaPrefixLsa *lsa)
 bool Ospfv3Area::updateIntraAreaPrefixLSA(IntraAreaPrefixLSA *currentLsa, const Ospfv3IntraAreaPrefixLsa *newLsa)
 {
     bool different = intraAreaPrefixLSADiffersFrom(currentLsa, newLsa);
+    // the assignment may change the identifying header fields, re-key the LSA in the index
+    this->intraAreaPrefixLSAsByKey.erase(lsaKey(currentLsa));
     *currentLsa = *newLsa;
+    this->intraAreaPrefixLSAsByKey[lsaKey(currentLsa)] = currentLsa;
 //    currentLsa->resetInstallTime();
 //    currentLsa->getHeaderForUpdate().setLsaAge(0); //reset the age
     if (different) {
@@ -1829,52 +1845,26 @@ Ospfv3Lsa *Ospfv3Area::getLSAbyKey(LSAKeyType LSAKey)
 {
     switch (LSAKey.LSType) {
         case ROUTER_LSA:
-            for (auto it = this->routerLSAList.begin(); it != this->routerLSAList.end(); it++) {
-                if (((*it)->getHeader().getAdvertisingRouter() == LSAKey.advertisingRouter) && (*it)->getHeader().getLinkStateID() == LSAKey.linkStateID) {
-                    return *it;
-                }
-            }
-            break;
+        case INTER_AREA_ROUTER_LSA:
+        case NSSA_LSA:
+            return getRouterLSAbyKey(LSAKey);
 
         case NETWORK_LSA:
-            for (auto it = this->networkLSAList.begin(); it != this->networkLSAList.end(); it++) {
-                if (((*it)->getHeader().getAdvertisingRouter() == LSAKey.advertisingRouter) && (*it)->getHeader().getLinkStateID() == LSAKey.linkStateID) {
-                    return *it;
-                }
-            }
-            break;
-
-        case INTER_AREA_PREFIX_LSA:
-            for (auto it = this->interAreaPrefixLSAList.begin(); it != this->interAreaPrefixLSAList.end(); it++) {
-                if (((*it)->getHeader().getAdvertisingRouter() == LSAKey.advertisingRouter) && (*it)->getHeader().getLinkStateID() == LSAKey.linkStateID) {
-                    return *it;
-                }
-            }
-            break;
+            return getNetworkLSAbyKey(LSAKey);
 
-        case INTER_AREA_ROUTER_LSA:
-            for (auto it = this->routerLSAList.begin(); it != this->routerLSAList.end(); it++) {
-                if (((*it)->getHeader().getAdvertisingRouter() == LSAKey.advertisingRouter) && (*it)->getHeader().getLinkStateID() == LSAKey.linkStateID) {
-                    return *it;
-                }
-            }
-            break;
-
-        case NSSA_LSA:
-            for (auto it = this->routerLSAList.begin(); it != this->routerLSAList.end(); it++) {
-                if (((*it)->getHeader().getAdvertisingRouter() == LSAKey.advertisingRouter) && (*it)->getHeader().getLinkStateID() == LSAKey.linkStateID) {
-                    return *it;
-                }
-            }
+        case INTER_AREA_PREFIX_LSA: {
+            auto it = this->interAreaPrefixLSAsByKey.find(LSAKey);
+            if (it != this->interAreaPrefixLSAsByKey.end())
+                return it->second;
             break;
+        }
 
-        case INTRA_AREA_PREFIX_LSA:
-            for (auto it = this->intraAreaPrefixLSAList.begin(); it != this->intraAreaPrefixLSAList.end(); it++) {
-                if (((*it)->getHeader().getAdvertisingRouter() == LSAKey.advertisingRouter) && (*it)->getHeader().getLinkStateID() == LSAKey.linkStateID) {
-                    return *it;
-                }
-            }
+        case INTRA_AREA_PREFIX_LSA: {
+            auto it = this->intraAreaPrefixLSAsByKey.find(LSAKey);
+            if (it != this->intraAreaPrefixLSAsByKey.end())
+                return it->second;
             break;
+        }
 
         case LINK_LSA:
             for (auto it = this->interfaceList.begin(); it != this->interfaceList.end(); it++) {
@@ -2005,11 +1995,34 @@ void Ospfv3Area::calculateShortestPathTree(std::vector<Ospfv3RoutingTableEntry *
     Ipv4Address routerID = this->getInstance()->getProcess()->getRouterID();
     bool finished = false;
     std::vector<Ospfv3Lsa *> treeVertices;
+    std::set<Ospfv3Lsa *> treeVertexSet; // for membership tests without scanning treeVertices
     Ospfv3Lsa *justAddedVertex;
-    std::vector<Ospfv3Lsa *> candidateVertices;
-    unsigned long i, j, k;
+    unsigned long i, k;
     unsigned long lsaCount;
 
+    // The candidate list is queried by vertex, updated with decreased distances
+    // and drained in distance order, so it is kept in a vertex-indexed map plus
+    // an ordered key set instead of a vector that would have to be scanned
+    // linearly for each of these operations. The key preserves the original
+    // selection rule: smallest distance first, network vertices preferred over
+    // router vertices, insertion order as the final tie breaker.
+    typedef std::tuple<unsigned long, int, unsigned long> CandidateKey; // (distance, vertex type rank, insertion index)
+    std::map<Ospfv3Lsa *, CandidateKey> candidateKeys;
+    std::set<std::pair<CandidateKey, Ospfv3Lsa *>> candidateQueue;
+    unsigned long nextCandidateIndex = 0;
+    auto vertexTypeRank = [] (Ospfv3Lsa *vertex) { return vertex->getHeader().getLsaType() == NETWORK_LSA ? 0 : 1; };
+    auto enqueueCandidate = [&] (Ospfv3Lsa *vertex, unsigned long distance) {
+        CandidateKey key(distance, vertexTypeRank(vertex), nextCandidateIndex++);
+        candidateKeys[vertex] = key;
+        candidateQueue.insert({ key, vertex });
+    };
+    auto decreaseCandidateDistance = [&] (Ospfv3Lsa *vertex, unsigned long distance) {
+        CandidateKey& key = candidateKeys[vertex];
+        candidateQueue.erase({ key, vertex });
+        std::get<0>(key) = distance;
+        candidateQueue.insert({ key, vertex });
+    };
+
     if (spfTreeRoot == nullptr) {
         RouterLSA *routerLSA = findRouterLSA(routerID);
         if (routerLSA == nullptr) {
@@ -2039,6 +2052,7 @@ void Ospfv3Area::calculateShortestPathTree(std::vector<Ospfv3RoutingTableEntry *
 
     spfTreeRoot->setDistance(0);
     treeVertices.push_back(spfTreeRoot); // root is first vertex in dijkstra alg
+    treeVertexSet.insert(spfTreeRoot);
     justAddedVertex = spfTreeRoot; // (1)
 
     do {
@@ -2072,29 +2086,13 @@ void Ospfv3Area::calculateShortestPathTree(std::vector<Ospfv3RoutingTableEntry *
                     continue;
                 }
 
-                unsigned int treeSize = treeVertices.size(); // already visited vertices (at the beginning, only root)
-                bool alreadyOnTree = false;
-
-                for (j = 0; j < treeSize; j++) { // if vertex, which was found is already in set of visited vertices, go to another one
-                    if (treeVertices[j] == joiningVertex) {
-                        alreadyOnTree = true;
-                        break;
-                    }
-                }
-                if (alreadyOnTree) { // (2) (c)
-//                    EV_DEBUG << "continue\n";
+                if (contains(treeVertexSet, joiningVertex)) { // (2) (c)
                     continue;
                 }
 
                 unsigned long linkStateCost = routerVertex->getDistance() + routerVertex->getRouters(iteration).metric;
-                unsigned int candidateCount = candidateVertices.size(); // candidateVertices is zero at the beginning
-                Ospfv3Lsa *candidate = nullptr;
+                Ospfv3Lsa *candidate = containsKey(candidateKeys, joiningVertex) ? joiningVertex : nullptr;
 
-                for (j = 0; j < candidateCount; j++) {
-                    if (candidateVertices[j] == joiningVertex) {
-                        candidate = candidateVertices[j];
-                    }
-                }
                 if (candidate != nullptr) { // (2) (d)               // first iteration, candidate is nullptr
                     RoutingInfo *routingInfo = check_and_cast<RoutingInfo *>(candidate);
                     unsigned long candidateDistance = routingInfo->getDistance();
@@ -2105,6 +2103,7 @@ void Ospfv3Area::calculateShortestPathTree(std::vector<Ospfv3RoutingTableEntry *
                     if (linkStateCost < candidateDistance) {
                         routingInfo->setDistance(linkStateCost);
                         routingInfo->clearNextHops();
+                        decreaseCandidateDistance(candidate, linkStateCost);
                     }
                     std::vector<NextHop> *newNextHops = calculateNextHops(joiningVertex, justAddedVertex); // (destination, parent)
                     unsigned int nextHopCount = newNextHops->size();
@@ -2126,7 +2125,7 @@ void Ospfv3Area::calculateShortestPathTree(std::vector<Ospfv3RoutingTableEntry *
                         RoutingInfo *vertexRoutingInfo = check_and_cast<RoutingInfo *>(joiningRouterVertex);
                         vertexRoutingInfo->setParent(justAddedVertex);
 
-                        candidateVertices.push_back(joiningRouterVertex);
+                        enqueueCandidate(joiningRouterVertex, linkStateCost);
                     }
                     else { // joiningVertexType == NETWORK_LSA
                         NetworkLSA *joiningNetworkVertex = check_and_cast<NetworkLSA *>(joiningVertex);
@@ -2144,7 +2143,7 @@ void Ospfv3Area::calculateShortestPathTree(std::vector<Ospfv3RoutingTableEntry *
                         RoutingInfo *vertexRoutingInfo = check_and_cast<RoutingInfo *>(joiningNetworkVertex);
                         vertexRoutingInfo->setParent(justAddedVertex);
 
-                        candidateVertices.push_back(joiningNetworkVertex);
+                        enqueueCandidate(joiningNetworkVertex, linkStateCost);
                     }
                 }
             } // end of for
@@ -2161,28 +2160,13 @@ void Ospfv3Area::calculateShortestPathTree(std::vector<Ospfv3RoutingTableEntry *
                 {
                     continue;
                 }
-                unsigned int treeSize = treeVertices.size();
-                bool alreadyOnTree = false;
-
-                for (j = 0; j < treeSize; j++) {
-                    if (treeVertices[j] == joiningVertex) {
-                        alreadyOnTree = true;
-                        break;
-                    }
-                }
-                if (alreadyOnTree) { // (2) (c) already on tree, continue
+                if (contains(treeVertexSet, joiningVertex)) { // (2) (c) already on tree, continue
                     continue;
                 }
 
                 unsigned long linkStateCost = networkVertex->getDistance(); // link cost from network to router is always 0
-                unsigned int candidateCount = candidateVertices.size();
-                Ospfv3Lsa *candidate = nullptr;
+                Ospfv3Lsa *candidate = containsKey(candidateKeys, joiningVertex) ? joiningVertex : nullptr;
 
-                for (j = 0; j < candidateCount; j++) {
-                    if (candidateVertices[j] == joiningVertex) {
-                        candidate = candidateVertices[j];
-                    }
-                }
                 if (candidate != nullptr) { // (2) (d)
                     RoutingInfo *routingInfo = check_and_cast<RoutingInfo *>(candidate);
                     unsigned long candidateDistance = routingInfo->getDistance();
@@ -2193,6 +2177,7 @@ void Ospfv3Area::calculateShortestPathTree(std::vector<Ospfv3RoutingTableEntry *
                     if (linkStateCost < candidateDistance) {
                         routingInfo->setDistance(linkStateCost);
                         routingInfo->clearNextHops();
+                        decreaseCandidateDistance(candidate, linkStateCost);
                     }
                     std::vector<NextHop> *newNextHops = calculateNextHops(joiningVertex, justAddedVertex); // (destination, parent)
                     unsigned int nextHopCount = newNextHops->size();
@@ -2213,47 +2198,22 @@ void Ospfv3Area::calculateShortestPathTree(std::vector<Ospfv3RoutingTableEntry *
                     RoutingInfo *vertexRoutingInfo = check_and_cast<RoutingInfo *>(joiningVertex);
                     vertexRoutingInfo->setParent(justAddedVertex);
 
-                    candidateVertices.push_back(joiningVertex);
+                    enqueueCandidate(joiningVertex, linkStateCost);
                 }
             }
         }
 
-        if (candidateVertices.empty()) { // (3)
+        if (candidateQueue.empty()) { // (3)
             finished = true;
         }
         else {
-            unsigned int candidateCount = candidateVertices.size();
-            unsigned long minDistance = LS_INFINITY;
-            Ospfv3Lsa *closestVertex = candidateVertices[0];
-
-            // this for-cycle edit distane from source vertex to all others adjacent vertices by dijstra algorithm
-            for (i = 0; i < candidateCount; i++) {
-                RoutingInfo *routingInfo = check_and_cast<RoutingInfo *>(candidateVertices[i]);
-                unsigned long currentDistance = routingInfo->getDistance();
-
-                if (currentDistance < minDistance) {
-                    closestVertex = candidateVertices[i];
-                    minDistance = currentDistance;
-                }
-                else {
-                    if (currentDistance == minDistance) {
-                        if ((closestVertex->getHeader().getLsaType() == ROUTER_LSA) &&
-                            (candidateVertices[i]->getHeader().getLsaType() == NETWORK_LSA))
-                        {
-                            closestVertex = candidateVertices[i];
-                        }
-                    }
-                }
-            }
+            auto closestIt = candidateQueue.begin();
+            Ospfv3Lsa *closestVertex = closestIt->second;
+            candidateQueue.erase(closestIt);
+            candidateKeys.erase(closestVertex);
 
             treeVertices.push_back(closestVertex); // treeVertices is the main SPF tree
-            // delete selected closestVertex  from candidateVertices
-            for (auto it = candidateVertices.begin(); it != candidateVertices.end(); it++) {
-                if ((*it) == closestVertex) {
-                    candidateVertices.erase(it);
-                    break;
-                }
-            }
+            treeVertexSet.insert(closestVertex);
             if (closestVertex->getHeader().getLsaType() == ROUTER_LSA) {
                 RouterLSA *routerLSA = check_and_cast<RouterLSA *>(closestVertex);
 
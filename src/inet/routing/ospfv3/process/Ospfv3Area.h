@@ -54,6 +54,15 @@ class INET_API Ospfv3Area : public cObject
     int getInterfaceCount() const { return this->interfaceList.size(); }
     Ospfv3Lsa *getLSAbyKey(LSAKeyType lsaKey);
 
+    static LSAKeyType lsaKey(const Ospfv3Lsa *lsa)
+    {
+        LSAKeyType lsaKey;
+        lsaKey.LSType = lsa->getHeader().getLsaType();
+        lsaKey.linkStateID = lsa->getHeader().getLinkStateID();
+        lsaKey.advertisingRouter = lsa->getHeader().getAdvertisingRouter();
+        return lsaKey;
+    }
+
     void addAddressRange(Ipv6AddressRange addressRange, bool advertise);
     bool hasAddressRange(Ipv6AddressRange addressRange) const;
     void addAddressRange(Ipv4AddressRange addressRange, bool advertise);
@@ -74,11 +83,11 @@ class INET_API Ospfv3Area : public cObject
     RouterLSA *findRouterLSAByID(Ipv4Address linkStateID);
     RouterLSA *findRouterLSA(Ipv4Address routerID);
     void deleteRouterLSA(int index);
-    void addRouterLSA(RouterLSA *newLSA) { this->routerLSAList.push_back(newLSA); }
+    void addRouterLSA(RouterLSA *newLSA) { this->routerLSAList.push_back(newLSA); this->routerLSAsByKey[lsaKey(newLSA)] = newLSA; }
     RouterLSA *routerLSAAlreadyExists(RouterLSA *newLsa);
 
     /*NETWORK LSA */
-    void addNetworkLSA(NetworkLSA *newLSA) { this->networkLSAList.push_back(newLSA); }
+    void addNetworkLSA(NetworkLSA *newLSA) { this->networkLSAList.push_back(newLSA); this->networkLSAsByKey[lsaKey(newLSA)] = newLSA; }
     NetworkLSA *originateNetworkLSA(Ospfv3Interface *interface); // this originates one router LSA for one area
     int getNetworkLSACount() { return this->networkLSAList.size(); }
     NetworkLSA *getNetworkLSA(int i) { return this->networkLSAList.at(i); }
@@ -94,7 +103,7 @@ class INET_API Ospfv3Area : public cObject
     NetworkLSA *findNetworkLSA(uint32_t intID, Ipv4Address routerID);
 
     /* INTER AREA PREFIX LSA */
-    void addInterAreaPrefixLSA(InterAreaPrefixLSA *newLSA) { this->interAreaPrefixLSAList.push_back(newLSA); }
+    void addInterAreaPrefixLSA(InterAreaPrefixLSA *newLSA) { this->interAreaPrefixLSAList.push_back(newLSA); this->interAreaPrefixLSAsByKey[lsaKey(newLSA)] = newLSA; }
     int getInterAreaPrefixLSACount() { return this->interAreaPrefixLSAList.size(); }
     InterAreaPrefixLSA *getInterAreaPrefixLSA(int i) { return this->interAreaPrefixLSAList.at(i); }
     void originateDefaultInterAreaPrefixLSA(Ospfv3Area *toArea);
@@ -112,7 +121,7 @@ class INET_API Ospfv3Area : public cObject
     // * INTRA AREA PREFIX LSA */
     IntraAreaPrefixLSA *originateIntraAreaPrefixLSA(); // this is for non-BROADCAST links
     IntraAreaPrefixLSA *originateNetIntraAreaPrefixLSA(NetworkLSA *networkLSA, Ospfv3Interface *interface, bool checkDuplicate); // this originates one router LSA for one area
-    void addIntraAreaPrefixLSA(IntraAreaPrefixLSA *newLSA) { this->intraAreaPrefixLSAList.push_back(newLSA); }
+    void addIntraAreaPrefixLSA(IntraAreaPrefixLSA *newLSA) { this->intraAreaPrefixLSAList.push_back(newLSA); this->intraAreaPrefixLSAsByKey[lsaKey(newLSA)] = newLSA; }
     int getIntraAreaPrefixLSACount() { return this->intraAreaPrefixLSAList.size(); }
     IntraAreaPrefixLSA *getIntraAreaPrefixLSA(int i) { return this->intraAreaPrefixLSAList.at(i); }
     IntraAreaPrefixLSA *getNetIntraAreaPrefixLSA(L3Address prefix, int prefLen);
@@ -189,10 +198,11 @@ class INET_API Ospfv3Area : public cObject
     int stubDefaultCost;
     bool transitCapability = false;
 
-    std::map<Ipv4Address, RouterLSA *> routerLSAsByID;
-    std::map<Ipv4Address, NetworkLSA *> networkLSAsByID;
-    std::map<Ipv4Address, InterAreaPrefixLSA *> interAreaPrefixLSAByID;
-    std::map<Ipv4Address, IntraAreaPrefixLSA *> intraAreaPrefixLSAByID;
+    // per-type indexes of the LSA lists below, keyed by (Link State ID, Advertising Router)
+    std::map<LSAKeyType, RouterLSA *, LSAKeyType_Less> routerLSAsByKey;
+    std::map<LSAKeyType, NetworkLSA *, LSAKeyType_Less> networkLSAsByKey;
+    std::map<LSAKeyType, InterAreaPrefixLSA *, LSAKeyType_Less> interAreaPrefixLSAsByKey;
+    std::map<LSAKeyType, IntraAreaPrefixLSA *, LSAKeyType_Less> intraAreaPrefixLSAsByKey;
 
     std::vector<RouterLSA *> routerLSAList;
     Ipv4Address routerLsID = Ipv4Address::UNSPECIFIED_ADDRESS;
@@ -253,6 +253,7 @@ void Rip::stopRIPRouting()
     for (auto& elem : ripRoutingTable)
         delete elem;
     ripRoutingTable.clear();
+    ripRouteIndex.clear();
     ripInterfaces.clear();
 }
 
@@ -271,6 +272,7 @@ RipRoute *Rip::importRoute(IRoute *route, RipRoute::RouteType type, int metric,
     }
 
     ripRoutingTable.push_back(ripRoute);
+    indexRipRoute(ripRoute);
     emit(numRoutesSignal, (unsigned long)ripRoutingTable.size());
     return ripRoute;
 }
@@ -388,8 +390,14 @@ void Rip::receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj,
                     route->getPrefixLength() != ripRoute->getPrefixLength() ||
                     route->getNextHopAsGeneric() != ripRoute->getNextHop() ||
                     route->getInterface() != ripRoute->getInterface();
+                bool keyChanged = route->getDestinationAsGeneric() != ripRoute->getDestination() ||
+                    route->getPrefixLength() != ripRoute->getPrefixLength();
+                if (keyChanged)
+                    unindexRipRoute(ripRoute, ripRoute->getDestination(), ripRoute->getPrefixLength());
                 ripRoute->setDestination(route->getDestinationAsGeneric());
                 ripRoute->setPrefixLength(route->getPrefixLength());
+                if (keyChanged)
+                    indexRipRoute(ripRoute);
                 ripRoute->setNextHop(route->getNextHopAsGeneric());
                 ripRoute->setInterface(route->getInterface());
                 if (changed) {
@@ -812,6 +820,7 @@ void Rip::addRoute(const L3Address& dest, int prefixLength, const NetworkInterfa
     ripRoute->setLastUpdateTime(simTime());
     ripRoute->setChanged(true);
     ripRoutingTable.push_back(ripRoute);
+    indexRipRoute(ripRoute);
 
     emit(numRoutesSignal, (unsigned long)ripRoutingTable.size());
     triggerUpdate();
@@ -959,7 +968,8 @@ Rip::RouteVector::iterator Rip::purgeRoute(RipRoute *ripRoute)
         rt->deleteRoute(route);
     }
 
-    // erase the ripRoute from the vector
+    // erase the ripRoute from the vector and the index
+    unindexRipRoute(ripRoute, ripRoute->getDestination(), ripRoute->getPrefixLength());
     auto itt = ripRoutingTable.erase(find(ripRoutingTable, ripRoute));
 
     delete ripRoute;
@@ -1000,20 +1010,35 @@ RipNetworkInterface *Rip::findRipInterfaceById(int interfaceId)
     return nullptr;
 }
 
-RipRoute *Rip::findRipRoute(const L3Address& destination, int prefixLength)
+void Rip::indexRipRoute(RipRoute *ripRoute)
 {
-    for (auto& elem : ripRoutingTable)
-        if ((elem)->getDestination() == destination && (elem)->getPrefixLength() == prefixLength)
-            return elem;
+    // multimap insertion keeps equal keys in insertion order, i.e. in ripRoutingTable order
+    ripRouteIndex.insert(std::make_pair(std::make_pair(ripRoute->getDestination(), ripRoute->getPrefixLength()), ripRoute));
+}
 
-    return nullptr;
+void Rip::unindexRipRoute(RipRoute *ripRoute, const L3Address& destination, int prefixLength)
+{
+    auto range = ripRouteIndex.equal_range(std::make_pair(destination, prefixLength));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == ripRoute) {
+            ripRouteIndex.erase(it);
+            return;
+        }
+    }
+}
+
+RipRoute *Rip::findRipRoute(const L3Address& destination, int prefixLength)
+{
+    auto range = ripRouteIndex.equal_range(std::make_pair(destination, prefixLength));
+    return range.first != range.second ? range.first->second : nullptr;
 }
 
 RipRoute *Rip::findRipRoute(const L3Address& destination, int prefixLength, RipRoute::RouteType type)
 {
-    for (auto& elem : ripRoutingTable)
-        if ((elem)->getType() == type && (elem)->getDestination() == destination && (elem)->getPrefixLength() == prefixLength)
-            return elem;
+    auto range = ripRouteIndex.equal_range(std::make_pair(destination, prefixLength));
+    for (auto it = range.first; it != range.second; ++it)
+        if (it->second->getType() == type)
+            return it->second;
 
     return nullptr;
 }
@@ -1083,6 +1108,7 @@ void Rip::deleteRipInterface(const NetworkInterface *ie)
     bool emitNumRoutesSignal = false;
     for (auto it = ripRoutingTable.begin(); it != ripRoutingTable.end();) {
         if ((*it)->getInterface() == ie) {
+            unindexRipRoute(*it, (*it)->getDestination(), (*it)->getPrefixLength());
             delete *it;
             it = ripRoutingTable.erase(it);
             emitNumRoutesSignal = true;
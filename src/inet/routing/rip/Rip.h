@@ -8,6 +8,8 @@
 #ifndef __INET_RIP_H
 #define __INET_RIP_H
 
+#include <map>
+
 #include "inet/common/ModuleRefByPar.h"
 #include "inet/common/packet/Packet.h"
 #include "inet/networklayer/contract/IInterfaceTable.h"
@@ -82,6 +84,10 @@ class INET_API Rip : public RoutingProtocolBase, protected cListener
     enum Mode { RIPv2, RIPng };
     typedef std::vector<RipNetworkInterface> InterfaceVector;
     typedef std::vector<RipRoute *> RouteVector;
+    // index over ripRoutingTable keyed by destination/prefix length; entries with
+    // the same key are kept in ripRoutingTable order, so lookups return the same
+    // route as a linear scan of the vector
+    typedef std::multimap<std::pair<L3Address, int>, RipRoute *> RouteMap;
     // environment
     cModule *host = nullptr; // the host module that owns this module
     ModuleRefByPar<IInterfaceTable> ift;
@@ -90,6 +96,7 @@ class INET_API Rip : public RoutingProtocolBase, protected cListener
     // state
     InterfaceVector ripInterfaces; // interfaces on which RIP is used
     RouteVector ripRoutingTable; // all advertised routes (imported or learned)
+    RouteMap ripRouteIndex; // destination/prefix length index over ripRoutingTable
     UdpSocket socket; // bound to the RIP port (see udpPort parameter)
     cMessage *updateTimer = nullptr; // for sending unsolicited Response messages in every ~30 seconds.
     cMessage *triggeredUpdateTimer = nullptr; // scheduled when there are pending changes
@@ -153,6 +160,9 @@ class INET_API Rip : public RoutingProtocolBase, protected cListener
   private:
     RipNetworkInterface *findRipInterfaceById(int interfaceId);
 
+    void indexRipRoute(RipRoute *ripRoute);
+    void unindexRipRoute(RipRoute *ripRoute, const L3Address& destination, int prefixLength);
+
     RipRoute *findRipRoute(const L3Address& destAddress, int prefixLength);
     RipRoute *findRipRoute(const L3Address& destination, int prefixLength, RipRoute::RouteType type);
     RipRoute *findRipRoute(const IRoute *route);
@@ -236,7 +236,7 @@ void Rtcp::chooseSSRC()
 
     EV_INFO << "chooseSSRC" << ssrc;
     _senderInfo->setSsrc(ssrc);
-    _participantInfos.add(_senderInfo);
+    addParticipantInfo(_senderInfo);
     _ssrcChosen = true;
 }
 
@@ -273,8 +273,7 @@ void Rtcp::createPacket()
             participantInfo->nextInterval(simTime());
 
             if (participantInfo->toBeDeleted(simTime())) {
-                _participantInfos.remove(participantInfo);
-                delete participantInfo;
+                removeParticipantInfo(participantInfo);
                 // perhaps inform the profile
             }
         }
@@ -327,7 +326,7 @@ void Rtcp::processIncomingRTPPacket(Packet *packet, Ipv4Address address, int por
         participantInfo = new RtpParticipantInfo(ssrc);
         participantInfo->setAddress(address);
         participantInfo->setRTPPort(port);
-        _participantInfos.add(participantInfo);
+        addParticipantInfo(participantInfo);
         good = true;
     }
     else {
@@ -395,7 +394,7 @@ void Rtcp::processIncomingRTCPSenderReportPacket(const Ptr<const RtcpSenderRepor
         participantInfo = new RtpReceiverInfo(ssrc);
         participantInfo->setAddress(address);
         participantInfo->setRTCPPort(port);
-        _participantInfos.add(participantInfo);
+        addParticipantInfo(participantInfo);
     }
     else {
         if ((participantInfo->getAddress() == address) &&
@@ -428,7 +427,7 @@ void Rtcp::processIncomingRTCPReceiverReportPacket(const Ptr<const RtcpReceiverR
         participantInfo = new RtpReceiverInfo(ssrc);
         participantInfo->setAddress(address);
         participantInfo->setRTCPPort(port);
-        _participantInfos.add(participantInfo);
+        addParticipantInfo(participantInfo);
     }
     else {
         if ((participantInfo->getAddress() == address) &&
@@ -468,7 +467,7 @@ void Rtcp::processIncomingRTCPSDESPacket(const Ptr<const RtcpSdesPacket>& rtcpSD
                 participantInfo = new RtpReceiverInfo(ssrc);
                 participantInfo->setAddress(address);
                 participantInfo->setRTCPPort(port);
-                _participantInfos.add(participantInfo);
+                addParticipantInfo(participantInfo);
             }
             else {
                 // check for ssrc conflict
@@ -484,9 +483,7 @@ void Rtcp::processIncomingRTCPByePacket(const Ptr<const RtcpByePacket>& rtcpByeP
     RtpParticipantInfo *participantInfo = findParticipantInfo(ssrc);
 
     if (participantInfo != nullptr && participantInfo != _senderInfo) {
-        _participantInfos.remove(participantInfo);
-
-        delete participantInfo;
+        removeParticipantInfo(participantInfo);
         // perhaps it would be useful to inform
         // the profile to remove the corresponding
         // receiver module
@@ -495,8 +492,21 @@ void Rtcp::processIncomingRTCPByePacket(const Ptr<const RtcpByePacket>& rtcpByeP
 
 RtpParticipantInfo *Rtcp::findParticipantInfo(uint32_t ssrc)
 {
-    std::string ssrcString = RtpParticipantInfo::ssrcToName(ssrc);
-    return check_and_cast_nullable<RtpParticipantInfo *>(_participantInfos.get(ssrcString.c_str()));
+    auto it = _participantInfosBySsrc.find(ssrc);
+    return it != _participantInfosBySsrc.end() ? it->second : nullptr;
+}
+
+void Rtcp::addParticipantInfo(RtpParticipantInfo *participantInfo)
+{
+    _participantInfos.add(participantInfo);
+    _participantInfosBySsrc[participantInfo->getSsrc()] = participantInfo;
+}
+
+void Rtcp::removeParticipantInfo(RtpParticipantInfo *participantInfo)
+{
+    _participantInfosBySsrc.erase(participantInfo->getSsrc());
+    _participantInfos.remove(participantInfo);
+    delete participantInfo;
 }
 
 void Rtcp::calculateAveragePacketSize(int size)
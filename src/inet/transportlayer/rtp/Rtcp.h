@@ -8,6 +8,8 @@
 #ifndef __INET_RTCP_H
 #define __INET_RTCP_H
 
+#include <map>
+
 #include "inet/common/lifecycle/LifecycleUnsupported.h"
 #include "inet/common/packet/Packet.h"
 #include "inet/networklayer/contract/ipv4/Ipv4Address.h"
@@ -150,6 +152,18 @@ class INET_API Rtcp : public cSimpleModule, public LifecycleUnsupported
      */
     virtual RtpParticipantInfo *findParticipantInfo(uint32_t ssrc);
 
+    /**
+     * Stores the RtpParticipantInfo object and indexes it by its ssrc
+     * identifier.
+     */
+    virtual void addParticipantInfo(RtpParticipantInfo *participantInfo);
+
+    /**
+     * Removes the RtpParticipantInfo object from the storage and from the
+     * ssrc index, and deletes it.
+     */
+    virtual void removeParticipantInfo(RtpParticipantInfo *participantInfo);
+
     /**
      * Recalculates the average size of an RtcpCompoundPacket when
      * one of this size has been sent or received.
@@ -203,6 +217,12 @@ class INET_API Rtcp : public cSimpleModule, public LifecycleUnsupported
      */
     cArray _participantInfos;
 
+    /**
+     * Index of _participantInfos by ssrc identifier, so that per packet
+     * lookups don't have to scan the array.
+     */
+    std::map<uint32_t, RtpParticipantInfo *> _participantInfosBySsrc;
+
     /**
      * The UDP socket for sending/receiving rtcp packets.
      */
@@ -36,6 +36,9 @@ Define_Module(Sctp);
 
 void Sctp::printInfoAssocMap()
 {
+    if (!cLog::runtimeLogPredicate(this, LOGLEVEL_DETAIL, nullptr))
+        return; // this runs for every received packet, don't walk the map when the output would be discarded anyway
+
     SctpAssociation *assoc;
     SockPair key;
     EV_DETAIL << "Number of Assocs: " << sizeAssocMap << "\n";
@@ -53,6 +56,9 @@ void Sctp::printInfoAssocMap()
 
 void Sctp::printVTagMap()
 {
+    if (!cLog::runtimeLogPredicate(this, LOGLEVEL_DETAIL, nullptr))
+        return; // this runs for every received packet, don't walk the map when the output would be discarded anyway
+
     int32_t assocId;
     VTagPair key;
     EV_DETAIL << "Number of Assocs: " << sctpVTagMap.size() << "\n";
@@ -151,6 +157,7 @@ Sctp::~Sctp()
     if (!(sctpAppAssocMap.empty())) {
         EV_DEBUG << "clear appConnMap ptr=" << &sctpAppAssocMap << "\n";
         sctpAppAssocMap.clear();
+        assocIdMap.clear();
     }
     if (!(assocStatMap.empty())) {
         EV_DEBUG << "clear assocStatMap ptr=" << &assocStatMap << "\n";
@@ -158,6 +165,7 @@ Sctp::~Sctp()
     }
     if (!(sctpVTagMap.empty())) {
         sctpVTagMap.clear();
+        vTagIndex.clear();
     }
     delete socketOptions;
     EV_DEBUG << "after clearing maps\n";
@@ -333,6 +341,7 @@ void Sctp::handleMessage(cMessage *msg)
                         key.appGateIndex = appGateIndex;
                         key.assocId = assocId;
                         sctpAppAssocMap[key] = assoc;
+                        assocIdMap[assocId] = assoc;
                         EV_INFO << "SCTP association created for appGateIndex " << appGateIndex << " and assoc " << assocId << "\n";
                         bool ret = assoc->processAppCommand(msg, const_cast<SctpCommandReq *>(controlInfo.get()));
                         if (!ret) {
@@ -536,15 +545,43 @@ SctpAssociation *Sctp::findAssocWithVTag(uint32_t peerVTag, uint32_t remotePort,
     EV_DEBUG << "findAssocWithVTag: peerVTag=" << peerVTag << " srcPort=" << remotePort << "    destPort=" << localPort << "\n";
     printInfoAssocMap();
 
-    // try with fully qualified SockPair
-    for (auto& elem : sctpVTagMap) {
-        if ((elem.second.peerVTag == peerVTag && elem.second.localPort == localPort
-             && elem.second.remotePort == remotePort)
-            || (elem.second.localVTag == peerVTag && elem.second.localPort == localPort
-                && elem.second.remotePort == remotePort))
-            return getAssoc(elem.first);
+    // look up the tag in the index, then verify the ports; of several matches
+    // take the lowest assocId, the same one a linear scan over the
+    // assocId-ordered sctpVTagMap would return
+    int32_t foundAssocId = -1;
+    auto range = vTagIndex.equal_range(peerVTag);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto elem = sctpVTagMap.find(it->second);
+        if (elem != sctpVTagMap.end() && elem->second.localPort == localPort
+            && elem->second.remotePort == remotePort
+            && (foundAssocId == -1 || elem->first < foundAssocId))
+            foundAssocId = elem->first;
+    }
+    return foundAssocId != -1 ? getAssoc(foundAssocId) : nullptr;
+}
+
+void Sctp::setVTagPair(int32_t assocId, const VTagPair& vtagPair)
+{
+    auto elem = sctpVTagMap.find(assocId);
+    if (elem != sctpVTagMap.end()) {
+        eraseVTagIndexEntry(elem->second.peerVTag, assocId);
+        eraseVTagIndexEntry(elem->second.localVTag, assocId);
+    }
+    sctpVTagMap[assocId] = vtagPair;
+    vTagIndex.insert({ vtagPair.peerVTag, assocId });
+    if (vtagPair.localVTag != vtagPair.peerVTag)
+        vTagIndex.insert({ vtagPair.localVTag, assocId });
+}
+
+void Sctp::eraseVTagIndexEntry(uint32_t vTag, int32_t assocId)
+{
+    auto range = vTagIndex.equal_range(vTag);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == assocId) {
+            vTagIndex.erase(it);
+            return;
+        }
     }
-    return nullptr;
 }
 
 SctpAssociation *Sctp::findAssocForInitAck(SctpInitAckChunk *initAckChunk, L3Address srcAddr, L3Address destAddr, uint32_t srcPort, uint32_t destPort, bool findListen)
@@ -831,17 +868,20 @@ void Sctp::addForkedAssociation(SctpAssociation *assoc, SctpAssociation *newAsso
     key.appGateIndex = assoc->appGateIndex;
     key.assocId = assoc->assocId;
     sctpAppAssocMap.erase(key);
+    assocIdMap.erase(assoc->assocId);
     assoc->listeningAssocId = assoc->assocId;
     int id = SctpSocket::getNewAssocId();
     EV_INFO << "id = " << id << endl;
     key.assocId = assoc->assocId = id;
     EV_INFO << "listeningAssocId set to " << assoc->listeningAssocId << " new assocId = " << assoc->assocId << endl;
     sctpAppAssocMap[key] = assoc;
+    assocIdMap[assoc->assocId] = assoc;
 
     // ...and newAssoc will live on with the old assocId
     key.appGateIndex = newAssoc->appGateIndex;
     key.assocId = newAssoc->assocId;
     sctpAppAssocMap[key] = newAssoc;
+    assocIdMap[newAssoc->assocId] = newAssoc;
     sizeAssocMap = sctpAssocMap.size();
     printInfoAssocMap();
 }
@@ -964,17 +1004,15 @@ void Sctp::removeAssociation(SctpAssociation *assoc)
     key.appGateIndex = assoc->appGateIndex;
     key.assocId = assoc->assocId;
     sctpAppAssocMap.erase(key);
+    assocIdMap.erase(assoc->assocId);
     assocList.remove(assoc);
     delete assoc;
 }
 
 SctpAssociation *Sctp::getAssoc(int32_t assocId)
 {
-    for (auto& elem : sctpAppAssocMap) {
-        if (elem.first.assocId == assocId)
-            return elem.second;
-    }
-    return nullptr;
+    auto i = assocIdMap.find(assocId);
+    return (i == assocIdMap.end()) ? nullptr : i->second;
 }
 
 void Sctp::finish()
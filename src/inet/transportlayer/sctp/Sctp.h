@@ -14,6 +14,7 @@
 #endif // ifdef _MSC_VER
 
 #include <map>
+#include <unordered_map>
 
 #include "inet/common/ModuleRefByPar.h"
 #include "inet/networklayer/common/L3Address.h"
@@ -161,11 +162,20 @@ class INET_API Sctp : public cSimpleModule
     typedef std::map<int32_t, VTagPair> SctpVTagMap;
     SctpVTagMap sctpVTagMap;
 
+    // reverse index of sctpVTagMap: both verification tags of each association
+    // are mapped to its assocId, so findAssocWithVTag() doesn't have to scan
+    // the whole map for every received packet
+    typedef std::unordered_multimap<uint32_t, int32_t> VTagIndex;
+    VTagIndex vTagIndex;
+
     typedef std::map<AppAssocKey, SctpAssociation *> SctpAppAssocMap;
     typedef std::map<SockPair, SctpAssociation *> SctpAssocMap;
 
     SctpAppAssocMap sctpAppAssocMap;
     SctpAssocMap sctpAssocMap;
+    // assocId -> association, kept in sync with sctpAppAssocMap so getAssoc()
+    // doesn't have to scan it
+    std::unordered_map<int32_t, SctpAssociation *> assocIdMap;
     std::list<SctpAssociation *> assocList;
 
     UdpSocket udpSocket;
@@ -184,6 +194,7 @@ class INET_API Sctp : public cSimpleModule
     SctpAssociation *findAssocForMessage(L3Address srcAddr, L3Address destAddr, uint32_t srcPort, uint32_t destPort, bool findListen);
     SctpAssociation *findAssocForApp(int32_t appGateIndex, int32_t assocId);
     int32_t findAssocForFd(int32_t fd);
+    void eraseVTagIndexEntry(uint32_t vTag, int32_t assocId);
     void sendAbortFromMain(SctpHeader *sctpMsg, L3Address fromAddr, L3Address toAddr);
     void sendShutdownCompleteFromMain(SctpHeader *sctpMsg, L3Address fromAddr, L3Address toAddr);
     virtual void refreshDisplay() const override;
@@ -239,6 +250,12 @@ class INET_API Sctp : public cSimpleModule
      */
     uint16_t getEphemeralPort();
 
+    /**
+     * To be called from SctpAssociation when the verification tags are set;
+     * records the tag pair and keeps the vtag lookup index in sync.
+     */
+    void setVTagPair(int32_t assocId, const VTagPair& vtagPair);
+
     SctpAssociation *getAssoc(int32_t assocId);
     SctpAssociation *findAssocWithVTag(uint32_t peerVTag, uint32_t remotePort, uint32_t localPort);
 
@@ -15,6 +15,7 @@
 
 #include <iostream>
 #include <list>
+#include <vector>
 
 #include "inet/networklayer/common/L3Address.h"
 #include "inet/networklayer/contract/IInterfaceTable.h"
@@ -416,6 +417,28 @@ class INET_API SctpDataVariables : public cObject
     SctpDataVariables();
     ~SctpDataVariables();
 
+    /**
+     * SctpDataVariables objects are created and destroyed for every DATA
+     * chunk in flight, so their storage is recycled through a free list
+     * instead of going to the heap allocator on every chunk.
+     */
+    static void *operator new(size_t size)
+    {
+        if (size != sizeof(SctpDataVariables) || freeList.empty())
+            return ::operator new(size);
+        void *pointer = freeList.back();
+        freeList.pop_back();
+        return pointer;
+    }
+
+    static void operator delete(void *pointer, size_t size)
+    {
+        if (size != sizeof(SctpDataVariables))
+            ::operator delete(pointer);
+        else
+            freeList.push_back(pointer);
+    }
+
     void setInitialDestination(SctpPathVariables *path)
     {
         initialDestination = path;
@@ -521,6 +544,8 @@ class INET_API SctpDataVariables : public cObject
     // ====== Private Control Information =================================
 
   private:
+    static std::vector<void *> freeList; // recycled storage for operator new/delete
+
     SctpPathVariables *initialDestination;
     SctpPathVariables *lastDestination;
     SctpPathVariables *nextDestination;
@@ -257,6 +257,8 @@ SctpPathVariables::~SctpPathVariables()
 
 const L3Address SctpDataVariables::zeroAddress = L3Address();
 
+std::vector<void *> SctpDataVariables::freeList;
+
 SctpDataVariables::SctpDataVariables()
 {
     userData = nullptr;
@@ -1767,7 +1769,7 @@ void SctpAssociation::stateEntered(int32_t status)
             vtagPair.localVTag = localVTag;
             vtagPair.localPort = localPort;
             vtagPair.remotePort = remotePort;
-            sctpMain->sctpVTagMap[assocId] = vtagPair;
+            sctpMain->setVTagPair(assocId, vtagPair);
             break;
         }
 
@@ -42,11 +42,13 @@ int SctpHeaderSerializer::getKeysHandle()
 void SctpHeaderSerializer::serialize(MemoryOutputStream& stream, const Ptr<const Chunk>& chunk) const
 {
     uint8_t buffer[MAXBUFLEN];
-    memset(&buffer, 0, MAXBUFLEN);
 //    int32_t size_chunk = sizeof(struct chunk);
 
     int authstart = 0;
     const auto& msg = staticPtrCast<const SctpHeader>(chunk);
+    // zeroing the buffer provides the padding bytes; only the part covered by
+    // the serialized message needs to be cleared, not the whole 64 kB buffer
+    memset(&buffer, 0, std::min<uint32_t>(MAXBUFLEN, B(msg->getChunkLength()).get()));
     struct common_header *ch = (struct common_header *)(buffer);
     uint32_t writtenbytes = sizeof(struct common_header);
 
@@ -32,6 +32,7 @@
 #include "inet/transportlayer/tcp/TcpConnection.h"
 #include "inet/transportlayer/tcp/TcpReceiveQueue.h"
 #include "inet/transportlayer/tcp/TcpSendQueue.h"
+#include "inet/transportlayer/tcp/TcpTimerQueue.h"
 #include "inet/transportlayer/tcp_common/TcpHeader.h"
 
 namespace inet {
@@ -44,6 +45,7 @@ simsignal_t Tcp::tcpConnectionRemovedSignal = registerSignal("tcpConnectionRemov
 
 Tcp::~Tcp()
 {
+    delete timerQueue;
 }
 
 void Tcp::initialize(int stage)
@@ -58,6 +60,8 @@ void Tcp::initialize(int stage)
 
         msl = par("msl");
         useDataNotification = par("useDataNotification");
+        if (par("useTimerQueue"))
+            timerQueue = new TcpTimerQueue(this);
 
         WATCH(lastEphemeralPort);
         WATCH_PTRMAP(tcpConnMap);
@@ -93,7 +97,10 @@ void Tcp::finish()
 
 void Tcp::handleSelfMessage(cMessage *msg)
 {
-    throw cRuntimeError("model error: should schedule timers on connection");
+    if (timerQueue != nullptr)
+        timerQueue->fireTimers();
+    else
+        throw cRuntimeError("model error: should schedule timers on connection");
 }
 
 void Tcp::handleUpperCommand(cMessage *msg)
@@ -27,6 +27,7 @@ namespace tcp {
 class TcpConnection;
 class TcpSendQueue;
 class TcpReceiveQueue;
+class TcpTimerQueue;
 
 /**
  * Implements the Tcp protocol. This section describes the internal
@@ -120,6 +121,8 @@ class INET_API Tcp : public TransportProtocolBase
     ushort lastEphemeralPort = static_cast<ushort>(-1);
     std::multiset<ushort> usedEphemeralPorts;
 
+    TcpTimerQueue *timerQueue = nullptr;
+
   protected:
     /** Factory method; may be overriden for customizing Tcp */
     virtual TcpConnection *createConnection(int socketId);
@@ -196,6 +199,12 @@ class INET_API Tcp : public TransportProtocolBase
 
     bool checkCrc(Packet *pk);
     int getMsl() { return msl; }
+
+    /**
+     * Returns the timer queue the connection timers are multiplexed onto, or
+     * nullptr when the connections schedule their timers individually.
+     */
+    TcpTimerQueue *getTimerQueue() { return timerQueue; }
 };
 
 } // namespace tcp
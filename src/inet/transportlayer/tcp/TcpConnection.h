@@ -396,6 +396,25 @@ class INET_API TcpConnection : public cSimpleModule
     Tcp *getTcpMain() { return tcpMain; }
     //@}
 
+    /** @name Timer handling
+     * These methods shadow the cSimpleModule scheduling methods. When the Tcp
+     * module uses a timer queue, the timers of all connections are multiplexed
+     * onto a single self-message instead of being scheduled individually in
+     * the future event set. Use isTimerScheduled() instead of
+     * cMessage::isScheduled() for timers handled by these methods.
+     */
+    //@{
+    void scheduleAfter(simtime_t delay, cMessage *timer);
+    void rescheduleAfter(simtime_t delay, cMessage *timer);
+    cMessage *cancelEvent(cMessage *timer);
+    bool isTimerScheduled(cMessage *timer) const;
+
+    /**
+     * Invoked by the timer queue of the Tcp module when a timer fires.
+     */
+    virtual void handleTimeout(cMessage *timer);
+    //@}
+
     /**
      * Process self-messages (timers).
      * Normally returns true. A return value of false means that the
@@ -15,6 +15,7 @@
 #include "inet/transportlayer/tcp/TcpReceiveQueue.h"
 #include "inet/transportlayer/tcp/TcpSackRexmitQueue.h"
 #include "inet/transportlayer/tcp/TcpSendQueue.h"
+#include "inet/transportlayer/tcp/TcpTimerQueue.h"
 #include "inet/transportlayer/tcp_common/TcpHeader.h"
 
 namespace inet {
@@ -151,6 +152,49 @@ void TcpConnection::handleMessage(cMessage *msg)
         throw cRuntimeError("model error: TcpConnection allows only self messages");
 }
 
+void TcpConnection::scheduleAfter(simtime_t delay, cMessage *timer)
+{
+    auto timerQueue = tcpMain->getTimerQueue();
+    if (timerQueue != nullptr)
+        timerQueue->scheduleTimer(simTime() + delay, timer);
+    else
+        cSimpleModule::scheduleAfter(delay, timer);
+}
+
+void TcpConnection::rescheduleAfter(simtime_t delay, cMessage *timer)
+{
+    auto timerQueue = tcpMain->getTimerQueue();
+    if (timerQueue != nullptr) {
+        timerQueue->cancelTimer(timer);
+        timerQueue->scheduleTimer(simTime() + delay, timer);
+    }
+    else
+        cSimpleModule::rescheduleAfter(delay, timer);
+}
+
+cMessage *TcpConnection::cancelEvent(cMessage *timer)
+{
+    auto timerQueue = tcpMain != nullptr ? tcpMain->getTimerQueue() : nullptr;
+    if (timerQueue != nullptr)
+        timerQueue->cancelTimer(timer);
+    else
+        cSimpleModule::cancelEvent(timer);
+    return timer;
+}
+
+bool TcpConnection::isTimerScheduled(cMessage *timer) const
+{
+    auto timerQueue = tcpMain->getTimerQueue();
+    return timerQueue != nullptr ? timerQueue->isTimerScheduled(timer) : timer->isScheduled();
+}
+
+void TcpConnection::handleTimeout(cMessage *timer)
+{
+    Enter_Method("handleTimeout");
+    if (!processTimer(timer))
+        tcpMain->removeConnection(this);
+}
+
 bool TcpConnection::processTimer(cMessage *msg)
 {
     printConnBrief();
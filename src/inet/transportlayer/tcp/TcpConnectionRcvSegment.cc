@@ -835,7 +835,7 @@ TcpEventCode TcpConnection::processSynInListen(Packet *tcpSegment, const Ptr<con
     sendSynAck();
     startSynRexmitTimer();
 
-    if (!connEstabTimer->isScheduled())
+    if (!isTimerScheduled(connEstabTimer))
         scheduleAfter(TCP_TIMEOUT_CONN_ESTAB, connEstabTimer);
 
     //"
@@ -7,6 +7,8 @@
 
 #include "inet/transportlayer/tcp/TcpSackRexmitQueue.h"
 
+#include <algorithm>
+
 namespace inet {
 
 namespace tcp {
@@ -19,8 +21,20 @@ TcpSackRexmitQueue::TcpSackRexmitQueue()
 
 TcpSackRexmitQueue::~TcpSackRexmitQueue()
 {
-    while (!rexmitQueue.empty())
-        rexmitQueue.pop_front();
+}
+
+TcpSackRexmitQueue::RexmitQueue::iterator TcpSackRexmitQueue::findRegion(uint32_t seqNum)
+{
+    uint32_t offset = seqNum - begin;
+    return std::upper_bound(rexmitQueue.begin(), rexmitQueue.end(), offset,
+            [this] (uint32_t offset, const Region& region) { return offset < (uint32_t)(region.endSeqNum - begin); });
+}
+
+TcpSackRexmitQueue::RexmitQueue::const_iterator TcpSackRexmitQueue::findRegion(uint32_t seqNum) const
+{
+    uint32_t offset = seqNum - begin;
+    return std::upper_bound(rexmitQueue.begin(), rexmitQueue.end(), offset,
+            [this] (uint32_t offset, const Region& region) { return offset < (uint32_t)(region.endSeqNum - begin); });
 }
 
 void TcpSackRexmitQueue::init(uint32_t seqNum)
@@ -96,10 +110,7 @@ void TcpSackRexmitQueue::enqueueSentData(uint32_t fromSeqNum, uint32_t toSeqNum)
         fromSeqNum = toSeqNum;
     }
     else {
-        auto i = rexmitQueue.begin();
-
-        while (i != rexmitQueue.end() && seqLE(i->endSeqNum, fromSeqNum))
-            i++;
+        auto i = findRegion(fromSeqNum);
 
         ASSERT(i != rexmitQueue.end());
         ASSERT(seqLE(i->beginSeqNum, fromSeqNum) && seqLess(fromSeqNum, i->endSeqNum));
@@ -108,7 +119,7 @@ void TcpSackRexmitQueue::enqueueSentData(uint32_t fromSeqNum, uint32_t toSeqNum)
             // chunk item
             region = *i;
             region.endSeqNum = fromSeqNum;
-            rexmitQueue.insert(i, region);
+            i = rexmitQueue.insert(i, region) + 1;
             i->beginSeqNum = fromSeqNum;
         }
 
@@ -128,7 +139,7 @@ void TcpSackRexmitQueue::enqueueSentData(uint32_t fromSeqNum, uint32_t toSeqNum)
             region.endSeqNum = toSeqNum;
             region.sacked = beforeEnd ? i->sacked : false;
             region.rexmitted = beforeEnd;
-            rexmitQueue.insert(i, region);
+            i = rexmitQueue.insert(i, region) + 1; // deque::insert invalidates iterators, reacquire the successor
             found = true;
             fromSeqNum = toSeqNum;
 
@@ -186,10 +197,7 @@ void TcpSackRexmitQueue::setSackedBit(uint32_t fromSeqNum, uint32_t toSeqNum)
     bool found = false;
 
     if (!rexmitQueue.empty()) {
-        auto i = rexmitQueue.begin();
-
-        while (i != rexmitQueue.end() && seqLE(i->endSeqNum, fromSeqNum))
-            i++;
+        auto i = findRegion(fromSeqNum);
 
         ASSERT(i != rexmitQueue.end() && seqLE(i->beginSeqNum, fromSeqNum) && seqLess(fromSeqNum, i->endSeqNum));
 
@@ -197,7 +205,7 @@ void TcpSackRexmitQueue::setSackedBit(uint32_t fromSeqNum, uint32_t toSeqNum)
             Region region = *i;
 
             region.endSeqNum = fromSeqNum;
-            rexmitQueue.insert(i, region);
+            i = rexmitQueue.insert(i, region) + 1; // deque::insert invalidates iterators, reacquire the successor
             i->beginSeqNum = fromSeqNum;
         }
 
@@ -215,7 +223,7 @@ void TcpSackRexmitQueue::setSackedBit(uint32_t fromSeqNum, uint32_t toSeqNum)
 
             region.endSeqNum = toSeqNum;
             region.sacked = true;
-            rexmitQueue.insert(i, region);
+            i = rexmitQueue.insert(i, region) + 1; // deque::insert invalidates iterators, reacquire the successor
             i->beginSeqNum = toSeqNum;
         }
     }
@@ -230,13 +238,10 @@ bool TcpSackRexmitQueue::getSackedBit(uint32_t seqNum) const
 {
     ASSERT(seqLE(begin, seqNum) && seqLE(seqNum, end));
 
-    RexmitQueue::const_iterator i = rexmitQueue.begin();
-
     if (end == seqNum)
         return false;
 
-    while (i != rexmitQueue.end() && seqLE(i->endSeqNum, seqNum))
-        i++;
+    auto i = findRegion(seqNum);
 
     ASSERT((i != rexmitQueue.end()) && seqLE(i->beginSeqNum, seqNum) && seqLess(seqNum, i->endSeqNum));
 
@@ -270,11 +275,8 @@ uint32_t TcpSackRexmitQueue::checkRexmitQueueForSackedOrRexmittedSegments(uint32
     if (rexmitQueue.empty() || (end == fromSeqNum))
         return 0;
 
-    RexmitQueue::const_iterator i = rexmitQueue.begin();
     uint32_t bytes = 0;
-
-    while (i != rexmitQueue.end() && seqLE(i->endSeqNum, fromSeqNum))
-        i++;
+    auto i = findRegion(fromSeqNum);
 
     while (i != rexmitQueue.end() && ((i->sacked || i->rexmitted))) {
         ASSERT(seqLE(i->beginSeqNum, fromSeqNum) && seqLess(fromSeqNum, i->endSeqNum));
@@ -316,17 +318,17 @@ uint32_t TcpSackRexmitQueue::getAmountOfSackedBytes(uint32_t fromSeqNum) const
     ASSERT(seqLE(begin, fromSeqNum) && seqLE(fromSeqNum, end));
 
     uint32_t bytes = 0;
-    RexmitQueue::const_reverse_iterator i = rexmitQueue.rbegin();
+    auto i = findRegion(fromSeqNum);
 
-    for (; i != rexmitQueue.rend() && seqLE(fromSeqNum, i->beginSeqNum); i++) {
+    if (i != rexmitQueue.end() && seqLess(i->beginSeqNum, fromSeqNum)) {
         if (i->sacked)
-            bytes += (i->endSeqNum - i->beginSeqNum);
+            bytes += (i->endSeqNum - fromSeqNum);
+        ++i;
     }
 
-    if (i != rexmitQueue.rend()
-        && seqLess(i->beginSeqNum, fromSeqNum) && seqLess(fromSeqNum, i->endSeqNum) && i->sacked)
-    {
-        bytes += (i->endSeqNum - fromSeqNum);
+    for (; i != rexmitQueue.end(); ++i) {
+        if (i->sacked)
+            bytes += (i->endSeqNum - i->beginSeqNum);
     }
 
     return bytes;
@@ -339,11 +341,8 @@ uint32_t TcpSackRexmitQueue::getNumOfDiscontiguousSacks(uint32_t fromSeqNum) con
     if (rexmitQueue.empty() || (fromSeqNum == end))
         return 0;
 
-    RexmitQueue::const_iterator i = rexmitQueue.begin();
     uint32_t counter = 0;
-
-    while (i != rexmitQueue.end() && seqLE(i->endSeqNum, fromSeqNum)) // search for seqNum
-        i++;
+    auto i = findRegion(fromSeqNum); // search for seqNum
 
     // search for discontiguous sacked regions
     bool prevSacked = false;
@@ -363,10 +362,7 @@ void TcpSackRexmitQueue::checkSackBlock(uint32_t fromSeqNum, uint32_t& length, b
 {
     ASSERT(seqLE(begin, fromSeqNum) && seqLess(fromSeqNum, end));
 
-    RexmitQueue::const_iterator i = rexmitQueue.begin();
-
-    while (i != rexmitQueue.end() && seqLE(i->endSeqNum, fromSeqNum)) // search for seqNum
-        i++;
+    auto i = findRegion(fromSeqNum); // search for seqNum
 
     ASSERT(i != rexmitQueue.end());
     ASSERT(seqLE(i->beginSeqNum, fromSeqNum) && seqLess(fromSeqNum, i->endSeqNum));
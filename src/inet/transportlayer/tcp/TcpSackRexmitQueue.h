@@ -7,6 +7,8 @@
 #ifndef __INET_TCPSACKREXMITQUEUE_H
 #define __INET_TCPSACKREXMITQUEUE_H
 
+#include <deque>
+
 #include "inet/transportlayer/tcp/TcpConnection.h"
 #include "inet/transportlayer/tcp_common/TcpHeader.h"
 
@@ -28,8 +30,8 @@ class INET_API TcpSackRexmitQueue
         bool rexmitted; // indicates whether region has already been retransmitted by data sender
     };
 
-    typedef std::list<Region> RexmitQueue;
-    RexmitQueue rexmitQueue; // rexmitQueue is ordered by seqnum, and doesn't have overlapped Regions
+    typedef std::deque<Region> RexmitQueue;
+    RexmitQueue rexmitQueue; // rexmitQueue is ordered by seqnum, the regions tile [begin, end) contiguously without overlaps
 
     uint32_t begin; // 1st sequence number stored
     uint32_t end; // last sequence number stored + 1
@@ -161,6 +163,15 @@ class INET_API TcpSackRexmitQueue
     virtual void checkSackBlock(uint32_t seqNum, uint32_t& length, bool& sacked, bool& rexmitted) const;
 
   protected:
+    /*
+     * Returns the region containing seqNum, or the end iterator if seqNum is
+     * not stored. Since the regions tile [begin, end) contiguously, the region
+     * is found with a binary search on the offsets from begin, which is also
+     * correct across sequence number wraparound.
+     */
+    RexmitQueue::iterator findRegion(uint32_t seqNum);
+    RexmitQueue::const_iterator findRegion(uint32_t seqNum) const;
+
     /*
      * Returns if TcpSackRexmitQueue is valid or not.
      */
@@ -77,7 +77,8 @@ void TcpSendQueue::discardUpTo(uint32_t seqNum)
     ASSERT(seqLE(begin, seqNum) && seqLE(seqNum, end));
 
     if (seqNum != begin) {
-        dataBuffer.pop(B(seqNum - begin));
+        // the ACKed data is not needed anymore, so don't materialize it as a chunk
+        dataBuffer.eraseAtFront(B(seqNum - begin));
         begin = seqNum;
     }
 }
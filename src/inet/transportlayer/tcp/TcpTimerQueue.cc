@@ -0,0 +1,79 @@
+//
+// Copyright (C) 2004 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#include "inet/transportlayer/tcp/TcpTimerQueue.h"
+
+#include "inet/transportlayer/tcp/Tcp.h"
+#include "inet/transportlayer/tcp/TcpConnection.h"
+
+namespace inet {
+namespace tcp {
+
+TcpTimerQueue::TcpTimerQueue(Tcp *tcp) :
+    tcp(tcp)
+{
+    fireTimersMessage = new cMessage("fireTimers");
+}
+
+TcpTimerQueue::~TcpTimerQueue()
+{
+    if (tcp != nullptr)
+        tcp->cancelEvent(fireTimersMessage);
+    delete fireTimersMessage;
+}
+
+void TcpTimerQueue::updateFireTimersMessage()
+{
+    if (timers.empty()) {
+        if (fireTimersMessage->isScheduled())
+            tcp->cancelEvent(fireTimersMessage);
+    }
+    else {
+        simtime_t earliestFireTime = timers.begin()->first;
+        if (!fireTimersMessage->isScheduled())
+            tcp->scheduleAt(earliestFireTime, fireTimersMessage);
+        else if (fireTimersMessage->getArrivalTime() != earliestFireTime)
+            tcp->rescheduleAt(earliestFireTime, fireTimersMessage);
+    }
+}
+
+void TcpTimerQueue::scheduleTimer(simtime_t fireTime, cMessage *timer)
+{
+    ASSERT(!isTimerScheduled(timer));
+    auto it = timers.insert({fireTime, timer});
+    timerPositions[timer] = it;
+    updateFireTimersMessage();
+}
+
+void TcpTimerQueue::cancelTimer(cMessage *timer)
+{
+    auto it = timerPositions.find(timer);
+    if (it != timerPositions.end()) {
+        timers.erase(it->second);
+        timerPositions.erase(it);
+        updateFireTimersMessage();
+    }
+}
+
+void TcpTimerQueue::fireTimers()
+{
+    // the first entry is looked up again in every iteration because
+    // dispatching a timer may cancel or reschedule other timers, or even
+    // delete the connection together with its remaining timers
+    while (!timers.empty() && timers.begin()->first == simTime()) {
+        auto it = timers.begin();
+        cMessage *timer = it->second;
+        timerPositions.erase(timer);
+        timers.erase(it);
+        auto connection = static_cast<TcpConnection *>(timer->getContextPointer());
+        connection->handleTimeout(timer);
+    }
+    updateFireTimersMessage();
+}
+
+} // namespace tcp
+} // namespace inet
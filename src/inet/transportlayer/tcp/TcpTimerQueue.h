@@ -0,0 +1,61 @@
+//
+// Copyright (C) 2004 OpenSim Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+
+#ifndef __INET_TCPTIMERQUEUE_H
+#define __INET_TCPTIMERQUEUE_H
+
+#include <map>
+
+#include "inet/common/INETDefs.h"
+
+namespace inet {
+namespace tcp {
+
+class Tcp;
+
+/**
+ * Multiplexes the timers of all TCP connections of a Tcp module onto a single
+ * self-message. With hundreds of thousands of concurrent connections the
+ * per-connection rexmit, persist, keepalive and 2MSL self-messages would
+ * otherwise dominate the future event set of the simulation kernel; with the
+ * timer queue the kernel only sees one pending event per Tcp module. Timers
+ * fire at exactly the same simulation time as they would when scheduled
+ * individually.
+ */
+class INET_API TcpTimerQueue
+{
+  protected:
+    typedef std::multimap<simtime_t, cMessage *> Timers;
+
+    Tcp *tcp = nullptr;
+    cMessage *fireTimersMessage = nullptr;
+    Timers timers;
+    std::map<cMessage *, Timers::iterator> timerPositions;
+
+  protected:
+    void updateFireTimersMessage();
+
+  public:
+    TcpTimerQueue(Tcp *tcp);
+    ~TcpTimerQueue();
+
+    bool isTimerScheduled(cMessage *timer) const { return timerPositions.find(timer) != timerPositions.end(); }
+
+    void scheduleTimer(simtime_t fireTime, cMessage *timer);
+    void cancelTimer(cMessage *timer);
+
+    /**
+     * Dispatches all timers due at the current simulation time. Called by the
+     * Tcp module when the multiplexed self-message fires.
+     */
+    void fireTimers();
+};
+
+} // namespace tcp
+} // namespace inet
+
+#endif
@@ -417,7 +417,7 @@ void TcpBaseAlg::receivedOutOfOrderSegment()
 void TcpBaseAlg::receiveSeqChanged()
 {
     // If we send a data segment already (with the updated seqNo) there is no need to send an additional ACK
-    if (state->full_sized_segment_counter == 0 && !state->ack_now && state->last_ack_sent == state->rcv_nxt && !delayedAckTimer->isScheduled()) { // ackSent?
+    if (state->full_sized_segment_counter == 0 && !state->ack_now && state->last_ack_sent == state->rcv_nxt && !isTimerScheduled(delayedAckTimer)) { // ackSent?
 //        tcpEV << "ACK has already been sent (possibly piggybacked on data)\n";
     }
     else {
@@ -446,7 +446,7 @@ void TcpBaseAlg::receiveSeqChanged()
             }
             else {
                 EV_INFO << "rcv_nxt changed to " << state->rcv_nxt << ", (delayed ACK enabled and full_sized_segment_counter=" << state->full_sized_segment_counter << ") scheduling ACK\n";
-                if (!delayedAckTimer->isScheduled()) // schedule delayed ACK timer if not already running
+                if (!isTimerScheduled(delayedAckTimer)) // schedule delayed ACK timer if not already running
                     conn->scheduleAfter(DELAYED_ACK_TIMEOUT, delayedAckTimer);
             }
         }
@@ -475,7 +475,7 @@ void TcpBaseAlg::receivedDataAck(uint32_t firstSeqAcked)
     // with the current RTO value.
     //
     if (state->snd_una == state->snd_max) {
-        if (rexmitTimer->isScheduled()) {
+        if (isTimerScheduled(rexmitTimer)) {
             EV_INFO << "ACK acks all outstanding segments, cancel REXMIT timer\n";
             cancelEvent(rexmitTimer);
         }
@@ -500,8 +500,8 @@ void TcpBaseAlg::receivedDataAck(uint32_t firstSeqAcked)
     //  If PERSIST timer is scheduled, cancel PERSIST timer.
     //
     if (state->snd_wnd == 0) { // received zero-sized window?
-        if (rexmitTimer->isScheduled()) {
-            if (persistTimer->isScheduled()) {
+        if (isTimerScheduled(rexmitTimer)) {
+            if (isTimerScheduled(persistTimer)) {
                 EV_INFO << "Received zero-sized window and REXMIT timer is running therefore PERSIST timer is canceled.\n";
                 cancelEvent(persistTimer);
                 state->persist_factor = 0;
@@ -510,7 +510,7 @@ void TcpBaseAlg::receivedDataAck(uint32_t firstSeqAcked)
                 EV_INFO << "Received zero-sized window and REXMIT timer is running therefore PERSIST timer is not started.\n";
         }
         else {
-            if (!persistTimer->isScheduled()) {
+            if (!isTimerScheduled(persistTimer)) {
                 EV_INFO << "Received zero-sized window therefore PERSIST timer is started.\n";
                 conn->scheduleAfter(state->persist_timeout, persistTimer);
             }
@@ -519,7 +519,7 @@ void TcpBaseAlg::receivedDataAck(uint32_t firstSeqAcked)
         }
     }
     else { // received non zero-sized window?
-        if (persistTimer->isScheduled()) {
+        if (isTimerScheduled(persistTimer)) {
             EV_INFO << "Received non zero-sized window therefore PERSIST timer is canceled.\n";
             cancelEvent(persistTimer);
             state->persist_factor = 0;
@@ -569,14 +569,14 @@ void TcpBaseAlg::ackSent()
     state->ack_now = false; // reset flag
     state->last_ack_sent = state->rcv_nxt; // update last_ack_sent, needed for TS option
     // if delayed ACK timer is running, cancel it
-    if (delayedAckTimer->isScheduled())
+    if (isTimerScheduled(delayedAckTimer))
         cancelEvent(delayedAckTimer);
 }
 
 void TcpBaseAlg::dataSent(uint32_t fromseq)
 {
     // if retransmission timer not running, schedule it
-    if (!rexmitTimer->isScheduled()) {
+    if (!isTimerScheduled(rexmitTimer)) {
         EV_INFO << "Starting REXMIT timer\n";
         startRexmitTimer();
     }
@@ -600,7 +600,7 @@ void TcpBaseAlg::segmentRetransmitted(uint32_t fromseq, uint32_t toseq)
 
 void TcpBaseAlg::restartRexmitTimer()
 {
-    if (rexmitTimer->isScheduled())
+    if (isTimerScheduled(rexmitTimer))
         cancelEvent(rexmitTimer);
 
     startRexmitTimer();
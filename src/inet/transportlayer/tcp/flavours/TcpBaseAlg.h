@@ -91,6 +91,9 @@ class INET_API TcpBaseAlg : public TcpAlgorithm
     /** Utility function */
     cMessage *cancelEvent(cMessage *msg) { return conn->cancelEvent(msg); }
 
+    /** Utility function */
+    bool isTimerScheduled(cMessage *msg) const { return conn->isTimerScheduled(msg); }
+
   public:
     /**
      * Ctor.
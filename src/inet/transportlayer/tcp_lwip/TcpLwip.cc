@@ -328,8 +328,19 @@ err_t TcpLwip::tcp_event_recv(TcpLwipConnection& conn, struct pbuf *p, err_t err
     else {
         EV_DETAIL << this << ": tcp_event_recv(" << conn.connIdM << ", pbuf[" << p->len << ", "
                   << p->tot_len << "], " << (int)err << ")\n";
-        for (auto c = p; c; c = c->next)
-            conn.receiveQueueM->enqueueTcpLayerData(c->payload, c->len);
+        if (p->next == nullptr)
+            conn.receiveQueueM->enqueueTcpLayerData(p->payload, p->len);
+        else {
+            // gather the pbuf chain into a single buffer so that the receive queue
+            // stores one chunk per segment instead of merging one chunk per pbuf
+            std::vector<uint8_t> buffer(p->tot_len);
+            unsigned int offset = 0;
+            for (auto c = p; c; c = c->next) {
+                memcpy(buffer.data() + offset, c->payload, c->len);
+                offset += c->len;
+            }
+            conn.receiveQueueM->enqueueTcpLayerData(buffer.data(), buffer.size());
+        }
         pLwipTcpLayerM->tcp_recved(conn.pcbM, p->tot_len);
         pbuf_free(p);
     }
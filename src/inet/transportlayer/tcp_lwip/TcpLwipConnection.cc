@@ -307,12 +307,16 @@ void TcpLwipConnection::do_SEND()
 {
     if (!sendUpEnabled)
         return;
-    char buffer[8 * 536];
-    int bytes;
     int allsent = 0;
 
-    while (0 != (bytes = sendQueueM->getBytesForTcpLayer(buffer, sizeof(buffer)))) {
-        int sent = send_data(buffer, bytes);
+    while (true) {
+        // hand the bytes to tcp_write() straight from the chunk's backing array,
+        // the stack copies them into its own segments anyway
+        const auto& bytesChunk = sendQueueM->peekBytesForTcpLayer(0xFFFF);
+        if (bytesChunk == nullptr)
+            break;
+        const auto& bytes = bytesChunk->getBytes();
+        int sent = send_data(const_cast<uint8_t *>(bytes.data()), bytes.size());
 
         if (sent > 0) {
             sendQueueM->dequeueTcpLayerMsg(sent);
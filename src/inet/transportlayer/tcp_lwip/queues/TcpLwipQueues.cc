@@ -45,14 +45,22 @@ unsigned int TcpLwipSendQueue::getBytesForTcpLayer(void *bufferP, unsigned int b
 {
     ASSERT(bufferP);
 
+    const auto& bytesChunk = peekBytesForTcpLayer(bufferLengthP);
+    if (bytesChunk == nullptr)
+        return 0;
+
+    return bytesChunk->copyToBuffer(static_cast<uint8_t *>(bufferP), bufferLengthP);
+}
+
+const Ptr<const BytesChunk> TcpLwipSendQueue::peekBytesForTcpLayer(unsigned int maxLengthP) const
+{
     unsigned int length = B(dataBuffer.getLength()).get();
-    if (bufferLengthP < length)
-        length = bufferLengthP;
+    if (maxLengthP < length)
+        length = maxLengthP;
     if (length == 0)
-        return 0;
+        return nullptr;
 
-    const auto& bytesChunk = dataBuffer.peek<BytesChunk>(B(length));
-    return bytesChunk->copyToBuffer(static_cast<uint8_t *>(bufferP), length);
+    return dataBuffer.peek<BytesChunk>(B(length));
 }
 
 void TcpLwipSendQueue::dequeueTcpLayerMsg(unsigned int msgLengthP)
@@ -102,6 +102,16 @@ class INET_API TcpLwipSendQueue : public cObject
      */
     virtual unsigned int getBytesForTcpLayer(void *bufferP, unsigned int bufferLengthP) const;
 
+    /**
+     * Returns the first at most maxLengthP queued bytes as a single BytesChunk,
+     * or nullptr if the queue is empty. This allows the connection to hand the
+     * bytes to tcp_write() directly from the chunk's backing array, without
+     * copying them into an intermediate buffer first.
+     *
+     * called before called socket->send_data()
+     */
+    virtual const Ptr<const BytesChunk> peekBytesForTcpLayer(unsigned int maxLengthP) const;
+
     /**
      * This function should remove msgLengthP bytes from TCP layer queue
      */
@@ -65,6 +65,7 @@ void Udp::initialize(int stage)
     if (stage == INITSTAGE_LOCAL) {
         const char *crcModeString = par("crcMode");
         crcMode = parseCrcMode(crcModeString, true);
+        cacheListenedSignals = par("cacheListenedSignals");
 
         lastEphemeralPort = EPHEMERAL_PORTRANGE_START;
         ift.reference(this, "interfaceTableModule", true);
@@ -118,6 +119,10 @@ void Udp::initialize(int stage)
         registerService(Protocol::udp, gate("appIn"), gate("appOut"));
         registerProtocol(Protocol::udp, gate("ipOut"), gate("ipIn"));
     }
+    else if (stage == INITSTAGE_LAST) {
+        if (cacheListenedSignals)
+            signalEmissionCache.build(this, { packetSentSignal, packetSentToLowerSignal, packetReceivedFromLowerSignal, packetReceivedSignal, packetSentToUpperSignal });
+    }
 }
 
 void Udp::handleLowerPacket(Packet *packet)
@@ -324,6 +329,8 @@ void Udp::bind(int sockId, const L3Address& localAddr, int localPort)
         sd = createSocket(sockId, localAddr, localPort);
         sd->isBound = true;
     }
+
+    invalidateUnicastDemuxCache();
 }
 
 Udp::SockDesc *Udp::findFirstSocketByLocalAddress(const L3Address& localAddr, ushort localPort)
@@ -357,6 +364,8 @@ Udp::SockDesc *Udp::createSocket(int sockId, const L3Address& localAddr, int loc
     SockDescList& list = socketsByPortMap[sd->localPort]; // create if doesn't exist
     list.push_back(sd);
 
+    invalidateUnicastDemuxCache();
+
     EV_INFO << "Socket created: " << *sd << "\n";
     return sd;
 }
@@ -392,6 +401,8 @@ void Udp::connect(int sockId, const L3Address& remoteAddr, int remotePort)
     sd->remotePort = remotePort;
     sd->onlyLocalPortIsSet = false;
 
+    invalidateUnicastDemuxCache();
+
     EV_INFO << "Socket connected: " << *sd << "\n";
 }
 
@@ -793,8 +804,8 @@ void Udp::handleUpperPacket(Packet *packet)
     packet->setKind(0);
 
     EV_INFO << "Sending app packet " << packet->getName() << " over " << l3Protocol->getName() << ".\n";
-    emit(packetSentSignal, packet);
-    emit(packetSentToLowerSignal, packet);
+    signalEmissionCache.emit(this, packetSentSignal, packet);
+    signalEmissionCache.emit(this, packetSentToLowerSignal, packet);
     send(packet, "ipOut");
     numSent++;
 }
@@ -891,6 +902,8 @@ void Udp::destroySocket(SocketsByIdMap::iterator it)
     if (list.empty())
         socketsByPortMap.erase(sd->localPort);
 
+    invalidateUnicastDemuxCache();
+
     delete sd;
 }
 
@@ -910,8 +923,8 @@ void Udp::destroySocket(int sockId)
 void Udp::processUDPPacket(Packet *udpPacket)
 {
     ASSERT(udpPacket->getControlInfo() == nullptr);
-    emit(packetReceivedFromLowerSignal, udpPacket);
-    emit(packetReceivedSignal, udpPacket);
+    signalEmissionCache.emit(this, packetReceivedFromLowerSignal, udpPacket);
+    signalEmissionCache.emit(this, packetReceivedSignal, udpPacket);
 
     udpPacket->removeTag<PacketProtocolTag>();
     b udpHeaderPopPosition = udpPacket->getFrontOffset();
@@ -1015,28 +1028,40 @@ bool Udp::verifyCrc(const Protocol *networkProtocol, const Ptr<const UdpHeader>&
 
 Udp::SockDesc *Udp::findSocketForUnicastPacket(const L3Address& localAddr, ushort localPort, const L3Address& remoteAddr, ushort remotePort)
 {
-    auto it = socketsByPortMap.find(localPort);
-    if (it == socketsByPortMap.end())
-        return nullptr;
+    UnicastDemuxKey key(localAddr, localPort, remoteAddr, remotePort);
+    auto cacheIt = unicastDemuxCache.find(key);
+    if (cacheIt != unicastDemuxCache.end())
+        return cacheIt->second;
 
-    // select the socket bound to ANY_ADDR only if there is no socket bound to localAddr
-    SockDescList& list = it->second;
-    SockDesc *socketBoundToAnyAddress = nullptr;
-    for (SockDescList::reverse_iterator it = list.rbegin(); it != list.rend(); ++it) {
-        SockDesc *sd = *it;
-        if (sd->onlyLocalPortIsSet || (
-                (sd->remotePort == -1 || sd->remotePort == remotePort) &&
-                (sd->localAddr.isUnspecified() || sd->localAddr == localAddr) &&
-                (sd->remoteAddr.isUnspecified() || sd->remoteAddr == remoteAddr)))
-        {
-            if (sd->localAddr.isUnspecified())
-                socketBoundToAnyAddress = sd;
-            else
-                return sd;
+    SockDesc *result = nullptr;
+    auto it = socketsByPortMap.find(localPort);
+    if (it != socketsByPortMap.end()) {
+        // select the socket bound to ANY_ADDR only if there is no socket bound to localAddr
+        SockDescList& list = it->second;
+        SockDesc *socketBoundToAnyAddress = nullptr;
+        for (SockDescList::reverse_iterator it = list.rbegin(); it != list.rend(); ++it) {
+            SockDesc *sd = *it;
+            if (sd->onlyLocalPortIsSet || (
+                    (sd->remotePort == -1 || sd->remotePort == remotePort) &&
+                    (sd->localAddr.isUnspecified() || sd->localAddr == localAddr) &&
+                    (sd->remoteAddr.isUnspecified() || sd->remoteAddr == remoteAddr)))
+            {
+                if (sd->localAddr.isUnspecified())
+                    socketBoundToAnyAddress = sd;
+                else {
+                    result = sd;
+                    break;
+                }
+            }
         }
+        if (result == nullptr)
+            result = socketBoundToAnyAddress;
     }
 
-    return socketBoundToAnyAddress;
+    if (unicastDemuxCache.size() >= MAX_NUM_UNICAST_DEMUX_CACHE_ENTRIES)
+        unicastDemuxCache.clear();
+    unicastDemuxCache[key] = result;
+    return result;
 }
 
 std::vector<Udp::SockDesc *> Udp::findSocketsForMcastBcastPacket(const L3Address& localAddr, ushort localPort, const L3Address& remoteAddr, ushort remotePort, bool isMulticast, bool isBroadcast)
@@ -1057,6 +1082,8 @@ std::vector<Udp::SockDesc *> Udp::findSocketsForMcastBcastPacket(const L3Address
             }
         }
         else if (isMulticast) {
+            if (sd->multicastMembershipTable.empty())
+                continue;
             auto membership = sd->findFirstMulticastMembership(localAddr);
             if (membership != sd->multicastMembershipTable.end()) {
                 if ((sd->remotePort == -1 || sd->remotePort == remotePort) &&
@@ -1136,7 +1163,7 @@ void Udp::sendUp(Ptr<const UdpHeader>& header, Packet *payload, SockDesc *sd, us
     payload->addTagIfAbsent<L4PortInd>()->setSrcPort(srcPort);
     payload->addTagIfAbsent<L4PortInd>()->setDestPort(destPort);
 
-    emit(packetSentToUpperSignal, payload);
+    signalEmissionCache.emit(this, packetSentToUpperSignal, payload);
     send(payload, "appOut");
     numPassedUp++;
 }
@@ -1322,6 +1349,7 @@ void Udp::clearAllSockets()
 
     socketsByIdMap.clear();
     socketsByPortMap.clear();
+    invalidateUnicastDemuxCache();
 }
 
 // #############################
@@ -10,8 +10,10 @@
 
 #include <list>
 #include <map>
+#include <tuple>
 
 #include "inet/common/Protocol.h"
+#include "inet/common/SignalEmissionCache.h"
 #include "inet/common/lifecycle/ModuleOperations.h"
 #include "inet/common/packet/Message.h"
 #include "inet/common/packet/Packet.h"
@@ -104,14 +106,25 @@ class INET_API Udp : public TransportProtocolBase
     typedef std::list<SockDesc *> SockDescList; // might contain duplicated local addresses if their reuseAddr flag is set
     typedef std::map<int, SockDesc *> SocketsByIdMap;
     typedef std::map<int, SockDescList> SocketsByPortMap;
+    typedef std::tuple<L3Address, ushort, L3Address, ushort> UnicastDemuxKey; // localAddr, localPort, remoteAddr, remotePort
 
   protected:
     CrcMode crcMode = CRC_MODE_UNDEFINED;
+    bool cacheListenedSignals = false;
+    SignalEmissionCache signalEmissionCache;
 
     // sockets
     SocketsByIdMap socketsByIdMap;
     SocketsByPortMap socketsByPortMap;
 
+    // memoized findSocketForUnicastPacket() results keyed on the packet addresses
+    // and ports; socket lookup dominates the per-packet cost when many sockets are
+    // bound to the same port, while the set of sockets rarely changes, so the
+    // result of the linear scan is remembered per flow and the whole cache is
+    // dropped whenever the socket tables change
+    std::map<UnicastDemuxKey, SockDesc *> unicastDemuxCache;
+    static const size_t MAX_NUM_UNICAST_DEMUX_CACHE_ENTRIES = 65536;
+
     // other state vars
     ushort lastEphemeralPort = EPHEMERAL_PORTRANGE_START;
     ModuleRefByPar<IInterfaceTable> ift;
@@ -142,6 +155,7 @@ class INET_API Udp : public TransportProtocolBase
     virtual void destroySocket(int sockId);
     void destroySocket(SocketsByIdMap::iterator it);
     virtual void clearAllSockets();
+    virtual void invalidateUnicastDemuxCache() { unicastDemuxCache.clear(); }
     virtual void setTimeToLive(SockDesc *sd, int ttl);
     virtual void setDscp(SockDesc *sd, short dscp);
     virtual void setTos(SockDesc *sd, short tos);
@@ -77,8 +77,13 @@ void InfoVisualizerBase::refreshDisplay() const
     auto simulation = getSimulation();
     for (auto infoVisualization : infoVisualizations) {
         auto module = simulation->getModule(infoVisualization->moduleId);
-        if (module != nullptr)
-            refreshInfoVisualization(infoVisualization, getInfoVisualizationText(module).c_str());
+        if (module != nullptr) {
+            auto text = getInfoVisualizationText(module);
+            if (text != infoVisualization->lastText) {
+                infoVisualization->lastText = text;
+                refreshInfoVisualization(infoVisualization, text.c_str());
+            }
+        }
     }
 }
 
@@ -23,6 +23,7 @@ class INET_API InfoVisualizerBase : public VisualizerBase
     class INET_API InfoVisualization {
       public:
         int moduleId = -1;
+        mutable std::string lastText; // cached formatted text, to skip figure updates when the text is unchanged
 
       public:
         InfoVisualization(int moduleId);
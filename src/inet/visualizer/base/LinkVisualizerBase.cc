@@ -69,6 +69,9 @@ void LinkVisualizerBase::initialize(int stage)
         labelFormat.parseFormat(par("labelFormat"));
         labelFont = cFigure::parseFont(par("labelFont"));
         labelColor = cFigure::Color(par("labelColor"));
+        labelUpdateInterval = par("labelUpdateInterval");
+        if (labelUpdateInterval < 1)
+            throw cRuntimeError("The specified labelUpdateInterval is invalid");
         fadeOutMode = par("fadeOutMode");
         fadeOutTime = par("fadeOutTime");
         fadeOutAnimationSpeed = par("fadeOutAnimationSpeed");
@@ -209,6 +212,7 @@ void LinkVisualizerBase::removeLastModule(int treeId)
 void LinkVisualizerBase::refreshLinkVisualization(const LinkVisualization *linkVisualization, cPacket *packet)
 {
     linkVisualization->lastUsageAnimationPosition = AnimationPosition();
+    linkVisualization->usageCount++;
 }
 
 void LinkVisualizerBase::updateLinkVisualization(cModule *source, cModule *destination, cPacket *packet)
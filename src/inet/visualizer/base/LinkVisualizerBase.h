@@ -33,6 +33,7 @@ class INET_API LinkVisualizerBase : public VisualizerBase, public cListener
     class INET_API LinkVisualization : public LineManager::ModuleLine {
       public:
         mutable AnimationPosition lastUsageAnimationPosition;
+        mutable long usageCount = 0;
 
       public:
         LinkVisualization(int sourceModuleId, int destinationModuleId);
@@ -67,6 +68,7 @@ class INET_API LinkVisualizerBase : public VisualizerBase, public cListener
     StringFormat labelFormat;
     cFigure::Font labelFont;
     cFigure::Color labelColor;
+    int labelUpdateInterval = -1;
     const char *fadeOutMode = nullptr;
     double fadeOutTime = NaN;
     double fadeOutAnimationSpeed = NaN;
@@ -61,6 +61,8 @@ void MobilityVisualizerBase::initialize(int stage)
         movementTrailLineStyle = cFigure::parseLineStyle(par("movementTrailLineStyle"));
         movementTrailLineWidth = par("movementTrailLineWidth");
         trailLength = par("trailLength");
+        movementTrailMinimumDistance = par("movementTrailMinimumDistance");
+        movementTrailMaximumAngle = par("movementTrailMaximumAngle");
         if (displayMobility)
             subscribe();
     }
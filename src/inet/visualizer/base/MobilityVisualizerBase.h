@@ -63,6 +63,8 @@ class INET_API MobilityVisualizerBase : public VisualizerBase, public cListener
     cFigure::LineStyle movementTrailLineStyle;
     double movementTrailLineWidth = NaN;
     int trailLength = -1;
+    double movementTrailMinimumDistance = NaN;
+    double movementTrailMaximumAngle = NaN;
     //@}
 
     std::map<int, MobilityVisualization *> mobilityVisualizations;
@@ -66,6 +66,7 @@ void StatisticVisualizerBase::initialize(int stage)
         statisticUnit = par("statisticUnit");
         statisticExpression = par("statisticExpression");
         format.parseFormat(par("format"));
+        minValueChange = par("minValueChange");
         cStringTokenizer tokenizer(par("unit"));
         while (tokenizer.hasMoreTokens())
             units.push_back(tokenizer.nextToken());
@@ -224,6 +225,16 @@ void StatisticVisualizerBase::processSignal(cComponent *source, simsignal_t sign
     }
 }
 
+bool StatisticVisualizerBase::checkValueChanged(const StatisticVisualization *statisticVisualization)
+{
+    double value = statisticVisualization->recorder->getLastValue();
+    if (minValueChange > 0 && !std::isnan(value) && !std::isnan(statisticVisualization->lastRefreshedValue)
+        && std::abs(value - statisticVisualization->lastRefreshedValue) < minValueChange)
+        return false;
+    statisticVisualization->lastRefreshedValue = value;
+    return true;
+}
+
 void StatisticVisualizerBase::refreshStatisticVisualization(const StatisticVisualization *statisticVisualization)
 {
     double value = statisticVisualization->recorder->getLastValue();
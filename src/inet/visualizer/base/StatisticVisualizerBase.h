@@ -42,6 +42,8 @@ class INET_API StatisticVisualizerBase : public VisualizerBase, public cListener
         const char *unit = nullptr;
         mutable double printValue = NaN;
         mutable const char *printUnit = nullptr;
+        mutable double lastRefreshedValue = NaN; // value at the last refresh, for the minValueChange threshold
+        mutable std::string lastText; // cached formatted text, to skip figure updates when the text is unchanged
 
       public:
         StatisticVisualization(int moduleId, simsignal_t signal, const char *unit);
@@ -69,6 +71,7 @@ class INET_API StatisticVisualizerBase : public VisualizerBase, public cListener
     const char *statisticExpression = nullptr;
     StringFormat format;
     std::vector<std::string> units;
+    double minValueChange = 0;
     cFigure::Font font;
     cFigure::Color textColor;
     cFigure::Color backgroundColor;
@@ -100,6 +103,7 @@ class INET_API StatisticVisualizerBase : public VisualizerBase, public cListener
     virtual void removeStatisticVisualization(const StatisticVisualization *statisticVisualization);
     virtual void removeAllStatisticVisualizations();
 
+    virtual bool checkValueChanged(const StatisticVisualization *statisticVisualization);
     virtual void refreshStatisticVisualization(const StatisticVisualization *statisticVisualization);
     virtual void processSignal(cComponent *source, simsignal_t signal, std::function<void(cIListener *)> receiveSignal);
 
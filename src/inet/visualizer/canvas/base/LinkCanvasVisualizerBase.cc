@@ -53,8 +53,16 @@ void LinkCanvasVisualizerBase::refreshDisplay() const
         auto sourceModule = simulation->getModule(linkVisualization->sourceModuleId);
         auto destinationModule = simulation->getModule(linkVisualization->destinationModuleId);
         if (sourceModule != nullptr && destinationModule != nullptr) {
-            auto sourcePosition = getContactPosition(sourceModule, getPosition(destinationModule), lineContactMode, lineContactSpacing);
-            auto destinationPosition = getContactPosition(destinationModule, getPosition(sourceModule), lineContactMode, lineContactSpacing);
+            auto sourceModulePosition = getPosition(sourceModule);
+            auto destinationModulePosition = getPosition(destinationModule);
+            // skip recomputing the figure end points when neither the node positions nor the line shift offsets changed
+            if (sourceModulePosition == linkCanvasVisualization->lastSourcePosition && destinationModulePosition == linkCanvasVisualization->lastDestinationPosition && lineManager->getChangeCount() == linkCanvasVisualization->lastLineManagerChangeCount)
+                continue;
+            linkCanvasVisualization->lastSourcePosition = sourceModulePosition;
+            linkCanvasVisualization->lastDestinationPosition = destinationModulePosition;
+            linkCanvasVisualization->lastLineManagerChangeCount = lineManager->getChangeCount();
+            auto sourcePosition = getContactPosition(sourceModule, destinationModulePosition, lineContactMode, lineContactSpacing);
+            auto destinationPosition = getContactPosition(destinationModule, sourceModulePosition, lineContactMode, lineContactSpacing);
             auto shift = lineManager->getLineShift(linkVisualization->sourceModuleId, linkVisualization->destinationModuleId, sourcePosition, destinationPosition, lineShiftMode, linkVisualization->shiftOffset) * lineShift;
             figure->setStart(canvasProjection->computeCanvasPoint(sourcePosition + shift));
             figure->setEnd(canvasProjection->computeCanvasPoint(destinationPosition + shift));
@@ -106,9 +114,11 @@ void LinkCanvasVisualizerBase::setAlpha(const LinkVisualization *linkVisualizati
 void LinkCanvasVisualizerBase::refreshLinkVisualization(const LinkVisualization *linkVisualization, cPacket *packet)
 {
     LinkVisualizerBase::refreshLinkVisualization(linkVisualization, packet);
-    auto linkCanvasVisualization = static_cast<const LinkCanvasVisualization *>(linkVisualization);
-    auto text = getLinkVisualizationText(packet);
-    linkCanvasVisualization->figure->getLabelFigure()->setText(text.c_str());
+    if (linkVisualization->usageCount % labelUpdateInterval == 0) {
+        auto linkCanvasVisualization = static_cast<const LinkCanvasVisualization *>(linkVisualization);
+        auto text = getLinkVisualizationText(packet);
+        linkCanvasVisualization->figure->getLabelFigure()->setText(text.c_str());
+    }
 }
 
 } // namespace visualizer
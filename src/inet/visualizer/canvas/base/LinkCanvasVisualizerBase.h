@@ -22,6 +22,11 @@ class INET_API LinkCanvasVisualizerBase : public LinkVisualizerBase
     class INET_API LinkCanvasVisualization : public LinkVisualization {
       public:
         LabeledLineFigure *figure = nullptr;
+        // the figure end points are only recomputed when the node positions or
+        // the line shift offsets change, see refreshDisplay
+        mutable Coord lastSourcePosition = Coord::NIL;
+        mutable Coord lastDestinationPosition = Coord::NIL;
+        mutable int lastLineManagerChangeCount = -1;
 
       public:
         LinkCanvasVisualization(LabeledLineFigure *figure, int sourceModuleId, int destinationModuleId);
@@ -84,14 +84,23 @@ void PathCanvasVisualizerBase::refreshDisplay() const
         auto pathVisualization = it.second;
         auto pathCanvasVisualization = static_cast<const PathCanvasVisualization *>(pathVisualization);
         auto moduleIds = pathCanvasVisualization->moduleIds;
+        std::vector<Coord> nodePositions;
+        nodePositions.reserve(moduleIds.size());
+        for (auto moduleId : moduleIds)
+            nodePositions.push_back(getPosition(simulation->getModule(moduleId)));
+        // skip recomputing the figure points when neither the node positions nor the line shift offsets changed
+        if (nodePositions == pathCanvasVisualization->lastNodePositions && lineManager->getChangeCount() == pathCanvasVisualization->lastLineManagerChangeCount)
+            continue;
+        pathCanvasVisualization->lastNodePositions = nodePositions;
+        pathCanvasVisualization->lastLineManagerChangeCount = lineManager->getChangeCount();
         std::vector<LineSegment> segments;
         for (size_t index = 1; index < moduleIds.size(); index++) {
             auto fromModuleId = moduleIds[index - 1];
             auto toModuleId = moduleIds[index];
             auto fromModule = simulation->getModule(fromModuleId);
             auto toModule = simulation->getModule(toModuleId);
-            auto fromPosition = getContactPosition(fromModule, getPosition(toModule), lineContactMode, lineContactSpacing);
-            auto toPosition = getContactPosition(toModule, getPosition(fromModule), lineContactMode, lineContactSpacing);
+            auto fromPosition = getContactPosition(fromModule, nodePositions[index], lineContactMode, lineContactSpacing);
+            auto toPosition = getContactPosition(toModule, nodePositions[index - 1], lineContactMode, lineContactSpacing);
             auto shift = lineManager->getLineShift(fromModuleId, toModuleId, fromPosition, toPosition, lineShiftMode, pathVisualization->shiftOffsets[index - 1]) * lineShift;
             segments.push_back(LineSegment(fromPosition + shift, toPosition + shift));
         }
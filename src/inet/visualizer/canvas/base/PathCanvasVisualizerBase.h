@@ -22,6 +22,10 @@ class INET_API PathCanvasVisualizerBase : public PathVisualizerBase
     class INET_API PathCanvasVisualization : public PathVisualization {
       public:
         LabeledPolylineFigure *figure = nullptr;
+        // the figure points are only recomputed when the node positions or the
+        // line shift offsets change, see refreshDisplay
+        mutable std::vector<Coord> lastNodePositions;
+        mutable int lastLineManagerChangeCount = -1;
 
       public:
         PathCanvasVisualization(const char *label, const std::vector<int>& path, LabeledPolylineFigure *figure);
@@ -99,15 +99,22 @@ void StatisticCanvasVisualizer::removeStatisticVisualization(const StatisticVisu
 
 void StatisticCanvasVisualizer::refreshStatisticVisualization(const StatisticVisualization *statisticVisualization)
 {
-    StatisticVisualizerBase::refreshStatisticVisualization(statisticVisualization);
     auto statisticCanvasVisualization = static_cast<const StatisticCanvasVisualization *>(statisticVisualization);
     auto figure = statisticCanvasVisualization->figure;
-    if (auto indicatorFigure = dynamic_cast<IIndicatorFigure *>(figure))
+    if (auto indicatorFigure = dynamic_cast<IIndicatorFigure *>(figure)) {
+        // indicator figures (e.g. plots) consume the value time series, so they must see every emission
+        StatisticVisualizerBase::refreshStatisticVisualization(statisticVisualization);
         indicatorFigure->setValue(0, simTime(), statisticVisualization->recorder->getLastValue());
-    else {
-        auto boxedLabelFigure = check_and_cast<BoxedLabelFigure *>(figure);
-        boxedLabelFigure->setText(getText(statisticVisualization).c_str());
-        statisticCanvasVisualization->networkNodeVisualization->setAnnotationSize(figure, boxedLabelFigure->getBounds().getSize());
+    }
+    else if (checkValueChanged(statisticVisualization)) {
+        StatisticVisualizerBase::refreshStatisticVisualization(statisticVisualization);
+        auto text = getText(statisticVisualization);
+        if (text != statisticVisualization->lastText) {
+            statisticVisualization->lastText = text;
+            auto boxedLabelFigure = check_and_cast<BoxedLabelFigure *>(figure);
+            boxedLabelFigure->setText(text.c_str());
+            statisticCanvasVisualization->networkNodeVisualization->setAnnotationSize(figure, boxedLabelFigure->getBounds().getSize());
+        }
     }
 }
 
@@ -45,22 +45,35 @@ void MobilityCanvasVisualizer::initialize(int stage)
 void MobilityCanvasVisualizer::refreshDisplay() const
 {
     MobilityVisualizerBase::refreshDisplay();
+    double zoomLevel = getEnvir()->getZoomLevel(visualizationTargetModule);
     for (auto it : mobilityVisualizations) {
         auto mobilityVisualization = static_cast<MobilityCanvasVisualization *>(it.second);
         auto mobility = mobilityVisualization->mobility;
-        auto position = canvasProjection->computeCanvasPoint(mobility->getCurrentPosition());
-        auto orientation = mobility->getCurrentAngularPosition();
-        auto velocity = canvasProjection->computeCanvasPoint(mobility->getCurrentVelocity());
+        auto currentPosition = mobility->getCurrentPosition();
+        auto currentAngularPosition = mobility->getCurrentAngularPosition();
+        auto currentVelocity = mobility->getCurrentVelocity();
+        // skip recomputing the canvas transforms and figure geometry for nodes that haven't changed
+        if (currentPosition == mobilityVisualization->lastPosition &&
+            mobilityVisualization->lastAngularPosition == currentAngularPosition &&
+            currentVelocity == mobilityVisualization->lastVelocity &&
+            zoomLevel == mobilityVisualization->lastZoomLevel)
+            continue;
+        mobilityVisualization->lastPosition = currentPosition;
+        mobilityVisualization->lastAngularPosition = currentAngularPosition;
+        mobilityVisualization->lastVelocity = currentVelocity;
+        mobilityVisualization->lastZoomLevel = zoomLevel;
+        auto position = canvasProjection->computeCanvasPoint(currentPosition);
+        auto velocity = canvasProjection->computeCanvasPoint(currentVelocity);
         if (displayPositions) {
-            double radius = positionCircleRadius / getEnvir()->getZoomLevel(visualizationTargetModule);
+            double radius = positionCircleRadius / zoomLevel;
             mobilityVisualization->positionFigure->setBounds(cFigure::Rectangle(position.x - radius, position.y - radius, 2 * radius, 2 * radius));
         }
         if (displayOrientations) {
             // NOTE: this negation cancels out the (incorrect) CCW angle handling of cPieSliceFigure (see bug https://dev.omnetpp.org/bugs/view.php?id=1030)
-            auto angle = -orientation.toEulerAngles().alpha;
+            auto angle = -currentAngularPosition.toEulerAngles().alpha;
             mobilityVisualization->orientationFigure->setStartAngle(rad(angle - rad(M_PI) * orientationPieSize).get());
             mobilityVisualization->orientationFigure->setEndAngle(rad(angle + rad(M_PI) * orientationPieSize).get());
-            double radius = orientationPieRadius / getEnvir()->getZoomLevel(visualizationTargetModule);
+            double radius = orientationPieRadius / zoomLevel;
             mobilityVisualization->orientationFigure->setBounds(cFigure::Rectangle(position.x - radius, position.y - radius, 2 * radius, 2 * radius));
         }
         if (displayVelocities) {
@@ -163,8 +176,18 @@ void MobilityCanvasVisualizer::extendMovementTrail(const IMobility *mobility, Tr
         startPosition = static_cast<cLineFigure *>(trailFigure->getFigure(trailFigure->getNumFigures() - 1))->getEnd();
     double dx = startPosition.x - endPosition.x;
     double dy = startPosition.y - endPosition.y;
-    // TODO 1?
-    if (trailFigure->getNumFigures() == 0 || dx * dx + dy * dy > 1) {
+    if (trailFigure->getNumFigures() == 0 || dx * dx + dy * dy > movementTrailMinimumDistance * movementTrailMinimumDistance) {
+        if (trailFigure->getNumFigures() != 0 && movementTrailMaximumAngle > 0) {
+            auto lastLine = static_cast<cLineFigure *>(trailFigure->getFigure(trailFigure->getNumFigures() - 1));
+            auto& lastStartPosition = lastLine->getStart();
+            double lastDirection = atan2(startPosition.y - lastStartPosition.y, startPosition.x - lastStartPosition.x);
+            double direction = atan2(endPosition.y - startPosition.y, endPosition.x - startPosition.x);
+            // extend the last trail section instead of adding a new one when the direction barely changes
+            if (fabs(remainder(direction - lastDirection, 2 * M_PI)) < movementTrailMaximumAngle) {
+                lastLine->setEnd(endPosition);
+                return;
+            }
+        }
         cLineFigure *movementLine = new cLineFigure("movementTrail");
         movementLine->setTags((std::string("movement_trail recent_history ") + tags).c_str());
         movementLine->setTooltip("This line represents the recent movement trail of the mobility model");
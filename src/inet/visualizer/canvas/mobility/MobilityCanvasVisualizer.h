@@ -25,6 +25,11 @@ class INET_API MobilityCanvasVisualizer : public MobilityVisualizerBase
         cPieSliceFigure *orientationFigure = nullptr;
         cLineFigure *velocityFigure = nullptr;
         TrailFigure *trailFigure = nullptr;
+        // the figures are only updated when the mobility state or the zoom level changed, see refreshDisplay
+        Coord lastPosition = Coord::NIL;
+        Quaternion lastAngularPosition;
+        Coord lastVelocity = Coord::NIL;
+        double lastZoomLevel = NaN;
 
       public:
         MobilityCanvasVisualization(cOvalFigure *positionFigure, cPieSliceFigure *orientationFigure, cLineFigure *velocityFigure, TrailFigure *trailFigure, IMobility *mobility);
@@ -48,6 +48,7 @@ void MediumCanvasVisualizer::initialize(int stage)
         signalWaveLength = par("signalWaveLength");
         signalWaveWidth = par("signalWaveWidth");
         signalWaveFadingAnimationSpeedFactor = par("signalWaveFadingAnimationSpeedFactor");
+        deferCanvasUpdates = par("deferCanvasUpdates");
         cCanvas *canvas = visualizationTargetModule->getCanvas();
         if (displaySignals) {
             signalLayer = new cGroupFigure("communication");
@@ -176,10 +177,20 @@ void MediumCanvasVisualizer::refreshDisplay() const
             const_cast<MediumCanvasVisualizer *>(this)->setAnimationSpeed();
         if (displaySignals) {
             for (auto transmission : transmissions)
-                if (matchesTransmission(transmission))
+                if (matchesTransmission(transmission)) {
+                    if (deferCanvasUpdates && getSignalFigure(transmission) == nullptr) {
+                        // figure creation was deferred from handleSignalAdded()
+                        auto self = const_cast<MediumCanvasVisualizer *>(this);
+                        cGroupFigure *signalFigure = createSignalFigure(transmission);
+                        self->signalLayer->addFigure(signalFigure);
+                        self->setSignalFigure(transmission, signalFigure);
+                    }
                     refreshSignalFigure(transmission);
+                }
         }
         if (!getEnvir()->isExpressMode()) {
+            if (deferCanvasUpdates && (displaySignalDepartures || displaySignalArrivals))
+                applyPendingFigureUpdates();
             if (displayMainPowerDensityMap)
                 refreshMainPowerDensityMapFigure();
             if (displayPowerDensityMaps) {
@@ -984,6 +995,8 @@ void MediumCanvasVisualizer::handleRadioRemoved(const IRadio *radio)
     auto networkNode = getContainingNode(module);
     if (networkNodeFilter.matches(networkNode)) {
         invalidDisplay = true;
+        pendingDepartureFigureUpdates.erase(radio);
+        pendingArrivalFigureUpdates.erase(radio);
         auto departureFigure = removeSignalDepartureFigure(radio);
         if (departureFigure != nullptr) {
             auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
@@ -1006,7 +1019,7 @@ void MediumCanvasVisualizer::handleSignalAdded(const ITransmission *transmission
     if (matchesTransmission(transmission)) {
         invalidDisplay = true;
         transmissions.push_back(transmission);
-        if (displaySignals) {
+        if (displaySignals && !deferCanvasUpdates) {
             cGroupFigure *signalFigure = createSignalFigure(transmission);
             signalLayer->addFigure(signalFigure);
             setSignalFigure(transmission, signalFigure);
@@ -1044,18 +1057,19 @@ void MediumCanvasVisualizer::handleSignalDepartureStarted(const ITransmission *t
         if (displaySignalDepartures) {
             auto transmitter = transmission->getTransmitterRadio();
             if (!transmitter) return;
-            auto figure = getSignalDepartureFigure(transmitter);
-            auto networkNode = getContainingNode(check_and_cast<const cModule *>(transmitter));
-            auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
-            networkNodeVisualization->setAnnotationVisible(figure, true);
-            auto labelFigure = check_and_cast<LabeledIconFigure *>(figure)->getLabelFigure();
-            if (auto scalarTransmission = dynamic_cast<const ScalarSignalAnalogModel *>(transmission->getAnalogModel())) {
-                char tmp[32];
-                sprintf(tmp, "%.4g dBW", fraction2dB(W(scalarTransmission->getPower()).get()));
-                labelFigure->setText(tmp);
+            char labelText[32] = "";
+            if (auto scalarTransmission = dynamic_cast<const ScalarSignalAnalogModel *>(transmission->getAnalogModel()))
+                sprintf(labelText, "%.4g dBW", fraction2dB(W(scalarTransmission->getPower()).get()));
+            if (deferCanvasUpdates)
+                pendingDepartureFigureUpdates[transmitter] = std::make_pair(true, std::string(labelText));
+            else {
+                auto figure = getSignalDepartureFigure(transmitter);
+                auto networkNode = getContainingNode(check_and_cast<const cModule *>(transmitter));
+                auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
+                networkNodeVisualization->setAnnotationVisible(figure, true);
+                auto labelFigure = check_and_cast<LabeledIconFigure *>(figure)->getLabelFigure();
+                labelFigure->setText(labelText);
             }
-            else
-                labelFigure->setText("");
         }
     }
 }
@@ -1070,10 +1084,14 @@ void MediumCanvasVisualizer::handleSignalDepartureEnded(const ITransmission *tra
         if (displaySignalDepartures) {
             auto transmitter = transmission->getTransmitterRadio();
             if (!transmitter) return;
-            auto figure = getSignalDepartureFigure(transmitter);
-            auto networkNode = getContainingNode(check_and_cast<const cModule *>(transmitter));
-            auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
-            networkNodeVisualization->setAnnotationVisible(figure, false);
+            if (deferCanvasUpdates)
+                pendingDepartureFigureUpdates[transmitter] = std::make_pair(false, std::string());
+            else {
+                auto figure = getSignalDepartureFigure(transmitter);
+                auto networkNode = getContainingNode(check_and_cast<const cModule *>(transmitter));
+                auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
+                networkNodeVisualization->setAnnotationVisible(figure, false);
+            }
         }
     }
 }
@@ -1089,18 +1107,19 @@ void MediumCanvasVisualizer::handleSignalArrivalStarted(const IReception *recept
         if (displaySignalArrivals) {
             auto receiver = reception->getReceiverRadio();
             if (networkNodeFilter.matches(check_and_cast<const cModule *>(receiver))) {
-                auto figure = getSignalArrivalFigure(receiver);
-                auto networkNode = getContainingNode(check_and_cast<const cModule *>(receiver));
-                auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
-                networkNodeVisualization->setAnnotationVisible(figure, true);
-                auto labelFigure = check_and_cast<LabeledIconFigure *>(figure)->getLabelFigure();
-                if (auto scalarReception = dynamic_cast<const ScalarReceptionAnalogModel *>(reception->getAnalogModel())) {
-                    char tmp[32];
-                    sprintf(tmp, "%.4g dBW", fraction2dB(W(scalarReception->getPower()).get()));
-                    labelFigure->setText(tmp);
+                char labelText[32] = "";
+                if (auto scalarReception = dynamic_cast<const ScalarReceptionAnalogModel *>(reception->getAnalogModel()))
+                    sprintf(labelText, "%.4g dBW", fraction2dB(W(scalarReception->getPower()).get()));
+                if (deferCanvasUpdates)
+                    pendingArrivalFigureUpdates[receiver] = std::make_pair(true, std::string(labelText));
+                else {
+                    auto figure = getSignalArrivalFigure(receiver);
+                    auto networkNode = getContainingNode(check_and_cast<const cModule *>(receiver));
+                    auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
+                    networkNodeVisualization->setAnnotationVisible(figure, true);
+                    auto labelFigure = check_and_cast<LabeledIconFigure *>(figure)->getLabelFigure();
+                    labelFigure->setText(labelText);
                 }
-                else
-                    labelFigure->setText("");
             }
         }
         if (displayCommunicationHeat) {
@@ -1128,15 +1147,41 @@ void MediumCanvasVisualizer::handleSignalArrivalEnded(const IReception *receptio
         if (displaySignalArrivals) {
             auto receiver = reception->getReceiverRadio();
             if (networkNodeFilter.matches(check_and_cast<const cModule *>(receiver))) {
-                auto figure = getSignalArrivalFigure(receiver);
-                auto networkNode = getContainingNode(check_and_cast<const cModule *>(receiver));
-                auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
-                networkNodeVisualization->setAnnotationVisible(figure, false);
+                if (deferCanvasUpdates)
+                    pendingArrivalFigureUpdates[receiver] = std::make_pair(false, std::string());
+                else {
+                    auto figure = getSignalArrivalFigure(receiver);
+                    auto networkNode = getContainingNode(check_and_cast<const cModule *>(receiver));
+                    auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
+                    networkNodeVisualization->setAnnotationVisible(figure, false);
+                }
             }
         }
     }
 }
 
+void MediumCanvasVisualizer::applyPendingFigureUpdates() const
+{
+    for (auto& it : pendingDepartureFigureUpdates) {
+        auto figure = getSignalDepartureFigure(it.first);
+        auto networkNode = getContainingNode(check_and_cast<const cModule *>(it.first));
+        auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
+        networkNodeVisualization->setAnnotationVisible(figure, it.second.first);
+        if (it.second.first)
+            check_and_cast<LabeledIconFigure *>(figure)->getLabelFigure()->setText(it.second.second.c_str());
+    }
+    pendingDepartureFigureUpdates.clear();
+    for (auto& it : pendingArrivalFigureUpdates) {
+        auto figure = getSignalArrivalFigure(it.first);
+        auto networkNode = getContainingNode(check_and_cast<const cModule *>(it.first));
+        auto networkNodeVisualization = networkNodeVisualizer->getNetworkNodeVisualization(networkNode);
+        networkNodeVisualization->setAnnotationVisible(figure, it.second.first);
+        if (it.second.first)
+            check_and_cast<LabeledIconFigure *>(figure)->getLabelFigure()->setText(it.second.second.c_str());
+    }
+    pendingArrivalFigureUpdates.clear();
+}
+
 void MediumCanvasVisualizer::receiveSignal(cComponent *source, simsignal_t signal, cObject *object, cObject *details)
 {
     Enter_Method("%s", cComponent::getSignalName(signal));
@@ -49,6 +49,7 @@ class INET_API MediumCanvasVisualizer : public MediumVisualizerBase
     double signalWaveFadingAnimationSpeedFactor = NaN;
     bool displayCommunicationHeat = false;
     int communicationHeatMapSize = 100;
+    bool deferCanvasUpdates = false;
     //@}
 
     /** @name Internal state */
@@ -80,6 +81,14 @@ class INET_API MediumCanvasVisualizer : public MediumVisualizerBase
      * The propagating signal figures for all ongoing transmissions.
      */
     std::map<int, cFigure *> signalFigures;
+    /**
+     * The latest recorded signal departure/arrival annotation state (visibility
+     * and label text) per radio, applied at the next display refresh when
+     * canvas updates are deferred. Updates between two refreshes coalesce,
+     * only the final state is rendered.
+     */
+    mutable std::map<const physicallayer::IRadio *, std::pair<bool, std::string>> pendingDepartureFigureUpdates;
+    mutable std::map<const physicallayer::IRadio *, std::pair<bool, std::string>> pendingArrivalFigureUpdates;
     /**
      * The main power density figure.
      */
@@ -138,6 +147,7 @@ class INET_API MediumCanvasVisualizer : public MediumVisualizerBase
 
     virtual cGroupFigure *createSignalFigure(const physicallayer::ITransmission *transmission) const;
     virtual void refreshSignalFigure(const physicallayer::ITransmission *transmission) const;
+    virtual void applyPendingFigureUpdates() const;
 
     virtual void handleRadioAdded(const physicallayer::IRadio *radio) override;
     virtual void handleRadioRemoved(const physicallayer::IRadio *radio) override;
@@ -67,6 +67,8 @@ void StatisticOsgVisualizer::removeStatisticVisualization(const StatisticVisuali
 
 void StatisticOsgVisualizer::refreshStatisticVisualization(const StatisticVisualization *statisticVisualization)
 {
+    if (!checkValueChanged(statisticVisualization))
+        return;
     StatisticVisualizerBase::refreshStatisticVisualization(statisticVisualization);
     auto statisticOsgVisualization = static_cast<const StatisticOsgVisualization *>(statisticVisualization);
     auto geode = check_and_cast<osg::Geode *>(statisticOsgVisualization->node);
@@ -72,6 +72,7 @@ void LineManager::addModuleLine(const ModuleLine *moduleLine)
     auto& cacheEntry = cacheEntries[key];
     cacheEntry.moduleLines.push_back(moduleLine);
     updateOffsets(moduleLine);
+    changeCount++;
 }
 
 void LineManager::removeModuleLine(const ModuleLine *moduleLine)
@@ -80,6 +81,7 @@ void LineManager::removeModuleLine(const ModuleLine *moduleLine)
     auto& cacheEntry = cacheEntries[key];
     cacheEntry.moduleLines.erase(std::remove(cacheEntry.moduleLines.begin(), cacheEntry.moduleLines.end(), moduleLine), cacheEntry.moduleLines.end());
     updateOffsets(moduleLine);
+    changeCount++;
 }
 
 void LineManager::addModulePath(const ModulePath *modulePath)
@@ -91,6 +93,7 @@ void LineManager::addModulePath(const ModulePath *modulePath)
         cacheEntry.modulePaths.push_back(value);
     }
     updateOffsets(modulePath);
+    changeCount++;
 }
 
 void LineManager::removeModulePath(const ModulePath *modulePath)
@@ -102,6 +105,7 @@ void LineManager::removeModulePath(const ModulePath *modulePath)
         cacheEntry.modulePaths.erase(std::remove(cacheEntry.modulePaths.begin(), cacheEntry.modulePaths.end(), value), cacheEntry.modulePaths.end());
     }
     updateOffsets(modulePath);
+    changeCount++;
 }
 
 Coord LineManager::getLineShift(int sourceModuleId, int destinationModuleId, const Coord& sourcePosition, const Coord& destinationPosition, const char *shiftMode, int shiftOffset)
@@ -45,6 +45,7 @@ class INET_API LineManager
 
   protected:
     std::map<std::pair<int, int>, CacheEntry> cacheEntries;
+    int changeCount = 0;
 
   protected:
     std::pair<int, int> getKey(int fromModuleId, int toModuleId) {
@@ -67,6 +68,13 @@ class INET_API LineManager
 
     Coord getLineShift(int sourceModuleId, int destinationModuleId, const Coord& sourcePosition, const Coord& destinationPosition, const char *shiftMode, int shiftOffset);
 
+    /**
+     * Returns a counter that is incremented whenever a line or path is added
+     * or removed. Shift offsets only change along with this counter, so it can
+     * be used to cache results computed from them.
+     */
+    int getChangeCount() const { return changeCount; }
+
     static LineManager *getCanvasLineManager(const cCanvas *canvas);
     static LineManager *getOsgLineManager(const cCanvas *canvas);
 };
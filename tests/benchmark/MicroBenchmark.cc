@@ -0,0 +1,147 @@
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#include <time.h>
+
+#include <iomanip>
+#include <iostream>
+
+#include "inet/common/packet/chunk/ByteCountChunk.h"
+#include "inet/common/packet/ChunkBuffer.h"
+#include "inet/common/TimeTag_m.h"
+#include "inet/networklayer/ipv4/Ipv4Header_m.h"
+#include "inet/networklayer/ipv4/Ipv4Route.h"
+#include "inet/networklayer/ipv4/Ipv4RouteTrie.h"
+#include "MicroBenchmark.h"
+
+namespace inet {
+
+Define_Module(MicroBenchmark);
+
+// process CPU time, see tests/speed/README.txt for the rationale
+static int64_t getCpuTimeNs()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+    return (int64_t)time.tv_sec * 1000000000 + time.tv_nsec;
+}
+
+// deterministic pseudo random sequence, so that runs measure identical workloads
+static uint32_t nextRandom(uint32_t& state)
+{
+    state = state * 1664525 + 1013904223;
+    return state;
+}
+
+void MicroBenchmark::run(const char *name, int iterations, int operationsPerIteration, const std::function<void()>& body)
+{
+    body(); // warm up caches and lazy initialization outside the measured loop
+    int64_t startTime = getCpuTimeNs();
+    for (int i = 0; i < iterations; i++)
+        body();
+    int64_t elapsedTime = getCpuTimeNs() - startTime;
+    std::cout << std::left << std::setw(48) << name << std::right
+              << std::setw(10) << iterations << " iterations"
+              << std::fixed << std::setprecision(1)
+              << std::setw(12) << (double)elapsedTime / iterations / operationsPerIteration << " ns/op" << std::endl;
+}
+
+void MicroBenchmark::benchmarkPacketInsertAndPop()
+{
+    const auto& payload = makeShared<ByteCountChunk>(B(1000));
+    std::vector<Ptr<const Chunk>> headers;
+    for (int i = 0; i < 10; i++)
+        headers.push_back(makeShared<ByteCountChunk>(B(10)));
+    run("Packet insertAtFront + popAtFront", 100000, headers.size(), [&] () {
+        Packet packet("benchmark");
+        packet.insertAtBack(payload);
+        for (const auto& header : headers)
+            packet.insertAtFront(header);
+        for (size_t i = 0; i < headers.size(); i++)
+            packet.popAtFront(B(10));
+    });
+}
+
+void MicroBenchmark::benchmarkChunkBufferReplace()
+{
+    const auto& chunk = makeShared<ByteCountChunk>(B(100));
+    run("ChunkBuffer replace at random offsets", 10000, 100, [&] () {
+        ChunkBuffer buffer;
+        uint32_t state = 42;
+        for (int i = 0; i < 100; i++)
+            buffer.replace(B(nextRandom(state) % 10000), chunk);
+    });
+}
+
+void MicroBenchmark::benchmarkTagAttachDetach()
+{
+    run("Packet tag attach + detach", 100000, 10, [&] () {
+        Packet packet("benchmark");
+        for (int i = 0; i < 10; i++) {
+            packet.addTag<CreationTimeTag>()->setCreationTime(SIMTIME_ZERO);
+            packet.removeTag<CreationTimeTag>();
+        }
+    });
+}
+
+void MicroBenchmark::benchmarkSerializerRoundTrip()
+{
+    const auto& ipv4Header = makeShared<Ipv4Header>();
+    ipv4Header->setSrcAddress(Ipv4Address("10.0.0.1"));
+    ipv4Header->setDestAddress(Ipv4Address("10.0.0.2"));
+    ipv4Header->setTimeToLive(64);
+    ipv4Header->setProtocolId(IP_PROT_UDP);
+    ipv4Header->setTotalLengthField(B(1020));
+    ipv4Header->setCrcMode(CRC_COMPUTED);
+    ipv4Header->setCrc(0);
+    const auto& payload = makeShared<ByteCountChunk>(B(1000));
+    run("Ipv4Header serializer round-trip", 10000, 1, [&] () {
+        Packet packet("benchmark");
+        packet.insertAtBack(payload);
+        packet.insertAtFront(ipv4Header);
+        const auto& bytes = packet.peekAllAsBytes();
+        Packet reconstructed("benchmark");
+        reconstructed.insertAtBack(bytes);
+        reconstructed.peekAtFront<Ipv4Header>();
+    });
+}
+
+void MicroBenchmark::benchmarkRouteTrieLookup()
+{
+    Ipv4RouteTrie trie;
+    Ipv4RouteTrie::RouteComparator comparator = [] (const Ipv4Route *a, const Ipv4Route *b) { return a->getMetric() < b->getMetric(); };
+    std::vector<Ipv4Route *> routes;
+    uint32_t state = 42;
+    for (int i = 0; i < 10000; i++) {
+        int prefixLength = 8 + nextRandom(state) % 17;
+        Ipv4Address netmask = Ipv4Address::makeNetmask(prefixLength);
+        Ipv4Route *route = new Ipv4Route();
+        route->setDestination(Ipv4Address(nextRandom(state)).doAnd(netmask));
+        route->setNetmask(netmask);
+        route->setMetric(i);
+        routes.push_back(route);
+        trie.add(route, comparator);
+    }
+    std::vector<Ipv4Address> addresses;
+    for (int i = 0; i < 100; i++)
+        addresses.push_back(Ipv4Address(nextRandom(state)));
+    run("Ipv4RouteTrie findBestMatchingRoute", 10000, addresses.size(), [&] () {
+        for (const auto& address : addresses)
+            trie.findBestMatchingRoute(address);
+    });
+    for (auto route : routes)
+        delete route;
+}
+
+void MicroBenchmark::initialize()
+{
+    benchmarkPacketInsertAndPop();
+    benchmarkChunkBufferReplace();
+    benchmarkTagAttachDetach();
+    benchmarkSerializerRoundTrip();
+    benchmarkRouteTrieLookup();
+    std::cout << "Microbenchmark: DONE" << std::endl;
+}
+
+} // namespace
@@ -0,0 +1,30 @@
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+//
+
+#ifndef __MICROBENCHMARK_H_
+#define __MICROBENCHMARK_H_
+
+#include <functional>
+
+#include "inet/common/packet/Packet.h"
+
+namespace inet {
+
+class MicroBenchmark : public cSimpleModule
+{
+  protected:
+    void initialize() override;
+
+    void run(const char *name, int iterations, int operationsPerIteration, const std::function<void()>& body);
+
+    void benchmarkPacketInsertAndPop();
+    void benchmarkChunkBufferReplace();
+    void benchmarkTagAttachDetach();
+    void benchmarkSerializerRoundTrip();
+    void benchmarkRouteTrieLookup();
+};
+
+} // namespace
+
+#endif // #ifndef __MICROBENCHMARK_H_
@@ -0,0 +1,46 @@
+#! /usr/bin/env python3
+#
+# Compares two microbenchmark result files produced by ./runbenchmark and
+# prints the per-benchmark change in ns/op. Exits with status 1 if any
+# benchmark got slower by more than the threshold (10% by default).
+
+import re
+import sys
+
+THRESHOLD = 10.0  # percent
+
+LINE_RE = re.compile(r"^(.*?)\s+(\d+) iterations\s+([\d.]+) ns/op$")
+
+def parse(fileName):
+    results = {}
+    with open(fileName) as f:
+        for line in f:
+            match = LINE_RE.match(line.rstrip())
+            if match:
+                results[match.group(1)] = float(match.group(3))
+    return results
+
+def main():
+    if len(sys.argv) != 3:
+        print("usage: comparebenchmarks.py <baseline> <current>")
+        return 2
+    baseline = parse(sys.argv[1])
+    current = parse(sys.argv[2])
+    regression = False
+    print("%-48s %12s %12s %8s" % ("benchmark", "baseline", "current", "change"))
+    for name, baselineValue in baseline.items():
+        if name not in current:
+            print("%-48s %12.1f %12s" % (name, baselineValue, "missing"))
+            continue
+        currentValue = current[name]
+        change = (currentValue - baselineValue) / baselineValue * 100
+        print("%-48s %12.1f %12.1f %+7.1f%%" % (name, baselineValue, currentValue, change))
+        if change > THRESHOLD:
+            regression = True
+    for name in current:
+        if name not in baseline:
+            print("%-48s %12s %12.1f" % (name, "missing", current[name]))
+    return 1 if regression else 0
+
+if __name__ == "__main__":
+    sys.exit(main())